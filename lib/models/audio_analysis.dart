@@ -0,0 +1,63 @@
+import 'dart:typed_data';
+
+import 'audio_stream.dart';
+
+/// Spectrum and loudness of one analysed raw audio stream (Windows).
+///
+/// Frames arrive as a 40-byte little-endian header followed by one float32
+/// level per band; fields are read lazily from a view over the message.
+class AudioAnalysisFrame {
+  static const int headerSize = 40;
+  static const int supportedVersion = 1;
+
+  final Uint8List bytes;
+  final ByteData _data;
+
+  AudioAnalysisFrame(this.bytes) : _data = ByteData.sublistView(bytes);
+
+  static AudioAnalysisFrame? tryParse(dynamic event) {
+    if (event is! Uint8List || event.lengthInBytes < headerSize) {
+      return null;
+    }
+    if (event[0] != supportedVersion) {
+      return null;
+    }
+    final frame = AudioAnalysisFrame(event);
+    if (event.lengthInBytes < headerSize + frame.bandCount * 4) {
+      return null;
+    }
+    return frame;
+  }
+
+  ZmAudioStreamKind get kind => ZmAudioStreamKind.values[_data.getUint8(1)];
+
+  int get bandCount => _data.getUint16(2, Endian.little);
+
+  /// Same meaning as [PcmChunk.streamId].
+  int get streamId => _data.getUint32(4, Endian.little);
+
+  int get sampleRate => _data.getUint32(8, Endian.little);
+
+  /// Samples lost on this stream since the previous frame.
+  int get droppedSamples => _data.getUint32(12, Endian.little);
+
+  /// SDK timestamp of the newest analysed sample in milliseconds.
+  int get timestamp => _data.getUint64(16, Endian.little);
+
+  /// Loudness over the last 400 ms in LUFS, -infinity until known.
+  double get momentaryLoudness => _data.getFloat32(24, Endian.little);
+
+  /// Loudness over the last 3 s in LUFS, -infinity until known.
+  double get shortTermLoudness => _data.getFloat32(28, Endian.little);
+
+  /// Gated loudness since the subscription started in LUFS.
+  double get integratedLoudness => _data.getFloat32(32, Endian.little);
+
+  /// Sample peak since the previous frame in dBFS.
+  double get peak => _data.getFloat32(36, Endian.little);
+
+  /// Band levels in dBFS, lowest band first, floored at -120.
+  Float32List get bands => Float32List.fromList(List<double>.generate(
+      bandCount,
+      (i) => _data.getFloat32(headerSize + i * 4, Endian.little)));
+}
@@ -0,0 +1,143 @@
+/// Raw audio stream kinds delivered by the Windows raw data pipeline.
+enum ZmAudioStreamKind {
+  mixed,
+  oneWay,
+  share,
+  interpreter,
+
+  /// A sub-mix produced by the plugin, see [ZoomPlatform.createAudioMix].
+  mix;
+}
+
+/// Selects one raw audio stream, or every stream of a kind when [userId]
+/// (oneWay, share) or [language] (interpreter) is left out. Each stream a
+/// selector of every stream matches is still delivered on its own, so PCM
+/// chunks never mix speakers and carry the real stream id. A [language] must
+/// be one of [ZoomPlatform.interpreterLanguages]; others are rejected.
+class ZmAudioStreamSelector {
+  final ZmAudioStreamKind kind;
+  final int? userId;
+  final String? language;
+  final int? mixId;
+
+  const ZmAudioStreamSelector.mixed()
+      : kind = ZmAudioStreamKind.mixed,
+        userId = null,
+        language = null,
+        mixId = null;
+
+  const ZmAudioStreamSelector.oneWay([this.userId])
+      : kind = ZmAudioStreamKind.oneWay,
+        language = null,
+        mixId = null;
+
+  const ZmAudioStreamSelector.share([this.userId])
+      : kind = ZmAudioStreamKind.share,
+        language = null,
+        mixId = null;
+
+  const ZmAudioStreamSelector.interpreter([this.language])
+      : kind = ZmAudioStreamKind.interpreter,
+        userId = null,
+        mixId = null;
+
+  const ZmAudioStreamSelector.mix(int this.mixId)
+      : kind = ZmAudioStreamKind.mix,
+        userId = null,
+        language = null;
+
+  Map<String, Object> toMap() => {
+        'kind': kind.name,
+        if (userId != null) 'userId': userId!,
+        if (language != null) 'language': language!,
+        if (mixId != null) 'mixId': mixId!,
+      };
+}
+
+/// One input of an audio sub-mix. [stream] must name a single stream.
+class ZmAudioMixInput {
+  final ZmAudioStreamSelector stream;
+  final double gain;
+
+  const ZmAudioMixInput(this.stream, {this.gain = 1.0});
+
+  Map<String, Object> toMap() => {
+        ...stream.toMap(),
+        'gain': gain,
+      };
+}
+
+/// Counters of a running audio sub-mix.
+class ZmAudioMixStats {
+  final int inputs;
+  final int blocks;
+  final int lateSamples;
+  final int droppedSamples;
+  final int rateMismatches;
+
+  const ZmAudioMixStats({
+    required this.inputs,
+    required this.blocks,
+    required this.lateSamples,
+    required this.droppedSamples,
+    required this.rateMismatches,
+  });
+
+  factory ZmAudioMixStats.fromMap(Map<String, int> map) => ZmAudioMixStats(
+        inputs: map['inputs'] ?? 0,
+        blocks: map['blocks'] ?? 0,
+        lateSamples: map['lateSamples'] ?? 0,
+        droppedSamples: map['droppedSamples'] ?? 0,
+        rateMismatches: map['rateMismatches'] ?? 0,
+      );
+}
+
+/// Counters of the share audio pump.
+class ZmShareAudioStats {
+  final bool sending;
+
+  /// A file or ended stream has been sent completely.
+  final bool finished;
+  final int chunksSent;
+  final int sendErrors;
+
+  /// Chunks the source could not fill; each is followed by a short
+  /// re-buffering gap.
+  final int underruns;
+  final int silentFrames;
+
+  /// Audio queued in the plugin, in milliseconds.
+  final int bufferedMs;
+
+  /// Frames [ZoomPlatform.pushShareAudio] can take right now.
+  final int freeFrames;
+  final int lateTicks;
+  final int maxLatenessUs;
+
+  const ZmShareAudioStats({
+    required this.sending,
+    required this.finished,
+    required this.chunksSent,
+    required this.sendErrors,
+    required this.underruns,
+    required this.silentFrames,
+    required this.bufferedMs,
+    required this.freeFrames,
+    required this.lateTicks,
+    required this.maxLatenessUs,
+  });
+
+  factory ZmShareAudioStats.fromMap(Map<String, dynamic> map) =>
+      ZmShareAudioStats(
+        sending: map['sending'] ?? false,
+        finished: map['finished'] ?? false,
+        chunksSent: map['chunksSent'] ?? 0,
+        sendErrors: map['sendErrors'] ?? 0,
+        underruns: map['underruns'] ?? 0,
+        silentFrames: map['silentFrames'] ?? 0,
+        bufferedMs: map['bufferedMs'] ?? 0,
+        freeFrames: map['freeFrames'] ?? 0,
+        lateTicks: map['lateTicks'] ?? 0,
+        maxLatenessUs: map['maxLatenessUs'] ?? 0,
+      );
+}
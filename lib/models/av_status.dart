@@ -0,0 +1,152 @@
+import 'dart:typed_data';
+
+/// Audio and video status bits, in the order of the native `AvStatus`.
+enum ZmAvStatusKind { muted, videoOn, talking, activeAudio }
+
+/// One update of the native audio and video status bits (Windows): a
+/// snapshot of every bit, or a delta to XOR into the bits already held.
+///
+/// Updates arrive as a 24-byte little-endian header, 8-byte slot
+/// assignments and 16-byte words of 64 slots each. A delta applies to the
+/// update with the sequence before its own only.
+class ZmAvStatusUpdate {
+  static const int headerSize = 24;
+  static const int assignmentSize = 8;
+  static const int wordSize = 16;
+  static const int supportedFormat = 1;
+
+  final Uint8List bytes;
+  final ByteData _data;
+
+  ZmAvStatusUpdate(this.bytes) : _data = ByteData.sublistView(bytes);
+
+  static ZmAvStatusUpdate? tryParse(dynamic event) {
+    if (event is! Uint8List || event.lengthInBytes < headerSize) {
+      return null;
+    }
+    if (event[0] != supportedFormat) {
+      return null;
+    }
+    final update = ZmAvStatusUpdate(event);
+    final size = headerSize +
+        update.assignmentCount * assignmentSize +
+        update.wordCount * wordSize;
+    return size <= event.lengthInBytes ? update : null;
+  }
+
+  bool get isSnapshot => _data.getUint8(1) == 0;
+
+  int get assignmentCount => _data.getUint32(4, Endian.little);
+
+  int get wordCount => _data.getUint32(8, Endian.little);
+
+  int get sequence => _data.getUint64(16, Endian.little);
+}
+
+/// A Dart copy of the native audio and video status bits, kept current by
+/// applying [ZmAvStatusUpdate]s in order.
+class ZmAvStatus {
+  final Map<int, int> _slots = {};
+  final Map<int, int> _users = {};
+  final List<Map<int, int>> _words =
+      List.generate(ZmAvStatusKind.values.length, (_) => <int, int>{});
+
+  /// 0 until the first update.
+  int sequence = 0;
+
+  /// Returns false, changing nothing, for a delta that does not follow
+  /// [sequence]; fetch a snapshot and apply that instead.
+  bool apply(ZmAvStatusUpdate update) {
+    if (!update.isSnapshot && update.sequence != sequence + 1) {
+      return false;
+    }
+    if (update.isSnapshot) {
+      _slots.clear();
+      _users.clear();
+      for (final words in _words) {
+        words.clear();
+      }
+    }
+
+    final data = update._data;
+    var offset = ZmAvStatusUpdate.headerSize;
+    for (var i = 0; i < update.assignmentCount; i++) {
+      final slot = data.getUint32(offset, Endian.little);
+      final userId = data.getUint32(offset + 4, Endian.little);
+      offset += ZmAvStatusUpdate.assignmentSize;
+
+      final previous = _users.remove(slot);
+      if (previous != null) {
+        _slots.remove(previous);
+      }
+      if (userId != 0) {
+        _users[slot] = userId;
+        _slots[userId] = slot;
+      }
+    }
+    for (var i = 0; i < update.wordCount; i++) {
+      final status = data.getUint8(offset);
+      final word = data.getUint32(offset + 4, Endian.little);
+      final mask = data.getUint64(offset + 8, Endian.little);
+      offset += ZmAvStatusUpdate.wordSize;
+      if (status >= _words.length) {
+        continue;
+      }
+
+      final words = _words[status];
+      final bits = update.isSnapshot ? mask : (words[word] ?? 0) ^ mask;
+      if (bits == 0) {
+        words.remove(word);
+      } else {
+        words[word] = bits;
+      }
+    }
+    sequence = update.sequence;
+    return true;
+  }
+
+  /// Users with a slot, in no particular order.
+  Iterable<int> get users => _slots.keys;
+
+  bool get(int userId, ZmAvStatusKind kind) {
+    final slot = _slots[userId];
+    if (slot == null) {
+      return false;
+    }
+    final bits = _words[kind.index][slot >> 6] ?? 0;
+    return (bits >> (slot & 63)) & 1 != 0;
+  }
+
+  bool isMuted(int userId) => get(userId, ZmAvStatusKind.muted);
+
+  bool isVideoOn(int userId) => get(userId, ZmAvStatusKind.videoOn);
+
+  bool isTalking(int userId) => get(userId, ZmAvStatusKind.talking);
+
+  bool hasActiveAudio(int userId) => get(userId, ZmAvStatusKind.activeAudio);
+
+  /// The users with [kind] set.
+  Iterable<int> usersWith(ZmAvStatusKind kind) sync* {
+    for (final entry in _words[kind.index].entries) {
+      for (var bit = 0; bit < 64; bit++) {
+        if ((entry.value >> bit) & 1 != 0) {
+          final userId = _users[(entry.key << 6) + bit];
+          if (userId != null) {
+            yield userId;
+          }
+        }
+      }
+    }
+  }
+
+  int count(ZmAvStatusKind kind) {
+    var count = 0;
+    for (var bits in _words[kind.index].values) {
+      while (bits != 0) {
+        bits &= bits - 1;
+        count++;
+      }
+    }
+    return count;
+  }
+}
@@ -0,0 +1,42 @@
+/// Progress of the native SDK callback journal (Windows).
+class ZmCallbackJournalStats {
+  final bool recording;
+
+  /// Callbacks journaled, with the participant snapshots they carry.
+  final int records;
+  final int bytesWritten;
+
+  /// Callbacks lost because the writer fell behind.
+  final int droppedRecords;
+
+  /// Distinct strings, such as names and chat text, written once each.
+  final int strings;
+  final int writeErrors;
+  final int queuedBytes;
+
+  /// Journal being written, empty when none.
+  final String path;
+
+  const ZmCallbackJournalStats({
+    required this.recording,
+    required this.records,
+    required this.bytesWritten,
+    required this.droppedRecords,
+    required this.strings,
+    required this.writeErrors,
+    required this.queuedBytes,
+    required this.path,
+  });
+
+  factory ZmCallbackJournalStats.fromMap(Map<String, dynamic> map) =>
+      ZmCallbackJournalStats(
+        recording: map['recording'] ?? false,
+        records: map['records'] ?? 0,
+        bytesWritten: map['bytesWritten'] ?? 0,
+        droppedRecords: map['droppedRecords'] ?? 0,
+        strings: map['strings'] ?? 0,
+        writeErrors: map['writeErrors'] ?? 0,
+        queuedBytes: map['queuedBytes'] ?? 0,
+        path: map['path'] ?? '',
+      );
+}
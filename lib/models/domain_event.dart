@@ -0,0 +1,146 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+/// One chat, caption, sharing or recording event (Windows), from that
+/// domain's own stream.
+///
+/// Events arrive as a 32-byte little-endian header followed by strings,
+/// each a 4-byte byte count and that many UTF-8 bytes. What [value],
+/// [otherId] and [strings] hold depends on the [kind]; see
+/// [ZmChatEventKind], [ZmCaptionEventKind], [ZmSharingEventKind] and
+/// [ZmRecordingEventKind].
+class ZmDomainEvent {
+  static const int headerSize = 32;
+  static const int supportedFormat = 1;
+
+  final int kind;
+
+  /// The sender, speaker or sharer; 0 for none.
+  final int userId;
+
+  /// The chat receiver or share source; 0 for none.
+  final int otherId;
+
+  /// The SDK enum or flag the kind carries.
+  final int value;
+
+  /// Null when the SDK gives no time.
+  final DateTime? time;
+
+  /// Counts the stream's events; a gap means some were dropped.
+  final int sequence;
+
+  final List<String> strings;
+
+  ZmDomainEvent(this.kind, this.userId, this.otherId, this.value, this.time,
+      this.sequence, this.strings);
+
+  static ZmDomainEvent? tryParse(dynamic event) {
+    if (event is! Uint8List || event.lengthInBytes < headerSize) {
+      return null;
+    }
+    if (event[0] != supportedFormat) {
+      return null;
+    }
+
+    final data = ByteData.sublistView(event);
+    final strings = <String>[];
+    var offset = headerSize;
+    for (var i = 0; i < event[2]; i++) {
+      if (offset + 4 > event.lengthInBytes) {
+        return null;
+      }
+      final length = data.getUint32(offset, Endian.little);
+      offset += 4;
+      if (offset + length > event.lengthInBytes) {
+        return null;
+      }
+      strings.add(utf8.decode(
+          Uint8List.sublistView(event, offset, offset + length),
+          allowMalformed: true));
+      offset += length;
+    }
+
+    final timeMs = data.getInt64(16, Endian.little);
+    return ZmDomainEvent(
+      event[1],
+      data.getUint32(4, Endian.little),
+      data.getUint32(8, Endian.little),
+      data.getInt32(12, Endian.little),
+      timeMs == 0 ? null : DateTime.fromMillisecondsSinceEpoch(timeMs),
+      data.getUint64(24, Endian.little),
+      strings,
+    );
+  }
+
+  /// The chat or transcription message id; empty for a closed caption.
+  String get messageId => _string(0);
+
+  /// The chat message, caption or transcription text.
+  String get content => _string(1);
+
+  /// The sender's or speaker's name.
+  String get name => _string(2);
+
+  /// The chat receiver's name.
+  String get receiverName => _string(3);
+
+  String _string(int index) => index < strings.length ? strings[index] : '';
+}
+
+/// Kinds on the chat stream.
+class ZmChatEventKind {
+  /// [ZmDomainEvent.value] is the SDK's SDKChatMessageType;
+  /// [ZmDomainEvent.otherId] is the receiver, 0 for everyone.
+  static const int message = 0;
+  static const int edited = 1;
+
+  /// Only [ZmDomainEvent.messageId] is set; [ZmDomainEvent.value] is the
+  /// SDK's SDKChatMessageDeleteType.
+  static const int deleted = 2;
+}
+
+/// Kinds on the captions stream.
+class ZmCaptionEventKind {
+  /// [ZmDomainEvent.content] is the caption.
+  static const int closedCaption = 0;
+
+  /// [ZmDomainEvent.value] is the SDK's SDKLiveTranscriptionOperationType.
+  static const int transcription = 1;
+
+  /// As [transcription], in the speaker's own language.
+  static const int originalLanguage = 2;
+}
+
+/// Kinds on the sharing stream. [ZmDomainEvent.otherId] is the share source.
+class ZmSharingEventKind {
+  /// [ZmDomainEvent.value] is the SDK's SharingStatus.
+  static const int status = 0;
+
+  /// [ZmDomainEvent.value] is the SDK's ShareType.
+  static const int content = 1;
+
+  /// [ZmDomainEvent.value] is 1 when locked.
+  static const int locked = 2;
+
+  static const int failedToStart = 3;
+}
+
+/// Kinds on the recording stream.
+class ZmRecordingEventKind {
+  /// [ZmDomainEvent.value] is the SDK's RecordingStatus.
+  static const int local = 0;
+  static const int cloud = 1;
+
+  /// [ZmDomainEvent.value] is 1 when this user may record.
+  static const int privilege = 2;
+
+  /// [ZmDomainEvent.value] is the SDK's RequestLocalRecordingStatus.
+  static const int localPrivilegeRequest = 3;
+
+  /// [ZmDomainEvent.value] is the SDK's RequestStartCloudRecordingStatus.
+  static const int cloudRequest = 4;
+
+  /// [ZmDomainEvent.time] is the end of the grace period.
+  static const int storageFull = 5;
+}
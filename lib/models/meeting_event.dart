@@ -0,0 +1,62 @@
+/// Tags of the events on `ZoomPlatform.onMeetingStatus` (Windows). Each
+/// event is a `[tag, detail]` list: the SDK result code for a status, the
+/// warning's SDK value for a statistics warning, a map for
+/// [meetingParameter] and the new topic for [topicChanged].
+class ZmMeetingEvent {
+  static const String statusIdle = 'MEETING_STATUS_IDLE';
+  static const String statusConnecting = 'MEETING_STATUS_CONNECTING';
+  static const String statusWaitingForHost = 'MEETING_STATUS_WAITINGFORHOST';
+  static const String statusInMeeting = 'MEETING_STATUS_INMEETING';
+  static const String statusDisconnecting = 'MEETING_STATUS_DISCONNECTING';
+  static const String statusReconnecting = 'MEETING_STATUS_RECONNECTING';
+  static const String statusFailed = 'MEETING_STATUS_FAILED';
+  static const String statusEnded = 'MEETING_STATUS_ENDED';
+  static const String statusUnknown = 'MEETING_STATUS_UNKNOWN';
+  static const String statusLocked = 'MEETING_STATUS_LOCKED';
+  static const String statusUnlocked = 'MEETING_STATUS_UNLOCKED';
+  static const String statusInWaitingRoom = 'MEETING_STATUS_IN_WAITING_ROOM';
+  static const String statusWebinarPromote = 'MEETING_STATUS_WEBINAR_PROMOTE';
+  static const String statusWebinarDepromote =
+      'MEETING_STATUS_WEBINAR_DEPROMOTE';
+  static const String statusJoinBreakoutRoom =
+      'MEETING_STATUS_JOIN_BREAKOUT_ROOM';
+  static const String statusLeaveBreakoutRoom =
+      'MEETING_STATUS_LEAVE_BREAKOUT_ROOM';
+
+  static const String warningNone = 'MEETING_STATISTICS_WARNING_NONE';
+  static const String warningNetworkQualityBad =
+      'MEETING_STATISTICS_WARNING_NETWORK_QUALITY_BAD';
+  static const String warningBusySystem =
+      'MEETING_STATISTICS_WARNING_BUSY_SYSTEM';
+
+  /// Detail keys: `meetingType`, `viewOnly`, `autoRecordingLocal`,
+  /// `autoRecordingCloud`, `meetingNumber`, `topic` and `host`.
+  static const String meetingParameter = 'MEETING_PARAMETER';
+
+  static const String topicChanged = 'MEETING_TOPIC_CHANGED';
+
+  static const List<String> statuses = [
+    statusIdle,
+    statusConnecting,
+    statusWaitingForHost,
+    statusInMeeting,
+    statusDisconnecting,
+    statusReconnecting,
+    statusFailed,
+    statusEnded,
+    statusUnknown,
+    statusLocked,
+    statusUnlocked,
+    statusInWaitingRoom,
+    statusWebinarPromote,
+    statusWebinarDepromote,
+    statusJoinBreakoutRoom,
+    statusLeaveBreakoutRoom,
+  ];
+
+  static const List<String> warnings = [
+    warningNone,
+    warningNetworkQualityBad,
+    warningBusySystem,
+  ];
+}
@@ -0,0 +1,192 @@
+import 'dart:typed_data';
+
+/// One update of the native meeting state (Windows): a snapshot of every
+/// field, or a delta with the fields that changed.
+///
+/// Updates arrive as a 24-byte little-endian header followed by 16-byte
+/// field records; the co-host record is followed by the co-hosts' user ids.
+/// A delta applies to [baseVersion] only; a client at another version asks
+/// for the changes since its own.
+class ZmMeetingStateUpdate {
+  static const int headerSize = 24;
+  static const int fieldSize = 16;
+  static const int supportedFormat = 1;
+
+  final Uint8List bytes;
+  final ByteData _data;
+
+  ZmMeetingStateUpdate(this.bytes) : _data = ByteData.sublistView(bytes);
+
+  static ZmMeetingStateUpdate? tryParse(dynamic event) {
+    if (event is! Uint8List || event.lengthInBytes < headerSize) {
+      return null;
+    }
+    if (event[0] != supportedFormat) {
+      return null;
+    }
+    return ZmMeetingStateUpdate(event);
+  }
+
+  bool get isSnapshot => _data.getUint8(1) == 0;
+
+  int get count => _data.getUint16(2, Endian.little);
+
+  /// The version a delta applies to; 0 for a snapshot.
+  int get baseVersion => _data.getUint64(8, Endian.little);
+
+  int get version => _data.getUint64(16, Endian.little);
+
+  /// Decoded in one pass; stops at a truncated record.
+  List<ZmMeetingStateRecord> get records {
+    final records = <ZmMeetingStateRecord>[];
+    var offset = headerSize;
+    for (var i = 0; i < count; i++) {
+      if (offset + fieldSize > bytes.lengthInBytes) {
+        break;
+      }
+      final field = _data.getUint8(offset);
+      final idCount = _data.getUint16(offset + 2, Endian.little);
+      final value = _data.getInt64(offset + 8, Endian.little);
+      offset += fieldSize;
+      if (offset + idCount * 4 > bytes.lengthInBytes) {
+        break;
+      }
+      final ids = List.generate(
+          idCount, (i) => _data.getUint32(offset + i * 4, Endian.little));
+      offset += idCount * 4;
+      records.add(ZmMeetingStateRecord._(field, value, ids));
+    }
+    return records;
+  }
+}
+
+/// One field in a [ZmMeetingStateUpdate].
+class ZmMeetingStateRecord {
+  static const int fieldStatus = 0;
+  static const int fieldHost = 1;
+  static const int fieldCoHosts = 2;
+  static const int fieldLocked = 3;
+  static const int fieldShareStatus = 4;
+  static const int fieldSharingUser = 5;
+  static const int fieldShareLocked = 6;
+  static const int fieldLocalRecording = 7;
+  static const int fieldCloudRecording = 8;
+  static const int fieldChat = 9;
+  static const int fieldCaptions = 10;
+  static const int fieldManualCaptions = 11;
+  static const int fieldLiveTranscription = 12;
+  static const int fieldAudioSendQuality = 13;
+  static const int fieldAudioReceiveQuality = 14;
+  static const int fieldVideoSendQuality = 15;
+  static const int fieldVideoReceiveQuality = 16;
+  static const int fieldShareSendQuality = 17;
+  static const int fieldShareReceiveQuality = 18;
+  static const int fieldStatisticsWarning = 19;
+
+  /// A `field*` constant.
+  final int field;
+
+  /// -1 until known.
+  final int value;
+
+  /// The co-hosts, for [fieldCoHosts].
+  final List<int> ids;
+
+  ZmMeetingStateRecord._(this.field, this.value, this.ids);
+}
+
+/// A Dart copy of the native meeting state, kept current by applying
+/// [ZmMeetingStateUpdate]s in order. Values are the SDK's enums as integers;
+/// the getters return null for fields not known yet.
+class ZmMeetingState {
+  static const int chatOff = 1 << 0;
+  static const int chatAllowed = 1 << 1;
+  static const int chatToEveryone = 1 << 2;
+  static const int chatToIndividuals = 1 << 3;
+  static const int chatToHostOnly = 1 << 4;
+  static const int chatToPanelists = 1 << 5;
+
+  /// Raw values by `ZmMeetingStateRecord.field*`; -1 until known.
+  final Map<int, int> values = {};
+
+  List<int> coHostIds = const [];
+
+  /// 0 until the first snapshot.
+  int version = 0;
+
+  /// Returns false, changing nothing, for a delta that does not start at
+  /// [version]; fetch the changes since [version] and apply those instead.
+  bool apply(ZmMeetingStateUpdate update) {
+    if (!update.isSnapshot && update.baseVersion != version) {
+      return false;
+    }
+    for (final record in update.records) {
+      values[record.field] = record.value;
+      if (record.field == ZmMeetingStateRecord.fieldCoHosts) {
+        coHostIds = record.ids;
+      }
+    }
+    version = update.version;
+    return true;
+  }
+
+  int? _value(int field) {
+    final value = values[field];
+    return value == null || value < 0 ? null : value;
+  }
+
+  bool? _flag(int field) {
+    final value = _value(field);
+    return value == null ? null : value != 0;
+  }
+
+  int? get status => _value(ZmMeetingStateRecord.fieldStatus);
+
+  /// 0 when the host has left.
+  int? get hostId => _value(ZmMeetingStateRecord.fieldHost);
+
+  bool? get locked => _flag(ZmMeetingStateRecord.fieldLocked);
+
+  int? get shareStatus => _value(ZmMeetingStateRecord.fieldShareStatus);
+
+  /// 0 when nobody is sharing.
+  int? get sharingUserId => _value(ZmMeetingStateRecord.fieldSharingUser);
+
+  bool? get shareLocked => _flag(ZmMeetingStateRecord.fieldShareLocked);
+
+  int? get localRecording => _value(ZmMeetingStateRecord.fieldLocalRecording);
+
+  int? get cloudRecording => _value(ZmMeetingStateRecord.fieldCloudRecording);
+
+  /// `chat*` bits.
+  int? get chat => _value(ZmMeetingStateRecord.fieldChat);
+
+  bool? get captions => _flag(ZmMeetingStateRecord.fieldCaptions);
+
+  bool? get manualCaptions => _flag(ZmMeetingStateRecord.fieldManualCaptions);
+
+  int? get liveTranscription =>
+      _value(ZmMeetingStateRecord.fieldLiveTranscription);
+
+  int? get audioSendQuality =>
+      _value(ZmMeetingStateRecord.fieldAudioSendQuality);
+
+  int? get audioReceiveQuality =>
+      _value(ZmMeetingStateRecord.fieldAudioReceiveQuality);
+
+  int? get videoSendQuality =>
+      _value(ZmMeetingStateRecord.fieldVideoSendQuality);
+
+  int? get videoReceiveQuality =>
+      _value(ZmMeetingStateRecord.fieldVideoReceiveQuality);
+
+  int? get shareSendQuality =>
+      _value(ZmMeetingStateRecord.fieldShareSendQuality);
+
+  int? get shareReceiveQuality =>
+      _value(ZmMeetingStateRecord.fieldShareReceiveQuality);
+
+  /// The last statistics warning.
+  int? get statisticsWarning =>
+      _value(ZmMeetingStateRecord.fieldStatisticsWarning);
+}
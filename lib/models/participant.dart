@@ -0,0 +1,81 @@
+/// A meeting participant from the native roster (Windows).
+class ZmParticipant {
+  final int userId;
+  final String name;
+  final bool host;
+  final bool coHost;
+  final bool myself;
+  final bool inWaitingRoom;
+
+  /// Joined by phone only.
+  final bool purePhone;
+  final bool bot;
+  final bool h323;
+  final bool interpreter;
+
+  /// Webinar panelist.
+  final bool panelist;
+
+  /// Webinar attendee.
+  final bool attendee;
+  final bool videoOn;
+  final bool muted;
+  final bool talking;
+  final bool handRaised;
+
+  const ZmParticipant({
+    required this.userId,
+    required this.name,
+    required this.host,
+    required this.coHost,
+    required this.myself,
+    required this.inWaitingRoom,
+    required this.purePhone,
+    required this.bot,
+    required this.h323,
+    required this.interpreter,
+    required this.panelist,
+    required this.attendee,
+    required this.videoOn,
+    required this.muted,
+    required this.talking,
+    required this.handRaised,
+  });
+
+  factory ZmParticipant.fromMap(Map<String, dynamic> map) => ZmParticipant(
+        userId: map['userId'] ?? 0,
+        name: map['name'] ?? '',
+        host: map['host'] ?? false,
+        coHost: map['coHost'] ?? false,
+        myself: map['myself'] ?? false,
+        inWaitingRoom: map['inWaitingRoom'] ?? false,
+        purePhone: map['purePhone'] ?? false,
+        bot: map['bot'] ?? false,
+        h323: map['h323'] ?? false,
+        interpreter: map['interpreter'] ?? false,
+        panelist: map['panelist'] ?? false,
+        attendee: map['attendee'] ?? false,
+        videoOn: map['videoOn'] ?? false,
+        muted: map['muted'] ?? false,
+        talking: map['talking'] ?? false,
+        handRaised: map['handRaised'] ?? false,
+      );
+}
+
+/// One page of a participant query (Windows).
+class ZmParticipantPage {
+  /// Participants matching the query, over all pages.
+  final int total;
+  final List<ZmParticipant> participants;
+
+  const ZmParticipantPage({required this.total, required this.participants});
+
+  factory ZmParticipantPage.fromMap(Map<String, dynamic> map) =>
+      ZmParticipantPage(
+        total: map['total'] ?? 0,
+        participants: ((map['participants'] as List?) ?? const [])
+            .map((item) =>
+                ZmParticipant.fromMap(Map<String, dynamic>.from(item as Map)))
+            .toList(),
+      );
+}
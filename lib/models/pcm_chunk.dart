@@ -0,0 +1,65 @@
+import 'dart:typed_data';
+
+import 'audio_stream.dart';
+
+/// One batch of 16-bit PCM from a subscribed raw audio stream (Windows).
+///
+/// Chunks arrive as a 24-byte little-endian header followed by interleaved
+/// samples; the header is parsed lazily from a view over the channel message.
+class PcmChunk {
+  static const int headerSize = 24;
+  static const int supportedVersion = 1;
+
+  final Uint8List bytes;
+  final ByteData _header;
+
+  PcmChunk(this.bytes)
+      : _header = ByteData.sublistView(bytes, 0, headerSize);
+
+  static PcmChunk? tryParse(dynamic event) {
+    if (event is! Uint8List || event.lengthInBytes < headerSize) {
+      return null;
+    }
+    if (event[0] != supportedVersion) {
+      return null;
+    }
+    return PcmChunk(event);
+  }
+
+  ZmAudioStreamKind get kind => ZmAudioStreamKind.values[_header.getUint8(1)];
+
+  int get channels => _header.getUint16(2, Endian.little);
+
+  /// User id for one-way and share streams, language id for interpreter
+  /// streams (see interpreterLanguages), 0 for the mixed stream.
+  int get streamId => _header.getUint32(4, Endian.little);
+
+  int get sampleRate => _header.getUint32(8, Endian.little);
+
+  /// Samples lost on this stream since the previous chunk.
+  int get droppedSamples => _header.getUint32(12, Endian.little);
+
+  /// SDK timestamp of the first sample in milliseconds.
+  int get timestamp => _header.getUint64(16, Endian.little);
+
+  /// The PCM payload without the header.
+  Uint8List get pcm => Uint8List.sublistView(bytes, headerSize);
+
+  /// The PCM payload as samples. A view when the message is 2-byte aligned,
+  /// otherwise a copy.
+  Int16List get samples {
+    final payload = pcm;
+    if (payload.offsetInBytes % 2 == 0) {
+      return payload.buffer
+          .asInt16List(payload.offsetInBytes, payload.lengthInBytes ~/ 2);
+    }
+    final data = ByteData.sublistView(payload);
+    return Int16List.fromList(List<int>.generate(payload.lengthInBytes ~/ 2,
+        (i) => data.getInt16(i * 2, Endian.little)));
+  }
+
+  Duration get duration => Duration(
+      microseconds: channels == 0 || sampleRate == 0
+          ? 0
+          : (pcm.lengthInBytes ~/ 2 ~/ channels) * 1000000 ~/ sampleRate);
+}
@@ -0,0 +1,24 @@
+/// Native picture-in-picture view of a hidden meeting (Windows).
+class ZmPipState {
+  /// Flutter texture showing the active speaker; display it with a
+  /// `Texture` widget.
+  final int textureId;
+
+  /// User being shown, 0 until the first active speaker is known.
+  final int userId;
+
+  /// Frames rendered into the texture so far.
+  final int frames;
+
+  const ZmPipState({
+    required this.textureId,
+    required this.userId,
+    required this.frames,
+  });
+
+  factory ZmPipState.fromMap(Map<String, dynamic> map) => ZmPipState(
+        textureId: map['textureId'] ?? -1,
+        userId: map['userId'] ?? 0,
+        frames: map['frames'] ?? 0,
+      );
+}
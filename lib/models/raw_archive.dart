@@ -0,0 +1,50 @@
+/// Progress of the raw media archiver (Windows).
+class ZmRawArchiveStats {
+  final bool archiving;
+
+  /// Segments started this session.
+  final int segments;
+  final int records;
+  final int bytesWritten;
+
+  /// Chunks written and synced to disk.
+  final int chunks;
+
+  /// Frames dropped because the writer fell behind.
+  final int droppedRecords;
+
+  /// Segments removed by the retention limits.
+  final int deletedSegments;
+  final int writeErrors;
+  final int queuedBytes;
+
+  /// Segment being written, empty when none.
+  final String segmentPath;
+
+  const ZmRawArchiveStats({
+    required this.archiving,
+    required this.segments,
+    required this.records,
+    required this.bytesWritten,
+    required this.chunks,
+    required this.droppedRecords,
+    required this.deletedSegments,
+    required this.writeErrors,
+    required this.queuedBytes,
+    required this.segmentPath,
+  });
+
+  factory ZmRawArchiveStats.fromMap(Map<String, dynamic> map) =>
+      ZmRawArchiveStats(
+        archiving: map['archiving'] ?? false,
+        segments: map['segments'] ?? 0,
+        records: map['records'] ?? 0,
+        bytesWritten: map['bytesWritten'] ?? 0,
+        chunks: map['chunks'] ?? 0,
+        droppedRecords: map['droppedRecords'] ?? 0,
+        deletedSegments: map['deletedSegments'] ?? 0,
+        writeErrors: map['writeErrors'] ?? 0,
+        queuedBytes: map['queuedBytes'] ?? 0,
+        segmentPath: map['segmentPath'] ?? '',
+      );
+}
@@ -0,0 +1,167 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'participant.dart';
+
+/// One update of the native roster (Windows): a snapshot of everyone, or a
+/// delta with who joined, who left and which fields changed.
+///
+/// Updates arrive as a 24-byte little-endian header followed by
+/// variable-size records. A delta applies to [baseVersion] only; a client at
+/// another version asks for the changes since its own.
+class ZmRosterUpdate {
+  static const int headerSize = 24;
+  static const int supportedFormat = 1;
+
+  final Uint8List bytes;
+  final ByteData _data;
+
+  ZmRosterUpdate(this.bytes) : _data = ByteData.sublistView(bytes);
+
+  static ZmRosterUpdate? tryParse(dynamic event) {
+    if (event is! Uint8List || event.lengthInBytes < headerSize) {
+      return null;
+    }
+    if (event[0] != supportedFormat) {
+      return null;
+    }
+    return ZmRosterUpdate(event);
+  }
+
+  bool get isSnapshot => _data.getUint8(1) == 0;
+
+  int get count => _data.getUint32(4, Endian.little);
+
+  /// The version a delta applies to; 0 for a snapshot.
+  int get baseVersion => _data.getUint64(8, Endian.little);
+
+  int get version => _data.getUint64(16, Endian.little);
+
+  /// Decoded in one pass; stops at a truncated record.
+  List<ZmRosterRecord> get records {
+    final records = <ZmRosterRecord>[];
+    var offset = headerSize;
+    for (var i = 0; i < count; i++) {
+      if (offset + 8 > bytes.lengthInBytes) {
+        break;
+      }
+      final userId = _data.getUint32(offset, Endian.little);
+      final op = _data.getUint8(offset + 4);
+      final flags = _data.getUint8(offset + 5);
+      final fields = _data.getUint16(offset + 6, Endian.little);
+      offset += 8;
+
+      String? name;
+      if (fields & ZmRosterRecord.fieldName != 0) {
+        if (offset + 2 > bytes.lengthInBytes) {
+          break;
+        }
+        final length = _data.getUint16(offset, Endian.little);
+        offset += 2;
+        if (offset + length > bytes.lengthInBytes) {
+          break;
+        }
+        name = utf8.decode(Uint8List.sublistView(bytes, offset, offset + length),
+            allowMalformed: true);
+        offset += length;
+      }
+      int? attributes;
+      if (fields & ZmRosterRecord.fieldAttributes != 0) {
+        if (offset + 2 > bytes.lengthInBytes) {
+          break;
+        }
+        attributes = _data.getUint16(offset, Endian.little);
+        offset += 2;
+      }
+      records.add(ZmRosterRecord._(userId, op, fields, flags, name, attributes));
+    }
+    return records;
+  }
+}
+
+/// One user's entry in a [ZmRosterUpdate].
+class ZmRosterRecord {
+  static const int fieldName = 1 << 0;
+  static const int fieldAttributes = 1 << 1;
+  static const int fieldVideoOn = 1 << 2;
+  static const int fieldMuted = 1 << 3;
+  static const int fieldTalking = 1 << 4;
+  static const int fieldHandRaised = 1 << 5;
+
+  final int userId;
+  final int _op;
+
+  /// Which fields the record carries, as `field*` bits.
+  final int fields;
+  final int _flags;
+  final String? name;
+  final int? _attributes;
+
+  ZmRosterRecord._(this.userId, this._op, this.fields, this._flags, this.name,
+      this._attributes);
+
+  /// The record has every field.
+  bool get joined => _op == 0;
+
+  bool get left => _op == 1;
+
+  bool has(int field) => fields & field != 0;
+
+  /// Applies the fields this record carries on top of [previous].
+  ZmParticipant merge(ZmParticipant? previous) {
+    bool attribute(int bit, bool? old) => _attributes != null
+        ? _attributes! & bit != 0
+        : old ?? false;
+    bool flag(int field, int bit, bool? old) =>
+        has(field) ? _flags & bit != 0 : old ?? false;
+
+    return ZmParticipant(
+      userId: userId,
+      name: name ?? previous?.name ?? '',
+      host: attribute(1 << 0, previous?.host),
+      coHost: attribute(1 << 1, previous?.coHost),
+      myself: attribute(1 << 2, previous?.myself),
+      inWaitingRoom: attribute(1 << 3, previous?.inWaitingRoom),
+      purePhone: attribute(1 << 4, previous?.purePhone),
+      bot: attribute(1 << 5, previous?.bot),
+      h323: attribute(1 << 6, previous?.h323),
+      interpreter: attribute(1 << 7, previous?.interpreter),
+      panelist: attribute(1 << 8, previous?.panelist),
+      attendee: attribute(1 << 9, previous?.attendee),
+      videoOn: flag(fieldVideoOn, 1 << 0, previous?.videoOn),
+      muted: flag(fieldMuted, 1 << 1, previous?.muted),
+      talking: flag(fieldTalking, 1 << 2, previous?.talking),
+      handRaised: flag(fieldHandRaised, 1 << 3, previous?.handRaised),
+    );
+  }
+}
+
+/// A Dart copy of the native roster, kept current by applying
+/// [ZmRosterUpdate]s in order.
+class ZmRoster {
+  final Map<int, ZmParticipant> participants = {};
+
+  /// 0 until the first snapshot.
+  int version = 0;
+
+  /// Returns false, changing nothing, for a delta that does not start at
+  /// [version]; fetch the changes since [version] and apply those instead.
+  bool apply(ZmRosterUpdate update) {
+    if (!update.isSnapshot && update.baseVersion != version) {
+      return false;
+    }
+    if (update.isSnapshot) {
+      participants.clear();
+    }
+    for (final record in update.records) {
+      if (record.left) {
+        participants.remove(record.userId);
+      } else {
+        participants[record.userId] =
+            record.merge(participants[record.userId]);
+      }
+    }
+    version = update.version;
+    return true;
+  }
+}
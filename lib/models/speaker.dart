@@ -0,0 +1,43 @@
+import 'dart:typed_data';
+
+/// The stable active speaker (Windows), sent when the current speaker or
+/// the recent speakers change.
+///
+/// Updates arrive as a 16-byte little-endian header followed by the recent
+/// speakers' user ids.
+class ZmSpeakerUpdate {
+  static const int headerSize = 16;
+  static const int supportedFormat = 1;
+
+  /// 0 when nobody has spoken yet.
+  final int current;
+
+  /// Earlier speakers, the one who held the floor last first.
+  final List<int> recent;
+
+  /// Counts updates; a gap means some were dropped.
+  final int sequence;
+
+  ZmSpeakerUpdate(this.current, this.recent, this.sequence);
+
+  static ZmSpeakerUpdate? tryParse(dynamic event) {
+    if (event is! Uint8List || event.lengthInBytes < headerSize) {
+      return null;
+    }
+    if (event[0] != supportedFormat) {
+      return null;
+    }
+
+    final data = ByteData.sublistView(event);
+    final count = data.getUint16(2, Endian.little);
+    if (event.lengthInBytes < headerSize + count * 4) {
+      return null;
+    }
+    return ZmSpeakerUpdate(
+      data.getUint32(4, Endian.little),
+      List.generate(
+          count, (i) => data.getUint32(headerSize + i * 4, Endian.little)),
+      data.getUint64(8, Endian.little),
+    );
+  }
+}
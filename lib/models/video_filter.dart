@@ -0,0 +1,151 @@
+import 'dart:typed_data';
+
+/// One stage of the camera pre-processing chain (Windows).
+abstract class ZmVideoFilter {
+  const ZmVideoFilter();
+
+  Map<String, dynamic> toMap();
+}
+
+/// Luma brightness (-1 to 1, a fraction of the range) and contrast (0 to 4,
+/// around mid grey).
+class ZmBrightnessContrastFilter extends ZmVideoFilter {
+  final double brightness;
+  final double contrast;
+
+  const ZmBrightnessContrastFilter({this.brightness = 0, this.contrast = 1});
+
+  @override
+  Map<String, dynamic> toMap() => {
+        'type': 'brightnessContrast',
+        'brightness': brightness,
+        'contrast': contrast,
+      };
+}
+
+/// Luma gamma (0.1 to 10); above 1 brightens the mid tones.
+class ZmGammaFilter extends ZmVideoFilter {
+  final double gamma;
+
+  const ZmGammaFilter(this.gamma);
+
+  @override
+  Map<String, dynamic> toMap() => {'type': 'gamma', 'gamma': gamma};
+}
+
+enum ZmBlurKernel { box, gaussian }
+
+/// Chroma noise reduction: 1 to 4 passes of a 3x3 kernel over U and V.
+class ZmChromaBlurFilter extends ZmVideoFilter {
+  final ZmBlurKernel kernel;
+  final int passes;
+
+  const ZmChromaBlurFilter(
+      {this.kernel = ZmBlurKernel.gaussian, this.passes = 1});
+
+  @override
+  Map<String, dynamic> toMap() => {
+        'type': 'chromaBlur',
+        'kernel': kernel.name,
+        'passes': passes,
+      };
+}
+
+/// A packed I420 image with a full-resolution alpha plane, blended onto the
+/// frame. Negative [x] and [y] are margins from the right and bottom edges.
+class ZmWatermarkFilter extends ZmVideoFilter {
+  final Uint8List image;
+  final Uint8List alpha;
+  final int width;
+  final int height;
+  final int x;
+  final int y;
+  final double opacity;
+
+  const ZmWatermarkFilter({
+    required this.image,
+    required this.alpha,
+    required this.width,
+    required this.height,
+    this.x = 0,
+    this.y = 0,
+    this.opacity = 1,
+  });
+
+  @override
+  Map<String, dynamic> toMap() => {
+        'type': 'watermark',
+        'image': image,
+        'alpha': alpha,
+        'width': width,
+        'height': height,
+        'x': x,
+        'y': y,
+        'opacity': opacity,
+      };
+}
+
+class ZmVideoFilterTiming {
+  final String name;
+  final int lastUs;
+  final int meanUs;
+  final int maxUs;
+
+  const ZmVideoFilterTiming({
+    required this.name,
+    required this.lastUs,
+    required this.meanUs,
+    required this.maxUs,
+  });
+
+  factory ZmVideoFilterTiming.fromMap(Map<dynamic, dynamic> map) =>
+      ZmVideoFilterTiming(
+        name: map['name'] ?? '',
+        lastUs: map['lastUs'] ?? 0,
+        meanUs: map['meanUs'] ?? 0,
+        maxUs: map['maxUs'] ?? 0,
+      );
+}
+
+class ZmVideoFilterStats {
+  final int frames;
+  final int width;
+  final int height;
+
+  /// Whole chain, per frame.
+  final int lastUs;
+  final int meanUs;
+  final int maxUs;
+  final int budgetUs;
+
+  /// Frames the chain took longer than [budgetUs] on.
+  final int overBudget;
+  final List<ZmVideoFilterTiming> filters;
+
+  const ZmVideoFilterStats({
+    required this.frames,
+    required this.width,
+    required this.height,
+    required this.lastUs,
+    required this.meanUs,
+    required this.maxUs,
+    required this.budgetUs,
+    required this.overBudget,
+    required this.filters,
+  });
+
+  factory ZmVideoFilterStats.fromMap(Map<String, dynamic> map) =>
+      ZmVideoFilterStats(
+        frames: map['frames'] ?? 0,
+        width: map['width'] ?? 0,
+        height: map['height'] ?? 0,
+        lastUs: map['lastUs'] ?? 0,
+        meanUs: map['meanUs'] ?? 0,
+        maxUs: map['maxUs'] ?? 0,
+        budgetUs: map['budgetUs'] ?? 0,
+        overBudget: map['overBudget'] ?? 0,
+        filters: ((map['filters'] as List?) ?? [])
+            .map((filter) => ZmVideoFilterTiming.fromMap(filter as Map))
+            .toList(),
+      );
+}
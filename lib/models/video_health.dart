@@ -0,0 +1,137 @@
+import 'dart:typed_data';
+
+/// Health of every watched video stream over one reporting interval
+/// (Windows).
+///
+/// Reports arrive as an 8-byte little-endian header followed by one 32-byte
+/// record per stream; fields are read lazily from a view over the message.
+class VideoHealthReport {
+  static const int headerSize = 8;
+  static const int supportedVersion = 1;
+
+  final Uint8List bytes;
+  final ByteData _data;
+
+  VideoHealthReport(this.bytes) : _data = ByteData.sublistView(bytes);
+
+  static VideoHealthReport? tryParse(dynamic event) {
+    if (event is! Uint8List || event.lengthInBytes < headerSize) {
+      return null;
+    }
+    if (event[0] != supportedVersion) {
+      return null;
+    }
+    final report = VideoHealthReport(event);
+    if (report.recordSize < VideoHealthRecord.size ||
+        event.lengthInBytes < headerSize + report.count * report.recordSize) {
+      return null;
+    }
+    return report;
+  }
+
+  int get recordSize => _data.getUint8(1);
+
+  int get count => _data.getUint16(2, Endian.little);
+
+  Duration get interval =>
+      Duration(milliseconds: _data.getUint32(4, Endian.little));
+
+  List<VideoHealthRecord> get streams => List<VideoHealthRecord>.generate(
+      count,
+      (i) => VideoHealthRecord._(_data, headerSize + i * recordSize));
+}
+
+/// One stream's entry in a [VideoHealthReport].
+class VideoHealthRecord {
+  static const int size = 32;
+
+  final ByteData _data;
+  final int _offset;
+
+  VideoHealthRecord._(this._data, this._offset);
+
+  /// User id, or share source id for a share subscription.
+  int get userId => _data.getUint32(_offset, Endian.little);
+
+  int get width => _data.getUint16(_offset + 4, Endian.little);
+
+  int get height => _data.getUint16(_offset + 6, Endian.little);
+
+  /// Frames with new content per second; repeats of the same picture do
+  /// not count.
+  double get fps => _data.getUint16(_offset + 8, Endian.little) / 100;
+
+  int get _flags => _data.getUint16(_offset + 10, Endian.little);
+
+  bool get frozen => _flags & 1 != 0;
+
+  /// Whether the SDK is currently delivering raw data for the stream.
+  bool get rawDataOn => _flags & 2 != 0;
+
+  bool get resolutionChanged => _flags & 4 != 0;
+
+  /// Smoothed difference between frame arrival and frame timestamp
+  /// intervals, in microseconds.
+  int get jitterUs => _data.getUint32(_offset + 12, Endian.little);
+
+  /// Longest wait for new content this interval, in milliseconds.
+  int get maxGapMs => _data.getUint32(_offset + 16, Endian.little);
+
+  /// Freezes since subscribing.
+  int get freezes => _data.getUint32(_offset + 20, Endian.little);
+
+  /// Time spent frozen since subscribing, in milliseconds.
+  int get frozenMs => _data.getUint32(_offset + 24, Endian.little);
+
+  /// Frames this interval identical to the one before.
+  int get repeatedFrames => _data.getUint32(_offset + 28, Endian.little);
+}
+
+/// Counters of one watched video stream (Windows).
+class ZmVideoHealthStats {
+  final int width;
+  final int height;
+  final int frames;
+  final int repeatedFrames;
+  final int resolutionChanges;
+  final int freezes;
+  final int frozenMs;
+  final bool frozen;
+
+  /// Since the last report.
+  final double fps;
+  final double arrivalFps;
+  final int maxGapMs;
+  final int jitterUs;
+
+  const ZmVideoHealthStats({
+    required this.width,
+    required this.height,
+    required this.frames,
+    required this.repeatedFrames,
+    required this.resolutionChanges,
+    required this.freezes,
+    required this.frozenMs,
+    required this.frozen,
+    required this.fps,
+    required this.arrivalFps,
+    required this.maxGapMs,
+    required this.jitterUs,
+  });
+
+  factory ZmVideoHealthStats.fromMap(Map<String, dynamic> map) =>
+      ZmVideoHealthStats(
+        width: map['width'] ?? 0,
+        height: map['height'] ?? 0,
+        frames: map['frames'] ?? 0,
+        repeatedFrames: map['repeatedFrames'] ?? 0,
+        resolutionChanges: map['resolutionChanges'] ?? 0,
+        freezes: map['freezes'] ?? 0,
+        frozenMs: map['frozenMs'] ?? 0,
+        frozen: map['frozen'] ?? false,
+        fps: map['fps'] ?? 0.0,
+        arrivalFps: map['arrivalFps'] ?? 0.0,
+        maxGapMs: map['maxGapMs'] ?? 0,
+        jitterUs: map['jitterUs'] ?? 0,
+      );
+}
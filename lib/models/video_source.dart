@@ -0,0 +1,202 @@
+/// Layout of frames pushed to an external video source.
+enum ZmVideoPixelFormat {
+  /// Packed I420: Y, then U, then V, without row padding.
+  i420,
+
+  /// 32-bit pixels, as from `Image.toByteData(format: ImageByteFormat.rawRgba)`.
+  rgba,
+  bgra,
+}
+
+/// Why the external video source does not send a larger capability.
+enum ZmVideoCapabilityLimit {
+  /// The largest capability offered is in use.
+  none,
+
+  /// Larger ones exceed what the SDK suggested.
+  suggested,
+
+  /// Larger ones would upscale the source.
+  source,
+
+  /// Larger ones exceed [ZoomPlatform.setVideoSourceBudget]'s size limits.
+  budget,
+
+  /// Larger ones are predicted to exceed the CPU budget.
+  cpu,
+
+  /// Packet loss, or the SDK encoding smaller than it is fed.
+  network,
+}
+
+/// A size and rate the SDK accepts from an external video source.
+class ZmVideoCapability {
+  final int width;
+  final int height;
+  final int fps;
+
+  const ZmVideoCapability(
+      {required this.width, required this.height, required this.fps});
+
+  factory ZmVideoCapability.fromMap(Map<dynamic, dynamic> map) =>
+      ZmVideoCapability(
+        width: map['width'] ?? 0,
+        height: map['height'] ?? 0,
+        fps: map['fps'] ?? 0,
+      );
+}
+
+class ZmVideoSourceStats {
+  /// The SDK has handed the external source a sender.
+  final bool initialized;
+  final bool sending;
+
+  /// A file or ended stream has been sent completely; its last frame keeps
+  /// being sent until the source is stopped.
+  final bool finished;
+
+  /// Capability in use.
+  final int width;
+  final int height;
+  final int fps;
+  final int capabilityChanges;
+  final ZmVideoCapabilityLimit limit;
+
+  /// Sender load expected at the capability in use, in percent of a core.
+  final double predictedCpuPercent;
+
+  /// Measured cost of scaling and sending one frame.
+  final int meanSendCostUs;
+
+  /// Largest frame area the network currently carries; 0 is unlimited.
+  final int networkLimit;
+  final int framesSent;
+  final int sendErrors;
+
+  /// Source frames sent more than once, because the source is slower than
+  /// the send rate.
+  final int framesRepeated;
+
+  /// Source frames never sent, because the source is faster than the send
+  /// rate.
+  final int framesSkipped;
+
+  /// Pushed frames dropped because the queue was full.
+  final int framesDropped;
+  final int starvedTicks;
+  final int resyncs;
+
+  /// How late frames were sent against their schedule.
+  final int meanLatenessUs;
+  final int maxLatenessUs;
+
+  /// Smoothed variation of the interval between frames.
+  final int intervalJitterUs;
+
+  const ZmVideoSourceStats({
+    required this.initialized,
+    required this.sending,
+    required this.finished,
+    required this.width,
+    required this.height,
+    required this.fps,
+    required this.capabilityChanges,
+    required this.limit,
+    required this.predictedCpuPercent,
+    required this.meanSendCostUs,
+    required this.networkLimit,
+    required this.framesSent,
+    required this.sendErrors,
+    required this.framesRepeated,
+    required this.framesSkipped,
+    required this.framesDropped,
+    required this.starvedTicks,
+    required this.resyncs,
+    required this.meanLatenessUs,
+    required this.maxLatenessUs,
+    required this.intervalJitterUs,
+  });
+
+  factory ZmVideoSourceStats.fromMap(Map<String, dynamic> map) =>
+      ZmVideoSourceStats(
+        initialized: map['initialized'] ?? false,
+        sending: map['sending'] ?? false,
+        finished: map['finished'] ?? false,
+        width: map['width'] ?? 0,
+        height: map['height'] ?? 0,
+        fps: map['fps'] ?? 0,
+        capabilityChanges: map['capabilityChanges'] ?? 0,
+        limit: ZmVideoCapabilityLimit.values.firstWhere(
+            (limit) => limit.name == map['limit'],
+            orElse: () => ZmVideoCapabilityLimit.none),
+        predictedCpuPercent: map['predictedCpuPercent'] ?? 0.0,
+        meanSendCostUs: map['meanSendCostUs'] ?? 0,
+        networkLimit: map['networkLimit'] ?? 0,
+        framesSent: map['framesSent'] ?? 0,
+        sendErrors: map['sendErrors'] ?? 0,
+        framesRepeated: map['framesRepeated'] ?? 0,
+        framesSkipped: map['framesSkipped'] ?? 0,
+        framesDropped: map['framesDropped'] ?? 0,
+        starvedTicks: map['starvedTicks'] ?? 0,
+        resyncs: map['resyncs'] ?? 0,
+        meanLatenessUs: map['meanLatenessUs'] ?? 0,
+        maxLatenessUs: map['maxLatenessUs'] ?? 0,
+        intervalJitterUs: map['intervalJitterUs'] ?? 0,
+      );
+}
+
+/// Counters of the external share source.
+class ZmShareSourceStats {
+  final bool sending;
+  final int width;
+  final int height;
+  final int framesPushed;
+
+  /// Pushed frames whose tiles all matched the previous frame.
+  final int framesUnchanged;
+  final int framesSent;
+
+  /// Unchanged frames resent so late joiners get a picture.
+  final int keepAliveFrames;
+
+  /// Changed frames replaced by a newer one before they could be sent.
+  final int framesSuperseded;
+  final int sendErrors;
+  final int lastChangedTiles;
+  final int tileCount;
+  final int meanHashUs;
+  final int meanConvertUs;
+
+  const ZmShareSourceStats({
+    required this.sending,
+    required this.width,
+    required this.height,
+    required this.framesPushed,
+    required this.framesUnchanged,
+    required this.framesSent,
+    required this.keepAliveFrames,
+    required this.framesSuperseded,
+    required this.sendErrors,
+    required this.lastChangedTiles,
+    required this.tileCount,
+    required this.meanHashUs,
+    required this.meanConvertUs,
+  });
+
+  factory ZmShareSourceStats.fromMap(Map<String, dynamic> map) =>
+      ZmShareSourceStats(
+        sending: map['sending'] ?? false,
+        width: map['width'] ?? 0,
+        height: map['height'] ?? 0,
+        framesPushed: map['framesPushed'] ?? 0,
+        framesUnchanged: map['framesUnchanged'] ?? 0,
+        framesSent: map['framesSent'] ?? 0,
+        keepAliveFrames: map['keepAliveFrames'] ?? 0,
+        framesSuperseded: map['framesSuperseded'] ?? 0,
+        sendErrors: map['sendErrors'] ?? 0,
+        lastChangedTiles: map['lastChangedTiles'] ?? 0,
+        tileCount: map['tileCount'] ?? 0,
+        meanHashUs: map['meanHashUs'] ?? 0,
+        meanConvertUs: map['meanConvertUs'] ?? 0,
+      );
+}
@@ -1,5 +1,6 @@
 import 'dart:async';
 import 'dart:convert';
+import 'dart:typed_data';
 
 import 'package:flutter/foundation.dart';
 import 'package:flutter_zoom_sdk/zoom_options.dart';
@@ -7,9 +8,41 @@ import 'package:flutter_zoom_sdk/zoom_view.dart';
 import 'package:crypto/crypto.dart';
 import 'package:plugin_platform_interface/plugin_platform_interface.dart';
 
+import 'models/audio_analysis.dart';
 import 'models/audio_types.dart';
+import 'models/audio_stream.dart';
+import 'models/av_status.dart';
+import 'models/callback_journal.dart';
+import 'models/domain_event.dart';
+import 'models/meeting_event.dart';
+import 'models/meeting_state.dart';
+import 'models/participant.dart';
+import 'models/pcm_chunk.dart';
+import 'models/pip.dart';
+import 'models/raw_archive.dart';
+import 'models/roster_sync.dart';
+import 'models/speaker.dart';
+import 'models/video_filter.dart';
+import 'models/video_health.dart';
+import 'models/video_source.dart';
 export 'zoom_options.dart';
+export 'models/audio_analysis.dart';
 export 'models/audio_types.dart';
+export 'models/audio_stream.dart';
+export 'models/av_status.dart';
+export 'models/callback_journal.dart';
+export 'models/domain_event.dart';
+export 'models/meeting_event.dart';
+export 'models/meeting_state.dart';
+export 'models/participant.dart';
+export 'models/pcm_chunk.dart';
+export 'models/pip.dart';
+export 'models/raw_archive.dart';
+export 'models/roster_sync.dart';
+export 'models/speaker.dart';
+export 'models/video_filter.dart';
+export 'models/video_health.dart';
+export 'models/video_source.dart';
 
 abstract class ZoomPlatform extends PlatformInterface {
   ZoomPlatform() : super(token: _token);
@@ -134,4 +167,505 @@ abstract class ZoomPlatform extends PlatformInterface {
   Stream<ZmAudioStatus> getMicStatusStream() {
     throw UnimplementedError('getMicStatusStream() has not been implemented.');
   }
+
+  /// Raw PCM chunks of the streams selected with [subscribePcmStream] (Windows)
+  Stream<PcmChunk> onPcmStream() {
+    throw UnimplementedError('onPcmStream() has not been implemented.');
+  }
+
+  /// Start delivering a raw audio stream on [onPcmStream] (Windows).
+  Future<bool> subscribePcmStream(ZmAudioStreamSelector stream) {
+    throw UnimplementedError('subscribePcmStream() has not been implemented.');
+  }
+
+  Future<bool> unsubscribePcmStream(ZmAudioStreamSelector stream) {
+    throw UnimplementedError(
+        'unsubscribePcmStream() has not been implemented.');
+  }
+
+  /// Set how much audio each [PcmChunk] carries. Returns the applied value.
+  Future<Duration> setPcmBatchDuration(Duration duration) {
+    throw UnimplementedError(
+        'setPcmBatchDuration() has not been implemented.');
+  }
+
+  /// Interpretation languages heard so far, keyed by the stream id used in
+  /// interpreter [PcmChunk]s (Windows)
+  Future<Map<int, String>> interpreterLanguages() {
+    throw UnimplementedError(
+        'interpreterLanguages() has not been implemented.');
+  }
+
+  /// Record the selected raw audio streams to one WAV file per stream in
+  /// [directory] (Windows)
+  Future<bool> startAudioRecording(
+      String directory, List<ZmAudioStreamSelector> streams) {
+    throw UnimplementedError(
+        'startAudioRecording() has not been implemented.');
+  }
+
+  /// Stop recording and return the paths of the finished WAV files (Windows)
+  Future<List<String>> stopAudioRecording() {
+    throw UnimplementedError('stopAudioRecording() has not been implemented.');
+  }
+
+  /// Mix [inputs] into a new stream selectable with
+  /// [ZmAudioStreamSelector.mix] using the returned id (Windows)
+  Future<int> createAudioMix(List<ZmAudioMixInput> inputs,
+      {int sampleRate = 32000}) {
+    throw UnimplementedError('createAudioMix() has not been implemented.');
+  }
+
+  Future<bool> setAudioMixInputs(int mixId, List<ZmAudioMixInput> inputs) {
+    throw UnimplementedError('setAudioMixInputs() has not been implemented.');
+  }
+
+  Future<bool> destroyAudioMix(int mixId) {
+    throw UnimplementedError('destroyAudioMix() has not been implemented.');
+  }
+
+  Future<ZmAudioMixStats?> audioMixStats(int mixId) {
+    throw UnimplementedError('audioMixStats() has not been implemented.');
+  }
+
+  /// Spectrum and loudness frames of the streams selected with
+  /// [subscribeAudioAnalysis] (Windows)
+  Stream<AudioAnalysisFrame> onAudioAnalysis() {
+    throw UnimplementedError('onAudioAnalysis() has not been implemented.');
+  }
+
+  /// Start analysing a raw audio stream: [bands] log-spaced bands between
+  /// [minFrequency] and [maxFrequency] from [fftSize]-point spectra, plus
+  /// EBU R128 loudness, at most one frame per [interval] (Windows).
+  Future<bool> subscribeAudioAnalysis(ZmAudioStreamSelector stream,
+      {int fftSize = 2048,
+      int bands = 32,
+      double minFrequency = 40,
+      double maxFrequency = 16000,
+      Duration interval = const Duration(milliseconds: 50)}) {
+    throw UnimplementedError(
+        'subscribeAudioAnalysis() has not been implemented.');
+  }
+
+  Future<bool> unsubscribeAudioAnalysis(ZmAudioStreamSelector stream) {
+    throw UnimplementedError(
+        'unsubscribeAudioAnalysis() has not been implemented.');
+  }
+
+  /// Share the audio of a 16-bit PCM WAV file without sharing the screen
+  /// (Windows). The share stops by itself at the end unless [loop] is set.
+  Future<bool> startShareAudioFile(String path, {bool loop = false}) {
+    throw UnimplementedError('startShareAudioFile() has not been implemented.');
+  }
+
+  /// Share audio fed with [pushShareAudio] without sharing the screen
+  /// (Windows).
+  Future<bool> startShareAudioStream(
+      {required int sampleRate, required int channels}) {
+    throw UnimplementedError(
+        'startShareAudioStream() has not been implemented.');
+  }
+
+  /// Queue interleaved little-endian 16-bit samples for the shared stream.
+  /// Returns the frames accepted; the rest did not fit.
+  Future<int> pushShareAudio(Uint8List samples) {
+    throw UnimplementedError('pushShareAudio() has not been implemented.');
+  }
+
+  /// Play out the queued audio, then stop sharing.
+  Future<bool> endShareAudioStream() {
+    throw UnimplementedError(
+        'endShareAudioStream() has not been implemented.');
+  }
+
+  Future<bool> stopShareAudio() {
+    throw UnimplementedError('stopShareAudio() has not been implemented.');
+  }
+
+  Future<ZmShareAudioStats> shareAudioStats() {
+    throw UnimplementedError('shareAudioStats() has not been implemented.');
+  }
+
+  /// Send a 4:2:0 Y4M file in place of the camera (Windows).
+  Future<bool> startVideoSourceFile(String path, {bool loop = false}) {
+    throw UnimplementedError(
+        'startVideoSourceFile() has not been implemented.');
+  }
+
+  /// Send frames fed with [pushVideoFrame] in place of the camera
+  /// (Windows). Without [fps] frames go out at the rate the SDK asks for.
+  Future<bool> startVideoSourceStream(
+      {required int width, required int height, double? fps}) {
+    throw UnimplementedError(
+        'startVideoSourceStream() has not been implemented.');
+  }
+
+  /// Queue a frame. RGBA and BGRA frames are converted to I420 natively;
+  /// their rows may be padded to [stride] bytes.
+  Future<bool> pushVideoFrame(Uint8List data,
+      {required int width,
+      required int height,
+      bool fullRange = false,
+      ZmVideoPixelFormat format = ZmVideoPixelFormat.i420,
+      int? stride}) {
+    throw UnimplementedError('pushVideoFrame() has not been implemented.');
+  }
+
+  /// No more frames will be pushed; the last one stays on screen.
+  Future<bool> endVideoSourceStream() {
+    throw UnimplementedError(
+        'endVideoSourceStream() has not been implemented.');
+  }
+
+  /// Give the camera back to the SDK.
+  Future<bool> stopVideoSource() {
+    throw UnimplementedError('stopVideoSource() has not been implemented.');
+  }
+
+  Future<ZmVideoSourceStats> videoSourceStats() {
+    throw UnimplementedError('videoSourceStats() has not been implemented.');
+  }
+
+  /// Limit what the external video source sends. The largest capability
+  /// the SDK offers that fits these limits, the source's native size and
+  /// rate and the network is used; [cpuPercent] is the share of one core
+  /// scaling and sending may take. Leave a limit out to lift it.
+  Future<bool> setVideoSourceBudget(
+      {int? cpuPercent, int? maxWidth, int? maxHeight, int? maxFps}) {
+    throw UnimplementedError(
+        'setVideoSourceBudget() has not been implemented.');
+  }
+
+  /// Capabilities the SDK currently offers the external video source.
+  Future<List<ZmVideoCapability>> videoSourceCapabilities() {
+    throw UnimplementedError(
+        'videoSourceCapabilities() has not been implemented.');
+  }
+
+  /// Filter the camera in place before it is encoded (Windows). An empty
+  /// list removes the chain. [budgetUs] is the per-frame time the chain's
+  /// statistics count overruns against.
+  Future<bool> setVideoFilters(List<ZmVideoFilter> filters, {int? budgetUs}) {
+    throw UnimplementedError('setVideoFilters() has not been implemented.');
+  }
+
+  Future<bool> clearVideoFilters() {
+    throw UnimplementedError('clearVideoFilters() has not been implemented.');
+  }
+
+  Future<ZmVideoFilterStats> videoFilterStats() {
+    throw UnimplementedError('videoFilterStats() has not been implemented.');
+  }
+
+  /// Share frames fed with [pushShareFrame] as a screen share (Windows).
+  /// Frames are sent only when their content changes, at most [maxFps] per
+  /// second, and repeated [keepAliveFps] times a second while static.
+  Future<bool> startShareSource({int maxFps = 15, int keepAliveFps = 1}) {
+    throw UnimplementedError('startShareSource() has not been implemented.');
+  }
+
+  /// Offer an RGBA or BGRA frame; rows may be padded to [stride] bytes.
+  /// Returns whether it differed from the previous frame.
+  Future<bool> pushShareFrame(Uint8List data,
+      {required int width,
+      required int height,
+      ZmVideoPixelFormat format = ZmVideoPixelFormat.rgba,
+      int? stride}) {
+    throw UnimplementedError('pushShareFrame() has not been implemented.');
+  }
+
+  Future<bool> stopShareSource() {
+    throw UnimplementedError('stopShareSource() has not been implemented.');
+  }
+
+  Future<ZmShareSourceStats> shareSourceStats() {
+    throw UnimplementedError('shareSourceStats() has not been implemented.');
+  }
+
+  /// Reports for the streams watched with [subscribeVideoHealth] (Windows).
+  Stream<VideoHealthReport> onVideoHealth() {
+    throw UnimplementedError('onVideoHealth() has not been implemented.');
+  }
+
+  /// Watch a user's video, or a share with [share], for freezes, frame rate
+  /// and jitter. [resolution] is 90, 180, 360, 720 or 1080; smaller costs
+  /// less and is enough to see freezes.
+  Future<bool> subscribeVideoHealth(int userId,
+      {bool share = false, int resolution = 180}) {
+    throw UnimplementedError(
+        'subscribeVideoHealth() has not been implemented.');
+  }
+
+  Future<bool> unsubscribeVideoHealth(int userId) {
+    throw UnimplementedError(
+        'unsubscribeVideoHealth() has not been implemented.');
+  }
+
+  /// How often [onVideoHealth] reports, 100 ms to 10 s.
+  Future<void> setVideoHealthInterval(Duration interval) {
+    throw UnimplementedError(
+        'setVideoHealthInterval() has not been implemented.');
+  }
+
+  /// Null when [userId] is not watched.
+  Future<ZmVideoHealthStats?> videoHealthStats(int userId) {
+    throw UnimplementedError('videoHealthStats() has not been implemented.');
+  }
+
+  /// Archive raw media into [directory] as fixed-duration segments that
+  /// survive a crash up to the last flushed chunk (Windows). Audio comes
+  /// from [streams]; add video with [addRawArchiveVideo]. The oldest
+  /// segments in [directory] are deleted past [maxBytes] or [maxSegments].
+  Future<bool> startRawArchive(String directory,
+      {List<ZmAudioStreamSelector> streams = const [],
+      Duration segmentDuration = const Duration(seconds: 60),
+      Duration flushInterval = const Duration(seconds: 1),
+      int? maxBytes,
+      int? maxSegments}) {
+    throw UnimplementedError('startRawArchive() has not been implemented.');
+  }
+
+  /// Archive a user's video, or a share with [share], at [resolution]
+  /// lines (90, 180, 360, 720 or 1080).
+  Future<bool> addRawArchiveVideo(int userId,
+      {bool share = false, int resolution = 360}) {
+    throw UnimplementedError('addRawArchiveVideo() has not been implemented.');
+  }
+
+  Future<bool> removeRawArchiveVideo(int userId) {
+    throw UnimplementedError(
+        'removeRawArchiveVideo() has not been implemented.');
+  }
+
+  /// Stop archiving and return this session's segments still on disk.
+  Future<List<String>> stopRawArchive() {
+    throw UnimplementedError('stopRawArchive() has not been implemented.');
+  }
+
+  Future<ZmRawArchiveStats> rawArchiveStats() {
+    throw UnimplementedError('rawArchiveStats() has not been implemented.');
+  }
+
+  /// Hide the meeting window and show the active speaker in a Flutter
+  /// texture instead of Zoom's mini window (Windows). Starts with [userId]
+  /// when given, then follows the active speaker at [resolution] lines.
+  /// Other raw video subscriptions pause until [stopPictureInPicture] or
+  /// [showMeeting]. Returns the texture id, null when unavailable.
+  Future<int?> startPictureInPicture({int? userId, int resolution = 180}) {
+    throw UnimplementedError(
+        'startPictureInPicture() has not been implemented.');
+  }
+
+  /// Does not restore the meeting window; [showMeeting] does both.
+  Future<bool> stopPictureInPicture() {
+    throw UnimplementedError(
+        'stopPictureInPicture() has not been implemented.');
+  }
+
+  /// Null when picture-in-picture is off.
+  Future<ZmPipState?> pictureInPictureState() {
+    throw UnimplementedError(
+        'pictureInPictureState() has not been implemented.');
+  }
+
+  /// Participants in the meeting, from the native roster (Windows).
+  Future<int> participantCount() {
+    throw UnimplementedError('participantCount() has not been implemented.');
+  }
+
+  /// Null when [userId] is not in the meeting.
+  Future<ZmParticipant?> participant(int userId) {
+    throw UnimplementedError('participant() has not been implemented.');
+  }
+
+  Future<List<int>> participantIds() {
+    throw UnimplementedError('participantIds() has not been implemented.');
+  }
+
+  /// A page of participants in name order, or reverse with [descending].
+  /// Only those matching every filter that is set and whose name starts with
+  /// [prefix], ignoring case, are included. [limit] is at most 1000.
+  Future<ZmParticipantPage> queryParticipants(
+      {String prefix = '',
+      bool handRaised = false,
+      bool inWaitingRoom = false,
+      bool hostOrCoHost = false,
+      bool purePhone = false,
+      bool bot = false,
+      bool descending = false,
+      int offset = 0,
+      int limit = 50}) {
+    throw UnimplementedError('queryParticipants() has not been implemented.');
+  }
+
+  /// Roster updates (Windows): a snapshot on joining, then a delta for each
+  /// short window with changes. Apply them to a [ZmRoster]; when one does not
+  /// apply, catch up with [rosterSince]. Participants are followed natively
+  /// only while this or [onAvStatusUpdate] is listened to, or after a
+  /// participants call, until the meeting ends.
+  Stream<ZmRosterUpdate> onRosterUpdate() {
+    throw UnimplementedError('onRosterUpdate() has not been implemented.');
+  }
+
+  /// The changes from [version] to now, or a snapshot when [version] is too
+  /// old. Pass 0 for a snapshot.
+  Future<ZmRosterUpdate?> rosterSince(int version) {
+    throw UnimplementedError('rosterSince() has not been implemented.');
+  }
+
+  /// Audio and video status updates (Windows): a delta for each short
+  /// window with changes, carrying only the 64-user words that changed.
+  /// Apply them to a [ZmAvStatus]; when one does not apply, start over from
+  /// [avStatusSnapshot].
+  Stream<ZmAvStatusUpdate> onAvStatusUpdate() {
+    throw UnimplementedError('onAvStatusUpdate() has not been implemented.');
+  }
+
+  /// Every audio and video status bit, as of the latest update.
+  Future<ZmAvStatusUpdate?> avStatusSnapshot() {
+    throw UnimplementedError('avStatusSnapshot() has not been implemented.');
+  }
+
+  /// How many users are muted, have video on, are talking and are in the
+  /// active audio list, under `muted`, `videoOn`, `talking` and
+  /// `activeAudio`, and how many are followed, under `users`.
+  Future<Map<String, int>> avStatusCounts() {
+    throw UnimplementedError('avStatusCounts() has not been implemented.');
+  }
+
+  /// The stable active speaker (Windows): fuses the SDK's active speaker,
+  /// active video and active audio events into one speaker that changes only
+  /// after a challenger has clearly led for a while. Sent only on change.
+  /// The tracker runs only while this is listened to or picture-in-picture
+  /// is on.
+  Stream<ZmSpeakerUpdate> onSpeakerUpdate() {
+    throw UnimplementedError('onSpeakerUpdate() has not been implemented.');
+  }
+
+  /// Tunes the speaker tracker: the current speaker keeps the floor for at
+  /// least [holdMs]; a challenger must out-score them by [hysteresis] for
+  /// [debounceMs]; ended signals halve every [halfLifeMs]; users scoring
+  /// under [minScore] are silent. [audioLevels] adds one-way raw audio
+  /// levels to the signals. Omitted values are left as they are.
+  Future<bool> configureSpeakerTracker(
+      {int? holdMs,
+      int? debounceMs,
+      double? hysteresis,
+      int? halfLifeMs,
+      double? minScore,
+      int? recentCount,
+      bool? audioLevels}) {
+    throw UnimplementedError(
+        'configureSpeakerTracker() has not been implemented.');
+  }
+
+  /// The latest speaker update.
+  Future<ZmSpeakerUpdate?> currentSpeaker() {
+    throw UnimplementedError('currentSpeaker() has not been implemented.');
+  }
+
+  /// How often the SDK named a new active speaker, under `signalChanges`,
+  /// against how often the stable speaker changed, under `switches`.
+  Future<Map<String, int>> speakerStats() {
+    throw UnimplementedError('speakerStats() has not been implemented.');
+  }
+
+  /// Meeting state updates (Windows): a snapshot on joining, then a delta
+  /// with the fields that changed in each short window. Apply them to a
+  /// [ZmMeetingState]; when one does not apply, catch up with
+  /// [meetingStateSince]. Only the status is followed until this is listened
+  /// to or the state is asked for.
+  Stream<ZmMeetingStateUpdate> onMeetingStateUpdate() {
+    throw UnimplementedError(
+        'onMeetingStateUpdate() has not been implemented.');
+  }
+
+  /// Every meeting state field in one call: status, host and co-hosts, lock,
+  /// sharing, recording, chat, captions and connection qualities.
+  Future<ZmMeetingStateUpdate?> meetingState() {
+    throw UnimplementedError('meetingState() has not been implemented.');
+  }
+
+  /// The fields changed after [version], or a snapshot when [version] is 0
+  /// or unknown.
+  Future<ZmMeetingStateUpdate?> meetingStateSince(int version) {
+    throw UnimplementedError('meetingStateSince() has not been implemented.');
+  }
+
+  /// Chat messages, edits and deletions (Windows), as [ZmChatEventKind]
+  /// events. Chat events are followed only while this is listened to.
+  Stream<ZmDomainEvent> onChatEvent() {
+    throw UnimplementedError('onChatEvent() has not been implemented.');
+  }
+
+  /// Closed captions and live transcription messages (Windows), as
+  /// [ZmCaptionEventKind] events. Caption events are followed only while
+  /// this is listened to.
+  Stream<ZmDomainEvent> onCaptionEvent() {
+    throw UnimplementedError('onCaptionEvent() has not been implemented.');
+  }
+
+  /// Every share start, stop, content change and lock (Windows), as
+  /// [ZmSharingEventKind] events; [onMeetingStateUpdate] keeps only the
+  /// latest. Share events are followed only while this or the meeting state
+  /// is listened to.
+  Stream<ZmDomainEvent> onSharingEvent() {
+    throw UnimplementedError('onSharingEvent() has not been implemented.');
+  }
+
+  /// Recording status, privilege and request outcomes (Windows), as
+  /// [ZmRecordingEventKind] events. Recording events are followed only while
+  /// this or the meeting state is listened to.
+  Stream<ZmDomainEvent> onRecordingEvent() {
+    throw UnimplementedError('onRecordingEvent() has not been implemented.');
+  }
+
+  /// Limits [onMeetingStatus] (Windows) to the [ZmMeetingEvent] tags in
+  /// [events]; the rest are neither encoded nor sent, but stay in the
+  /// replay journal for a later listener with a wider subscription. Pass
+  /// null for every event.
+  Future<bool> subscribeMeetingEvents(List<String>? events) {
+    throw UnimplementedError(
+        'subscribeMeetingEvents() has not been implemented.');
+  }
+
+  /// Tunes the native journal of meeting events (Windows) that is replayed,
+  /// oldest first, to every new [onMeetingStatus] listener: at most
+  /// [capacity] events, only those younger than [maxAgeMs] (0 for any age).
+  /// When full, the oldest event makes room unless [dropOldest] is false.
+  /// Omitted values are left as they are.
+  Future<bool> configureMeetingEventReplay(
+      {int? capacity, int? maxAgeMs, bool? dropOldest}) {
+    throw UnimplementedError(
+        'configureMeetingEventReplay() has not been implemented.');
+  }
+
+  /// How many meeting events the journal holds, under `buffered`, its
+  /// `capacity`, and how many it has dropped for lack of room, under
+  /// `dropped`.
+  Future<Map<String, int>> meetingEventStats() {
+    throw UnimplementedError('meetingEventStats() has not been implemented.');
+  }
+
+  /// Journal every SDK callback the plugin receives to [path] (Windows), in
+  /// a compact binary form for replaying with tools/callback_replay. Only
+  /// events the plugin already follows are recorded. Writes are batched
+  /// and synced every [flushInterval]; past [maxQueuedBytes] waiting to be
+  /// written, callbacks are dropped.
+  Future<bool> startCallbackJournal(String path,
+      {Duration flushInterval = const Duration(seconds: 1),
+      int? maxQueuedBytes}) {
+    throw UnimplementedError(
+        'startCallbackJournal() has not been implemented.');
+  }
+
+  /// Stop journaling, flushing what is queued, and return the final stats.
+  Future<ZmCallbackJournalStats> stopCallbackJournal() {
+    throw UnimplementedError('stopCallbackJournal() has not been implemented.');
+  }
+
+  Future<ZmCallbackJournalStats> callbackJournalStats() {
+    throw UnimplementedError(
+        'callbackJournalStats() has not been implemented.');
+  }
 }
@@ -1,4 +1,5 @@
 import 'dart:async';
+import 'dart:typed_data';
 import 'package:flutter/services.dart';
 import 'package:flutter_zoom_sdk/zoom_platform_view.dart';
 
@@ -14,6 +15,39 @@ class ZoomView extends ZoomPlatform {
   final EventChannel micChannelStream =
       const EventChannel('flutter_zoom_sdk/microphone/stream');
 
+  final EventChannel pcmChannelStream =
+      const EventChannel('flutter_zoom_sdk/pcm_stream');
+
+  final EventChannel audioAnalysisChannelStream =
+      const EventChannel('flutter_zoom_sdk/audio_analysis');
+
+  final EventChannel videoHealthChannelStream =
+      const EventChannel('flutter_zoom_sdk/video_health');
+
+  final EventChannel rosterChannelStream =
+      const EventChannel('flutter_zoom_sdk/roster');
+
+  final EventChannel avStatusChannelStream =
+      const EventChannel('flutter_zoom_sdk/av_status');
+
+  final EventChannel speakerChannelStream =
+      const EventChannel('flutter_zoom_sdk/speaker');
+
+  final EventChannel meetingStateChannelStream =
+      const EventChannel('flutter_zoom_sdk/meeting_state');
+
+  final EventChannel chatChannelStream =
+      const EventChannel('flutter_zoom_sdk/chat');
+
+  final EventChannel captionChannelStream =
+      const EventChannel('flutter_zoom_sdk/captions');
+
+  final EventChannel sharingChannelStream =
+      const EventChannel('flutter_zoom_sdk/sharing');
+
+  final EventChannel recordingChannelStream =
+      const EventChannel('flutter_zoom_sdk/recording');
+
   /// The event channel used to interact with the native platform init function
   @override
   Future<List> initZoom(ZoomOptions options, {bool alreadyInit = false}) async {
@@ -220,4 +254,653 @@ class ZoomView extends ZoomPlatform {
         .receiveBroadcastStream()
         .map((event) => ZmAudioStatus.values[event]);
   }
+
+  @override
+  Stream<PcmChunk> onPcmStream() {
+    return pcmChannelStream
+        .receiveBroadcastStream()
+        .map(PcmChunk.tryParse)
+        .where((chunk) => chunk != null)
+        .cast<PcmChunk>();
+  }
+
+  @override
+  Future<bool> subscribePcmStream(ZmAudioStreamSelector stream) {
+    return channel
+        .invokeMethod<bool>('pcm_stream_subscribe', stream.toMap())
+        .then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> unsubscribePcmStream(ZmAudioStreamSelector stream) {
+    return channel
+        .invokeMethod<bool>('pcm_stream_unsubscribe', stream.toMap())
+        .then((value) => value ?? false);
+  }
+
+  @override
+  Future<Duration> setPcmBatchDuration(Duration duration) {
+    return channel.invokeMethod<int>('pcm_stream_set_batch_duration', {
+      'milliseconds': duration.inMilliseconds,
+    }).then((value) => Duration(milliseconds: value ?? 0));
+  }
+
+  @override
+  Future<Map<int, String>> interpreterLanguages() {
+    return channel
+        .invokeMapMethod<int, String>('interpreter_languages')
+        .then((value) => value ?? <int, String>{});
+  }
+
+  @override
+  Future<bool> startAudioRecording(
+      String directory, List<ZmAudioStreamSelector> streams) {
+    return channel.invokeMethod<bool>('audio_recorder_start', {
+      'directory': directory,
+      'streams': streams.map((stream) => stream.toMap()).toList(),
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<List<String>> stopAudioRecording() {
+    return channel
+        .invokeListMethod<String>('audio_recorder_stop')
+        .then((value) => value ?? <String>[]);
+  }
+
+  @override
+  Future<int> createAudioMix(List<ZmAudioMixInput> inputs,
+      {int sampleRate = 32000}) {
+    return channel.invokeMethod<int>('audio_mixer_create', {
+      'sampleRate': sampleRate,
+      'inputs': inputs.map((input) => input.toMap()).toList(),
+    }).then((value) => value ?? 0);
+  }
+
+  @override
+  Future<bool> setAudioMixInputs(int mixId, List<ZmAudioMixInput> inputs) {
+    return channel.invokeMethod<bool>('audio_mixer_set_inputs', {
+      'mixId': mixId,
+      'inputs': inputs.map((input) => input.toMap()).toList(),
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> destroyAudioMix(int mixId) {
+    return channel.invokeMethod<bool>('audio_mixer_destroy', {
+      'mixId': mixId,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<ZmAudioMixStats?> audioMixStats(int mixId) {
+    return channel.invokeMapMethod<String, int>('audio_mixer_stats', {
+      'mixId': mixId,
+    }).then((value) => value == null ? null : ZmAudioMixStats.fromMap(value));
+  }
+
+  @override
+  Stream<AudioAnalysisFrame> onAudioAnalysis() {
+    return audioAnalysisChannelStream
+        .receiveBroadcastStream()
+        .map(AudioAnalysisFrame.tryParse)
+        .where((frame) => frame != null)
+        .cast<AudioAnalysisFrame>();
+  }
+
+  @override
+  Future<bool> subscribeAudioAnalysis(ZmAudioStreamSelector stream,
+      {int fftSize = 2048,
+      int bands = 32,
+      double minFrequency = 40,
+      double maxFrequency = 16000,
+      Duration interval = const Duration(milliseconds: 50)}) {
+    return channel.invokeMethod<bool>('audio_analysis_subscribe', {
+      ...stream.toMap(),
+      'fftSize': fftSize,
+      'bands': bands,
+      'minFrequency': minFrequency,
+      'maxFrequency': maxFrequency,
+      'intervalMs': interval.inMilliseconds,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> unsubscribeAudioAnalysis(ZmAudioStreamSelector stream) {
+    return channel
+        .invokeMethod<bool>('audio_analysis_unsubscribe', stream.toMap())
+        .then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> startShareAudioFile(String path, {bool loop = false}) {
+    return channel.invokeMethod<bool>('share_audio_start', {
+      'path': path,
+      'loop': loop,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> startShareAudioStream(
+      {required int sampleRate, required int channels}) {
+    return channel.invokeMethod<bool>('share_audio_start', {
+      'sampleRate': sampleRate,
+      'channels': channels,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<int> pushShareAudio(Uint8List samples) {
+    return channel.invokeMethod<int>('share_audio_push', {
+      'samples': samples,
+    }).then((value) => value ?? 0);
+  }
+
+  @override
+  Future<bool> endShareAudioStream() {
+    return channel
+        .invokeMethod<bool>('share_audio_end')
+        .then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> stopShareAudio() {
+    return channel
+        .invokeMethod<bool>('share_audio_stop')
+        .then((value) => value ?? false);
+  }
+
+  @override
+  Future<ZmShareAudioStats> shareAudioStats() {
+    return channel
+        .invokeMapMethod<String, dynamic>('share_audio_stats')
+        .then((value) => ZmShareAudioStats.fromMap(value ?? {}));
+  }
+
+  @override
+  Future<bool> startVideoSourceFile(String path, {bool loop = false}) {
+    return channel.invokeMethod<bool>('video_source_start', {
+      'path': path,
+      'loop': loop,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> startVideoSourceStream(
+      {required int width, required int height, double? fps}) {
+    return channel.invokeMethod<bool>('video_source_start', {
+      'width': width,
+      'height': height,
+      if (fps != null) 'fps': fps,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> pushVideoFrame(Uint8List data,
+      {required int width,
+      required int height,
+      bool fullRange = false,
+      ZmVideoPixelFormat format = ZmVideoPixelFormat.i420,
+      int? stride}) {
+    return channel.invokeMethod<bool>('video_source_push', {
+      'width': width,
+      'height': height,
+      'data': data,
+      'fullRange': fullRange,
+      'format': format.name,
+      if (stride != null) 'stride': stride,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> endVideoSourceStream() {
+    return channel
+        .invokeMethod<bool>('video_source_end')
+        .then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> stopVideoSource() {
+    return channel
+        .invokeMethod<bool>('video_source_stop')
+        .then((value) => value ?? false);
+  }
+
+  @override
+  Future<ZmVideoSourceStats> videoSourceStats() {
+    return channel
+        .invokeMapMethod<String, dynamic>('video_source_stats')
+        .then((value) => ZmVideoSourceStats.fromMap(value ?? {}));
+  }
+
+  @override
+  Future<bool> setVideoSourceBudget(
+      {int? cpuPercent, int? maxWidth, int? maxHeight, int? maxFps}) {
+    return channel.invokeMethod<bool>('video_source_budget', {
+      if (cpuPercent != null) 'cpuPercent': cpuPercent,
+      if (maxWidth != null) 'maxWidth': maxWidth,
+      if (maxHeight != null) 'maxHeight': maxHeight,
+      if (maxFps != null) 'maxFps': maxFps,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<List<ZmVideoCapability>> videoSourceCapabilities() {
+    return channel
+        .invokeListMethod<Map>('video_source_capabilities')
+        .then((value) => (value ?? [])
+            .map((capability) => ZmVideoCapability.fromMap(capability))
+            .toList());
+  }
+
+  @override
+  Future<bool> setVideoFilters(List<ZmVideoFilter> filters, {int? budgetUs}) {
+    return channel.invokeMethod<bool>('video_filter_set', {
+      'filters': filters.map((filter) => filter.toMap()).toList(),
+      if (budgetUs != null) 'budgetUs': budgetUs,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> clearVideoFilters() {
+    return channel
+        .invokeMethod<bool>('video_filter_clear')
+        .then((value) => value ?? false);
+  }
+
+  @override
+  Future<ZmVideoFilterStats> videoFilterStats() {
+    return channel
+        .invokeMapMethod<String, dynamic>('video_filter_stats')
+        .then((value) => ZmVideoFilterStats.fromMap(value ?? {}));
+  }
+
+  @override
+  Future<bool> startShareSource({int maxFps = 15, int keepAliveFps = 1}) {
+    return channel.invokeMethod<bool>('share_source_start', {
+      'maxFps': maxFps,
+      'keepAliveFps': keepAliveFps,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> pushShareFrame(Uint8List data,
+      {required int width,
+      required int height,
+      ZmVideoPixelFormat format = ZmVideoPixelFormat.rgba,
+      int? stride}) {
+    return channel.invokeMethod<bool>('share_source_push', {
+      'data': data,
+      'width': width,
+      'height': height,
+      'format': format.name,
+      if (stride != null) 'stride': stride,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> stopShareSource() {
+    return channel
+        .invokeMethod<bool>('share_source_stop')
+        .then((value) => value ?? false);
+  }
+
+  @override
+  Future<ZmShareSourceStats> shareSourceStats() {
+    return channel
+        .invokeMapMethod<String, dynamic>('share_source_stats')
+        .then((value) => ZmShareSourceStats.fromMap(value ?? {}));
+  }
+
+  @override
+  Stream<VideoHealthReport> onVideoHealth() {
+    return videoHealthChannelStream
+        .receiveBroadcastStream()
+        .map(VideoHealthReport.tryParse)
+        .where((report) => report != null)
+        .cast<VideoHealthReport>();
+  }
+
+  @override
+  Future<bool> subscribeVideoHealth(int userId,
+      {bool share = false, int resolution = 180}) {
+    return channel.invokeMethod<bool>('video_health_subscribe', {
+      'userId': userId,
+      'type': share ? 'share' : 'video',
+      'resolution': resolution,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> unsubscribeVideoHealth(int userId) {
+    return channel.invokeMethod<bool>('video_health_unsubscribe', {
+      'userId': userId,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<void> setVideoHealthInterval(Duration interval) {
+    return channel.invokeMethod<void>('video_health_interval', {
+      'intervalMs': interval.inMilliseconds,
+    });
+  }
+
+  @override
+  Future<ZmVideoHealthStats?> videoHealthStats(int userId) {
+    return channel.invokeMapMethod<String, dynamic>('video_health_stats', {
+      'userId': userId,
+    }).then(
+        (value) => value == null ? null : ZmVideoHealthStats.fromMap(value));
+  }
+
+  @override
+  Future<bool> startRawArchive(String directory,
+      {List<ZmAudioStreamSelector> streams = const [],
+      Duration segmentDuration = const Duration(seconds: 60),
+      Duration flushInterval = const Duration(seconds: 1),
+      int? maxBytes,
+      int? maxSegments}) {
+    return channel.invokeMethod<bool>('raw_archive_start', {
+      'directory': directory,
+      'streams': streams.map((stream) => stream.toMap()).toList(),
+      'segmentSeconds': segmentDuration.inSeconds,
+      'flushMs': flushInterval.inMilliseconds,
+      if (maxBytes != null) 'maxBytes': maxBytes,
+      if (maxSegments != null) 'maxSegments': maxSegments,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> addRawArchiveVideo(int userId,
+      {bool share = false, int resolution = 360}) {
+    return channel.invokeMethod<bool>('raw_archive_add_video', {
+      'userId': userId,
+      'type': share ? 'share' : 'video',
+      'resolution': resolution,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> removeRawArchiveVideo(int userId) {
+    return channel.invokeMethod<bool>('raw_archive_remove_video', {
+      'userId': userId,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<List<String>> stopRawArchive() {
+    return channel
+        .invokeListMethod<String>('raw_archive_stop')
+        .then((value) => value ?? <String>[]);
+  }
+
+  @override
+  Future<ZmRawArchiveStats> rawArchiveStats() {
+    return channel
+        .invokeMapMethod<String, dynamic>('raw_archive_stats')
+        .then((value) => ZmRawArchiveStats.fromMap(value ?? {}));
+  }
+
+  @override
+  Future<int?> startPictureInPicture({int? userId, int resolution = 180}) {
+    return channel.invokeMethod<int>('pip_start', {
+      if (userId != null) 'userId': userId,
+      'resolution': resolution,
+    });
+  }
+
+  @override
+  Future<bool> stopPictureInPicture() {
+    return channel
+        .invokeMethod<bool>('pip_stop')
+        .then((value) => value ?? false);
+  }
+
+  @override
+  Future<ZmPipState?> pictureInPictureState() {
+    return channel
+        .invokeMapMethod<String, dynamic>('pip_state')
+        .then((value) => value == null ? null : ZmPipState.fromMap(value));
+  }
+
+  @override
+  Future<int> participantCount() {
+    return channel
+        .invokeMethod<int>('participants_count')
+        .then((value) => value ?? 0);
+  }
+
+  @override
+  Future<ZmParticipant?> participant(int userId) {
+    return channel.invokeMapMethod<String, dynamic>('participants_get', {
+      'userId': userId,
+    }).then((value) => value == null ? null : ZmParticipant.fromMap(value));
+  }
+
+  @override
+  Future<List<int>> participantIds() {
+    return channel
+        .invokeListMethod<int>('participants_ids')
+        .then((value) => value ?? <int>[]);
+  }
+
+  @override
+  Future<ZmParticipantPage> queryParticipants(
+      {String prefix = '',
+      bool handRaised = false,
+      bool inWaitingRoom = false,
+      bool hostOrCoHost = false,
+      bool purePhone = false,
+      bool bot = false,
+      bool descending = false,
+      int offset = 0,
+      int limit = 50}) {
+    return channel.invokeMapMethod<String, dynamic>('participants_query', {
+      'prefix': prefix,
+      'handRaised': handRaised,
+      'inWaitingRoom': inWaitingRoom,
+      'hostOrCoHost': hostOrCoHost,
+      'purePhone': purePhone,
+      'bot': bot,
+      'descending': descending,
+      'offset': offset,
+      'limit': limit,
+    }).then((value) => ZmParticipantPage.fromMap(value ?? {}));
+  }
+
+  @override
+  Stream<ZmRosterUpdate> onRosterUpdate() {
+    return rosterChannelStream
+        .receiveBroadcastStream()
+        .map(ZmRosterUpdate.tryParse)
+        .where((update) => update != null)
+        .cast<ZmRosterUpdate>();
+  }
+
+  @override
+  Future<ZmRosterUpdate?> rosterSince(int version) {
+    return channel.invokeMethod<Uint8List>('participants_roster_since', {
+      'version': version,
+    }).then(ZmRosterUpdate.tryParse);
+  }
+
+  @override
+  Stream<ZmAvStatusUpdate> onAvStatusUpdate() {
+    return avStatusChannelStream
+        .receiveBroadcastStream()
+        .map(ZmAvStatusUpdate.tryParse)
+        .where((update) => update != null)
+        .cast<ZmAvStatusUpdate>();
+  }
+
+  @override
+  Future<ZmAvStatusUpdate?> avStatusSnapshot() {
+    return channel
+        .invokeMethod<Uint8List>('participants_av_snapshot')
+        .then(ZmAvStatusUpdate.tryParse);
+  }
+
+  @override
+  Future<Map<String, int>> avStatusCounts() {
+    return channel
+        .invokeMapMethod<String, int>('participants_av_counts')
+        .then((value) => value ?? {});
+  }
+
+  @override
+  Stream<ZmSpeakerUpdate> onSpeakerUpdate() {
+    return speakerChannelStream
+        .receiveBroadcastStream()
+        .map(ZmSpeakerUpdate.tryParse)
+        .where((update) => update != null)
+        .cast<ZmSpeakerUpdate>();
+  }
+
+  @override
+  Future<bool> configureSpeakerTracker(
+      {int? holdMs,
+      int? debounceMs,
+      double? hysteresis,
+      int? halfLifeMs,
+      double? minScore,
+      int? recentCount,
+      bool? audioLevels}) {
+    final arguments = <String, dynamic>{
+      if (holdMs != null) 'holdMs': holdMs,
+      if (debounceMs != null) 'debounceMs': debounceMs,
+      if (hysteresis != null) 'hysteresis': hysteresis,
+      if (halfLifeMs != null) 'halfLifeMs': halfLifeMs,
+      if (minScore != null) 'minScore': minScore,
+      if (recentCount != null) 'recentCount': recentCount,
+      if (audioLevels != null) 'audioLevels': audioLevels,
+    };
+    return channel
+        .invokeMethod<bool>('speaker_configure', arguments)
+        .then((value) => value ?? false);
+  }
+
+  @override
+  Future<ZmSpeakerUpdate?> currentSpeaker() {
+    return channel
+        .invokeMethod<Uint8List>('speaker_current')
+        .then(ZmSpeakerUpdate.tryParse);
+  }
+
+  @override
+  Future<Map<String, int>> speakerStats() {
+    return channel
+        .invokeMapMethod<String, int>('speaker_stats')
+        .then((value) => value ?? {});
+  }
+
+  @override
+  Stream<ZmMeetingStateUpdate> onMeetingStateUpdate() {
+    return meetingStateChannelStream
+        .receiveBroadcastStream()
+        .map(ZmMeetingStateUpdate.tryParse)
+        .where((update) => update != null)
+        .cast<ZmMeetingStateUpdate>();
+  }
+
+  @override
+  Future<ZmMeetingStateUpdate?> meetingState() {
+    return channel
+        .invokeMethod<Uint8List>('meeting_state_get')
+        .then(ZmMeetingStateUpdate.tryParse);
+  }
+
+  @override
+  Future<ZmMeetingStateUpdate?> meetingStateSince(int version) {
+    return channel.invokeMethod<Uint8List>('meeting_state_since', {
+      'version': version,
+    }).then(ZmMeetingStateUpdate.tryParse);
+  }
+
+  @override
+  Stream<ZmDomainEvent> onChatEvent() {
+    return chatChannelStream
+        .receiveBroadcastStream()
+        .map(ZmDomainEvent.tryParse)
+        .where((event) => event != null)
+        .cast<ZmDomainEvent>();
+  }
+
+  @override
+  Stream<ZmDomainEvent> onCaptionEvent() {
+    return captionChannelStream
+        .receiveBroadcastStream()
+        .map(ZmDomainEvent.tryParse)
+        .where((event) => event != null)
+        .cast<ZmDomainEvent>();
+  }
+
+  @override
+  Stream<ZmDomainEvent> onSharingEvent() {
+    return sharingChannelStream
+        .receiveBroadcastStream()
+        .map(ZmDomainEvent.tryParse)
+        .where((event) => event != null)
+        .cast<ZmDomainEvent>();
+  }
+
+  @override
+  Stream<ZmDomainEvent> onRecordingEvent() {
+    return recordingChannelStream
+        .receiveBroadcastStream()
+        .map(ZmDomainEvent.tryParse)
+        .where((event) => event != null)
+        .cast<ZmDomainEvent>();
+  }
+
+  @override
+  Future<bool> subscribeMeetingEvents(List<String>? events) {
+    return channel.invokeMethod<bool>('meeting_events_subscribe', {
+      'events': events,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<bool> configureMeetingEventReplay(
+      {int? capacity, int? maxAgeMs, bool? dropOldest}) {
+    final arguments = <String, dynamic>{
+      if (capacity != null) 'capacity': capacity,
+      if (maxAgeMs != null) 'maxAgeMs': maxAgeMs,
+      if (dropOldest != null) 'dropOldest': dropOldest,
+    };
+    return channel
+        .invokeMethod<bool>('meeting_events_replay', arguments)
+        .then((value) => value ?? false);
+  }
+
+  @override
+  Future<Map<String, int>> meetingEventStats() {
+    return channel
+        .invokeMapMethod<String, int>('meeting_events_stats')
+        .then((value) => value ?? {});
+  }
+
+  @override
+  Future<bool> startCallbackJournal(String path,
+      {Duration flushInterval = const Duration(seconds: 1),
+      int? maxQueuedBytes}) {
+    return channel.invokeMethod<bool>('callback_journal_start', {
+      'path': path,
+      'flushMs': flushInterval.inMilliseconds,
+      if (maxQueuedBytes != null) 'maxQueuedBytes': maxQueuedBytes,
+    }).then((value) => value ?? false);
+  }
+
+  @override
+  Future<ZmCallbackJournalStats> stopCallbackJournal() {
+    return channel
+        .invokeMapMethod<String, dynamic>('callback_journal_stop')
+        .then((value) => ZmCallbackJournalStats.fromMap(value ?? {}));
+  }
+
+  @override
+  Future<ZmCallbackJournalStats> callbackJournalStats() {
+    return channel
+        .invokeMapMethod<String, dynamic>('callback_journal_stats')
+        .then((value) => ZmCallbackJournalStats.fromMap(value ?? {}));
+  }
 }
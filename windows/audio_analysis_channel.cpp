@@ -0,0 +1,75 @@
+#include "audio_analysis_channel.h"
+
+#include <string>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	namespace {
+		constexpr char kChannelName[] = "flutter_zoom_sdk/audio_analysis";
+
+		constexpr size_t kMaxPendingFrames = 128;
+	}
+
+	AudioAnalysisChannel::AudioAnalysisChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, AudioRawDataHub& hub, WorkerPool& pool)
+		: hub_(hub),
+		events_(messenger, dispatcher, kChannelName, kMaxPendingFrames),
+		analyzer_(hub, pool, [this](PooledBuffer frame) { events_.send(std::move(frame)); }, BinaryEventChannel::kEnvelopePrefix) {}
+
+	AudioAnalysisChannel::~AudioAnalysisChannel() {
+		analyzer_.unsubscribeAll();
+	}
+
+	bool AudioAnalysisChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		if (method.compare("audio_analysis_subscribe") == 0) {
+			AudioStreamKey key;
+			if (!arguments || !AudioStreamKeyFromArguments(*arguments, hub_.languages(), key)) {
+				result->Error("INVALID_ARGUMENTS", "Expected an audio stream selector");
+				return true;
+			}
+
+			AudioAnalysisConfig config;
+			int64_t value = 0;
+			double frequency = 0.0;
+			if (IntArgument(*arguments, "fftSize", value) && value > 0) {
+				config.fftSize = static_cast<size_t>(value);
+			}
+			if (IntArgument(*arguments, "bands", value) && value > 0) {
+				config.bands = static_cast<size_t>(value);
+			}
+			if (IntArgument(*arguments, "intervalMs", value)) {
+				config.interval = std::chrono::milliseconds(value);
+			}
+			if (DoubleArgument(*arguments, "minFrequency", frequency)) {
+				config.minFrequency = static_cast<float>(frequency);
+			}
+			if (DoubleArgument(*arguments, "maxFrequency", frequency)) {
+				config.maxFrequency = static_cast<float>(frequency);
+			}
+
+			result->Success(EncodableValue(analyzer_.subscribe(key, config)));
+			return true;
+		}
+		else if (method.compare("audio_analysis_unsubscribe") == 0) {
+			AudioStreamKey key;
+			if (!arguments || !AudioStreamKeyFromArguments(*arguments, hub_.languages(), key)) {
+				result->Error("INVALID_ARGUMENTS", "Expected an audio stream selector");
+				return true;
+			}
+
+			result->Success(EncodableValue(analyzer_.unsubscribe(key)));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
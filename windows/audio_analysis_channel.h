@@ -0,0 +1,45 @@
+#ifndef FLUTTER_PLUGIN_AUDIO_ANALYSIS_CHANNEL_H_
+#define FLUTTER_PLUGIN_AUDIO_ANALYSIS_CHANNEL_H_
+
+#include <flutter/binary_messenger.h>
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <memory>
+
+#include "binary_event_channel.h"
+#include "media/audio_analyzer.h"
+#include "media/audio_raw_data_hub.h"
+#include "media/worker_pool.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Dart side of AudioAnalyzer. Frames go out on the
+	// "flutter_zoom_sdk/audio_analysis" event channel as Uint8List events.
+	class AudioAnalysisChannel {
+	public:
+		AudioAnalysisChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, AudioRawDataHub& hub, WorkerPool& pool);
+
+		~AudioAnalysisChannel();
+
+		AudioAnalysisChannel(const AudioAnalysisChannel&) = delete;
+		AudioAnalysisChannel& operator=(const AudioAnalysisChannel&) = delete;
+
+		// Handles the audio_analysis_* methods. Returns false, leaving result
+		// untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+	private:
+		AudioRawDataHub& hub_;
+		BinaryEventChannel events_;
+
+		// Declared last so its tasks finish before the members above go away.
+		AudioAnalyzer analyzer_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_AUDIO_ANALYSIS_CHANNEL_H_
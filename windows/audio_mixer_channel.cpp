@@ -0,0 +1,118 @@
+#include "audio_mixer_channel.h"
+
+#include <string>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableList;
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	AudioMixerChannel::AudioMixerChannel(AudioRawDataHub& hub) : hub_(hub), nextMixId_(1) {}
+
+	bool AudioMixerChannel::parseInputs(const EncodableMap& arguments, std::vector<AudioMixInput>& inputs) {
+		auto itInputs = arguments.find(EncodableValue("inputs"));
+		if (itInputs == arguments.end() || !std::holds_alternative<EncodableList>(itInputs->second)) {
+			return false;
+		}
+
+		for (const auto& item : std::get<EncodableList>(itInputs->second)) {
+			if (!std::holds_alternative<EncodableMap>(item)) {
+				return false;
+			}
+
+			const auto& map = std::get<EncodableMap>(item);
+			AudioMixInput input;
+			if (!AudioStreamKeyFromArguments(map, hub_.languages(), input.key) || input.key.isWildcard()) {
+				return false;
+			}
+
+			double gain = 1.0;
+			if (DoubleArgument(map, "gain", gain)) {
+				input.gain = static_cast<float>(gain);
+			}
+			inputs.push_back(input);
+		}
+
+		return true;
+	}
+
+	bool AudioMixerChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		if (method.compare("audio_mixer_create") == 0) {
+			std::vector<AudioMixInput> inputs;
+			if (!arguments || !parseInputs(*arguments, inputs)) {
+				result->Error("INVALID_ARGUMENTS", "Expected inputs with a user, language or mix each");
+				return true;
+			}
+
+			AudioMixerConfig config;
+			int64_t value = 0;
+			if (IntArgument(*arguments, "sampleRate", value) && value >= 8000 && value <= 48000) {
+				config.sampleRate = static_cast<uint32_t>(value);
+			}
+			if (IntArgument(*arguments, "jitterMs", value) && value >= 0 && value <= 1000) {
+				config.jitter = std::chrono::milliseconds(value);
+			}
+
+			const uint32_t mixId = nextMixId_++;
+			auto mixer = std::make_unique<AudioMixer>(hub_, mixId, config);
+			mixer->setInputs(inputs);
+			mixers_[mixId] = std::move(mixer);
+
+			result->Success(EncodableValue(static_cast<int64_t>(mixId)));
+			return true;
+		}
+
+		int64_t mixId = 0;
+		const bool hasMix = arguments && IntArgument(*arguments, "mixId", mixId);
+		auto it = hasMix ? mixers_.find(static_cast<uint32_t>(mixId)) : mixers_.end();
+
+		if (method.compare("audio_mixer_set_inputs") == 0) {
+			std::vector<AudioMixInput> inputs;
+			if (it == mixers_.end() || !parseInputs(*arguments, inputs)) {
+				result->Error("INVALID_ARGUMENTS", "Expected an existing mixId and inputs");
+				return true;
+			}
+
+			it->second->setInputs(inputs);
+
+			result->Success(EncodableValue(true));
+			return true;
+		}
+		else if (method.compare("audio_mixer_destroy") == 0) {
+			bool res = it != mixers_.end();
+			if (res) {
+				mixers_.erase(it);
+			}
+
+			result->Success(EncodableValue(res));
+			return true;
+		}
+		else if (method.compare("audio_mixer_stats") == 0) {
+			if (it == mixers_.end()) {
+				result->Success();
+				return true;
+			}
+
+			const AudioMixerStats stats = it->second->stats();
+			EncodableMap map;
+			map[EncodableValue("inputs")] = EncodableValue(static_cast<int64_t>(stats.inputs));
+			map[EncodableValue("blocks")] = EncodableValue(static_cast<int64_t>(stats.blocks));
+			map[EncodableValue("lateSamples")] = EncodableValue(static_cast<int64_t>(stats.lateSamples));
+			map[EncodableValue("droppedSamples")] = EncodableValue(static_cast<int64_t>(stats.droppedSamples));
+			map[EncodableValue("rateMismatches")] = EncodableValue(static_cast<int64_t>(stats.rateMismatches));
+
+			result->Success(EncodableValue(map));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
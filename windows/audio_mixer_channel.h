@@ -0,0 +1,42 @@
+#ifndef FLUTTER_PLUGIN_AUDIO_MIXER_CHANNEL_H_
+#define FLUTTER_PLUGIN_AUDIO_MIXER_CHANNEL_H_
+
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "media/audio_mixer.h"
+#include "media/audio_raw_data_hub.h"
+
+namespace flutter_zoom_sdk {
+
+	// Dart side of AudioMixer: creates named sub-mixes whose output is the
+	// stream selector {"kind": "mix", "mixId": id}.
+	class AudioMixerChannel {
+	public:
+		explicit AudioMixerChannel(AudioRawDataHub& hub);
+
+		AudioMixerChannel(const AudioMixerChannel&) = delete;
+		AudioMixerChannel& operator=(const AudioMixerChannel&) = delete;
+
+		// Handles the audio_mixer_* methods. Returns false, leaving result
+		// untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+	private:
+		bool parseInputs(const flutter::EncodableMap& arguments, std::vector<AudioMixInput>& inputs);
+
+		AudioRawDataHub& hub_;
+		std::map<uint32_t, std::unique_ptr<AudioMixer>> mixers_;
+		uint32_t nextMixId_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_AUDIO_MIXER_CHANNEL_H_
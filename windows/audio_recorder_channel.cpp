@@ -0,0 +1,60 @@
+#include "audio_recorder_channel.h"
+
+#include <string>
+#include <vector>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableList;
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	AudioRecorderChannel::AudioRecorderChannel(AudioRawDataHub& hub) : hub_(hub), recorder_(hub) {}
+
+	bool AudioRecorderChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		if (method.compare("audio_recorder_start") == 0) {
+			std::string directory;
+			if (!arguments || !StringArgument(*arguments, "directory", directory)) {
+				result->Error("INVALID_ARGUMENTS", "Expected directory");
+				return true;
+			}
+
+			std::vector<AudioStreamKey> streams;
+			auto itStreams = arguments->find(EncodableValue("streams"));
+			if (itStreams != arguments->end() && std::holds_alternative<EncodableList>(itStreams->second)) {
+				for (const auto& item : std::get<EncodableList>(itStreams->second)) {
+					AudioStreamKey key;
+					if (!std::holds_alternative<EncodableMap>(item) ||
+						!AudioStreamKeyFromArguments(std::get<EncodableMap>(item), hub_.languages(), key)) {
+						result->Error("INVALID_ARGUMENTS", "Expected audio stream selectors");
+						return true;
+					}
+					streams.push_back(key);
+				}
+			}
+
+			bool res = recorder_.start(directory, streams);
+
+			result->Success(EncodableValue(res));
+			return true;
+		}
+		else if (method.compare("audio_recorder_stop") == 0) {
+			EncodableList files;
+			for (const auto& path : recorder_.stop()) {
+				files.push_back(EncodableValue(path));
+			}
+
+			result->Success(EncodableValue(files));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
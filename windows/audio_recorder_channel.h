@@ -0,0 +1,35 @@
+#ifndef FLUTTER_PLUGIN_AUDIO_RECORDER_CHANNEL_H_
+#define FLUTTER_PLUGIN_AUDIO_RECORDER_CHANNEL_H_
+
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <memory>
+
+#include "media/audio_raw_data_hub.h"
+#include "media/audio_recorder.h"
+
+namespace flutter_zoom_sdk {
+
+	// Dart side of AudioRecorder, on the main plugin channel.
+	class AudioRecorderChannel {
+	public:
+		explicit AudioRecorderChannel(AudioRawDataHub& hub);
+
+		AudioRecorderChannel(const AudioRecorderChannel&) = delete;
+		AudioRecorderChannel& operator=(const AudioRecorderChannel&) = delete;
+
+		// Handles the audio_recorder_* methods. Returns false, leaving result
+		// untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+	private:
+		AudioRawDataHub& hub_;
+		AudioRecorder recorder_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_AUDIO_RECORDER_CHANNEL_H_
@@ -0,0 +1,124 @@
+#include "binary_event_channel.h"
+
+#include <flutter/event_stream_handler_functions.h>
+#include <flutter/standard_method_codec.h>
+
+#include <cstring>
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableValue;
+
+	namespace {
+		constexpr uint8_t kEnvelopeSuccess = 0;
+		constexpr uint8_t kStandardCodecUint8List = 8;
+
+		// Writes the StandardMethodCodec success envelope for a Uint8List of
+		// payloadSize bytes so that it ends exactly at kEnvelopePrefix. Returns
+		// the offset the message starts at.
+		size_t writeEnvelope(uint8_t* buffer, size_t payloadSize) {
+			uint8_t size[5];
+			size_t sizeBytes;
+			if (payloadSize < 254) {
+				size[0] = static_cast<uint8_t>(payloadSize);
+				sizeBytes = 1;
+			}
+			else if (payloadSize <= 0xffff) {
+				const uint16_t value = static_cast<uint16_t>(payloadSize);
+				size[0] = 254;
+				std::memcpy(size + 1, &value, sizeof(value));
+				sizeBytes = 3;
+			}
+			else {
+				const uint32_t value = static_cast<uint32_t>(payloadSize);
+				size[0] = 255;
+				std::memcpy(size + 1, &value, sizeof(value));
+				sizeBytes = 5;
+			}
+
+			const size_t start = BinaryEventChannel::kEnvelopePrefix - 2 - sizeBytes;
+			buffer[start] = kEnvelopeSuccess;
+			buffer[start + 1] = kStandardCodecUint8List;
+			std::memcpy(buffer + start + 2, size, sizeBytes);
+			return start;
+		}
+	}
+
+	BinaryEventChannel::BinaryEventChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, std::string name, size_t maxPending,
+		ListenChanged listenChanged)
+		: messenger_(messenger),
+		dispatcher_(dispatcher),
+		name_(std::move(name)),
+		maxPending_(maxPending),
+		listenChanged_(std::move(listenChanged)),
+		drainPosted_(false),
+		listening_(false) {
+		eventChannel_ = std::make_unique<flutter::EventChannel<EncodableValue>>(
+			messenger, name_, &flutter::StandardMethodCodec::GetInstance());
+
+		eventChannel_->SetStreamHandler(
+			std::make_unique<flutter::StreamHandlerFunctions<>>(
+				[this](auto arguments, auto events) {
+			// Events are written to the messenger directly; the sink is not used.
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				listening_ = true;
+			}
+			if (listenChanged_) {
+				listenChanged_(true);
+			}
+			return nullptr;
+		},
+				[this](auto arguments) {
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				listening_ = false;
+				pending_.clear();
+			}
+			if (listenChanged_) {
+				listenChanged_(false);
+			}
+			return nullptr;
+		}));
+	}
+
+	BinaryEventChannel::~BinaryEventChannel() {
+		eventChannel_->SetStreamHandler(nullptr);
+	}
+
+	void BinaryEventChannel::send(PooledBuffer buffer) {
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		if (!listening_) {
+			return;
+		}
+
+		if (pending_.size() >= maxPending_) {
+			pending_.pop_front();
+		}
+		pending_.push_back(std::move(buffer));
+
+		if (!drainPosted_) {
+			drainPosted_ = true;
+			dispatcher_.post([this]() { drain(); });
+		}
+	}
+
+	void BinaryEventChannel::drain() {
+		std::deque<PooledBuffer> buffers;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			buffers.swap(pending_);
+			drainPosted_ = false;
+		}
+
+		for (auto& buffer : buffers) {
+			const size_t payloadSize = buffer->size() - kEnvelopePrefix;
+			const size_t start = writeEnvelope(buffer->data(), payloadSize);
+
+			messenger_->Send(name_, buffer->data() + start, buffer->size() - start);
+			// The engine has copied the message; the buffer goes back to the pool
+			// when it is destroyed.
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
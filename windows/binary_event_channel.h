@@ -0,0 +1,64 @@
+#ifndef FLUTTER_PLUGIN_BINARY_EVENT_CHANNEL_H_
+#define FLUTTER_PLUGIN_BINARY_EVENT_CHANNEL_H_
+
+#include <flutter/binary_messenger.h>
+#include <flutter/event_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "media/buffer_pool.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Event channel whose events are Uint8Lists built by native producers. The
+	// StandardMethodCodec envelope is written into the first kEnvelopePrefix
+	// bytes that producers leave free in each buffer, so the engine's own copy
+	// is the only one. send() may be called from any thread.
+	class BinaryEventChannel {
+	public:
+		// Success byte + Uint8List type byte + up to five size bytes.
+		static constexpr size_t kEnvelopePrefix = 7;
+
+		// Called on the platform thread when Dart starts or stops listening,
+		// so producers run only while someone listens.
+		using ListenChanged = std::function<void(bool listening)>;
+
+		// Buffers waiting for the platform thread beyond maxPending are dropped
+		// oldest first; Dart is not keeping up and stale data is useless.
+		BinaryEventChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, std::string name, size_t maxPending,
+			ListenChanged listenChanged = nullptr);
+
+		~BinaryEventChannel();
+
+		BinaryEventChannel(const BinaryEventChannel&) = delete;
+		BinaryEventChannel& operator=(const BinaryEventChannel&) = delete;
+
+		// Queues buffer for Dart; dropped when nobody listens.
+		void send(PooledBuffer buffer);
+
+	private:
+		void drain();
+
+		flutter::BinaryMessenger* messenger_;
+		PlatformDispatcher& dispatcher_;
+		const std::string name_;
+		const size_t maxPending_;
+		const ListenChanged listenChanged_;
+		std::unique_ptr<flutter::EventChannel<flutter::EncodableValue>> eventChannel_;
+
+		std::mutex mutex_;
+		std::deque<PooledBuffer> pending_;
+		bool drainPosted_;
+		bool listening_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_BINARY_EVENT_CHANNEL_H_
@@ -0,0 +1,114 @@
+#include "callback_journal_channel.h"
+
+#include <string>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	namespace {
+		EncodableValue statsToValue(const CallbackJournalStats& stats) {
+			EncodableMap map;
+			map[EncodableValue("recording")] = EncodableValue(stats.recording);
+			map[EncodableValue("records")] = EncodableValue(static_cast<int64_t>(stats.records));
+			map[EncodableValue("bytesWritten")] = EncodableValue(static_cast<int64_t>(stats.bytesWritten));
+			map[EncodableValue("droppedRecords")] = EncodableValue(static_cast<int64_t>(stats.droppedRecords));
+			map[EncodableValue("strings")] = EncodableValue(static_cast<int64_t>(stats.strings));
+			map[EncodableValue("writeErrors")] = EncodableValue(static_cast<int64_t>(stats.writeErrors));
+			map[EncodableValue("queuedBytes")] = EncodableValue(static_cast<int64_t>(stats.queuedBytes));
+			map[EncodableValue("path")] = EncodableValue(stats.path);
+			return EncodableValue(map);
+		}
+	}
+
+	CallbackJournalChannel::CallbackJournalChannel(AudioEventFanout& audioEvents, VideoEventFanout& videoEvents,
+		ShareEventFanout& shareEvents, RecordingEventFanout& recordingEvents, ChatEventFanout& chatEvents,
+		CaptionEventFanout& captionEvents, ParticipantsChannel& participants, MeetingServiceGetter meetingService)
+		: audioEvents_(audioEvents),
+		videoEvents_(videoEvents),
+		shareEvents_(shareEvents),
+		recordingEvents_(recordingEvents),
+		chatEvents_(chatEvents),
+		captionEvents_(captionEvents),
+		participants_(participants),
+		meetingService_(std::move(meetingService)),
+		recorder_(journal_, [this](uint32_t userId) -> ZOOM_SDK_NAMESPACE::IUserInfo* {
+			ZOOM_SDK_NAMESPACE::IMeetingService* meetingService = meetingService_();
+			ZOOM_SDK_NAMESPACE::IMeetingParticipantsController* controller =
+				meetingService ? meetingService->GetMeetingParticipantsController() : nullptr;
+			return controller ? controller->GetUserByUserID(userId) : nullptr;
+		}) {}
+
+	CallbackJournalChannel::~CallbackJournalChannel() {
+		stop();
+	}
+
+	void CallbackJournalChannel::tap(CallbackRecorder* recorder) {
+		audioEvents_.setTap(recorder);
+		videoEvents_.setTap(recorder);
+		shareEvents_.setTap(recorder);
+		recordingEvents_.setTap(recorder);
+		chatEvents_.setTap(recorder);
+		captionEvents_.setTap(recorder);
+		participants_.setRecorder(recorder);
+	}
+
+	bool CallbackJournalChannel::start(const std::string& path, const CallbackJournalConfig& config) {
+		if (!journal_.start(path, config)) {
+			return false;
+		}
+
+		// A replay starts from the status the journal started in.
+		ZOOM_SDK_NAMESPACE::IMeetingService* meetingService = meetingService_();
+		if (meetingService) {
+			recorder_.onMeetingStatus(meetingService->GetMeetingStatus(), 0);
+		}
+		tap(&recorder_);
+		return true;
+	}
+
+	CallbackJournalStats CallbackJournalChannel::stop() {
+		tap(nullptr);
+		return journal_.stop();
+	}
+
+	bool CallbackJournalChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		if (method.compare("callback_journal_start") == 0) {
+			std::string path;
+			if (!arguments || !StringArgument(*arguments, "path", path) || path.empty()) {
+				result->Error("INVALID_ARGUMENTS", "Expected a path");
+				return true;
+			}
+
+			CallbackJournalConfig config;
+			int64_t value = 0;
+			if (IntArgument(*arguments, "flushMs", value)) {
+				config.flushInterval = std::chrono::milliseconds(value);
+			}
+			if (IntArgument(*arguments, "maxQueuedBytes", value) && value > 0) {
+				config.maxQueuedBytes = static_cast<size_t>(value);
+			}
+
+			result->Success(EncodableValue(start(path, config)));
+			return true;
+		}
+		else if (method.compare("callback_journal_stop") == 0) {
+			result->Success(statsToValue(stop()));
+			return true;
+		}
+		else if (method.compare("callback_journal_stats") == 0) {
+			result->Success(statsToValue(journal_.stats()));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,68 @@
+#ifndef FLUTTER_PLUGIN_CALLBACK_JOURNAL_CHANNEL_H_
+#define FLUTTER_PLUGIN_CALLBACK_JOURNAL_CHANNEL_H_
+
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <meeting_service_interface.h>
+
+#include <functional>
+#include <memory>
+
+#include "meeting/callback_journal.h"
+#include "meeting/callback_recorder.h"
+#include "meeting/meeting_event_fanout.h"
+#include "participants_channel.h"
+
+namespace flutter_zoom_sdk {
+
+	// Journals the SDK callbacks the plugin receives to a file, for replaying
+	// them with tools/callback_replay. Recording taps the fanouts and the
+	// participants events rather than listening, so it changes nothing the
+	// SDK is asked for: only what the plugin already follows is recorded.
+	class CallbackJournalChannel {
+	public:
+		using MeetingServiceGetter = std::function<ZOOM_SDK_NAMESPACE::IMeetingService*()>;
+
+		CallbackJournalChannel(AudioEventFanout& audioEvents, VideoEventFanout& videoEvents,
+			ShareEventFanout& shareEvents, RecordingEventFanout& recordingEvents, ChatEventFanout& chatEvents,
+			CaptionEventFanout& captionEvents, ParticipantsChannel& participants, MeetingServiceGetter meetingService);
+
+		~CallbackJournalChannel();
+
+		CallbackJournalChannel(const CallbackJournalChannel&) = delete;
+		CallbackJournalChannel& operator=(const CallbackJournalChannel&) = delete;
+
+		// For the auth and meeting service listeners to record into; nullptr
+		// while not recording.
+		CallbackRecorder* recorder() { return journal_.isRecording() ? &recorder_ : nullptr; }
+
+		// Handles the callback_journal_* methods. Returns false, leaving
+		// result untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+	private:
+		bool start(const std::string& path, const CallbackJournalConfig& config);
+
+		CallbackJournalStats stop();
+
+		// Sets or clears recorder_ as the tap everywhere.
+		void tap(CallbackRecorder* recorder);
+
+		AudioEventFanout& audioEvents_;
+		VideoEventFanout& videoEvents_;
+		ShareEventFanout& shareEvents_;
+		RecordingEventFanout& recordingEvents_;
+		ChatEventFanout& chatEvents_;
+		CaptionEventFanout& captionEvents_;
+		ParticipantsChannel& participants_;
+		MeetingServiceGetter meetingService_;
+		CallbackJournal journal_;
+		CallbackRecorder recorder_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_CALLBACK_JOURNAL_CHANNEL_H_
@@ -0,0 +1,71 @@
+#include "caption_channel.h"
+
+#include <string>
+
+#include "util/zchar_util.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr char kChannelName[] = "flutter_zoom_sdk/captions";
+
+		// Transcription updates come several a second while someone talks.
+		constexpr size_t kMaxPendingEvents = 64;
+	}
+
+	CaptionChannel::Events::Events(DomainEventChannel& events)
+		: events_(events) {}
+
+	void CaptionChannel::Events::onClosedCaptionMsgReceived(const zchar_t* ccMsg, unsigned int sender_id, time_t time) {
+		DomainEvent event;
+		event.kind = static_cast<uint8_t>(CaptionEventKind::ClosedCaption);
+		event.userId = sender_id;
+		event.timeMs = static_cast<int64_t>(time) * 1000;
+		// Captions have no id; the text is where a transcription's is.
+		event.strings.push_back(std::string());
+		event.strings.push_back(ToUtf8(ccMsg));
+		events_.send(event);
+	}
+
+	void CaptionChannel::Events::onLiveTranscriptionMsgInfoReceived(ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo* messageInfo) {
+		sendTranscription(CaptionEventKind::Transcription, messageInfo);
+	}
+
+	void CaptionChannel::Events::onOriginalLanguageMsgReceived(ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo* messageInfo) {
+		sendTranscription(CaptionEventKind::OriginalLanguage, messageInfo);
+	}
+
+	void CaptionChannel::Events::sendTranscription(CaptionEventKind kind, ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo* messageInfo) {
+		if (!messageInfo) {
+			return;
+		}
+
+		DomainEvent event;
+		event.kind = static_cast<uint8_t>(kind);
+		event.userId = messageInfo->GetSpeakerID();
+		event.value = static_cast<int32_t>(messageInfo->GetMessageOperationType());
+		event.timeMs = static_cast<int64_t>(messageInfo->GetTimeStamp()) * 1000;
+		event.strings.push_back(ToUtf8(messageInfo->GetMessageID()));
+		event.strings.push_back(ToUtf8(messageInfo->GetMessageContent()));
+		event.strings.push_back(ToUtf8(messageInfo->GetSpeakerName()));
+		events_.send(event);
+	}
+
+	CaptionChannel::CaptionChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, CaptionEventFanout& captionEvents)
+		: captionEvents_(captionEvents),
+		events_(messenger, dispatcher, kChannelName, kMaxPendingEvents,
+			[this](bool listening) {
+				if (listening) {
+					captionEvents_.add(&listener_);
+				}
+				else {
+					captionEvents_.remove(&listener_);
+				}
+			}),
+		listener_(events_) {}
+
+	CaptionChannel::~CaptionChannel() {
+		captionEvents_.remove(&listener_);
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,57 @@
+#ifndef FLUTTER_PLUGIN_CAPTION_CHANNEL_H_
+#define FLUTTER_PLUGIN_CAPTION_CHANNEL_H_
+
+#include <flutter/binary_messenger.h>
+
+#include "domain_event_channel.h"
+#include "meeting/meeting_event_fanout.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Sends closed captions and live transcription messages on the
+	// "flutter_zoom_sdk/captions" event channel as DomainEvents of
+	// CaptionEventKind. Listens on captionEvents, which the caller sets on the
+	// closed caption controller, only while Dart listens.
+	class CaptionChannel {
+	public:
+		CaptionChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, CaptionEventFanout& captionEvents);
+
+		~CaptionChannel();
+
+		CaptionChannel(const CaptionChannel&) = delete;
+		CaptionChannel& operator=(const CaptionChannel&) = delete;
+
+	private:
+		class Events : public ZOOM_SDK_NAMESPACE::IClosedCaptionControllerEvent {
+		public:
+			explicit Events(DomainEventChannel& events);
+
+			void onAssignedToSendCC(bool bAssigned) override {}
+			void onClosedCaptionMsgReceived(const zchar_t* ccMsg, unsigned int sender_id, time_t time) override;
+			void onLiveTranscriptionStatus(ZOOM_SDK_NAMESPACE::SDKLiveTranscriptionStatus status) override {}
+			void onOriginalLanguageMsgReceived(ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo* messageInfo) override;
+			void onLiveTranscriptionMsgInfoReceived(ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo* messageInfo) override;
+			void onLiveTranscriptionMsgError(ZOOM_SDK_NAMESPACE::ILiveTranscriptionLanguage* spokenLanguage, ZOOM_SDK_NAMESPACE::ILiveTranscriptionLanguage* transcriptLanguage) override {}
+			void onRequestForLiveTranscriptReceived(unsigned int requester_id, bool bAnonymous) override {}
+			void onRequestLiveTranscriptionStatusChange(bool bEnabled) override {}
+			void onCaptionStatusChanged(bool bEnabled) override {}
+			void onStartCaptionsRequestReceived(ZOOM_SDK_NAMESPACE::ICCRequestHandler* handler) override {}
+			void onStartCaptionsRequestApproved() override {}
+			void onManualCaptionStatusChanged(bool bEnabled) override {}
+			void onSpokenLanguageChanged(ZOOM_SDK_NAMESPACE::ILiveTranscriptionLanguage* spokenLanguage) override {}
+
+		private:
+			void sendTranscription(CaptionEventKind kind, ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo* messageInfo);
+
+			DomainEventChannel& events_;
+		};
+
+		CaptionEventFanout& captionEvents_;
+		DomainEventChannel events_;
+		Events listener_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_CAPTION_CHANNEL_H_
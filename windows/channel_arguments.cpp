@@ -0,0 +1,130 @@
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	bool IntArgument(const EncodableMap& arguments, const char* name, int64_t& value) {
+		auto it = arguments.find(EncodableValue(name));
+		if (it == arguments.end()) {
+			return false;
+		}
+		if (auto v32 = std::get_if<int32_t>(&it->second)) {
+			value = *v32;
+			return true;
+		}
+		if (auto v64 = std::get_if<int64_t>(&it->second)) {
+			value = *v64;
+			return true;
+		}
+		return false;
+	}
+
+	bool DoubleArgument(const EncodableMap& arguments, const char* name, double& value) {
+		auto it = arguments.find(EncodableValue(name));
+		if (it == arguments.end()) {
+			return false;
+		}
+		if (auto v = std::get_if<double>(&it->second)) {
+			value = *v;
+			return true;
+		}
+		int64_t integer = 0;
+		if (IntArgument(arguments, name, integer)) {
+			value = static_cast<double>(integer);
+			return true;
+		}
+		return false;
+	}
+
+	bool BoolArgument(const EncodableMap& arguments, const char* name, bool& value) {
+		auto it = arguments.find(EncodableValue(name));
+		if (it == arguments.end() || !std::holds_alternative<bool>(it->second)) {
+			return false;
+		}
+		value = std::get<bool>(it->second);
+		return true;
+	}
+
+	bool StringArgument(const EncodableMap& arguments, const char* name, std::string& value) {
+		auto it = arguments.find(EncodableValue(name));
+		if (it == arguments.end() || !std::holds_alternative<std::string>(it->second)) {
+			return false;
+		}
+		value = std::get<std::string>(it->second);
+		return true;
+	}
+
+	bool AudioStreamKeyFromArguments(const EncodableMap& arguments, const LanguageRegistry& languages, AudioStreamKey& key) {
+		std::string kind;
+		if (!StringArgument(arguments, "kind", kind)) {
+			return false;
+		}
+
+		int64_t userId = 0;
+		const bool hasUser = IntArgument(arguments, "userId", userId);
+
+		if (kind == "mixed") {
+			key = AudioStreamKey{ AudioStreamKind::Mixed, 0 };
+			return true;
+		}
+		if (kind == "oneWay") {
+			key = AudioStreamKey{ AudioStreamKind::OneWay, hasUser ? static_cast<uint32_t>(userId) : kAnyStreamId };
+			return true;
+		}
+		if (kind == "share") {
+			key = AudioStreamKey{ AudioStreamKind::Share, hasUser ? static_cast<uint32_t>(userId) : kAnyStreamId };
+			return true;
+		}
+		if (kind == "interpreter") {
+			std::string language;
+			// Only languages the SDK has delivered have ids; interning Dart's
+			// names would grow the registry for good with whatever it sends.
+			key = AudioStreamKey{ AudioStreamKind::Interpreter,
+				StringArgument(arguments, "language", language) ? languages.find(language) : kAnyStreamId };
+			return key.id != LanguageRegistry::kInvalidId;
+		}
+		if (kind == "mix") {
+			int64_t mixId = 0;
+			if (!IntArgument(arguments, "mixId", mixId)) {
+				return false;
+			}
+			key = AudioStreamKey{ AudioStreamKind::Mix, static_cast<uint32_t>(mixId) };
+			return true;
+		}
+
+		return false;
+	}
+
+	bool ResolutionArgument(const EncodableMap& arguments, const char* name, ZOOM_SDK_NAMESPACE::ZoomSDKResolution& resolution) {
+		if (arguments.find(EncodableValue(name)) == arguments.end()) {
+			return true;
+		}
+
+		int64_t lines = 0;
+		if (!IntArgument(arguments, name, lines)) {
+			return false;
+		}
+
+		switch (lines) {
+		case 90:
+			resolution = ZOOM_SDK_NAMESPACE::ZoomSDKResolution_90P;
+			return true;
+		case 180:
+			resolution = ZOOM_SDK_NAMESPACE::ZoomSDKResolution_180P;
+			return true;
+		case 360:
+			resolution = ZOOM_SDK_NAMESPACE::ZoomSDKResolution_360P;
+			return true;
+		case 720:
+			resolution = ZOOM_SDK_NAMESPACE::ZoomSDKResolution_720P;
+			return true;
+		case 1080:
+			resolution = ZOOM_SDK_NAMESPACE::ZoomSDKResolution_1080P;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,39 @@
+#ifndef FLUTTER_PLUGIN_CHANNEL_ARGUMENTS_H_
+#define FLUTTER_PLUGIN_CHANNEL_ARGUMENTS_H_
+
+#include <flutter/encodable_value.h>
+
+#include <rawdata/rawdata_renderer_interface.h>
+
+#include <cstdint>
+#include <string>
+
+#include "media/audio_stream.h"
+#include "media/language_registry.h"
+
+namespace flutter_zoom_sdk {
+
+	// Dart ints arrive as int32_t or int64_t depending on magnitude.
+	bool IntArgument(const flutter::EncodableMap& arguments, const char* name, int64_t& value);
+
+	bool DoubleArgument(const flutter::EncodableMap& arguments, const char* name, double& value);
+
+	bool BoolArgument(const flutter::EncodableMap& arguments, const char* name, bool& value);
+
+	bool StringArgument(const flutter::EncodableMap& arguments, const char* name, std::string& value);
+
+	// Parses an audio stream selector:
+	//   {"kind": "mixed"}
+	//   {"kind": "oneWay" | "share", "userId": int}   (no userId: every user)
+	//   {"kind": "interpreter", "language": String}   (no language: every language;
+	//                                                  a language not heard yet fails)
+	//   {"kind": "mix", "mixId": int}
+	bool AudioStreamKeyFromArguments(const flutter::EncodableMap& arguments, const LanguageRegistry& languages, AudioStreamKey& key);
+
+	// Raw data resolution in lines: 90, 180, 360, 720 or 1080. An absent
+	// argument leaves resolution untouched; any other value fails.
+	bool ResolutionArgument(const flutter::EncodableMap& arguments, const char* name, ZOOM_SDK_NAMESPACE::ZoomSDKResolution& resolution);
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_CHANNEL_ARGUMENTS_H_
@@ -0,0 +1,68 @@
+#include "chat_channel.h"
+
+#include "util/zchar_util.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr char kChannelName[] = "flutter_zoom_sdk/chat";
+
+		// Messages are not versioned; keep a burst rather than drop it.
+		constexpr size_t kMaxPendingEvents = 64;
+	}
+
+	ChatChannel::Events::Events(DomainEventChannel& events)
+		: events_(events) {}
+
+	void ChatChannel::Events::onChatMsgNotification(ZOOM_SDK_NAMESPACE::IChatMsgInfo* chatMsg, const zchar_t* content) {
+		sendMessage(ChatEventKind::Message, chatMsg);
+	}
+
+	void ChatChannel::Events::onChatMessageEditNotification(ZOOM_SDK_NAMESPACE::IChatMsgInfo* chatMsg) {
+		sendMessage(ChatEventKind::Edited, chatMsg);
+	}
+
+	void ChatChannel::Events::onChatMsgDeleteNotification(const zchar_t* msgID, ZOOM_SDK_NAMESPACE::SDKChatMessageDeleteType deleteBy) {
+		DomainEvent event;
+		event.kind = static_cast<uint8_t>(ChatEventKind::Deleted);
+		event.value = static_cast<int32_t>(deleteBy);
+		event.strings.push_back(ToUtf8(msgID));
+		events_.send(event);
+	}
+
+	void ChatChannel::Events::sendMessage(ChatEventKind kind, ZOOM_SDK_NAMESPACE::IChatMsgInfo* chatMsg) {
+		if (!chatMsg) {
+			return;
+		}
+
+		DomainEvent event;
+		event.kind = static_cast<uint8_t>(kind);
+		event.userId = chatMsg->GetSenderUserId();
+		event.otherId = chatMsg->IsChatToAll() ? 0 : chatMsg->GetReceiverUserId();
+		event.value = static_cast<int32_t>(chatMsg->GetChatMessageType());
+		event.timeMs = static_cast<int64_t>(chatMsg->GetTimeStamp()) * 1000;
+		event.strings.push_back(ToUtf8(chatMsg->GetMessageID()));
+		event.strings.push_back(ToUtf8(chatMsg->GetContent()));
+		event.strings.push_back(ToUtf8(chatMsg->GetSenderDisplayName()));
+		event.strings.push_back(ToUtf8(chatMsg->GetReceiverDisplayName()));
+		events_.send(event);
+	}
+
+	ChatChannel::ChatChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, ChatEventFanout& chatEvents)
+		: chatEvents_(chatEvents),
+		events_(messenger, dispatcher, kChannelName, kMaxPendingEvents,
+			[this](bool listening) {
+				if (listening) {
+					chatEvents_.add(&listener_);
+				}
+				else {
+					chatEvents_.remove(&listener_);
+				}
+			}),
+		listener_(events_) {}
+
+	ChatChannel::~ChatChannel() {
+		chatEvents_.remove(&listener_);
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,51 @@
+#ifndef FLUTTER_PLUGIN_CHAT_CHANNEL_H_
+#define FLUTTER_PLUGIN_CHAT_CHANNEL_H_
+
+#include <flutter/binary_messenger.h>
+
+#include "domain_event_channel.h"
+#include "meeting/meeting_event_fanout.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Sends chat messages, edits and deletions on the "flutter_zoom_sdk/chat"
+	// event channel as DomainEvents of ChatEventKind. Listens on chatEvents,
+	// which the caller sets on the chat controller, only while Dart listens.
+	class ChatChannel {
+	public:
+		ChatChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, ChatEventFanout& chatEvents);
+
+		~ChatChannel();
+
+		ChatChannel(const ChatChannel&) = delete;
+		ChatChannel& operator=(const ChatChannel&) = delete;
+
+	private:
+		class Events : public ZOOM_SDK_NAMESPACE::IMeetingChatCtrlEvent {
+		public:
+			explicit Events(DomainEventChannel& events);
+
+			void onChatMsgNotification(ZOOM_SDK_NAMESPACE::IChatMsgInfo* chatMsg, const zchar_t* content = nullptr) override;
+			void onChatStatusChangedNotification(ZOOM_SDK_NAMESPACE::ChatStatus* status_) override {}
+			void onChatMsgDeleteNotification(const zchar_t* msgID, ZOOM_SDK_NAMESPACE::SDKChatMessageDeleteType deleteBy) override;
+			void onChatMessageEditNotification(ZOOM_SDK_NAMESPACE::IChatMsgInfo* chatMsg) override;
+			void onShareMeetingChatStatusChanged(bool isStart) override {}
+			void onFileSendStart(ZOOM_SDK_NAMESPACE::ISDKFileSender* sender) override {}
+			void onFileReceived(ZOOM_SDK_NAMESPACE::ISDKFileReceiver* receiver) override {}
+			void onFileTransferProgress(ZOOM_SDK_NAMESPACE::SDKFileTransferInfo* info) override {}
+
+		private:
+			void sendMessage(ChatEventKind kind, ZOOM_SDK_NAMESPACE::IChatMsgInfo* chatMsg);
+
+			DomainEventChannel& events_;
+		};
+
+		ChatEventFanout& chatEvents_;
+		DomainEventChannel events_;
+		Events listener_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_CHAT_CHANNEL_H_
@@ -0,0 +1,23 @@
+#include "domain_event_channel.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// Room for the header and a short message; longer ones grow it.
+		constexpr size_t kEventBufferSize = 512;
+		constexpr size_t kIdleEventBuffers = 4;
+	}
+
+	DomainEventChannel::DomainEventChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher,
+		std::string name, size_t maxPending, BinaryEventChannel::ListenChanged listenChanged)
+		: events_(messenger, dispatcher, std::move(name), maxPending, std::move(listenChanged)),
+		pool_(BufferPool::create(kEventBufferSize, kIdleEventBuffers)),
+		sequence_(0) {}
+
+	void DomainEventChannel::send(const DomainEvent& event) {
+		PooledBuffer buffer = pool_->acquire();
+		writeDomainEvent(event, ++sequence_, *buffer, BinaryEventChannel::kEnvelopePrefix);
+		events_.send(std::move(buffer));
+	}
+
+}  // namespace flutter_zoom_sdk
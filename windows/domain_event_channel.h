@@ -0,0 +1,41 @@
+#ifndef FLUTTER_PLUGIN_DOMAIN_EVENT_CHANNEL_H_
+#define FLUTTER_PLUGIN_DOMAIN_EVENT_CHANNEL_H_
+
+#include <flutter/binary_messenger.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "binary_event_channel.h"
+#include "media/buffer_pool.h"
+#include "meeting/domain_event.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Event channel for the events of one SDK controller, as DomainEvent
+	// Uint8Lists. Each domain has its own, so a chatty one holds up neither
+	// the others nor the meeting events. The owner follows the controller
+	// only while listenChanged says Dart listens.
+	class DomainEventChannel {
+	public:
+		DomainEventChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, std::string name,
+			size_t maxPending, BinaryEventChannel::ListenChanged listenChanged);
+
+		DomainEventChannel(const DomainEventChannel&) = delete;
+		DomainEventChannel& operator=(const DomainEventChannel&) = delete;
+
+		// Platform thread.
+		void send(const DomainEvent& event);
+
+	private:
+		BinaryEventChannel events_;
+		std::shared_ptr<BufferPool> pool_;
+		uint64_t sequence_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_DOMAIN_EVENT_CHANNEL_H_
@@ -12,10 +12,73 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
+
+#include "channel_arguments.h"
+#include "util/zchar_util.h"
 
 namespace flutter_zoom_sdk {
 	FlutterZoomSdkPlugin* plagin;
 
+	namespace {
+		// Meeting events kept for listeners that arrive late or again after a
+		// hot restart.
+		constexpr size_t kMeetingJournalCapacity = 64;
+		constexpr int64_t kMaxMeetingJournalCapacity = 1024;
+
+		uint64_t nowMs() {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+
+		// [tag, detail] as the meeting event stream sends it.
+		EncodableValue encodeMeetingEvent(const MeetingEventRecord& record) {
+			EncodableValue detail;
+			if (record.event == kMeetingParameterEvent) {
+				EncodableMap parameter;
+				parameter[EncodableValue("meetingType")] = EncodableValue(record.value);
+				parameter[EncodableValue("viewOnly")] = EncodableValue(record.viewOnly);
+				parameter[EncodableValue("autoRecordingLocal")] = EncodableValue(record.autoRecordingLocal);
+				parameter[EncodableValue("autoRecordingCloud")] = EncodableValue(record.autoRecordingCloud);
+				parameter[EncodableValue("meetingNumber")] = EncodableValue(record.meetingNumber);
+				parameter[EncodableValue("topic")] = EncodableValue(record.topic);
+				parameter[EncodableValue("host")] = EncodableValue(record.host);
+				detail = EncodableValue(parameter);
+			}
+			else if (record.event == kMeetingTopicEvent) {
+				detail = EncodableValue(record.topic);
+			}
+			else {
+				detail = EncodableValue(record.value);
+			}
+
+			EncodableList results;
+			results.push_back(EncodableValue(meetingEventTag(record.event)));
+			results.push_back(std::move(detail));
+			return EncodableValue(results);
+		}
+
+		// Sets fanout on controller while set and something listens to it;
+		// otherwise the controller has no listener and makes no callbacks.
+		template <typename Controller, typename Fanout>
+		void setControllerEvents(Controller* controller, Fanout* fanout, bool set, const wchar_t* unavailable) {
+			const bool wanted = set && fanout->wanted();
+			if (!controller) {
+				if (wanted) {
+					_cputts(unavailable);
+				}
+				return;
+			}
+
+			if (!wanted) {
+				controller->SetEvent(nullptr);
+			}
+			else if (controller->SetEvent(fanout) != ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+				_cputts(unavailable);
+			}
+		}
+	}
+
 	// static
 	void FlutterZoomSdkPlugin::RegisterWithRegistrar(
 		flutter::PluginRegistrarWindows* registrar) {
@@ -30,6 +93,66 @@ namespace flutter_zoom_sdk {
 
 		auto plugin = std::make_unique<FlutterZoomSdkPlugin>();
 
+		plugin->pcmStreamChannel = std::make_unique<PcmStreamChannel>(
+			registrar->messenger(), *plugin->dispatcher, *plugin->audioRawDataHub);
+		plugin->audioRecorderChannel = std::make_unique<AudioRecorderChannel>(*plugin->audioRawDataHub);
+		plugin->audioMixerChannel = std::make_unique<AudioMixerChannel>(*plugin->audioRawDataHub);
+		plugin->audioAnalysisChannel = std::make_unique<AudioAnalysisChannel>(
+			registrar->messenger(), *plugin->dispatcher, *plugin->audioRawDataHub, *plugin->workerPool);
+		FlutterZoomSdkPlugin* self = plugin.get();
+		plugin->shareAudioChannel = std::make_unique<ShareAudioChannel>(
+			*plugin->dispatcher, [self]() { return self->MeetingService; });
+		plugin->videoSourceChannel = std::make_unique<VideoSourceChannel>(
+			*plugin->dispatcher, [self]() { return self->SettingService; });
+		plugin->videoFilterChannel = std::make_unique<VideoFilterChannel>();
+		plugin->shareSourceChannel = std::make_unique<ShareSourceChannel>(
+			[self]() { return self->MeetingService; });
+		plugin->videoHealthChannel = std::make_unique<VideoHealthChannel>(
+			registrar->messenger(), *plugin->dispatcher);
+		plugin->rawArchiveChannel = std::make_unique<RawArchiveChannel>(
+			*plugin->audioRawDataHub, [self]() { return self->MeetingService; });
+		plugin->pipChannel = std::make_unique<PipChannel>(
+			registrar->texture_registrar(), [self]() { return self->MeetingService; },
+			[self]() { return self->speakerChannel ? self->speakerChannel->current() : 0u; },
+			[self](bool paused) {
+				if (self->videoHealthChannel) {
+					self->videoHealthChannel->setPaused(paused);
+				}
+				// The picture follows the speaker.
+				if (self->speakerChannel) {
+					self->speakerChannel->setFollowed(paused);
+				}
+			});
+		plugin->participantsChannel = std::make_unique<ParticipantsChannel>(
+			registrar->messenger(), *plugin->dispatcher, *plugin->audioEvents, *plugin->videoEvents,
+			[self]() { return self->MeetingService; });
+		plugin->meetingStateChannel = std::make_unique<MeetingStateChannel>(
+			registrar->messenger(), *plugin->dispatcher, *plugin->shareEvents, *plugin->recordingEvents,
+			*plugin->chatEvents, *plugin->captionEvents, plugin->participantsChannel->roster(),
+			[self](bool wanted) { self->wantRoster(wanted); },
+			[self]() { return self->MeetingService; });
+		plugin->speakerChannel = std::make_unique<SpeakerChannel>(
+			registrar->messenger(), *plugin->dispatcher, *plugin->audioRawDataHub, *plugin->audioEvents, *plugin->videoEvents,
+			plugin->participantsChannel->roster(),
+			[self](bool wanted) { self->wantRoster(wanted); },
+			[self](uint32_t userId) {
+				if (self->pipChannel) {
+					self->pipChannel->followSpeaker(userId);
+				}
+			});
+		plugin->chatChannel = std::make_unique<ChatChannel>(
+			registrar->messenger(), *plugin->dispatcher, *plugin->chatEvents);
+		plugin->captionChannel = std::make_unique<CaptionChannel>(
+			registrar->messenger(), *plugin->dispatcher, *plugin->captionEvents);
+		plugin->sharingChannel = std::make_unique<SharingChannel>(
+			registrar->messenger(), *plugin->dispatcher, *plugin->shareEvents);
+		plugin->recordingChannel = std::make_unique<RecordingChannel>(
+			registrar->messenger(), *plugin->dispatcher, *plugin->recordingEvents);
+		plugin->callbackJournalChannel = std::make_unique<CallbackJournalChannel>(
+			*plugin->audioEvents, *plugin->videoEvents, *plugin->shareEvents, *plugin->recordingEvents,
+			*plugin->chatEvents, *plugin->captionEvents, *plugin->participantsChannel,
+			[self]() { return self->MeetingService; });
+
 		channel->SetMethodCallHandler(
 			[plugin_pointer = plugin.get()](const auto& call, auto result) {
 			plugin_pointer->HandleMethodCall(call, std::move(result));
@@ -49,14 +172,54 @@ namespace flutter_zoom_sdk {
 		registrar->AddPlugin(std::move(plugin));
 	}
 
-	FlutterZoomSdkPlugin::FlutterZoomSdkPlugin() {
+	FlutterZoomSdkPlugin::FlutterZoomSdkPlugin()
+		: meetingJournal(kMeetingJournalCapacity) {
 		plagin = this;
 		FlutterZoomSdkPlugin::AuthService = nullptr;
 		FlutterZoomSdkPlugin::MeetingService = nullptr;
 		FlutterZoomSdkPlugin::SettingService = nullptr;
+
+		dispatcher = std::make_unique<PlatformDispatcher>();
+		audioRawDataHub = std::make_unique<AudioRawDataHub>();
+		workerPool = std::make_unique<WorkerPool>();
+		audioEvents = std::make_unique<AudioEventFanout>();
+		videoEvents = std::make_unique<VideoEventFanout>();
+		shareEvents = std::make_unique<ShareEventFanout>();
+		recordingEvents = std::make_unique<RecordingEventFanout>();
+		chatEvents = std::make_unique<ChatEventFanout>();
+		captionEvents = std::make_unique<CaptionEventFanout>();
+		audioEvents->setDemandChanged([this]() { syncControllerEvents(); });
+		videoEvents->setDemandChanged([this]() { syncControllerEvents(); });
+		shareEvents->setDemandChanged([this]() { syncControllerEvents(); });
+		recordingEvents->setDemandChanged([this]() { syncControllerEvents(); });
+		chatEvents->setDemandChanged([this]() { syncControllerEvents(); });
+		captionEvents->setDemandChanged([this]() { syncControllerEvents(); });
+		controllerEventsSet = false;
+		rawDataAttached = false;
 	}
 
 	FlutterZoomSdkPlugin::~FlutterZoomSdkPlugin() {
+		callbackJournalChannel.reset();
+		speakerChannel.reset();
+		pipChannel.reset();
+		pcmStreamChannel.reset();
+		audioRecorderChannel.reset();
+		audioMixerChannel.reset();
+		audioAnalysisChannel.reset();
+		shareAudioChannel.reset();
+		videoSourceChannel.reset();
+		videoFilterChannel.reset();
+		shareSourceChannel.reset();
+		videoHealthChannel.reset();
+		rawArchiveChannel.reset();
+		recordingChannel.reset();
+		sharingChannel.reset();
+		captionChannel.reset();
+		chatChannel.reset();
+		meetingStateChannel.reset();
+		participantsChannel.reset();
+		detachRawData();
+
 		FlutterZoomSdkPlugin::AuthService = nullptr;
 		FlutterZoomSdkPlugin::MeetingService = nullptr;
 		FlutterZoomSdkPlugin::SettingService = nullptr;
@@ -69,14 +232,13 @@ namespace flutter_zoom_sdk {
 
     void FlutterZoomSdkPlugin::MeetingStreamListen(unique_ptr<flutter::EventSink<>>&& events) {
         FlutterZoomSdkPlugin::meeting_event_sink_ = std::move(events);
-        FlutterZoomSdkPlugin::createMeetingService();
-
-        if (FlutterZoomSdkPlugin::MeetingService != NULL) {
-            if (!meetingListener) {
-                meetingListener = std::make_unique<MeetingServiceEvent>();
+        // Whatever happened before this listener, in order.
+        meetingJournal.replay(nowMs(), [this](const MeetingEventRecord& journaled) {
+            if (meetingEvents.wants(journaled.event)) {
+                meeting_event_sink_->Success(encodeMeetingEvent(journaled));
             }
-            FlutterZoomSdkPlugin::MeetingService->SetEvent(meetingListener.get());
-        }
+        });
+        FlutterZoomSdkPlugin::createMeetingService();
     }
 
 	void FlutterZoomSdkPlugin::HandleMethodCall(
@@ -121,6 +283,108 @@ namespace flutter_zoom_sdk {
 
 			result->Success(EncodableValue(res));
 		}
+		else if (method_call.method_name().compare("meeting_events_subscribe") == 0) {
+			// No tags list subscribes to everything.
+			uint64_t mask = kAllMeetingEvents;
+			const EncodableValue* tags = nullptr;
+			if (arguments) {
+				auto found = arguments->find(EncodableValue("events"));
+				if (found != arguments->end() && !found->second.IsNull()) {
+					tags = &found->second;
+				}
+			}
+			if (tags) {
+				auto list = get_if<EncodableList>(tags);
+				if (!list) {
+					result->Error("INVALID_ARGUMENTS", "Expected a list of event tags");
+					return;
+				}
+
+				mask = 0;
+				for (const EncodableValue& tag : *list) {
+					auto name = get_if<string>(&tag);
+					const int event = name ? meetingEventFromTag(*name) : kNoMeetingEvent;
+					if (event == kNoMeetingEvent) {
+						result->Error("INVALID_ARGUMENTS", "Unknown meeting event tag");
+						return;
+					}
+					mask |= uint64_t(1) << event;
+				}
+			}
+
+			meetingEvents.setMask(mask);
+			result->Success(EncodableValue(true));
+		}
+		else if (method_call.method_name().compare("meeting_events_replay") == 0) {
+			int64_t capacity = static_cast<int64_t>(meetingJournal.capacity());
+			int64_t maxAgeMs = static_cast<int64_t>(meetingJournal.maxAgeMs());
+			bool dropOldest = meetingJournal.overflow() == JournalOverflow::DropOldest;
+			if (arguments) {
+				IntArgument(*arguments, "capacity", capacity);
+				IntArgument(*arguments, "maxAgeMs", maxAgeMs);
+				BoolArgument(*arguments, "dropOldest", dropOldest);
+			}
+			if (capacity < 0 || capacity > kMaxMeetingJournalCapacity || maxAgeMs < 0) {
+				result->Error("INVALID_ARGUMENTS", "Expected a capacity up to 1024 and a non-negative maxAgeMs");
+				return;
+			}
+
+			meetingJournal.configure(static_cast<size_t>(capacity), static_cast<uint64_t>(maxAgeMs),
+				dropOldest ? JournalOverflow::DropOldest : JournalOverflow::DropNewest);
+			result->Success(EncodableValue(true));
+		}
+		else if (method_call.method_name().compare("meeting_events_stats") == 0) {
+			EncodableMap map;
+			map[EncodableValue("buffered")] = EncodableValue(static_cast<int64_t>(meetingJournal.size()));
+			map[EncodableValue("dropped")] = EncodableValue(static_cast<int64_t>(meetingJournal.dropped()));
+			map[EncodableValue("capacity")] = EncodableValue(static_cast<int64_t>(meetingJournal.capacity()));
+			result->Success(EncodableValue(map));
+		}
+		else if (pcmStreamChannel && pcmStreamChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the PCM stream channel
+		}
+		else if (audioRecorderChannel && audioRecorderChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the audio recorder
+		}
+		else if (audioMixerChannel && audioMixerChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the audio mixer
+		}
+		else if (audioAnalysisChannel && audioAnalysisChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the audio analysis channel
+		}
+		else if (shareAudioChannel && shareAudioChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the share audio pump
+		}
+		else if (videoSourceChannel && videoSourceChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the external video source
+		}
+		else if (videoFilterChannel && videoFilterChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the video filter chain
+		}
+		else if (shareSourceChannel && shareSourceChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the external share source
+		}
+		else if (videoHealthChannel && videoHealthChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the video health monitor
+		}
+		else if (rawArchiveChannel && rawArchiveChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the raw media archiver
+		}
+		else if (pipChannel && pipChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the picture-in-picture renderer
+		}
+		else if (participantsChannel && participantsChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the participant roster
+		}
+		else if (meetingStateChannel && meetingStateChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the meeting state
+		}
+		else if (speakerChannel && speakerChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the active speaker tracker
+		}
+		else if (callbackJournalChannel && callbackJournalChannel->HandleMethodCall(method_call, result)) {
+			// Handled by the callback journal
+		}
 		else {
 			result->NotImplemented();
 		}
@@ -270,6 +534,13 @@ namespace flutter_zoom_sdk {
 				_cputts(L"Created Meeting Service\n");
 			}
 		}
+
+		// Listen from the start, whether or not Dart does yet, so the journal
+		// holds every status for the first listener.
+		if (FlutterZoomSdkPlugin::MeetingService && !meetingListener) {
+			meetingListener = std::make_unique<MeetingServiceEvent>();
+			FlutterZoomSdkPlugin::MeetingService->SetEvent(meetingListener.get());
+		}
 	}
 
 	void FlutterZoomSdkPlugin::createSettingService() {
@@ -296,6 +567,10 @@ namespace flutter_zoom_sdk {
 	}
 
 	bool FlutterZoomSdkPlugin::showMeeting() {
+		if (pipChannel) {
+			pipChannel->stop();
+		}
+
 		if (FlutterZoomSdkPlugin::MeetingService) {
 			ZOOM_SDK_NAMESPACE::IMeetingUIController* UIController = FlutterZoomSdkPlugin::MeetingService->GetUIController();
 
@@ -375,12 +650,176 @@ namespace flutter_zoom_sdk {
 		}
 	}
 
+	void FlutterZoomSdkPlugin::updateRawDataState(ZOOM_SDK_NAMESPACE::MeetingStatus status) {
+		switch (status) {
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_INMEETING:
+			FlutterZoomSdkPlugin::attachRawData();
+			break;
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_DISCONNECTING:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_ENDED:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_FAILED:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_IDLE:
+			if (pipChannel) {
+				pipChannel->stop();
+			}
+			FlutterZoomSdkPlugin::detachRawData();
+			break;
+		default:
+			break;
+		}
+	}
+
+	void FlutterZoomSdkPlugin::updateParticipantsState(ZOOM_SDK_NAMESPACE::MeetingStatus status) {
+		if (!participantsChannel) {
+			return;
+		}
+
+		switch (status) {
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_INMEETING:
+			participantsChannel->setInMeeting(true);
+			break;
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_DISCONNECTING:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_ENDED:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_FAILED:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_IDLE:
+			participantsChannel->setInMeeting(false);
+			break;
+		default:
+			break;
+		}
+	}
+
+	void FlutterZoomSdkPlugin::wantRoster(bool wanted) {
+		if (!participantsChannel) {
+			return;
+		}
+
+		if (wanted) {
+			participantsChannel->retain();
+		}
+		else {
+			participantsChannel->release();
+		}
+	}
+
+	void FlutterZoomSdkPlugin::updateControllerEvents(ZOOM_SDK_NAMESPACE::MeetingStatus status) {
+		switch (status) {
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_INMEETING:
+			controllerEventsSet = true;
+			syncControllerEvents();
+			break;
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_ENDED:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_FAILED:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_IDLE:
+			controllerEventsSet = false;
+			syncControllerEvents();
+			break;
+		default:
+			break;
+		}
+	}
+
+	void FlutterZoomSdkPlugin::syncControllerEvents() {
+		if (!FlutterZoomSdkPlugin::MeetingService) {
+			return;
+		}
+
+		const bool set = controllerEventsSet;
+		setControllerEvents(FlutterZoomSdkPlugin::MeetingService->GetMeetingAudioController(), audioEvents.get(), set, L"Audio controller events unavailable\n");
+		setControllerEvents(FlutterZoomSdkPlugin::MeetingService->GetMeetingVideoController(), videoEvents.get(), set, L"Video controller events unavailable\n");
+		setControllerEvents(FlutterZoomSdkPlugin::MeetingService->GetMeetingShareController(), shareEvents.get(), set, L"Share controller events unavailable\n");
+		setControllerEvents(FlutterZoomSdkPlugin::MeetingService->GetMeetingRecordingController(), recordingEvents.get(), set, L"Recording controller events unavailable\n");
+		setControllerEvents(FlutterZoomSdkPlugin::MeetingService->GetMeetingChatController(), chatEvents.get(), set, L"Chat controller events unavailable\n");
+		setControllerEvents(FlutterZoomSdkPlugin::MeetingService->GetMeetingClosedCaptionController(), captionEvents.get(), set, L"Closed caption controller events unavailable\n");
+	}
+
+	void FlutterZoomSdkPlugin::updateMeetingState(ZOOM_SDK_NAMESPACE::MeetingStatus status) {
+		if (meetingStateChannel) {
+			meetingStateChannel->onMeetingStatus(status);
+		}
+	}
+
+	void FlutterZoomSdkPlugin::updateStatisticsWarning(ZOOM_SDK_NAMESPACE::StatisticsWarningType type) {
+		if (meetingStateChannel) {
+			meetingStateChannel->onStatisticsWarning(type);
+		}
+	}
+
+	CallbackRecorder* FlutterZoomSdkPlugin::callbackRecorder() {
+		return callbackJournalChannel ? callbackJournalChannel->recorder() : nullptr;
+	}
+
+	void FlutterZoomSdkPlugin::sendMeetingEvent(MeetingEventRecord record) {
+		// A status or warning newer than the table has no tag to send.
+		if (record.event == kNoMeetingEvent) {
+			return;
+		}
+		if (meeting_event_sink_ && meetingEvents.wants(record.event)) {
+			meeting_event_sink_->Success(encodeMeetingEvent(record));
+		}
+		// Journaled whatever the subscription, for listeners that want more.
+		meetingJournal.push(nowMs(), std::move(record));
+	}
+
+	bool FlutterZoomSdkPlugin::startRawRecording() {
+		if (!FlutterZoomSdkPlugin::MeetingService) {
+			return false;
+		}
+
+		ZOOM_SDK_NAMESPACE::IMeetingRecordingController* recordingController = FlutterZoomSdkPlugin::MeetingService->GetMeetingRecordingController();
+
+		if (recordingController && recordingController->CanStartRawRecording() == ZOOM_SDK_NAMESPACE::SDKError::SDKERR_SUCCESS) {
+			return recordingController->StartRawRecording() == ZOOM_SDK_NAMESPACE::SDKError::SDKERR_SUCCESS;
+		}
+
+		return false;
+	}
+
+	void FlutterZoomSdkPlugin::attachRawData() {
+		if (rawDataAttached) {
+			return;
+		}
+
+		// Raw data needs either the app-level license or the raw recording
+		// privilege in the current meeting.
+		if (!FlutterZoomSdkPlugin::startRawRecording() && !ZOOM_SDK_NAMESPACE::HasRawdataLicense()) {
+			_cputts(L"Raw data is not available in this meeting\n");
+			return;
+		}
+
+		audioRawDataHub->attach(ZOOM_SDK_NAMESPACE::GetAudioRawdataHelper());
+		rawDataAttached = true;
+
+		_cputts(L"Raw data attached\n");
+	}
+
+	void FlutterZoomSdkPlugin::detachRawData() {
+		if (!rawDataAttached) {
+			return;
+		}
+
+		audioRawDataHub->detach();
+
+		if (FlutterZoomSdkPlugin::MeetingService) {
+			ZOOM_SDK_NAMESPACE::IMeetingRecordingController* recordingController = FlutterZoomSdkPlugin::MeetingService->GetMeetingRecordingController();
+
+			if (recordingController) {
+				recordingController->StopRawRecording();
+			}
+		}
+
+		rawDataAttached = false;
+	}
+
 	// class AuthEvent 
 	AuthEvent::AuthEvent() {}
 
 	AuthEvent::~AuthEvent() {}
 
 	void AuthEvent::onAuthenticationReturn(ZOOM_SDK_NAMESPACE::AuthResult ret) {
+		if (CallbackRecorder* recorder = plagin->callbackRecorder()) {
+			recorder->onAuthResult(ret);
+		}
 		if (ret == ZOOM_SDK_NAMESPACE::SDKError::SDKERR_SUCCESS) {
 			plagin->joinMeeting();
 		}
@@ -388,11 +827,23 @@ namespace flutter_zoom_sdk {
 
 	void AuthEvent::onLoginReturnWithReason(ZOOM_SDK_NAMESPACE::LOGINSTATUS ret, ZOOM_SDK_NAMESPACE::IAccountInfo* pAccountInfo, ZOOM_SDK_NAMESPACE::LoginFailReason reason) {}
 
-	void AuthEvent::onLogout() {}
+	void AuthEvent::onLogout() {
+		if (CallbackRecorder* recorder = plagin->callbackRecorder()) {
+			recorder->onLogout();
+		}
+	}
 
-	void AuthEvent::onZoomIdentityExpired() {}
+	void AuthEvent::onZoomIdentityExpired() {
+		if (CallbackRecorder* recorder = plagin->callbackRecorder()) {
+			recorder->onIdentityExpired();
+		}
+	}
 
-	void AuthEvent::onZoomAuthIdentityExpired() {}
+	void AuthEvent::onZoomAuthIdentityExpired() {
+		if (CallbackRecorder* recorder = plagin->callbackRecorder()) {
+			recorder->onIdentityExpired();
+		}
+	}
 
 	void AuthEvent::onNotificationServiceStatus(ZOOM_SDK_NAMESPACE::SDKNotificationServiceStatus status) {}
 
@@ -405,33 +856,64 @@ namespace flutter_zoom_sdk {
 	MeetingServiceEvent::~MeetingServiceEvent() {}
 
 	void MeetingServiceEvent::onMeetingStatusChanged(ZOOM_SDK_NAMESPACE::MeetingStatus status, int iResult) {
-		if (status == ZOOM_SDK_NAMESPACE::MEETING_STATUS_INMEETING) {
-			EncodableList results;
-
-			results.push_back(EncodableValue("MEETING_STATUS_INMEETING"));
-			results.push_back(EncodableValue(iResult));
-
-			plagin->meeting_event_sink_->Success(results);
+		if (CallbackRecorder* recorder = plagin->callbackRecorder()) {
+			recorder->onMeetingStatus(status, iResult);
 		}
-		else if (status == ZOOM_SDK_NAMESPACE::MEETING_STATUS_DISCONNECTING) {
-			EncodableList results;
-
-			results.push_back(EncodableValue("MEETING_STATUS_DISCONNECTING"));
-			results.push_back(EncodableValue(iResult));
+		plagin->updateControllerEvents(status);
+		plagin->updateRawDataState(status);
+		plagin->updateParticipantsState(status);
+		plagin->updateMeetingState(status);
+
+		MeetingEventRecord record;
+		record.event = meetingStatusEvent(status);
+		record.value = iResult;
+		plagin->sendMeetingEvent(std::move(record));
+	}
 
-			plagin->meeting_event_sink_->Success(results);
+	void MeetingServiceEvent::onMeetingStatisticsWarningNotification(ZOOM_SDK_NAMESPACE::StatisticsWarningType type) {
+		if (CallbackRecorder* recorder = plagin->callbackRecorder()) {
+			recorder->onStatisticsWarning(type);
 		}
+		plagin->updateStatisticsWarning(type);
+		MeetingEventRecord record;
+		record.event = statisticsWarningEvent(type);
+		record.value = static_cast<int>(type);
+		plagin->sendMeetingEvent(std::move(record));
 	}
 
-	void MeetingServiceEvent::onMeetingStatisticsWarningNotification(ZOOM_SDK_NAMESPACE::StatisticsWarningType type) {}
+	void MeetingServiceEvent::onMeetingParameterNotification(const ZOOM_SDK_NAMESPACE::MeetingParameter* meeting_param) {
+		if (!meeting_param) {
+			return;
+		}
+		if (CallbackRecorder* recorder = plagin->callbackRecorder()) {
+			recorder->onMeetingParameter(*meeting_param);
+		}
 
-	void MeetingServiceEvent::onMeetingParameterNotification(const ZOOM_SDK_NAMESPACE::MeetingParameter* meeting_param) {}
+		MeetingEventRecord record;
+		record.event = kMeetingParameterEvent;
+		record.value = static_cast<int>(meeting_param->meeting_type);
+		record.viewOnly = meeting_param->is_view_only;
+		record.autoRecordingLocal = meeting_param->is_auto_recording_local;
+		record.autoRecordingCloud = meeting_param->is_auto_recording_cloud;
+		record.meetingNumber = static_cast<int64_t>(meeting_param->meeting_number);
+		record.topic = ToUtf8(meeting_param->meeting_topic);
+		record.host = ToUtf8(meeting_param->meeting_host);
+		plagin->sendMeetingEvent(std::move(record));
+	}
 
 	void MeetingServiceEvent::onSuspendParticipantsActivities(){}
 
 	void MeetingServiceEvent::onAICompanionActiveChangeNotice(bool bActive){}
 
-	void MeetingServiceEvent::onMeetingTopicChanged(const zchar_t *sTopic){}
+	void MeetingServiceEvent::onMeetingTopicChanged(const zchar_t *sTopic) {
+		if (CallbackRecorder* recorder = plagin->callbackRecorder()) {
+			recorder->onMeetingTopic(sTopic);
+		}
+		MeetingEventRecord record;
+		record.event = kMeetingTopicEvent;
+		record.topic = ToUtf8(sTopic);
+		plagin->sendMeetingEvent(std::move(record));
+	}
 
 	void MeetingServiceEvent::onMeetingFullToWatchLiveStream(const zchar_t* sLiveStreamUrl){}
 
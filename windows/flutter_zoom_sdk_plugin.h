@@ -21,6 +21,34 @@
 #include <setting_service_interface.h>
 #include <meeting_service_components/meeting_ui_ctrl_interface.h>
 #include <meeting_service_components/meeting_configuration_interface.h>
+#include <meeting_service_components/meeting_recording_interface.h>
+#include <rawdata/zoom_rawdata_api.h>
+
+#include "audio_analysis_channel.h"
+#include "audio_mixer_channel.h"
+#include "audio_recorder_channel.h"
+#include "callback_journal_channel.h"
+#include "caption_channel.h"
+#include "chat_channel.h"
+#include "media/audio_raw_data_hub.h"
+#include "media/worker_pool.h"
+#include "meeting/event_journal.h"
+#include "meeting/meeting_event_fanout.h"
+#include "meeting/meeting_event_filter.h"
+#include "meeting_state_channel.h"
+#include "participants_channel.h"
+#include "pcm_stream_channel.h"
+#include "pip_channel.h"
+#include "platform_dispatcher.h"
+#include "raw_archive_channel.h"
+#include "recording_channel.h"
+#include "share_audio_channel.h"
+#include "share_source_channel.h"
+#include "sharing_channel.h"
+#include "speaker_channel.h"
+#include "video_filter_channel.h"
+#include "video_health_channel.h"
+#include "video_source_channel.h"
 
 namespace flutter_zoom_sdk {
 	using flutter::EncodableList;
@@ -30,6 +58,22 @@ namespace flutter_zoom_sdk {
 
     class MeetingServiceEvent;
 
+	// A meeting event as the SDK reported it. Encoded for Dart only when sent
+	// or replayed to a listener subscribed to it.
+	struct MeetingEventRecord {
+		int event = kNoMeetingEvent;
+		// The status result, the warning, or the parameter's meeting type.
+		int value = 0;
+		// The topic, for the topic and the parameter.
+		string topic;
+		// The rest of the parameter.
+		string host;
+		int64_t meetingNumber = 0;
+		bool viewOnly = false;
+		bool autoRecordingLocal = false;
+		bool autoRecordingCloud = false;
+	};
+
     ZOOM_SDK_NAMESPACE::SDK_LANGUAGE_ID LanguageIdFromString(const string &lang_in);
 
 	class FlutterZoomSdkPlugin : public flutter::Plugin {
@@ -48,6 +92,31 @@ namespace flutter_zoom_sdk {
 
 		void joinMeeting();
 
+		// Attaches or detaches the raw data pipelines as the meeting status changes.
+		void updateRawDataState(ZOOM_SDK_NAMESPACE::MeetingStatus status);
+
+		// Starts or stops following the participants as the meeting status changes.
+		void updateParticipantsState(ZOOM_SDK_NAMESPACE::MeetingStatus status);
+
+		// Sets the event fanouts on the audio, video, share, recording, chat
+		// and closed caption controllers while in a meeting and listened to.
+		void updateControllerEvents(ZOOM_SDK_NAMESPACE::MeetingStatus status);
+
+		// Records the meeting status in the meeting state.
+		void updateMeetingState(ZOOM_SDK_NAMESPACE::MeetingStatus status);
+
+		// Records a statistics warning in the meeting state.
+		void updateStatisticsWarning(ZOOM_SDK_NAMESPACE::StatisticsWarningType type);
+
+		// Sends [tag, detail] on the meeting event stream if Dart subscribed
+		// to the event, and journals the record for the next listener either
+		// way. Events newer than the tag table are dropped.
+		void sendMeetingEvent(MeetingEventRecord record);
+
+		// Where the auth and meeting service callbacks are journaled; nullptr
+		// while not recording.
+		CallbackRecorder* callbackRecorder();
+
 	private:
 		ZOOM_SDK_NAMESPACE::IAuthService* AuthService;
 		ZOOM_SDK_NAMESPACE::IMeetingService* MeetingService;
@@ -58,6 +127,85 @@ namespace flutter_zoom_sdk {
 
         unique_ptr<MeetingServiceEvent> meetingListener;
 
+		// Declared before the channels that post to it so it outlives them.
+		unique_ptr<PlatformDispatcher> dispatcher;
+
+		unique_ptr<AudioRawDataHub> audioRawDataHub;
+
+		// Shared by the analysis stages; outlives the channels that post to it.
+		unique_ptr<WorkerPool> workerPool;
+
+		// The only controller listeners; channels add to them.
+		unique_ptr<AudioEventFanout> audioEvents;
+
+		unique_ptr<VideoEventFanout> videoEvents;
+
+		unique_ptr<ShareEventFanout> shareEvents;
+
+		unique_ptr<RecordingEventFanout> recordingEvents;
+
+		unique_ptr<ChatEventFanout> chatEvents;
+
+		unique_ptr<CaptionEventFanout> captionEvents;
+
+		unique_ptr<PcmStreamChannel> pcmStreamChannel;
+
+		unique_ptr<AudioRecorderChannel> audioRecorderChannel;
+
+		unique_ptr<AudioMixerChannel> audioMixerChannel;
+
+		unique_ptr<AudioAnalysisChannel> audioAnalysisChannel;
+
+		unique_ptr<ShareAudioChannel> shareAudioChannel;
+
+		unique_ptr<VideoSourceChannel> videoSourceChannel;
+
+		unique_ptr<VideoFilterChannel> videoFilterChannel;
+
+		unique_ptr<ShareSourceChannel> shareSourceChannel;
+
+		unique_ptr<VideoHealthChannel> videoHealthChannel;
+
+		unique_ptr<RawArchiveChannel> rawArchiveChannel;
+
+		// Pauses videoHealthChannel while on; reset before it.
+		unique_ptr<PipChannel> pipChannel;
+
+		unique_ptr<ParticipantsChannel> participantsChannel;
+
+		// Follows participantsChannel's roster; reset before it.
+		unique_ptr<MeetingStateChannel> meetingStateChannel;
+
+		// Follows participantsChannel's roster and drives pipChannel; reset
+		// before both.
+		unique_ptr<SpeakerChannel> speakerChannel;
+
+		// One event channel per domain; each listens on its fanout only while
+		// Dart listens to it.
+		unique_ptr<ChatChannel> chatChannel;
+
+		unique_ptr<CaptionChannel> captionChannel;
+
+		unique_ptr<SharingChannel> sharingChannel;
+
+		unique_ptr<RecordingChannel> recordingChannel;
+
+		// Taps the fanouts and participantsChannel; reset before them.
+		unique_ptr<CallbackJournalChannel> callbackJournalChannel;
+
+		bool rawDataAttached;
+
+		// The meeting events Dart subscribed to with meeting_events_subscribe.
+		MeetingEventFilter meetingEvents;
+
+		// The latest meeting events, replayed to every new listener, so none
+		// are lost before Dart listens or across a hot restart. Kept raw, so
+		// only events a listener wants are ever encoded.
+		EventJournal<MeetingEventRecord> meetingJournal;
+
+		// Whether the fanouts with listeners should be set on the controllers.
+		bool controllerEventsSet;
+
 		// Called when a method is called on this plugin's channel from Dart.
 		void HandleMethodCall(
 			const flutter::MethodCall<EncodableValue>& method_call,
@@ -71,6 +219,13 @@ namespace flutter_zoom_sdk {
 
 		void createSettingService();
 
+		// Keeps participantsChannel following the roster while wanted.
+		void wantRoster(bool wanted);
+
+		// Sets each fanout on its controller, or clears it when nobody
+		// listens, as the meeting or the fanout's listeners change.
+		void syncControllerEvents();
+
 		bool leaveMeeting();
 
 		bool hideMeeting();
@@ -78,6 +233,12 @@ namespace flutter_zoom_sdk {
 		bool showMeeting();
 
 		void pressWinAndDownKeys();
+
+		bool startRawRecording();
+
+		void attachRawData();
+
+		void detachRawData();
 	};
 
 	class AuthEvent : public ZOOM_SDK_NAMESPACE::IAuthServiceEvent {
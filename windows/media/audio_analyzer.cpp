@@ -0,0 +1,401 @@
+#include "media/audio_analyzer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "media/loudness_meter.h"
+#include "media/real_fft.h"
+#include "media/timestamped_audio_ring.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr double kPi = 3.14159265358979323846;
+		// One second of 48 kHz stereo, well above the largest hop.
+		constexpr size_t kStreamRingSamples = 48000 * 2;
+		constexpr size_t kMinFftSize = 256;
+		constexpr size_t kMaxFftSize = 8192;
+		constexpr size_t kMinBands = 1;
+		constexpr size_t kMaxBands = 128;
+		constexpr auto kMinInterval = std::chrono::milliseconds(16);
+		constexpr auto kMaxInterval = std::chrono::milliseconds(2000);
+		constexpr size_t kIdleFrameBuffers = 16;
+		constexpr float kFloorDb = -120.0f;
+
+		template <typename T>
+		void putLE(uint8_t* dst, T value) {
+			std::memcpy(dst, &value, sizeof(T));
+		}
+
+		size_t frameCapacity(size_t prefix) {
+			return prefix + kAudioAnalysisHeaderSize + kMaxBands * sizeof(float);
+		}
+
+		float powerToDb(double power) {
+			return power > 0.0 ? std::max(kFloorDb, static_cast<float>(10.0 * std::log10(power))) : kFloorDb;
+		}
+	}
+
+	AudioAnalysisConfig AudioAnalysisConfig::normalized() const {
+		AudioAnalysisConfig config = *this;
+
+		size_t size = kMinFftSize;
+		while (size < config.fftSize && size < kMaxFftSize) {
+			size *= 2;
+		}
+		config.fftSize = size;
+		config.bands = std::clamp(config.bands, kMinBands, kMaxBands);
+		config.minFrequency = std::max(config.minFrequency, 1.0f);
+		config.maxFrequency = std::max(config.maxFrequency, config.minFrequency * 1.01f);
+		config.interval = std::clamp(config.interval, std::chrono::milliseconds(kMinInterval), std::chrono::milliseconds(kMaxInterval));
+		return config;
+	}
+
+	// Everything a pool task needs, shared with the taps so a hub dispatch that
+	// races unsubscribe finds a closed core instead of a destroyed analyzer.
+	class AudioAnalyzer::Core {
+	public:
+		Core(WorkerPool& pool, FrameSink sink, size_t reservedPrefix)
+			: reservedPrefix(reservedPrefix),
+			buffers(BufferPool::create(frameCapacity(reservedPrefix), kIdleFrameBuffers)),
+			pool_(pool),
+			sink_(std::move(sink)),
+			jobs_(0),
+			closed_(false) {}
+
+		void schedule(std::shared_ptr<Stream> stream);
+
+		void emit(PooledBuffer frame) { sink_(std::move(frame)); }
+
+		// Refuses new tasks and waits for the running ones.
+		void close() {
+			std::unique_lock<std::mutex> lock(mutex_);
+			closed_ = true;
+			idle_.wait(lock, [this]() { return jobs_ == 0; });
+		}
+
+		const size_t reservedPrefix;
+		const std::shared_ptr<BufferPool> buffers;
+
+	private:
+		void run(const std::shared_ptr<Stream>& stream);
+
+		WorkerPool& pool_;
+		FrameSink sink_;
+
+		std::mutex mutex_;
+		std::condition_variable idle_;
+		size_t jobs_;
+		bool closed_;
+	};
+
+	// One concrete stream. The SDK thread writes the ring; everything else is
+	// owned by whichever pool task holds the scheduled flag.
+	class AudioAnalyzer::Stream {
+	public:
+		Stream(const AudioStreamKey& key, const AudioAnalysisConfig& config)
+			: key(key), config(config), ring(kStreamRingSamples) {}
+
+		// Samples per channel between spectra.
+		size_t hop() const { return config.fftSize / 2; }
+
+		void process(Core& core);
+
+		const AudioStreamKey key;
+		const AudioAnalysisConfig config;
+		TimestampedAudioRing ring;
+		std::atomic<bool> scheduled{ false };
+
+	private:
+		void prepare(uint32_t sampleRate, uint32_t channels);
+
+		void analyseHop();
+
+		void emit(Core& core, uint64_t timestamp);
+
+		uint32_t sampleRate_ = 0;
+		uint32_t channels_ = 0;
+		std::unique_ptr<RealFft> fft_;
+		std::unique_ptr<LoudnessMeter> loudness_;
+		std::vector<float> window_;
+		// 4 / (N * sum(w^2)): band power relative to a full-scale sine.
+		double powerScale_ = 0.0;
+		std::vector<std::pair<size_t, size_t>> bandBins_;
+
+		std::vector<int16_t> pcm_;
+		std::vector<float> history_;
+		size_t historyFill_ = 0;
+		std::vector<float> windowed_;
+		std::vector<float> re_;
+		std::vector<float> im_;
+
+		std::vector<double> bandPower_;
+		size_t spectra_ = 0;
+		int32_t peak_ = 0;
+		uint64_t lastEmit_ = 0;
+		bool emitted_ = false;
+	};
+
+	void AudioAnalyzer::Core::schedule(std::shared_ptr<Stream> stream) {
+		if (stream->scheduled.exchange(true, std::memory_order_acq_rel)) {
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (closed_) {
+				stream->scheduled.store(false, std::memory_order_release);
+				return;
+			}
+			jobs_++;
+		}
+
+		pool_.post([this, stream]() { run(stream); });
+	}
+
+	void AudioAnalyzer::Core::run(const std::shared_ptr<Stream>& stream) {
+		const size_t hopSamples = stream->hop();
+		do {
+			stream->process(*this);
+			stream->scheduled.store(false, std::memory_order_release);
+			// Audio that arrived after the last check but before the flag was
+			// cleared would otherwise wait for the next callback.
+		} while (stream->ring.available() >= hopSamples * std::max<uint32_t>(stream->ring.channels(), 1)
+			&& !stream->scheduled.exchange(true, std::memory_order_acq_rel));
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		jobs_--;
+		idle_.notify_all();
+	}
+
+	void AudioAnalyzer::Stream::prepare(uint32_t sampleRate, uint32_t channels) {
+		sampleRate_ = sampleRate;
+		channels_ = channels;
+
+		const size_t n = config.fftSize;
+		fft_ = std::make_unique<RealFft>(n);
+		loudness_ = std::make_unique<LoudnessMeter>(sampleRate, channels);
+
+		// Periodic Hann.
+		window_.resize(n);
+		double sumSquares = 0.0;
+		for (size_t i = 0; i < n; i++) {
+			const double w = 0.5 - 0.5 * std::cos(2.0 * kPi * static_cast<double>(i) / static_cast<double>(n));
+			window_[i] = static_cast<float>(w);
+			sumSquares += w * w;
+		}
+		powerScale_ = 4.0 / (static_cast<double>(n) * sumSquares);
+
+		// Band edges in bins; narrow low bands get at least one bin.
+		const double binHz = static_cast<double>(sampleRate) / static_cast<double>(n);
+		const double nyquist = sampleRate / 2.0;
+		const double low = std::min<double>(config.minFrequency, nyquist / 2.0);
+		const double high = std::min<double>(config.maxFrequency, nyquist);
+		const size_t lastBin = n / 2;
+		bandBins_.resize(config.bands);
+		for (size_t b = 0; b < config.bands; b++) {
+			const double from = low * std::pow(high / low, static_cast<double>(b) / config.bands);
+			const double to = low * std::pow(high / low, static_cast<double>(b + 1) / config.bands);
+			size_t first = std::min(static_cast<size_t>(std::lround(from / binHz)), lastBin);
+			size_t last = std::min(static_cast<size_t>(std::lround(to / binHz)), lastBin + 1);
+			if (last <= first) {
+				last = std::min(first + 1, lastBin + 1);
+				first = last - 1;
+			}
+			bandBins_[b] = { first, last };
+		}
+
+		pcm_.resize(hop() * channels);
+		history_.assign(n, 0.0f);
+		historyFill_ = 0;
+		windowed_.resize(n);
+		re_.resize(fft_->binCount());
+		im_.resize(fft_->binCount());
+		bandPower_.assign(config.bands, 0.0);
+		spectra_ = 0;
+		peak_ = 0;
+		emitted_ = false;
+	}
+
+	void AudioAnalyzer::Stream::process(Core& core) {
+		const uint32_t rate = ring.sampleRate();
+		const uint32_t channels = std::max<uint32_t>(ring.channels(), 1);
+		if (rate == 0) {
+			return;
+		}
+		if (rate != sampleRate_ || channels != channels_) {
+			prepare(rate, channels);
+		}
+
+		const size_t hopFrames = hop();
+		while (ring.available() >= hopFrames * channels) {
+			const uint64_t timestamp = ring.frontTimestamp();
+			ring.read(pcm_.data(), pcm_.size());
+
+			loudness_->add(pcm_.data(), hopFrames);
+			analyseHop();
+
+			const uint64_t end = timestamp + hopFrames * 1000 / sampleRate_;
+			if (!emitted_ || end < lastEmit_ || end - lastEmit_ >= static_cast<uint64_t>(config.interval.count())) {
+				emit(core, end);
+			}
+		}
+	}
+
+	void AudioAnalyzer::Stream::analyseHop() {
+		constexpr float kScale = 1.0f / 32768.0f;
+		const size_t n = config.fftSize;
+		const size_t hopFrames = hop();
+
+		// Slide the analysis window by one hop, downmixing to mono.
+		std::memmove(history_.data(), history_.data() + hopFrames, (n - hopFrames) * sizeof(float));
+		float* tail = history_.data() + (n - hopFrames);
+		const float channelScale = kScale / static_cast<float>(channels_);
+		for (size_t i = 0; i < hopFrames; i++) {
+			int32_t sum = 0;
+			for (uint32_t c = 0; c < channels_; c++) {
+				const int32_t sample = pcm_[i * channels_ + c];
+				sum += sample;
+				peak_ = std::max(peak_, std::abs(sample));
+			}
+			tail[i] = static_cast<float>(sum) * channelScale;
+		}
+		historyFill_ = std::min(historyFill_ + hopFrames, n);
+		if (historyFill_ < n) {
+			return;
+		}
+
+		for (size_t i = 0; i < n; i++) {
+			windowed_[i] = history_[i] * window_[i];
+		}
+		fft_->forward(windowed_.data(), re_.data(), im_.data());
+
+		for (size_t b = 0; b < bandBins_.size(); b++) {
+			double power = 0.0;
+			for (size_t k = bandBins_[b].first; k < bandBins_[b].second; k++) {
+				power += static_cast<double>(re_[k]) * re_[k] + static_cast<double>(im_[k]) * im_[k];
+			}
+			bandPower_[b] += power * powerScale_;
+		}
+		spectra_++;
+	}
+
+	void AudioAnalyzer::Stream::emit(Core& core, uint64_t timestamp) {
+		const size_t bands = bandPower_.size();
+
+		PooledBuffer frame = core.buffers->acquire();
+		frame->resize(core.reservedPrefix + kAudioAnalysisHeaderSize + bands * sizeof(float));
+
+		uint8_t* header = frame->data() + core.reservedPrefix;
+		header[0] = kAudioAnalysisVersion;
+		header[1] = static_cast<uint8_t>(key.kind);
+		putLE<uint16_t>(header + 2, static_cast<uint16_t>(bands));
+		putLE<uint32_t>(header + 4, key.id);
+		putLE<uint32_t>(header + 8, sampleRate_);
+		putLE<uint32_t>(header + 12, ring.takeDropped());
+		putLE<uint64_t>(header + 16, timestamp);
+		putLE<float>(header + 24, loudness_->momentary());
+		putLE<float>(header + 28, loudness_->shortTerm());
+		putLE<float>(header + 32, loudness_->integrated());
+		const double peak = static_cast<double>(peak_) / 32768.0;
+		putLE<float>(header + 36, powerToDb(peak * peak));
+
+		uint8_t* levels = header + kAudioAnalysisHeaderSize;
+		for (size_t b = 0; b < bands; b++) {
+			const float level = spectra_ > 0 ? powerToDb(bandPower_[b] / static_cast<double>(spectra_)) : kFloorDb;
+			putLE<float>(levels + b * sizeof(float), level);
+		}
+
+		std::fill(bandPower_.begin(), bandPower_.end(), 0.0);
+		spectra_ = 0;
+		peak_ = 0;
+		lastEmit_ = timestamp;
+		emitted_ = true;
+
+		core.emit(std::move(frame));
+	}
+
+	AudioAnalyzer::Tap::Tap(std::shared_ptr<Core> core, const AudioAnalysisConfig& config)
+		: core_(std::move(core)), config_(config) {}
+
+	void AudioAnalyzer::Tap::onAudioFrame(const AudioStreamKey& key, const AudioFrame& frame) {
+		std::shared_ptr<Stream> stream;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			auto& slot = streams_[key];
+			if (!slot) {
+				slot = std::make_shared<Stream>(key, config_);
+			}
+			stream = slot;
+		}
+
+		stream->ring.write(frame);
+		if (stream->ring.available() >= stream->hop() * std::max<uint32_t>(frame.channels, 1)) {
+			core_->schedule(std::move(stream));
+		}
+	}
+
+	AudioAnalyzer::AudioAnalyzer(AudioRawDataHub& hub, WorkerPool& pool, FrameSink sink, size_t reservedPrefix)
+		: hub_(hub),
+		core_(std::make_shared<Core>(pool, std::move(sink), reservedPrefix)) {}
+
+	AudioAnalyzer::~AudioAnalyzer() {
+		unsubscribeAll();
+		core_->close();
+	}
+
+	bool AudioAnalyzer::subscribe(const AudioStreamKey& key, const AudioAnalysisConfig& config) {
+		std::shared_ptr<Tap> tap;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (taps_.count(key)) {
+				return false;
+			}
+			tap = std::make_shared<Tap>(core_, config.normalized());
+			taps_.emplace(key, tap);
+		}
+
+		hub_.addConsumer(key, tap);
+		return true;
+	}
+
+	bool AudioAnalyzer::unsubscribe(const AudioStreamKey& key) {
+		std::shared_ptr<Tap> tap;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			auto it = taps_.find(key);
+			if (it == taps_.end()) {
+				return false;
+			}
+			tap = it->second;
+			taps_.erase(it);
+		}
+
+		hub_.removeConsumer(key, tap);
+		return true;
+	}
+
+	void AudioAnalyzer::unsubscribeAll() {
+		std::unordered_map<AudioStreamKey, std::shared_ptr<Tap>, AudioStreamKeyHash> taps;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			taps.swap(taps_);
+		}
+
+		for (auto& entry : taps) {
+			hub_.removeConsumer(entry.first, entry.second);
+		}
+	}
+
+	size_t AudioAnalyzer::subscriptionCount() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return taps_.size();
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,107 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_AUDIO_ANALYZER_H_
+#define FLUTTER_PLUGIN_MEDIA_AUDIO_ANALYZER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "media/audio_raw_data_hub.h"
+#include "media/audio_stream.h"
+#include "media/buffer_pool.h"
+#include "media/worker_pool.h"
+
+namespace flutter_zoom_sdk {
+
+	// Layout of every analysis frame, all little-endian:
+	//   0  u8   version (kAudioAnalysisVersion)
+	//   1  u8   AudioStreamKind
+	//   2  u16  band count
+	//   4  u32  stream id
+	//   8  u32  sample rate
+	//   12 u32  samples dropped on this stream since the previous frame
+	//   16 u64  timestamp of the newest analysed sample, milliseconds
+	//   24 f32  momentary loudness, LUFS
+	//   28 f32  short-term loudness, LUFS
+	//   32 f32  integrated loudness, LUFS
+	//   36 f32  sample peak since the previous frame, dBFS
+	//   40      f32 band levels, dBFS, lowest band first
+	// Loudness is -infinity until enough audio has been seen; levels floor at
+	// -120 dBFS.
+	constexpr uint8_t kAudioAnalysisVersion = 1;
+	constexpr size_t kAudioAnalysisHeaderSize = 40;
+
+	struct AudioAnalysisConfig {
+		// Power of two, 256 to 8192. Spectra are taken every fftSize / 2 frames.
+		size_t fftSize = 2048;
+		// Log-spaced between minFrequency and maxFrequency (clamped to Nyquist).
+		size_t bands = 32;
+		float minFrequency = 40.0f;
+		float maxFrequency = 16000.0f;
+		// At most one frame per interval of audio; band levels are the mean
+		// power of the spectra taken in between.
+		std::chrono::milliseconds interval{ 50 };
+
+		// Clamps every field into its supported range.
+		AudioAnalysisConfig normalized() const;
+	};
+
+	// Spectrum and loudness per subscribed stream. SDK threads only copy
+	// samples into a per-stream ring; windowing, FFT, band folding and
+	// K-weighting run as tasks on the shared worker pool, one task per stream
+	// at a time. Wildcard subscriptions analyse each matching stream
+	// separately.
+	class AudioAnalyzer {
+	public:
+		// Receives a finished frame. The first reservedPrefix bytes of the buffer
+		// are left for the caller, the header follows. Called on pool threads.
+		using FrameSink = std::function<void(PooledBuffer frame)>;
+
+		AudioAnalyzer(AudioRawDataHub& hub, WorkerPool& pool, FrameSink sink, size_t reservedPrefix = 0);
+
+		// Waits for running analysis tasks.
+		~AudioAnalyzer();
+
+		AudioAnalyzer(const AudioAnalyzer&) = delete;
+		AudioAnalyzer& operator=(const AudioAnalyzer&) = delete;
+
+		bool subscribe(const AudioStreamKey& key, const AudioAnalysisConfig& config);
+
+		bool unsubscribe(const AudioStreamKey& key);
+
+		void unsubscribeAll();
+
+		size_t subscriptionCount();
+
+	private:
+		class Core;
+		class Stream;
+
+		// Consumer registered with the hub for one subscription.
+		class Tap : public IAudioStreamConsumer {
+		public:
+			Tap(std::shared_ptr<Core> core, const AudioAnalysisConfig& config);
+
+			void onAudioFrame(const AudioStreamKey& key, const AudioFrame& frame) override;
+
+		private:
+			const std::shared_ptr<Core> core_;
+			const AudioAnalysisConfig config_;
+
+			std::mutex mutex_;
+			std::unordered_map<AudioStreamKey, std::shared_ptr<Stream>, AudioStreamKeyHash> streams_;
+		};
+
+		AudioRawDataHub& hub_;
+		std::shared_ptr<Core> core_;
+
+		std::mutex mutex_;
+		std::unordered_map<AudioStreamKey, std::shared_ptr<Tap>, AudioStreamKeyHash> taps_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_AUDIO_ANALYZER_H_
@@ -0,0 +1,78 @@
+#include "media/audio_mix_kernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "media/simd.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		inline int16_t saturate(int32_t value) {
+			return static_cast<int16_t>(std::min(32767, std::max(-32768, value)));
+		}
+
+		inline int16_t scaleQ14(int16_t sample, int16_t gainQ14) {
+			return saturate((static_cast<int32_t>(sample) * gainQ14 + (1 << 13)) >> 14);
+		}
+	}
+
+	int16_t GainToQ14(float gain) {
+		const float scaled = std::round(std::max(0.0f, gain) * kUnityGainQ14);
+		return static_cast<int16_t>(std::min(scaled, 32767.0f));
+	}
+
+	void MixAccumulateScalar(int16_t* acc, const int16_t* src, size_t count, int16_t gainQ14) {
+		for (size_t i = 0; i < count; ++i) {
+			acc[i] = saturate(static_cast<int32_t>(acc[i]) + scaleQ14(src[i], gainQ14));
+		}
+	}
+
+	void MixAccumulate(int16_t* acc, const int16_t* src, size_t count, int16_t gainQ14) {
+		size_t i = 0;
+
+#if defined(FLUTTER_ZOOM_SDK_SSE2)
+		if (gainQ14 == kUnityGainQ14) {
+			for (; i + 8 <= count; i += 8) {
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + i));
+				__m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(acc + i), _mm_adds_epi16(a, s));
+			}
+		}
+		else {
+			const __m128i gain = _mm_set1_epi16(gainQ14);
+			const __m128i round = _mm_set1_epi32(1 << 13);
+			for (; i + 8 <= count; i += 8) {
+				__m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				// Full 32-bit products from the low and high halves.
+				__m128i lo = _mm_mullo_epi16(s, gain);
+				__m128i hi = _mm_mulhi_epi16(s, gain);
+				__m128i p0 = _mm_srai_epi32(_mm_add_epi32(_mm_unpacklo_epi16(lo, hi), round), 14);
+				__m128i p1 = _mm_srai_epi32(_mm_add_epi32(_mm_unpackhi_epi16(lo, hi), round), 14);
+				__m128i scaled = _mm_packs_epi32(p0, p1);
+
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(acc + i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(acc + i), _mm_adds_epi16(a, scaled));
+			}
+		}
+#elif defined(FLUTTER_ZOOM_SDK_NEON)
+		const int16x4_t gain = vdup_n_s16(gainQ14);
+		for (; i + 8 <= count; i += 8) {
+			int16x8_t s = vld1q_s16(src + i);
+			int32x4_t p0 = vmull_s16(vget_low_s16(s), gain);
+			int32x4_t p1 = vmull_s16(vget_high_s16(s), gain);
+			int16x8_t scaled = vcombine_s16(vqrshrn_n_s32(p0, 14), vqrshrn_n_s32(p1, 14));
+			vst1q_s16(acc + i, vqaddq_s16(vld1q_s16(acc + i), scaled));
+		}
+#endif
+
+		MixAccumulateScalar(acc + i, src + i, count - i, gainQ14);
+	}
+
+	void DownmixStereo(int16_t* dst, const int16_t* src, size_t frames) {
+		for (size_t i = 0; i < frames; ++i) {
+			dst[i] = static_cast<int16_t>((static_cast<int32_t>(src[2 * i]) + src[2 * i + 1]) >> 1);
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
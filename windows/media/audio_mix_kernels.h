@@ -0,0 +1,25 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_AUDIO_MIX_KERNELS_H_
+#define FLUTTER_PLUGIN_MEDIA_AUDIO_MIX_KERNELS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace flutter_zoom_sdk {
+
+	// Gains are Q14 fixed point: 16384 is unity, 32767 just under +6 dB.
+	constexpr int16_t kUnityGainQ14 = 16384;
+
+	int16_t GainToQ14(float gain);
+
+	// acc[i] = saturate(acc[i] + round(src[i] * gain)), vectorized.
+	void MixAccumulate(int16_t* acc, const int16_t* src, size_t count, int16_t gainQ14);
+
+	// Reference implementation of MixAccumulate.
+	void MixAccumulateScalar(int16_t* acc, const int16_t* src, size_t count, int16_t gainQ14);
+
+	// Averages interleaved stereo pairs into mono. dst may alias src.
+	void DownmixStereo(int16_t* dst, const int16_t* src, size_t frames);
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_AUDIO_MIX_KERNELS_H_
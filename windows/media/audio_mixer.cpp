@@ -0,0 +1,225 @@
+#include "media/audio_mixer.h"
+
+#include <algorithm>
+
+#include "media/audio_mix_kernels.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// Half a second per input at 48 kHz stereo.
+		constexpr size_t kInputRingSamples = 48000;
+		constexpr auto kPumpInterval = std::chrono::milliseconds(5);
+		// With no new input for this long the mix clock restarts on the next
+		// frame instead of mixing a long run of silence.
+		constexpr auto kIdleReset = std::chrono::milliseconds(500);
+
+		uint64_t msToFrames(uint64_t milliseconds, uint32_t sampleRate) {
+			return milliseconds * sampleRate / 1000;
+		}
+	}
+
+	AudioMixer::Input::Input(AudioMixer& mixer, const AudioStreamKey& streamKey, int16_t gain)
+		: key(streamKey), gainQ14(gain), ring(kInputRingSamples), mixer_(mixer) {}
+
+	void AudioMixer::Input::onAudioFrame(const AudioStreamKey&, const AudioFrame& frame) {
+		ring.write(frame);
+		mixer_.noteTimestamp(frame.timestamp);
+	}
+
+	AudioMixer::AudioMixer(AudioRawDataHub& hub, uint32_t mixId, const AudioMixerConfig& config)
+		: hub_(hub),
+		mixId_(mixId),
+		config_(config),
+		blockFrames_(static_cast<size_t>(msToFrames(config.block.count(), config.sampleRate))),
+		stopping_(false),
+		nextBlock_(0),
+		lastNewest_(0),
+		lastProgress_(std::chrono::steady_clock::now()),
+		mix_(blockFrames_) {
+		if (config_.threaded) {
+			worker_ = std::thread(&AudioMixer::run, this);
+		}
+	}
+
+	AudioMixer::~AudioMixer() {
+		setInputs({});
+
+		if (worker_.joinable()) {
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				stopping_ = true;
+			}
+			wake_.notify_all();
+			worker_.join();
+		}
+	}
+
+	void AudioMixer::setInputs(const std::vector<AudioMixInput>& inputs) {
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		std::vector<std::shared_ptr<Input>> next;
+		for (const auto& input : inputs) {
+			if (input.key.isWildcard() || input.key == outputKey()) {
+				continue;
+			}
+
+			auto existing = std::find_if(inputs_.begin(), inputs_.end(),
+				[&](const std::shared_ptr<Input>& current) { return current->key == input.key; });
+
+			if (existing != inputs_.end()) {
+				(*existing)->gainQ14.store(GainToQ14(input.gain), std::memory_order_relaxed);
+				next.push_back(*existing);
+			}
+			else {
+				next.push_back(std::make_shared<Input>(*this, input.key, GainToQ14(input.gain)));
+				hub_.addConsumer(input.key, next.back());
+			}
+		}
+
+		for (const auto& current : inputs_) {
+			if (std::find(next.begin(), next.end(), current) == next.end()) {
+				hub_.removeConsumer(current->key, current);
+			}
+		}
+
+		inputs_.swap(next);
+		stats_.inputs = static_cast<uint32_t>(inputs_.size());
+	}
+
+	AudioMixerStats AudioMixer::stats() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return stats_;
+	}
+
+	void AudioMixer::noteTimestamp(uint64_t timestamp) {
+		uint64_t newest = newestTimestamp_.load(std::memory_order_relaxed);
+		while (timestamp > newest &&
+			!newestTimestamp_.compare_exchange_weak(newest, timestamp, std::memory_order_relaxed)) {
+		}
+	}
+
+	void AudioMixer::pump() {
+		std::vector<std::shared_ptr<Input>> inputs;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			inputs = inputs_;
+		}
+
+		const uint64_t newest = newestTimestamp_.load(std::memory_order_relaxed);
+		const auto now = std::chrono::steady_clock::now();
+
+		if (newest != lastNewest_) {
+			lastNewest_ = newest;
+			lastProgress_ = now;
+		}
+		else if (nextBlock_ != 0 && now - lastProgress_ > kIdleReset) {
+			nextBlock_ = 0;
+			for (auto& input : inputs) {
+				input->aligned = false;
+			}
+			return;
+		}
+
+		const uint64_t jitter = static_cast<uint64_t>(config_.jitter.count());
+		const uint64_t block = static_cast<uint64_t>(config_.block.count());
+
+		if (nextBlock_ == 0) {
+			if (newest < jitter + block) {
+				return;
+			}
+			nextBlock_ = newest - jitter;
+		}
+
+		while (nextBlock_ + block + jitter <= newest) {
+			mixBlock(nextBlock_, inputs);
+			nextBlock_ += block;
+		}
+	}
+
+	void AudioMixer::mixBlock(uint64_t blockStart, const std::vector<std::shared_ptr<Input>>& inputs) {
+		std::fill(mix_.begin(), mix_.end(), static_cast<int16_t>(0));
+
+		const uint32_t rate = config_.sampleRate;
+		const uint64_t tolerance = static_cast<uint64_t>(config_.tolerance.count());
+		AudioMixerStats delta;
+
+		for (const auto& input : inputs) {
+			TimestampedAudioRing& ring = input->ring;
+			delta.droppedSamples += ring.takeDropped();
+
+			const uint32_t inputRate = ring.sampleRate();
+			if (inputRate == 0) {
+				continue;
+			}
+			if (inputRate != rate) {
+				delta.rateMismatches += ring.skip(ring.available());
+				continue;
+			}
+
+			const size_t channels = std::min<size_t>(2, std::max<uint32_t>(1, ring.channels()));
+			if (ring.available() < channels) {
+				continue;
+			}
+
+			size_t offset = 0;
+			const uint64_t front = ring.frontTimestamp();
+			if (!input->aligned || front + tolerance < blockStart || front > blockStart + tolerance) {
+				if (front < blockStart) {
+					const size_t late = static_cast<size_t>(msToFrames(blockStart - front, rate)) * channels;
+					const size_t skipped = ring.skip(std::min(late, ring.available()));
+					delta.lateSamples += skipped;
+					if (ring.available() < channels) {
+						input->aligned = false;
+						continue;
+					}
+				}
+				else {
+					offset = static_cast<size_t>(msToFrames(front - blockStart, rate));
+					if (offset >= blockFrames_) {
+						continue;
+					}
+				}
+				input->aligned = true;
+			}
+
+			const size_t frames = std::min(blockFrames_ - offset, ring.available() / channels);
+			scratch_.resize(frames * channels);
+			ring.read(scratch_.data(), frames * channels);
+			if (channels == 2) {
+				DownmixStereo(scratch_.data(), scratch_.data(), frames);
+			}
+
+			MixAccumulate(mix_.data() + offset, scratch_.data(), frames, input->gainQ14.load(std::memory_order_relaxed));
+		}
+
+		AudioFrame frame;
+		frame.samples = mix_.data();
+		frame.sampleCount = blockFrames_;
+		frame.sampleRate = rate;
+		frame.channels = 1;
+		frame.timestamp = blockStart;
+		hub_.publish(outputKey(), frame);
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		stats_.blocks++;
+		stats_.lateSamples += delta.lateSamples;
+		stats_.droppedSamples += delta.droppedSamples;
+		stats_.rateMismatches += delta.rateMismatches;
+	}
+
+	void AudioMixer::run() {
+		std::unique_lock<std::mutex> lock(mutex_);
+		while (!stopping_) {
+			wake_.wait_for(lock, kPumpInterval);
+			if (stopping_) {
+				break;
+			}
+
+			lock.unlock();
+			pump();
+			lock.lock();
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,121 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_AUDIO_MIXER_H_
+#define FLUTTER_PLUGIN_MEDIA_AUDIO_MIXER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "media/audio_raw_data_hub.h"
+#include "media/audio_stream.h"
+#include "media/timestamped_audio_ring.h"
+
+namespace flutter_zoom_sdk {
+
+	struct AudioMixInput {
+		AudioStreamKey key;
+		float gain = 1.0f;
+	};
+
+	struct AudioMixerConfig {
+		uint32_t sampleRate = 32000;
+		std::chrono::milliseconds block{ 10 };
+		// How far the mix trails the newest input timestamp, to let slower
+		// streams catch up before their slot is mixed.
+		std::chrono::milliseconds jitter{ 60 };
+		// Inputs further than this from the mix clock are re-aligned by
+		// skipping or padding; closer ones are read back to back.
+		std::chrono::milliseconds tolerance{ 20 };
+		// False leaves pumping to the caller (benchmarks, replay).
+		bool threaded = true;
+	};
+
+	struct AudioMixerStats {
+		uint64_t blocks = 0;
+		uint64_t lateSamples = 0;      // skipped because they arrived after their slot
+		uint64_t droppedSamples = 0;   // lost to full input rings
+		uint64_t rateMismatches = 0;   // input samples ignored for a foreign sample rate
+		uint32_t inputs = 0;
+	};
+
+	// Mixes a chosen set of streams (one-way users, interpreter languages,
+	// other mixes) with per-input gains into a mono stream that the hub
+	// publishes as AudioStreamKind::Mix with this mixer's id. Anything that
+	// consumes hub streams — PCM streaming, the recorder — can take the mix.
+	// Inputs are aligned on AudioRawData::GetTimeStamp and summed with
+	// saturating int16 vector adds.
+	class AudioMixer {
+	public:
+		AudioMixer(AudioRawDataHub& hub, uint32_t mixId, const AudioMixerConfig& config = AudioMixerConfig());
+
+		~AudioMixer();
+
+		AudioMixer(const AudioMixer&) = delete;
+		AudioMixer& operator=(const AudioMixer&) = delete;
+
+		// Replaces the input set. Inputs kept across calls keep their buffered
+		// audio and only change gain. Wildcard keys are ignored.
+		void setInputs(const std::vector<AudioMixInput>& inputs);
+
+		AudioStreamKey outputKey() const { return AudioStreamKey{ AudioStreamKind::Mix, mixId_ }; }
+
+		AudioMixerStats stats();
+
+		// Mixes every block that is due. Called by the worker thread, or by the
+		// owner when config.threaded is false.
+		void pump();
+
+	private:
+		class Input : public IAudioStreamConsumer {
+		public:
+			Input(AudioMixer& mixer, const AudioStreamKey& key, int16_t gainQ14);
+
+			void onAudioFrame(const AudioStreamKey& key, const AudioFrame& frame) override;
+
+			const AudioStreamKey key;
+			std::atomic<int16_t> gainQ14;
+			TimestampedAudioRing ring;
+			// Mixer-thread owned: read back to back until drift exceeds tolerance.
+			bool aligned = false;
+
+		private:
+			AudioMixer& mixer_;
+		};
+
+		void noteTimestamp(uint64_t timestamp);
+
+		void mixBlock(uint64_t blockStart, const std::vector<std::shared_ptr<Input>>& inputs);
+
+		void run();
+
+		AudioRawDataHub& hub_;
+		const uint32_t mixId_;
+		const AudioMixerConfig config_;
+		const size_t blockFrames_;
+
+		// Newest input timestamp, written by SDK threads.
+		std::atomic<uint64_t> newestTimestamp_{ 0 };
+
+		std::mutex mutex_;
+		std::condition_variable wake_;
+		std::vector<std::shared_ptr<Input>> inputs_;
+		AudioMixerStats stats_;
+		bool stopping_;
+
+		// Pump-owned.
+		uint64_t nextBlock_;
+		uint64_t lastNewest_;
+		std::chrono::steady_clock::time_point lastProgress_;
+		std::vector<int16_t> mix_;
+		std::vector<int16_t> scratch_;
+
+		std::thread worker_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_AUDIO_MIXER_H_
@@ -0,0 +1,196 @@
+#include "media/audio_raw_data_hub.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		uint32_t kindBit(AudioStreamKind kind) {
+			return 1u << static_cast<uint32_t>(kind);
+		}
+	}
+
+	bool AudioRawDataHub::RouteTable::wantsInterpreters() const {
+		if (wildcardKinds & kindBit(AudioStreamKind::Interpreter)) {
+			return true;
+		}
+		for (const auto& route : routes) {
+			if (route.first.kind == AudioStreamKind::Interpreter) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool AudioRawDataHub::RouteTable::wantsSdkAudio() const {
+		for (const auto& route : routes) {
+			if (route.first.kind != AudioStreamKind::Mix) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	AudioRawDataHub::AudioRawDataHub()
+		: routes_(std::make_shared<const RouteTable>()),
+		helper_(nullptr),
+		subscribed_(false),
+		subscribedWithInterpreters_(false) {}
+
+	AudioRawDataHub::~AudioRawDataHub() {
+		detach();
+	}
+
+	void AudioRawDataHub::attach(ZOOM_SDK_NAMESPACE::IZoomSDKAudioRawDataHelper* helper) {
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		if (helper_ == helper) {
+			return;
+		}
+
+		if (helper_ && subscribed_) {
+			helper_->unSubscribe();
+		}
+		subscribed_ = false;
+		helper_ = helper;
+
+		updateSubscriptionLocked();
+	}
+
+	void AudioRawDataHub::detach() {
+		attach(nullptr);
+	}
+
+	bool AudioRawDataHub::isSubscribed() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return subscribed_;
+	}
+
+	void AudioRawDataHub::addConsumer(const AudioStreamKey& key, std::shared_ptr<IAudioStreamConsumer> consumer) {
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		auto next = std::make_shared<RouteTable>(*std::atomic_load(&routes_));
+		auto& consumers = next->routes[key];
+		if (std::find(consumers.begin(), consumers.end(), consumer) == consumers.end()) {
+			consumers.push_back(std::move(consumer));
+		}
+		if (key.isWildcard()) {
+			next->wildcardKinds |= kindBit(key.kind);
+		}
+		std::atomic_store(&routes_, std::shared_ptr<const RouteTable>(std::move(next)));
+
+		updateSubscriptionLocked();
+	}
+
+	void AudioRawDataHub::removeConsumer(const AudioStreamKey& key, const std::shared_ptr<IAudioStreamConsumer>& consumer) {
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		auto next = std::make_shared<RouteTable>(*std::atomic_load(&routes_));
+		auto it = next->routes.find(key);
+		if (it == next->routes.end()) {
+			return;
+		}
+
+		auto& consumers = it->second;
+		consumers.erase(std::remove(consumers.begin(), consumers.end(), consumer), consumers.end());
+		if (consumers.empty()) {
+			next->routes.erase(it);
+			if (key.isWildcard()) {
+				next->wildcardKinds &= ~kindBit(key.kind);
+			}
+		}
+		std::atomic_store(&routes_, std::shared_ptr<const RouteTable>(std::move(next)));
+
+		updateSubscriptionLocked();
+	}
+
+	void AudioRawDataHub::updateSubscriptionLocked() {
+		if (!helper_) {
+			return;
+		}
+
+		auto routes = std::atomic_load(&routes_);
+		const bool wanted = routes->wantsSdkAudio();
+		const bool withInterpreters = routes->wantsInterpreters();
+
+		// The interpreter flag is fixed per subscription, so a change means
+		// subscribing again.
+		if (subscribed_ && (!wanted || withInterpreters != subscribedWithInterpreters_)) {
+			helper_->unSubscribe();
+			subscribed_ = false;
+		}
+
+		if (wanted && !subscribed_) {
+			subscribed_ = helper_->subscribe(this, withInterpreters) == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS;
+			subscribedWithInterpreters_ = withInterpreters;
+		}
+	}
+
+	void AudioRawDataHub::dispatch(const AudioStreamKey& key, AudioRawData* data) {
+		if (!data) {
+			return;
+		}
+
+		// The snapshot keeps the consumers alive even if they are removed while
+		// this callback is still running.
+		auto routes = std::atomic_load(&routes_);
+		if (!routes->routes.count(key) && !(routes->wildcardKinds & kindBit(key.kind))) {
+			return;
+		}
+
+		AudioFrame frame;
+		frame.samples = reinterpret_cast<const int16_t*>(data->GetBuffer());
+		frame.sampleCount = data->GetBufferLen() / sizeof(int16_t);
+		frame.sampleRate = data->GetSampleRate();
+		frame.channels = std::max(1u, data->GetChannelNum());
+		frame.timestamp = data->GetTimeStamp();
+
+		dispatchFrame(*routes, key, frame);
+	}
+
+	void AudioRawDataHub::publish(const AudioStreamKey& key, const AudioFrame& frame) {
+		auto routes = std::atomic_load(&routes_);
+		dispatchFrame(*routes, key, frame);
+	}
+
+	void AudioRawDataHub::dispatchFrame(const RouteTable& routes, const AudioStreamKey& key, const AudioFrame& frame) {
+		auto it = routes.routes.find(key);
+		if (it != routes.routes.end()) {
+			for (const auto& consumer : it->second) {
+				consumer->onAudioFrame(key, frame);
+			}
+		}
+
+		if (routes.wildcardKinds & kindBit(key.kind)) {
+			auto itAny = routes.routes.find(AudioStreamKey{ key.kind, kAnyStreamId });
+			if (itAny != routes.routes.end()) {
+				for (const auto& consumer : itAny->second) {
+					consumer->onAudioFrame(key, frame);
+				}
+			}
+		}
+	}
+
+	void AudioRawDataHub::onMixedAudioRawDataReceived(AudioRawData* data_) {
+		dispatch(AudioStreamKey{ AudioStreamKind::Mixed, 0 }, data_);
+	}
+
+	void AudioRawDataHub::onOneWayAudioRawDataReceived(AudioRawData* data_, uint32_t user_id) {
+		dispatch(AudioStreamKey{ AudioStreamKind::OneWay, user_id }, data_);
+	}
+
+	void AudioRawDataHub::onShareAudioRawDataReceived(AudioRawData* data_, uint32_t user_id) {
+		dispatch(AudioStreamKey{ AudioStreamKind::Share, user_id }, data_);
+	}
+
+	void AudioRawDataHub::onOneWayInterpreterAudioRawDataReceived(AudioRawData* data_, const zchar_t* pLanguageName) {
+		const uint32_t languageId = languages_.intern(pLanguageName);
+		if (languageId == LanguageRegistry::kInvalidId) {
+			return;
+		}
+
+		dispatch(AudioStreamKey{ AudioStreamKind::Interpreter, languageId }, data_);
+	}
+
+}  // namespace flutter_zoom_sdk
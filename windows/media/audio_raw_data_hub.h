@@ -0,0 +1,96 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_AUDIO_RAW_DATA_HUB_H_
+#define FLUTTER_PLUGIN_MEDIA_AUDIO_RAW_DATA_HUB_H_
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <zoom_sdk_def.h>
+#include <zoom_sdk_raw_data_def.h>
+#include <rawdata/rawdata_audio_helper_interface.h>
+
+#include "media/audio_stream.h"
+#include "media/language_registry.h"
+
+namespace flutter_zoom_sdk {
+
+	// Single IZoomSDKAudioRawDataDelegate for the plugin. Fans each raw audio
+	// callback out to the consumers registered for that stream. The SDK
+	// subscription is only held while at least one consumer exists, and a
+	// stream nobody asked for is dropped after one map lookup. Interpreter
+	// channels are only requested from the SDK while someone consumes them and
+	// are demultiplexed by interned language id.
+	class AudioRawDataHub : public ZOOM_SDK_NAMESPACE::IZoomSDKAudioRawDataDelegate {
+	public:
+		AudioRawDataHub();
+
+		virtual ~AudioRawDataHub();
+
+		AudioRawDataHub(const AudioRawDataHub&) = delete;
+		AudioRawDataHub& operator=(const AudioRawDataHub&) = delete;
+
+		// Called when raw data becomes available (in meeting, license granted)
+		// and when it goes away. Passing nullptr detaches.
+		void attach(ZOOM_SDK_NAMESPACE::IZoomSDKAudioRawDataHelper* helper);
+
+		void detach();
+
+		bool isSubscribed();
+
+		// A key with kAnyStreamId receives every stream of that kind, including
+		// ones that appear later (new users, new interpretation languages).
+		void addConsumer(const AudioStreamKey& key, std::shared_ptr<IAudioStreamConsumer> consumer);
+
+		void removeConsumer(const AudioStreamKey& key, const std::shared_ptr<IAudioStreamConsumer>& consumer);
+
+		// Feeds a plugin-produced stream (e.g. an AudioMixer output) to its
+		// consumers as if it came from the SDK.
+		void publish(const AudioStreamKey& key, const AudioFrame& frame);
+
+		LanguageRegistry& languages() { return languages_; }
+
+		void onMixedAudioRawDataReceived(AudioRawData* data_) override;
+
+		void onOneWayAudioRawDataReceived(AudioRawData* data_, uint32_t user_id) override;
+
+		void onShareAudioRawDataReceived(AudioRawData* data_, uint32_t user_id) override;
+
+		void onOneWayInterpreterAudioRawDataReceived(AudioRawData* data_, const zchar_t* pLanguageName) override;
+
+	private:
+		using ConsumerList = std::vector<std::shared_ptr<IAudioStreamConsumer>>;
+
+		struct RouteTable {
+			std::unordered_map<AudioStreamKey, ConsumerList, AudioStreamKeyHash> routes;
+			// Bit per AudioStreamKind that has a kAnyStreamId route.
+			uint32_t wildcardKinds = 0;
+
+			bool wantsInterpreters() const;
+
+			// True if any route needs audio from the SDK rather than the plugin.
+			bool wantsSdkAudio() const;
+		};
+
+		void dispatch(const AudioStreamKey& key, AudioRawData* data);
+
+		void dispatchFrame(const RouteTable& routes, const AudioStreamKey& key, const AudioFrame& frame);
+
+		// Subscribes or unsubscribes with the SDK to match the route table.
+		// Caller holds mutex_.
+		void updateSubscriptionLocked();
+
+		// Copy-on-write: SDK threads load a snapshot, writers publish a new one.
+		std::shared_ptr<const RouteTable> routes_;
+
+		std::mutex mutex_;
+		ZOOM_SDK_NAMESPACE::IZoomSDKAudioRawDataHelper* helper_;
+		bool subscribed_;
+		bool subscribedWithInterpreters_;
+
+		LanguageRegistry languages_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_AUDIO_RAW_DATA_HUB_H_
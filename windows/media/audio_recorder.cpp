@@ -0,0 +1,220 @@
+#include "media/audio_recorder.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// Two seconds of 48 kHz stereo per track.
+		constexpr size_t kTrackRingSamples = 48000 * 2 * 2;
+		constexpr size_t kDrainChunkSamples = 4096;
+		constexpr auto kDrainInterval = std::chrono::milliseconds(100);
+
+		const char* kindName(AudioStreamKind kind) {
+			switch (kind) {
+			case AudioStreamKind::Mixed: return "mixed";
+			case AudioStreamKind::OneWay: return "user";
+			case AudioStreamKind::Share: return "share";
+			case AudioStreamKind::Interpreter: return "interpreter";
+			case AudioStreamKind::Mix: return "mix";
+			}
+			return "stream";
+		}
+
+		std::string sanitize(const std::string& name) {
+			std::string out;
+			for (unsigned char c : name) {
+				out.push_back(std::isalnum(c) || c >= 0x80 ? static_cast<char>(c) : '_');
+			}
+			return out;
+		}
+
+		// The hub hands a consumer every frame once per route it holds, so a key
+		// listed twice, or a user also covered by their kind's wildcard, would be
+		// written twice into the same track.
+		std::vector<AudioStreamKey> distinctStreams(const std::vector<AudioStreamKey>& streams) {
+			std::vector<AudioStreamKey> out;
+			for (const auto& key : streams) {
+				const AudioStreamKey any{ key.kind, kAnyStreamId };
+				if (std::find(out.begin(), out.end(), key) != out.end() ||
+					(!key.isWildcard() && std::find(streams.begin(), streams.end(), any) != streams.end())) {
+					continue;
+				}
+				out.push_back(key);
+			}
+			return out;
+		}
+	}
+
+	AudioRecorder::Track::Track(const AudioStreamKey& streamKey) : key(streamKey), samples(kTrackRingSamples) {}
+
+	void AudioRecorder::Sink::onAudioFrame(const AudioStreamKey& key, const AudioFrame& frame) {
+		auto track = recorder_.trackFor(key);
+		if (!track) {
+			return;
+		}
+
+		track->sampleRate.store(frame.sampleRate, std::memory_order_relaxed);
+		track->channels.store(frame.channels, std::memory_order_relaxed);
+
+		const size_t written = track->samples.write(frame.samples, frame.sampleCount);
+		if (written < frame.sampleCount) {
+			track->dropped.fetch_add(frame.sampleCount - written, std::memory_order_relaxed);
+		}
+	}
+
+	AudioRecorder::AudioRecorder(AudioRawDataHub& hub)
+		: hub_(hub),
+		sink_(std::make_shared<Sink>(*this)),
+		tracks_(std::make_shared<const TrackMap>()),
+		recording_(false) {}
+
+	AudioRecorder::~AudioRecorder() {
+		stop();
+	}
+
+	bool AudioRecorder::start(const std::string& directory, const std::vector<AudioStreamKey>& streams) {
+		const std::vector<AudioStreamKey> routes = distinctStreams(streams);
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (recording_ || routes.empty()) {
+				return false;
+			}
+
+			std::error_code error;
+			if (!std::filesystem::is_directory(std::filesystem::u8path(directory), error)) {
+				return false;
+			}
+
+			directory_ = directory;
+			streams_ = routes;
+			std::atomic_store(&tracks_, std::make_shared<const TrackMap>());
+			recording_ = true;
+			writer_ = std::thread(&AudioRecorder::run, this);
+		}
+
+		for (const auto& key : routes) {
+			hub_.addConsumer(key, sink_);
+		}
+		return true;
+	}
+
+	std::vector<std::string> AudioRecorder::stop() {
+		std::vector<AudioStreamKey> streams;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!recording_) {
+				return {};
+			}
+			streams.swap(streams_);
+			recording_ = false;
+		}
+
+		for (const auto& key : streams) {
+			hub_.removeConsumer(key, sink_);
+		}
+
+		wake_.notify_all();
+		writer_.join();
+
+		// The writer has exited; flush what is left and finalize the files.
+		drainTracks();
+
+		std::vector<std::string> paths;
+		for (auto& entry : *std::atomic_load(&tracks_)) {
+			Track& track = *entry.second;
+			if (track.writer.isOpen()) {
+				track.writer.close();
+				paths.push_back(track.path);
+			}
+		}
+		return paths;
+	}
+
+	bool AudioRecorder::isRecording() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return recording_;
+	}
+
+	std::shared_ptr<AudioRecorder::Track> AudioRecorder::trackFor(const AudioStreamKey& key) {
+		auto tracks = std::atomic_load(&tracks_);
+		auto it = tracks->find(key);
+		if (it != tracks->end()) {
+			return it->second;
+		}
+
+		// First frame of a stream: allocate once, off the common path.
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (!recording_) {
+			return nullptr;
+		}
+
+		tracks = std::atomic_load(&tracks_);
+		it = tracks->find(key);
+		if (it != tracks->end()) {
+			return it->second;
+		}
+
+		auto next = std::make_shared<TrackMap>(*tracks);
+		auto track = std::make_shared<Track>(key);
+		next->emplace(key, track);
+		std::atomic_store(&tracks_, std::shared_ptr<const TrackMap>(std::move(next)));
+		return track;
+	}
+
+	std::string AudioRecorder::fileNameFor(const AudioStreamKey& key) {
+		std::string name = kindName(key.kind);
+
+		if (key.kind == AudioStreamKind::Interpreter) {
+			const std::string language = hub_.languages().name(key.id);
+			name += "_" + (language.empty() ? std::to_string(key.id) : sanitize(language));
+		}
+		else if (key.kind != AudioStreamKind::Mixed) {
+			name += "_" + std::to_string(key.id);
+		}
+
+		return name + ".wav";
+	}
+
+	void AudioRecorder::run() {
+		std::unique_lock<std::mutex> lock(mutex_);
+		while (recording_) {
+			wake_.wait_for(lock, kDrainInterval);
+
+			lock.unlock();
+			drainTracks();
+			lock.lock();
+		}
+	}
+
+	void AudioRecorder::drainTracks() {
+		int16_t chunk[kDrainChunkSamples];
+
+		for (auto& entry : *std::atomic_load(&tracks_)) {
+			Track& track = *entry.second;
+
+			if (!track.writer.isOpen()) {
+				const uint32_t rate = track.sampleRate.load(std::memory_order_relaxed);
+				if (rate == 0) {
+					continue;
+				}
+
+				track.path = (std::filesystem::u8path(directory_) / std::filesystem::u8path(fileNameFor(track.key))).u8string();
+				if (!track.writer.open(track.path, rate, static_cast<uint16_t>(track.channels.load(std::memory_order_relaxed)))) {
+					// Drop the audio rather than let the ring stall the producer.
+					track.samples.skip(track.samples.readAvailable());
+					continue;
+				}
+			}
+
+			size_t count;
+			while ((count = track.samples.read(chunk, kDrainChunkSamples)) > 0) {
+				track.writer.write(chunk, count);
+			}
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,90 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_AUDIO_RECORDER_H_
+#define FLUTTER_PLUGIN_MEDIA_AUDIO_RECORDER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "media/audio_raw_data_hub.h"
+#include "media/audio_stream.h"
+#include "media/spsc_ring.h"
+#include "media/wav_file.h"
+
+namespace flutter_zoom_sdk {
+
+	// Records raw audio streams to one WAV file per stream. Selecting a kind
+	// with kAnyStreamId records every stream of that kind as it appears, e.g.
+	// all interpretation languages of a multilingual event. SDK threads only
+	// copy into a ring; a writer thread does the file I/O.
+	class AudioRecorder {
+	public:
+		explicit AudioRecorder(AudioRawDataHub& hub);
+
+		~AudioRecorder();
+
+		AudioRecorder(const AudioRecorder&) = delete;
+		AudioRecorder& operator=(const AudioRecorder&) = delete;
+
+		// directory is UTF-8 and must exist. Fails if already recording.
+		bool start(const std::string& directory, const std::vector<AudioStreamKey>& streams);
+
+		// Finalizes all files and returns their paths.
+		std::vector<std::string> stop();
+
+		bool isRecording();
+
+	private:
+		struct Track {
+			explicit Track(const AudioStreamKey& streamKey);
+
+			AudioStreamKey key;
+			SpscRing<int16_t> samples;
+			std::atomic<uint32_t> sampleRate{ 0 };
+			std::atomic<uint32_t> channels{ 1 };
+			std::atomic<uint64_t> dropped{ 0 };
+			// Writer-thread owned.
+			WavWriter writer;
+			std::string path;
+		};
+
+		using TrackMap = std::unordered_map<AudioStreamKey, std::shared_ptr<Track>, AudioStreamKeyHash>;
+
+		// Registered with the hub for every selected key.
+		class Sink : public IAudioStreamConsumer {
+		public:
+			explicit Sink(AudioRecorder& recorder) : recorder_(recorder) {}
+
+			void onAudioFrame(const AudioStreamKey& key, const AudioFrame& frame) override;
+
+		private:
+			AudioRecorder& recorder_;
+		};
+
+		std::shared_ptr<Track> trackFor(const AudioStreamKey& key);
+
+		std::string fileNameFor(const AudioStreamKey& key);
+
+		void run();
+
+		void drainTracks();
+
+		AudioRawDataHub& hub_;
+		std::shared_ptr<Sink> sink_;
+
+		std::mutex mutex_;
+		std::condition_variable wake_;
+		std::shared_ptr<const TrackMap> tracks_;
+		std::vector<AudioStreamKey> streams_;
+		std::string directory_;
+		bool recording_;
+		std::thread writer_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_AUDIO_RECORDER_H_
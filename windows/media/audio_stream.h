@@ -0,0 +1,69 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_AUDIO_STREAM_H_
+#define FLUTTER_PLUGIN_MEDIA_AUDIO_STREAM_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace flutter_zoom_sdk {
+
+	// Which IZoomSDKAudioRawDataDelegate callback a stream comes from.
+	enum class AudioStreamKind : uint8_t {
+		Mixed = 0,
+		OneWay = 1,
+		Share = 2,
+		Interpreter = 3,
+		// Produced inside the plugin by an AudioMixer, not by the SDK.
+		Mix = 4,
+	};
+
+	// Identifies one raw audio stream. id is the user id for one-way and share
+	// audio, the LanguageRegistry id for interpreter audio, the mixer id for
+	// plugin mixes and 0 for the mixed stream. kAnyStreamId selects every stream of a kind.
+	constexpr uint32_t kAnyStreamId = 0xFFFFFFFFu;
+
+	struct AudioStreamKey {
+		AudioStreamKind kind = AudioStreamKind::Mixed;
+		uint32_t id = 0;
+
+		bool operator==(const AudioStreamKey& other) const {
+			return kind == other.kind && id == other.id;
+		}
+
+		bool operator!=(const AudioStreamKey& other) const {
+			return !(*this == other);
+		}
+
+		bool isWildcard() const {
+			return id == kAnyStreamId;
+		}
+	};
+
+	struct AudioStreamKeyHash {
+		size_t operator()(const AudioStreamKey& key) const {
+			return std::hash<uint64_t>()((static_cast<uint64_t>(key.kind) << 32) | key.id);
+		}
+	};
+
+	// Borrowed view of one AudioRawData callback. Only valid for the duration of
+	// the consumer call; consumers copy what they need.
+	struct AudioFrame {
+		const int16_t* samples = nullptr;
+		size_t sampleCount = 0;  // interleaved, across all channels
+		uint32_t sampleRate = 0;
+		uint32_t channels = 1;
+		uint64_t timestamp = 0;  // milliseconds, from AudioRawData::GetTimeStamp
+	};
+
+	// Receives frames for the streams it was registered for. Called on SDK audio
+	// threads, so implementations must not block.
+	class IAudioStreamConsumer {
+	public:
+		virtual ~IAudioStreamConsumer() {}
+
+		virtual void onAudioFrame(const AudioStreamKey& key, const AudioFrame& frame) = 0;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_AUDIO_STREAM_H_
@@ -0,0 +1,104 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_BUFFER_POOL_H_
+#define FLUTTER_PLUGIN_MEDIA_BUFFER_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	class BufferPool;
+
+	// Returns a buffer to the pool it came from instead of freeing it.
+	struct PooledBufferReleaser {
+		std::weak_ptr<BufferPool> pool;
+
+		void operator()(std::vector<uint8_t>* buffer) const;
+	};
+
+	using PooledBuffer = std::unique_ptr<std::vector<uint8_t>, PooledBufferReleaser>;
+
+	// Recycles byte buffers of one size class so steady-state media paths do not
+	// hit the heap. Buffers keep their capacity across reuse; the pool only caps
+	// how many idle buffers it holds on to.
+	class BufferPool : public std::enable_shared_from_this<BufferPool> {
+	public:
+		static std::shared_ptr<BufferPool> create(size_t bufferSize, size_t maxIdle) {
+			return std::shared_ptr<BufferPool>(new BufferPool(bufferSize, maxIdle));
+		}
+
+		BufferPool(const BufferPool&) = delete;
+		BufferPool& operator=(const BufferPool&) = delete;
+
+		~BufferPool() {
+			for (auto* buffer : idle_) {
+				delete buffer;
+			}
+		}
+
+		// Hands out an empty buffer with at least bufferSize() bytes reserved.
+		PooledBuffer acquire() {
+			std::vector<uint8_t>* buffer = nullptr;
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				if (!idle_.empty()) {
+					buffer = idle_.back();
+					idle_.pop_back();
+				}
+			}
+
+			if (!buffer) {
+				buffer = new std::vector<uint8_t>();
+				buffer->reserve(bufferSize_);
+			}
+			buffer->clear();
+
+			return PooledBuffer(buffer, PooledBufferReleaser{ weak_from_this() });
+		}
+
+		size_t bufferSize() const { return bufferSize_; }
+
+		size_t idleCount() {
+			std::lock_guard<std::mutex> lock(mutex_);
+			return idle_.size();
+		}
+
+	private:
+		friend struct PooledBufferReleaser;
+
+		BufferPool(size_t bufferSize, size_t maxIdle) : bufferSize_(bufferSize), maxIdle_(maxIdle) {
+			idle_.reserve(maxIdle);
+		}
+
+		void recycle(std::vector<uint8_t>* buffer) {
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				// Buffers that grew past twice the size class are not worth keeping.
+				if (idle_.size() < maxIdle_ && buffer->capacity() <= bufferSize_ * 2) {
+					idle_.push_back(buffer);
+					return;
+				}
+			}
+			delete buffer;
+		}
+
+		const size_t bufferSize_;
+		const size_t maxIdle_;
+		std::mutex mutex_;
+		std::vector<std::vector<uint8_t>*> idle_;
+	};
+
+	inline void PooledBufferReleaser::operator()(std::vector<uint8_t>* buffer) const {
+		if (auto owner = pool.lock()) {
+			owner->recycle(buffer);
+		}
+		else {
+			delete buffer;
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_BUFFER_POOL_H_
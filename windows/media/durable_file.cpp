@@ -0,0 +1,104 @@
+#include "media/durable_file.h"
+
+#include <fcntl.h>
+
+#include <algorithm>
+#include <filesystem>
+
+#if defined(_WIN32)
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// Largest single write; the CRT takes an unsigned int.
+		constexpr size_t kMaxWrite = 1u << 30;
+
+		int openFile(const std::string& path) {
+#if defined(_WIN32)
+			int fd = -1;
+			_wsopen_s(&fd, std::filesystem::u8path(path).c_str(),
+				_O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _SH_DENYWR, _S_IREAD | _S_IWRITE);
+			return fd;
+#else
+			return ::open(std::filesystem::u8path(path).c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+#endif
+		}
+
+		long long writeFile(int fd, const uint8_t* data, size_t size) {
+#if defined(_WIN32)
+			return _write(fd, data, static_cast<unsigned int>(size));
+#else
+			return ::write(fd, data, size);
+#endif
+		}
+
+		bool syncFile(int fd) {
+#if defined(_WIN32)
+			return _commit(fd) == 0;
+#elif defined(__APPLE__)
+			return fcntl(fd, F_FULLFSYNC) == 0 || fsync(fd) == 0;
+#else
+			return fdatasync(fd) == 0;
+#endif
+		}
+
+		bool closeFile(int fd) {
+#if defined(_WIN32)
+			return _close(fd) == 0;
+#else
+			return ::close(fd) == 0;
+#endif
+		}
+	}
+
+	DurableFile::DurableFile() : fd_(-1), size_(0) {}
+
+	DurableFile::~DurableFile() {
+		close();
+	}
+
+	bool DurableFile::open(const std::string& path) {
+		close();
+
+		fd_ = openFile(path);
+		size_ = 0;
+		return fd_ >= 0;
+	}
+
+	bool DurableFile::write(const uint8_t* data, size_t size) {
+		if (fd_ < 0) {
+			return false;
+		}
+
+		while (size > 0) {
+			const long long written = writeFile(fd_, data, std::min(size, kMaxWrite));
+			if (written <= 0) {
+				return false;
+			}
+			data += written;
+			size -= static_cast<size_t>(written);
+			size_ += static_cast<uint64_t>(written);
+		}
+		return true;
+	}
+
+	bool DurableFile::sync() {
+		return fd_ >= 0 && syncFile(fd_);
+	}
+
+	bool DurableFile::close() {
+		if (fd_ < 0) {
+			return true;
+		}
+
+		const bool closed = closeFile(fd_);
+		fd_ = -1;
+		return closed;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,44 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_DURABLE_FILE_H_
+#define FLUTTER_PLUGIN_MEDIA_DURABLE_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace flutter_zoom_sdk {
+
+	// Append-only file written with unbuffered descriptor writes. sync()
+	// returns once everything written so far is on disk, so a caller that
+	// writes whole blocks and syncs after each knows exactly what survives a
+	// power loss.
+	class DurableFile {
+	public:
+		DurableFile();
+
+		~DurableFile();
+
+		DurableFile(const DurableFile&) = delete;
+		DurableFile& operator=(const DurableFile&) = delete;
+
+		// path is UTF-8. Creates or truncates the file.
+		bool open(const std::string& path);
+
+		bool write(const uint8_t* data, size_t size);
+
+		bool sync();
+
+		bool close();
+
+		bool isOpen() const { return fd_ >= 0; }
+
+		// Bytes written since open.
+		uint64_t size() const { return size_; }
+
+	private:
+		int fd_;
+		uint64_t size_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_DURABLE_FILE_H_
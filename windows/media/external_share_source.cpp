@@ -0,0 +1,190 @@
+#include "media/external_share_source.h"
+
+#include <algorithm>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		using Clock = std::chrono::steady_clock;
+
+		constexpr uint32_t kMaxFps = 30;
+
+		Clock::duration periodOf(uint32_t fps) {
+			return std::chrono::duration_cast<Clock::duration>(
+				std::chrono::duration<double>(1.0 / std::clamp<uint32_t>(fps, 1, kMaxFps)));
+		}
+
+		uint64_t elapsedUs(Clock::time_point start) {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count());
+		}
+	}
+
+	ExternalShareSource::ExternalShareSource(const ExternalShareSourceConfig& config)
+		: config_(config),
+		hashTotalUs_(0),
+		convertTotalUs_(0),
+		pendingWidth_(0),
+		pendingHeight_(0),
+		stopping_(false),
+		hasher_(config.tileSize) {}
+
+	ExternalShareSource::~ExternalShareSource() {
+		stopThread();
+	}
+
+	void ExternalShareSource::setConfig(const ExternalShareSourceConfig& config) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		config_ = config;
+		hasher_ = TileHasher(config.tileSize);
+	}
+
+	bool ExternalShareSource::push(const uint8_t* pixels, int srcStride, int width, int height, PixelOrder order) {
+		if (srcStride <= 0) {
+			srcStride = 4 * width;
+		}
+
+		const Clock::time_point hashStart = Clock::now();
+		const size_t changed = hasher_.update(pixels, srcStride, width, height, 4);
+		const uint64_t hashUs = elapsedUs(hashStart);
+
+		bool fullRange;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stats_.framesPushed++;
+			stats_.lastChangedTiles = static_cast<uint32_t>(changed);
+			stats_.tileCount = static_cast<uint32_t>(hasher_.tileCount());
+			hashTotalUs_ += hashUs;
+			stats_.meanHashUs = static_cast<uint32_t>(hashTotalUs_ / stats_.framesPushed);
+			if (changed == 0) {
+				stats_.framesUnchanged++;
+				return false;
+			}
+			fullRange = config_.fullRange;
+		}
+
+		// Converted outside the lock so the sender thread is never held up.
+		const Clock::time_point convertStart = Clock::now();
+		PooledBuffer frame = converter_.convert(pixels, srcStride, width, height, order, fullRange);
+		const uint64_t convertUs = elapsedUs(convertStart);
+
+		PooledBuffer superseded;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			convertTotalUs_ += convertUs;
+			const uint64_t converted = stats_.framesPushed - stats_.framesUnchanged;
+			stats_.meanConvertUs = static_cast<uint32_t>(convertTotalUs_ / converted);
+			if (pending_) {
+				stats_.framesSuperseded++;
+			}
+			superseded = std::move(pending_);
+			pending_ = std::move(frame);
+			pendingWidth_ = width;
+			pendingHeight_ = height;
+		}
+		wake_.notify_all();
+		return true;
+	}
+
+	ExternalShareSourceStats ExternalShareSource::stats() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return stats_;
+	}
+
+	void ExternalShareSource::onStartSend(ZOOM_SDK_NAMESPACE::IZoomSDKShareSender* pSender) {
+		stopThread();
+		if (!pSender) {
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		stopping_ = false;
+		stats_.sending = true;
+		worker_ = std::thread(&ExternalShareSource::run, this, pSender);
+	}
+
+	void ExternalShareSource::onStopSend() {
+		stopThread();
+	}
+
+	void ExternalShareSource::stopThread() {
+		std::thread worker;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stopping_ = true;
+			stats_.sending = false;
+			worker.swap(worker_);
+		}
+		wake_.notify_all();
+
+		if (worker.joinable()) {
+			worker.join();
+		}
+	}
+
+	void ExternalShareSource::run(ZOOM_SDK_NAMESPACE::IZoomSDKShareSender* sender) {
+		// The frame on screen, resent for keep-alive.
+		PooledBuffer current;
+		int width = 0;
+		int height = 0;
+		Clock::time_point lastSend;
+
+		std::unique_lock<std::mutex> lock(mutex_);
+		while (!stopping_) {
+			const Clock::duration minInterval = periodOf(config_.maxFps);
+			const Clock::duration keepAlive = periodOf(config_.keepAliveFps);
+
+			const bool fresh = pending_ && Clock::now() - lastSend >= minInterval;
+			const bool stale = current && Clock::now() - lastSend >= keepAlive;
+			if (!fresh && !stale) {
+				if (pending_) {
+					wake_.wait_until(lock, lastSend + minInterval);
+				}
+				else if (current) {
+					wake_.wait_until(lock, lastSend + keepAlive);
+				}
+				else {
+					wake_.wait(lock);
+				}
+				continue;
+			}
+
+			PooledBuffer previous;
+			if (fresh) {
+				previous = std::move(current);
+				current = std::move(pending_);
+				width = pendingWidth_;
+				height = pendingHeight_;
+			}
+			const bool fullRange = config_.fullRange;
+			lock.unlock();
+
+			// The previous frame goes back to its pool here, outside the lock.
+			previous.reset();
+			const ZOOM_SDK_NAMESPACE::SDKError err = sender->sendShareFrame(
+				reinterpret_cast<char*>(current->data()), width, height, static_cast<int>(current->size()),
+				fullRange ? ZOOM_SDK_NAMESPACE::FrameDataFormat_I420_FULL : ZOOM_SDK_NAMESPACE::FrameDataFormat_I420_LIMITED);
+			lastSend = Clock::now();
+
+			lock.lock();
+			if (err == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+				stats_.framesSent++;
+				stats_.keepAliveFrames += fresh ? 0 : 1;
+			}
+			else {
+				stats_.sendErrors++;
+			}
+			stats_.width = static_cast<uint32_t>(width);
+			stats_.height = static_cast<uint32_t>(height);
+		}
+
+		// A restarted share must not wait for the next change to show
+		// something, so the frame on screen is kept for the next start unless
+		// something newer has arrived.
+		if (current && !pending_) {
+			pending_ = std::move(current);
+			pendingWidth_ = width;
+			pendingHeight_ = height;
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,100 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_EXTERNAL_SHARE_SOURCE_H_
+#define FLUTTER_PLUGIN_MEDIA_EXTERNAL_SHARE_SOURCE_H_
+
+#include <rawdata/rawdata_share_source_helper_interface.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "media/buffer_pool.h"
+#include "media/rgba_to_i420.h"
+#include "media/tile_hash.h"
+
+namespace flutter_zoom_sdk {
+
+	struct ExternalShareSourceConfig {
+		// Changed content is sent at most this often.
+		uint32_t maxFps = 15;
+		// Unchanged content is sent again at least this often, so viewers
+		// joining late and the SDK's encoder still get frames.
+		uint32_t keepAliveFps = 1;
+		int tileSize = 32;
+		bool fullRange = true;
+	};
+
+	struct ExternalShareSourceStats {
+		bool sending = false;
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint64_t framesPushed = 0;
+		// Pushed frames whose tiles all matched the previous frame; they cost
+		// a hash and nothing else.
+		uint64_t framesUnchanged = 0;
+		uint64_t framesSent = 0;
+		uint64_t keepAliveFrames = 0;
+		// Converted frames replaced by a newer one before they were sent.
+		uint64_t framesSuperseded = 0;
+		uint64_t sendErrors = 0;
+		uint32_t lastChangedTiles = 0;
+		uint32_t tileCount = 0;
+		uint32_t meanHashUs = 0;
+		uint32_t meanConvertUs = 0;
+	};
+
+	// External share source for setExternalShareSource, fed with RGBA frames
+	// such as widget snapshots. Each pushed frame is hashed in tiles; only a
+	// frame with changed tiles is converted to I420 and handed to the sender
+	// thread, which sends it no faster than maxFps. Without changes the last
+	// frame is repeated at keepAliveFps, so a static dashboard costs a hash
+	// per push and one send a second.
+	class ExternalShareSource : public ZOOM_SDK_NAMESPACE::IZoomSDKShareSource {
+	public:
+		explicit ExternalShareSource(const ExternalShareSourceConfig& config = ExternalShareSourceConfig());
+
+		~ExternalShareSource();
+
+		ExternalShareSource(const ExternalShareSource&) = delete;
+		ExternalShareSource& operator=(const ExternalShareSource&) = delete;
+
+		// Applies to frames pushed from now on; resets change detection.
+		void setConfig(const ExternalShareSourceConfig& config);
+
+		// Producer side, one thread. srcStride 0 means tightly packed rows.
+		// Returns true when the frame changed and will be sent.
+		bool push(const uint8_t* pixels, int srcStride, int width, int height, PixelOrder order);
+
+		ExternalShareSourceStats stats();
+
+		void onStartSend(ZOOM_SDK_NAMESPACE::IZoomSDKShareSender* pSender) override;
+
+		void onStopSend() override;
+
+	private:
+		void run(ZOOM_SDK_NAMESPACE::IZoomSDKShareSender* sender);
+
+		void stopThread();
+
+		std::mutex mutex_;
+		std::condition_variable wake_;
+		ExternalShareSourceConfig config_;
+		ExternalShareSourceStats stats_;
+		uint64_t hashTotalUs_;
+		uint64_t convertTotalUs_;
+		// Converted and not yet picked up by the sender thread.
+		PooledBuffer pending_;
+		int pendingWidth_;
+		int pendingHeight_;
+		bool stopping_;
+		std::thread worker_;
+
+		// Producer owned.
+		TileHasher hasher_;
+		RgbaToI420Converter converter_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_EXTERNAL_SHARE_SOURCE_H_
@@ -0,0 +1,331 @@
+#include "media/external_video_source.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// Behind by more than this (a suspended machine, a debugger) the
+		// schedule restarts from now instead of bursting to catch up.
+		constexpr auto kMaxBacklog = std::chrono::milliseconds(500);
+		// Used when neither the capability nor the source has a rate.
+		constexpr uint32_t kDefaultFps = 30;
+		constexpr uint32_t kMaxFps = 60;
+		// RFC 3550 jitter smoothing.
+		constexpr int64_t kJitterGain = 16;
+		// How often the capability is reconsidered and statistics requested
+		// while sending.
+		constexpr auto kEvaluationInterval = std::chrono::seconds(2);
+
+		// Even dimensions inside width x height with the source's aspect ratio.
+		void fitSize(int sourceWidth, int sourceHeight, int width, int height, int& outWidth, int& outHeight) {
+			outWidth = width;
+			outHeight = height;
+			if (sourceWidth > 0 && sourceHeight > 0) {
+				const int64_t scaledHeight = static_cast<int64_t>(width) * sourceHeight / sourceWidth;
+				if (scaledHeight <= height) {
+					outHeight = static_cast<int>(scaledHeight);
+				}
+				else {
+					outWidth = static_cast<int>(static_cast<int64_t>(height) * sourceWidth / sourceHeight);
+				}
+			}
+			outWidth = std::max(outWidth & ~1, 2);
+			outHeight = std::max(outHeight & ~1, 2);
+		}
+	}
+
+	ExternalVideoSource::ExternalVideoSource()
+		: sender_(nullptr),
+		chosenForWidth_(0),
+		chosenForHeight_(0),
+		ticks_(0),
+		latenessTotalUs_(0),
+		sendCostTotalUs_(0),
+		stopping_(false) {}
+
+	ExternalVideoSource::~ExternalVideoSource() {
+		stopThread();
+	}
+
+	void ExternalVideoSource::setSource(std::shared_ptr<IVideoFrameSource> source) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		source_ = std::move(source);
+		stats_.finished = false;
+		chooseCapability();
+	}
+
+	void ExternalVideoSource::setFinishedCallback(FinishedCallback callback) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		finishedCallback_ = std::move(callback);
+	}
+
+	void ExternalVideoSource::setStatisticsCallback(StatisticsCallback callback) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		statisticsCallback_ = std::move(callback);
+	}
+
+	void ExternalVideoSource::setBudget(const VideoCapabilityBudget& budget) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		policy_.setBudget(budget);
+		chooseCapability();
+	}
+
+	VideoCapabilityBudget ExternalVideoSource::budget() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return policy_.budget();
+	}
+
+	void ExternalVideoSource::setStatistics(const VideoSendStatistics& statistics) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (policy_.recordStatistics(statistics, capability_)) {
+			chooseCapability();
+		}
+	}
+
+	std::vector<ZOOM_SDK_NAMESPACE::VideoSourceCapability> ExternalVideoSource::capabilities() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return capabilities_;
+	}
+
+	ExternalVideoSourceStats ExternalVideoSource::stats() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		ExternalVideoSourceStats stats = stats_;
+		stats.meanLatenessUs = ticks_ > 0 ? static_cast<uint32_t>(latenessTotalUs_ / ticks_) : 0;
+		stats.meanSendCostUs = stats_.framesSent > 0 ? static_cast<uint32_t>(sendCostTotalUs_ / stats_.framesSent) : 0;
+		stats.networkLimit = policy_.networkLimit();
+		return stats;
+	}
+
+	void ExternalVideoSource::setCapabilities(
+		ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::VideoSourceCapability>* capabilities,
+		const ZOOM_SDK_NAMESPACE::VideoSourceCapability& suggested) {
+		capabilities_.clear();
+		const int count = capabilities ? capabilities->GetCount() : 0;
+		for (int i = 0; i < count; i++) {
+			capabilities_.push_back(capabilities->GetItem(i));
+		}
+		suggested_ = suggested;
+		chooseCapability();
+	}
+
+	void ExternalVideoSource::chooseCapability() {
+		chosenForWidth_ = source_ ? source_->width() : 0;
+		chosenForHeight_ = source_ ? source_->height() : 0;
+
+		const VideoCapabilityChoice choice = policy_.choose(capabilities_, suggested_,
+			chosenForWidth_, chosenForHeight_, source_ ? source_->frameRate() : 0.0, capability_);
+		const ZOOM_SDK_NAMESPACE::VideoSourceCapability& chosen = choice.capability;
+		if (chosen.width != capability_.width || chosen.height != capability_.height || chosen.frame != capability_.frame) {
+			capability_ = chosen;
+			stats_.capabilityChanges++;
+		}
+		stats_.limit = choice.limit;
+		stats_.predictedCpuPercent = choice.predictedCpuPercent;
+		stats_.width = capability_.width;
+		stats_.height = capability_.height;
+		stats_.fps = capability_.frame;
+	}
+
+	void ExternalVideoSource::onInitialize(ZOOM_SDK_NAMESPACE::IZoomSDKVideoSender* sender,
+		ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::VideoSourceCapability>* support_cap_list,
+		ZOOM_SDK_NAMESPACE::VideoSourceCapability& suggest_cap) {
+		stopThread();
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		sender_ = sender;
+		stats_.initialized = sender != nullptr;
+		setCapabilities(support_cap_list, suggest_cap);
+	}
+
+	void ExternalVideoSource::onPropertyChange(
+		ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::VideoSourceCapability>* support_cap_list,
+		ZOOM_SDK_NAMESPACE::VideoSourceCapability suggest_cap) {
+		// The sender thread picks the new capability up on its next frame.
+		std::lock_guard<std::mutex> lock(mutex_);
+		setCapabilities(support_cap_list, suggest_cap);
+	}
+
+	void ExternalVideoSource::onStartSend() {
+		stopThread();
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (!sender_) {
+			return;
+		}
+		stopping_ = false;
+		stats_.sending = true;
+		worker_ = std::thread(&ExternalVideoSource::run, this, sender_);
+	}
+
+	void ExternalVideoSource::onStopSend() {
+		stopThread();
+	}
+
+	void ExternalVideoSource::onUninitialized() {
+		stopThread();
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		sender_ = nullptr;
+		stats_.initialized = false;
+	}
+
+	void ExternalVideoSource::stopThread() {
+		std::thread worker;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stopping_ = true;
+			stats_.sending = false;
+			worker.swap(worker_);
+		}
+		wake_.notify_all();
+
+		if (worker.joinable()) {
+			worker.join();
+		}
+	}
+
+	ZOOM_SDK_NAMESPACE::SDKError ExternalVideoSource::sendFrame(ZOOM_SDK_NAMESPACE::IZoomSDKVideoSender* sender,
+		const VideoFrame& frame, const ZOOM_SDK_NAMESPACE::VideoSourceCapability& capability,
+		int& width, int& height) {
+		width = frame.planes.width;
+		height = frame.planes.height;
+		if (capability.width > 0 && capability.height > 0) {
+			fitSize(frame.planes.width, frame.planes.height,
+				static_cast<int>(capability.width), static_cast<int>(capability.height), width, height);
+		}
+
+		scaled_.resize(I420BufferSize(width, height));
+		ScaleI420(frame.planes, I420Planes::packed(scaled_.data(), width, height));
+
+		return sender->sendVideoFrame(reinterpret_cast<char*>(scaled_.data()), width, height,
+			static_cast<int>(scaled_.size()), 0,
+			frame.fullRange ? ZOOM_SDK_NAMESPACE::FrameDataFormat_I420_FULL : ZOOM_SDK_NAMESPACE::FrameDataFormat_I420_LIMITED);
+	}
+
+	void ExternalVideoSource::run(ZOOM_SDK_NAMESPACE::IZoomSDKVideoSender* sender) {
+		using Clock = std::chrono::steady_clock;
+
+		std::shared_ptr<IVideoFrameSource> current;
+		uint64_t lastSequence = 0;
+		bool haveLast = false;
+		bool finishReported = false;
+
+		Clock::time_point start = Clock::now();
+		Clock::time_point next = start;
+		Clock::time_point lastWake;
+		Clock::duration lastInterval{};
+		Clock::time_point nextEvaluation = start + kEvaluationInterval;
+		int64_t jitterUs = 0;
+
+		std::unique_lock<std::mutex> lock(mutex_);
+		while (!stopping_) {
+			const Clock::time_point wokeAt = Clock::now();
+			StatisticsCallback statisticsCallback;
+			if (wokeAt >= nextEvaluation
+				|| (current && (current->width() != chosenForWidth_ || current->height() != chosenForHeight_))) {
+				chooseCapability();
+				if (wokeAt >= nextEvaluation) {
+					statisticsCallback = statisticsCallback_;
+					nextEvaluation = wokeAt + kEvaluationInterval;
+				}
+			}
+			const ZOOM_SDK_NAMESPACE::VideoSourceCapability capability = capability_;
+			std::shared_ptr<IVideoFrameSource> source = source_;
+			lock.unlock();
+
+			if (statisticsCallback) {
+				statisticsCallback();
+			}
+
+			if (source != current) {
+				current = std::move(source);
+				start = next;
+				haveLast = false;
+				finishReported = false;
+			}
+
+			// Never faster than the source, so slow sources are not padded
+			// with repeats.
+			uint32_t fps = capability.frame > 0 ? capability.frame : kDefaultFps;
+			if (current && current->frameRate() > 0.0) {
+				fps = std::min(fps, static_cast<uint32_t>(std::ceil(current->frameRate())));
+			}
+			fps = std::clamp<uint32_t>(fps, 1, kMaxFps);
+			const auto interval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / fps));
+
+			VideoFrame frame;
+			const bool haveFrame = current
+				&& current->frameAt(std::chrono::duration_cast<std::chrono::microseconds>(next - start), frame);
+			int sentWidth = 0;
+			int sentHeight = 0;
+			const Clock::time_point sendStart = Clock::now();
+			const ZOOM_SDK_NAMESPACE::SDKError err = haveFrame
+				? sendFrame(sender, frame, capability, sentWidth, sentHeight) : ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS;
+			const auto sendCost = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - sendStart);
+			const bool finished = current && current->finished();
+
+			lock.lock();
+			if (haveFrame) {
+				if (err == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+					stats_.framesSent++;
+					sendCostTotalUs_ += static_cast<uint64_t>(sendCost.count());
+					policy_.recordSendCost(static_cast<uint32_t>(sentWidth), static_cast<uint32_t>(sentHeight), sendCost);
+				}
+				else {
+					stats_.sendErrors++;
+				}
+				if (haveLast && frame.sequence == lastSequence) {
+					stats_.framesRepeated++;
+				}
+				else if (haveLast && frame.sequence > lastSequence + 1) {
+					stats_.framesSkipped += frame.sequence - lastSequence - 1;
+				}
+				lastSequence = frame.sequence;
+				haveLast = true;
+			}
+			else {
+				stats_.starvedTicks++;
+			}
+
+			const int64_t latenessUs = std::max<int64_t>(
+				std::chrono::duration_cast<std::chrono::microseconds>(wokeAt - next).count(), 0);
+			ticks_++;
+			latenessTotalUs_ += static_cast<uint64_t>(latenessUs);
+			stats_.maxLatenessUs = std::max(stats_.maxLatenessUs, static_cast<uint32_t>(latenessUs));
+			if (lastWake != Clock::time_point() && lastInterval.count() > 0) {
+				const int64_t deviationUs = std::chrono::duration_cast<std::chrono::microseconds>(
+					(wokeAt - lastWake) - lastInterval).count();
+				jitterUs += (std::abs(deviationUs) - jitterUs) / kJitterGain;
+				stats_.intervalJitterUs = static_cast<uint32_t>(jitterUs);
+			}
+			lastWake = wokeAt;
+			lastInterval = interval;
+
+			FinishedCallback finishedCallback;
+			if (finished && !finishReported) {
+				finishReported = true;
+				stats_.finished = true;
+				finishedCallback = finishedCallback_;
+			}
+			if (finishedCallback) {
+				lock.unlock();
+				finishedCallback();
+				lock.lock();
+			}
+
+			next += interval;
+			if (Clock::now() - next > kMaxBacklog) {
+				next = Clock::now();
+				stats_.resyncs++;
+			}
+
+			if (wake_.wait_until(lock, next, [this]() { return stopping_; })) {
+				break;
+			}
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,154 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_EXTERNAL_VIDEO_SOURCE_H_
+#define FLUTTER_PLUGIN_MEDIA_EXTERNAL_VIDEO_SOURCE_H_
+
+#include <rawdata/rawdata_video_source_helper_interface.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "media/video_capability_policy.h"
+#include "media/video_frame_source.h"
+
+namespace flutter_zoom_sdk {
+
+	struct ExternalVideoSourceStats {
+		bool initialized = false;
+		bool sending = false;
+		bool finished = false;
+		// Capability in use.
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t fps = 0;
+		uint32_t capabilityChanges = 0;
+		// Why nothing larger is sent, and the load the policy expects.
+		VideoCapabilityLimit limit = VideoCapabilityLimit::None;
+		double predictedCpuPercent = 0.0;
+		// Measured cost of scaling and sending one frame.
+		uint32_t meanSendCostUs = 0;
+		// Largest area the network currently carries; 0 is unlimited.
+		uint64_t networkLimit = 0;
+		uint64_t framesSent = 0;
+		uint64_t sendErrors = 0;
+		// Ticks that sent the previous source frame again, and source frames
+		// that were never sent because the sender was ahead of the source.
+		uint64_t framesRepeated = 0;
+		uint64_t framesSkipped = 0;
+		// Ticks with nothing to send yet.
+		uint64_t starvedTicks = 0;
+		// Times the schedule was restarted after falling far behind.
+		uint64_t resyncs = 0;
+		// How late frames were sent against their schedule, and the RFC 3550
+		// style smoothed jitter of the interval between sends.
+		uint32_t meanLatenessUs = 0;
+		uint32_t maxLatenessUs = 0;
+		uint32_t intervalJitterUs = 0;
+	};
+
+	// External camera for setExternalVideoSource. Between onStartSend and
+	// onStopSend a dedicated thread sends one frame per tick of the chosen
+	// capability's rate, on an absolute schedule so late wake-ups do not
+	// drift the stream. The source frame for each tick is picked by its
+	// media time, so a source slower or faster than the send rate is
+	// repeated or skipped rather than slowed down or sped up. Frames are
+	// scaled to fit the capability, keeping the source's aspect ratio; a
+	// capability change takes effect on the next frame. The capability is
+	// picked by a VideoCapabilityPolicy whenever the SDK offers new ones, the
+	// source or budget changes, or every few seconds as measured costs and
+	// SDK statistics move.
+	class ExternalVideoSource : public ZOOM_SDK_NAMESPACE::IZoomSDKVideoSource {
+	public:
+		// Called once on the sender thread when a finite source has been sent.
+		using FinishedCallback = std::function<void()>;
+		// Called on the sender thread every few seconds while sending; answer
+		// with setStatistics from a thread that may call the SDK.
+		using StatisticsCallback = std::function<void()>;
+
+		ExternalVideoSource();
+
+		~ExternalVideoSource();
+
+		ExternalVideoSource(const ExternalVideoSource&) = delete;
+		ExternalVideoSource& operator=(const ExternalVideoSource&) = delete;
+
+		// Takes effect on the next frame; media time restarts at zero.
+		void setSource(std::shared_ptr<IVideoFrameSource> source);
+
+		void setFinishedCallback(FinishedCallback callback);
+
+		void setStatisticsCallback(StatisticsCallback callback);
+
+		void setBudget(const VideoCapabilityBudget& budget);
+
+		VideoCapabilityBudget budget();
+
+		void setStatistics(const VideoSendStatistics& statistics);
+
+		// What the SDK currently offers.
+		std::vector<ZOOM_SDK_NAMESPACE::VideoSourceCapability> capabilities();
+
+		ExternalVideoSourceStats stats();
+
+		void onInitialize(ZOOM_SDK_NAMESPACE::IZoomSDKVideoSender* sender,
+			ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::VideoSourceCapability>* support_cap_list,
+			ZOOM_SDK_NAMESPACE::VideoSourceCapability& suggest_cap) override;
+
+		void onPropertyChange(ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::VideoSourceCapability>* support_cap_list,
+			ZOOM_SDK_NAMESPACE::VideoSourceCapability suggest_cap) override;
+
+		void onStartSend() override;
+
+		void onStopSend() override;
+
+		void onUninitialized() override;
+
+	private:
+		// Keeps a copy of what the SDK offers, so the choice can be redone
+		// when the source changes size.
+		void setCapabilities(ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::VideoSourceCapability>* capabilities,
+			const ZOOM_SDK_NAMESPACE::VideoSourceCapability& suggested);
+
+		// Called with mutex_ held.
+		void chooseCapability();
+
+		void run(ZOOM_SDK_NAMESPACE::IZoomSDKVideoSender* sender);
+
+		void stopThread();
+
+		// Scales frame into scaled_ and sends it, reporting the size sent.
+		ZOOM_SDK_NAMESPACE::SDKError sendFrame(ZOOM_SDK_NAMESPACE::IZoomSDKVideoSender* sender,
+			const VideoFrame& frame, const ZOOM_SDK_NAMESPACE::VideoSourceCapability& capability,
+			int& width, int& height);
+
+		std::mutex mutex_;
+		std::condition_variable wake_;
+		ZOOM_SDK_NAMESPACE::IZoomSDKVideoSender* sender_;
+		std::vector<ZOOM_SDK_NAMESPACE::VideoSourceCapability> capabilities_;
+		ZOOM_SDK_NAMESPACE::VideoSourceCapability suggested_;
+		ZOOM_SDK_NAMESPACE::VideoSourceCapability capability_;
+		// Source size the capability was chosen for.
+		int chosenForWidth_;
+		int chosenForHeight_;
+		std::shared_ptr<IVideoFrameSource> source_;
+		FinishedCallback finishedCallback_;
+		StatisticsCallback statisticsCallback_;
+		VideoCapabilityPolicy policy_;
+		ExternalVideoSourceStats stats_;
+		uint64_t ticks_;
+		uint64_t latenessTotalUs_;
+		uint64_t sendCostTotalUs_;
+		bool stopping_;
+		std::thread worker_;
+
+		// Sender-thread owned.
+		std::vector<uint8_t> scaled_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_EXTERNAL_VIDEO_SOURCE_H_
@@ -0,0 +1,105 @@
+#include "media/i420_image.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr int kFractionBits = 8;
+		constexpr int kOne = 1 << kFractionBits;
+
+		void copyPlane(const uint8_t* src, int srcStride, uint8_t* dst, int dstStride, int width, int height) {
+			for (int row = 0; row < height; row++) {
+				std::memcpy(dst + static_cast<size_t>(row) * dstStride, src + static_cast<size_t>(row) * srcStride, width);
+			}
+		}
+
+		// Source coordinate of destination pixel i in 8.8 fixed point, clamped so
+		// that the right-hand neighbour is always inside the plane.
+		void samplePositions(int srcSize, int dstSize, std::vector<int>& index, std::vector<int>& fraction) {
+			index.resize(dstSize);
+			fraction.resize(dstSize);
+			const int64_t step = (static_cast<int64_t>(srcSize) << 16) / dstSize;
+			for (int i = 0; i < dstSize; i++) {
+				int64_t position = ((2 * i + 1) * step / 2 - (1 << 15)) >> (16 - kFractionBits);
+				position = std::clamp<int64_t>(position, 0, static_cast<int64_t>(srcSize - 1) << kFractionBits);
+				index[i] = static_cast<int>(position >> kFractionBits);
+				fraction[i] = static_cast<int>(position & (kOne - 1));
+				if (index[i] == srcSize - 1) {
+					fraction[i] = 0;
+				}
+			}
+		}
+
+		void scalePlane(const uint8_t* src, int srcStride, int srcWidth, int srcHeight,
+			uint8_t* dst, int dstStride, int dstWidth, int dstHeight) {
+			if (srcWidth == dstWidth && srcHeight == dstHeight) {
+				copyPlane(src, srcStride, dst, dstStride, dstWidth, dstHeight);
+				return;
+			}
+
+			std::vector<int> xIndex, xFraction, yIndex, yFraction;
+			samplePositions(srcWidth, dstWidth, xIndex, xFraction);
+			samplePositions(srcHeight, dstHeight, yIndex, yFraction);
+
+			for (int y = 0; y < dstHeight; y++) {
+				const uint8_t* top = src + static_cast<size_t>(yIndex[y]) * srcStride;
+				const uint8_t* bottom = yIndex[y] + 1 < srcHeight ? top + srcStride : top;
+				const int fy = yFraction[y];
+				uint8_t* out = dst + static_cast<size_t>(y) * dstStride;
+
+				for (int x = 0; x < dstWidth; x++) {
+					const int i = xIndex[x];
+					const int j = i + 1 < srcWidth ? i + 1 : i;
+					const int fx = xFraction[x];
+					const int upper = top[i] * (kOne - fx) + top[j] * fx;
+					const int lower = bottom[i] * (kOne - fx) + bottom[j] * fx;
+					out[x] = static_cast<uint8_t>((upper * (kOne - fy) + lower * fy + (1 << (2 * kFractionBits - 1))) >> (2 * kFractionBits));
+				}
+			}
+		}
+	}
+
+	I420Planes I420Planes::packed(uint8_t* data, int width, int height) {
+		I420Planes planes;
+		planes.width = width;
+		planes.height = height;
+		planes.strideY = width;
+		planes.strideU = I420ChromaWidth(width);
+		planes.strideV = planes.strideU;
+		planes.y = data;
+		planes.u = data + static_cast<size_t>(width) * height;
+		planes.v = planes.u + static_cast<size_t>(planes.strideU) * I420ChromaHeight(height);
+		return planes;
+	}
+
+	I420ConstPlanes I420ConstPlanes::packed(const uint8_t* data, int width, int height) {
+		return I420ConstPlanes(I420Planes::packed(const_cast<uint8_t*>(data), width, height));
+	}
+
+	void CopyI420(const I420ConstPlanes& src, const I420Planes& dst) {
+		const int width = std::min(src.width, dst.width);
+		const int height = std::min(src.height, dst.height);
+		copyPlane(src.y, src.strideY, dst.y, dst.strideY, width, height);
+		copyPlane(src.u, src.strideU, dst.u, dst.strideU, I420ChromaWidth(width), I420ChromaHeight(height));
+		copyPlane(src.v, src.strideV, dst.v, dst.strideV, I420ChromaWidth(width), I420ChromaHeight(height));
+	}
+
+	void ScaleI420(const I420ConstPlanes& src, const I420Planes& dst) {
+		if (src.width <= 0 || src.height <= 0 || dst.width <= 0 || dst.height <= 0) {
+			return;
+		}
+
+		scalePlane(src.y, src.strideY, src.width, src.height, dst.y, dst.strideY, dst.width, dst.height);
+
+		const int srcChromaWidth = I420ChromaWidth(src.width);
+		const int srcChromaHeight = I420ChromaHeight(src.height);
+		const int dstChromaWidth = I420ChromaWidth(dst.width);
+		const int dstChromaHeight = I420ChromaHeight(dst.height);
+		scalePlane(src.u, src.strideU, srcChromaWidth, srcChromaHeight, dst.u, dst.strideU, dstChromaWidth, dstChromaHeight);
+		scalePlane(src.v, src.strideV, srcChromaWidth, srcChromaHeight, dst.v, dst.strideV, dstChromaWidth, dstChromaHeight);
+	}
+
+}  // namespace flutter_zoom_sdk
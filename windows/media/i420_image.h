@@ -0,0 +1,63 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_I420_IMAGE_H_
+#define FLUTTER_PLUGIN_MEDIA_I420_IMAGE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace flutter_zoom_sdk {
+
+	// Chroma planes are half size, rounded up, so odd dimensions keep their
+	// last column and row.
+	inline int I420ChromaWidth(int width) { return (width + 1) / 2; }
+
+	inline int I420ChromaHeight(int height) { return (height + 1) / 2; }
+
+	// Bytes of a packed I420 image: Y, then U, then V, without row padding.
+	inline size_t I420BufferSize(int width, int height) {
+		return static_cast<size_t>(width) * height
+			+ 2 * static_cast<size_t>(I420ChromaWidth(width)) * I420ChromaHeight(height);
+	}
+
+	// Writable view of the three planes of an I420 image.
+	struct I420Planes {
+		uint8_t* y = nullptr;
+		uint8_t* u = nullptr;
+		uint8_t* v = nullptr;
+		int strideY = 0;
+		int strideU = 0;
+		int strideV = 0;
+		int width = 0;
+		int height = 0;
+
+		static I420Planes packed(uint8_t* data, int width, int height);
+	};
+
+	// Read-only view of the three planes of an I420 image.
+	struct I420ConstPlanes {
+		const uint8_t* y = nullptr;
+		const uint8_t* u = nullptr;
+		const uint8_t* v = nullptr;
+		int strideY = 0;
+		int strideU = 0;
+		int strideV = 0;
+		int width = 0;
+		int height = 0;
+
+		I420ConstPlanes() = default;
+
+		I420ConstPlanes(const I420Planes& planes)
+			: y(planes.y), u(planes.u), v(planes.v),
+			strideY(planes.strideY), strideU(planes.strideU), strideV(planes.strideV),
+			width(planes.width), height(planes.height) {}
+
+		static I420ConstPlanes packed(const uint8_t* data, int width, int height);
+	};
+
+	void CopyI420(const I420ConstPlanes& src, const I420Planes& dst);
+
+	// Bilinear, pixel-centre aligned. Equal sizes are copied.
+	void ScaleI420(const I420ConstPlanes& src, const I420Planes& dst);
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_I420_IMAGE_H_
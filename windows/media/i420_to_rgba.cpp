@@ -0,0 +1,47 @@
+#include "media/i420_to_rgba.h"
+
+#include <algorithm>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// Inverse of the BT.601 coefficients in rgba_to_i420.cpp, 8-bit fixed
+		// point.
+		struct Coefficients {
+			int y, yOffset;
+			int rv, gu, gv, bu;
+		};
+
+		constexpr Coefficients kLimited = { 298, 16, 409, -100, -208, 516 };
+		constexpr Coefficients kFull = { 256, 0, 359, -88, -183, 454 };
+
+		inline uint8_t clamp8(int value) {
+			return static_cast<uint8_t>(std::clamp(value, 0, 255));
+		}
+	}
+
+	void ConvertI420ToRgba(const I420ConstPlanes& src, bool fullRange, uint8_t* dst, int dstStride) {
+		const Coefficients& c = fullRange ? kFull : kLimited;
+		if (dstStride == 0) {
+			dstStride = src.width * 4;
+		}
+
+		for (int row = 0; row < src.height; row++) {
+			const uint8_t* y = src.y + static_cast<size_t>(row) * src.strideY;
+			const uint8_t* u = src.u + static_cast<size_t>(row / 2) * src.strideU;
+			const uint8_t* v = src.v + static_cast<size_t>(row / 2) * src.strideV;
+			uint8_t* out = dst + static_cast<size_t>(row) * dstStride;
+			for (int x = 0; x < src.width; x++) {
+				const int luma = (y[x] - c.yOffset) * c.y + 128;
+				const int d = u[x / 2] - 128;
+				const int e = v[x / 2] - 128;
+				out[0] = clamp8((luma + c.rv * e) >> 8);
+				out[1] = clamp8((luma + c.gu * d + c.gv * e) >> 8);
+				out[2] = clamp8((luma + c.bu * d) >> 8);
+				out[3] = 255;
+				out += 4;
+			}
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
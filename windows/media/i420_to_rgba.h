@@ -0,0 +1,17 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_I420_TO_RGBA_H_
+#define FLUTTER_PLUGIN_MEDIA_I420_TO_RGBA_H_
+
+#include <cstdint>
+
+#include "media/i420_image.h"
+
+namespace flutter_zoom_sdk {
+
+	// BT.601 conversion of src into opaque 32-bit Rgba pixels, the layout of
+	// a Flutter pixel buffer texture. Each chroma sample covers its 2x2
+	// block. dstStride is in bytes, 0 for tightly packed rows.
+	void ConvertI420ToRgba(const I420ConstPlanes& src, bool fullRange, uint8_t* dst, int dstStride = 0);
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_I420_TO_RGBA_H_
@@ -0,0 +1,98 @@
+#include "media/language_registry.h"
+
+#include <atomic>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		bool sameName(const zstring& known, const zchar_t* name) {
+			size_t i = 0;
+			for (; i < known.size(); ++i) {
+				if (name[i] != known[i]) {
+					return false;
+				}
+			}
+			return name[i] == 0;
+		}
+	}
+
+	LanguageRegistry::LanguageRegistry() : entries_(std::make_shared<const EntryList>()) {}
+
+	uint32_t LanguageRegistry::intern(const zchar_t* name) {
+		if (!name || !*name) {
+			return kInvalidId;
+		}
+
+		auto entries = std::atomic_load(&entries_);
+		for (const auto& entry : *entries) {
+			if (sameName(entry.name, name)) {
+				return entry.id;
+			}
+		}
+
+		return insert(zstring(name));
+	}
+
+	uint32_t LanguageRegistry::intern(const std::string& utf8Name) {
+		if (utf8Name.empty()) {
+			return kInvalidId;
+		}
+
+		const uint32_t id = find(utf8Name);
+		return id != kInvalidId ? id : insert(FromUtf8(utf8Name));
+	}
+
+	uint32_t LanguageRegistry::find(const std::string& utf8Name) const {
+		auto entries = std::atomic_load(&entries_);
+		for (const auto& entry : *entries) {
+			if (entry.utf8 == utf8Name) {
+				return entry.id;
+			}
+		}
+		return kInvalidId;
+	}
+
+	std::string LanguageRegistry::name(uint32_t id) const {
+		auto entries = std::atomic_load(&entries_);
+		// Ids are assigned sequentially from 1.
+		if (id == kInvalidId || id > entries->size()) {
+			return std::string();
+		}
+		return (*entries)[id - 1].utf8;
+	}
+
+	std::vector<std::pair<uint32_t, std::string>> LanguageRegistry::languages() const {
+		std::vector<std::pair<uint32_t, std::string>> result;
+
+		auto entries = std::atomic_load(&entries_);
+		result.reserve(entries->size());
+		for (const auto& entry : *entries) {
+			result.emplace_back(entry.id, entry.utf8);
+		}
+		return result;
+	}
+
+	uint32_t LanguageRegistry::insert(zstring name) {
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		// Another thread may have added it since the lock-free miss.
+		auto current = std::atomic_load(&entries_);
+		for (const auto& entry : *current) {
+			if (entry.name == name) {
+				return entry.id;
+			}
+		}
+
+		auto next = std::make_shared<EntryList>(*current);
+		Entry entry;
+		entry.utf8 = ToUtf8(name.c_str());
+		entry.name = std::move(name);
+		entry.id = static_cast<uint32_t>(next->size() + 1);
+		next->push_back(std::move(entry));
+
+		const uint32_t id = next->back().id;
+		std::atomic_store(&entries_, std::shared_ptr<const EntryList>(std::move(next)));
+		return id;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,56 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_LANGUAGE_REGISTRY_H_
+#define FLUTTER_PLUGIN_MEDIA_LANGUAGE_REGISTRY_H_
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <zoom_sdk_def.h>
+
+#include "util/zchar_util.h"
+
+namespace flutter_zoom_sdk {
+
+	// Interns interpretation language names to small ids. The SDK hands us the
+	// language as a zchar_t string on every 10 ms interpreter callback; known
+	// names resolve with a lock-free scan of a handful of entries and no
+	// conversion. Ids start at 1 and are never reused.
+	class LanguageRegistry {
+	public:
+		static constexpr uint32_t kInvalidId = 0;
+
+		LanguageRegistry();
+
+		// Hot path, called from SDK audio threads.
+		uint32_t intern(const zchar_t* name);
+
+		uint32_t intern(const std::string& utf8Name);
+
+		// Returns kInvalidId for names that were never seen.
+		uint32_t find(const std::string& utf8Name) const;
+
+		std::string name(uint32_t id) const;
+
+		std::vector<std::pair<uint32_t, std::string>> languages() const;
+
+	private:
+		struct Entry {
+			zstring name;
+			std::string utf8;
+			uint32_t id;
+		};
+
+		using EntryList = std::vector<Entry>;
+
+		uint32_t insert(zstring name);
+
+		std::shared_ptr<const EntryList> entries_;
+		std::mutex mutex_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_LANGUAGE_REGISTRY_H_
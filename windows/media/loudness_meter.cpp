@@ -0,0 +1,186 @@
+#include "media/loudness_meter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr double kPi = 3.14159265358979323846;
+		constexpr double kAbsoluteGate = -70.0;
+		constexpr double kRelativeGate = -10.0;
+		constexpr double kHistogramStep = 0.1;
+		constexpr size_t kMomentaryBlocks = 4;
+
+		double energyToLufs(double energy) {
+			return -0.691 + 10.0 * std::log10(energy);
+		}
+
+		double lufsToEnergy(double lufs) {
+			return std::pow(10.0, (lufs + 0.691) / 10.0);
+		}
+
+		float silence() {
+			return -std::numeric_limits<float>::infinity();
+		}
+	}
+
+	LoudnessMeter::LoudnessMeter(uint32_t sampleRate, uint32_t channels)
+		: sampleRate_(sampleRate),
+		channels_(std::clamp<uint32_t>(channels, 1, kMaxChannels)),
+		blockFrames_(std::max<size_t>(sampleRate / 10, 1)),
+		histogramCount_(kHistogramBins),
+		histogramEnergy_(kHistogramBins) {
+		// BS.1770 filters from their analog prototypes, so any SDK rate works.
+		const double rate = std::max<uint32_t>(sampleRate, 8000);
+		{
+			const double f0 = 1681.974450955533;
+			const double gain = 3.999843853973347;
+			const double q = 0.7071752369554196;
+			const double k = std::tan(kPi * f0 / rate);
+			const double vh = std::pow(10.0, gain / 20.0);
+			const double vb = std::pow(vh, 0.4996667741545416);
+			const double a0 = 1.0 + k / q + k * k;
+			shelf_ = Biquad{
+				(vh + vb * k / q + k * k) / a0,
+				2.0 * (k * k - vh) / a0,
+				(vh - vb * k / q + k * k) / a0,
+				2.0 * (k * k - 1.0) / a0,
+				(1.0 - k / q + k * k) / a0 };
+		}
+		{
+			const double f0 = 38.13547087602444;
+			const double q = 0.5003270373238773;
+			const double k = std::tan(kPi * f0 / rate);
+			const double a0 = 1.0 + k / q + k * k;
+			highPass_ = Biquad{ 1.0, -2.0, 1.0, 2.0 * (k * k - 1.0) / a0, (1.0 - k / q + k * k) / a0 };
+		}
+
+		reset();
+	}
+
+	void LoudnessMeter::reset() {
+		shelfState_.fill(FilterState());
+		highPassState_.fill(FilterState());
+		blockEnergy_ = 0.0;
+		blockFill_ = 0;
+		blocks_.fill(0.0);
+		blockCount_ = 0;
+		std::fill(histogramCount_.begin(), histogramCount_.end(), 0u);
+		std::fill(histogramEnergy_.begin(), histogramEnergy_.end(), 0.0);
+	}
+
+	void LoudnessMeter::add(const int16_t* samples, size_t frames) {
+		constexpr double kScale = 1.0 / 32768.0;
+
+		for (size_t i = 0; i < frames; i++) {
+			for (uint32_t c = 0; c < channels_; c++) {
+				const double x = samples[i * channels_ + c] * kScale;
+
+				// Transposed direct form II.
+				FilterState& s = shelfState_[c];
+				const double y = shelf_.b0 * x + s.z1;
+				s.z1 = shelf_.b1 * x - shelf_.a1 * y + s.z2;
+				s.z2 = shelf_.b2 * x - shelf_.a2 * y;
+
+				FilterState& h = highPassState_[c];
+				const double z = highPass_.b0 * y + h.z1;
+				h.z1 = highPass_.b1 * y - highPass_.a1 * z + h.z2;
+				h.z2 = highPass_.b2 * y - highPass_.a2 * z;
+
+				// L and R weigh 1.0; mono streams are treated as one channel.
+				blockEnergy_ += z * z;
+			}
+
+			if (++blockFill_ == blockFrames_) {
+				finishBlock();
+			}
+		}
+	}
+
+	void LoudnessMeter::finishBlock() {
+		std::move(blocks_.begin() + 1, blocks_.end(), blocks_.begin());
+		blocks_.back() = blockEnergy_ / static_cast<double>(blockFrames_);
+		blockCount_ = std::min(blockCount_ + 1, kBlockHistory);
+		blockEnergy_ = 0.0;
+		blockFill_ = 0;
+
+		// Gating blocks are 400 ms with 75% overlap, i.e. one per 100 ms block.
+		if (blockCount_ < kMomentaryBlocks) {
+			return;
+		}
+
+		double energy = 0.0;
+		for (size_t i = kBlockHistory - kMomentaryBlocks; i < kBlockHistory; i++) {
+			energy += blocks_[i];
+		}
+		energy /= kMomentaryBlocks;
+
+		if (energy <= 0.0) {
+			return;
+		}
+		const double lufs = energyToLufs(energy);
+		if (lufs <= kAbsoluteGate) {
+			return;
+		}
+
+		const size_t bin = std::min(static_cast<size_t>((lufs - kAbsoluteGate) / kHistogramStep), kHistogramBins - 1);
+		histogramCount_[bin]++;
+		histogramEnergy_[bin] += energy;
+	}
+
+	float LoudnessMeter::windowLoudness(size_t blocks) const {
+		if (blockCount_ < blocks) {
+			return silence();
+		}
+
+		double energy = 0.0;
+		for (size_t i = kBlockHistory - blocks; i < kBlockHistory; i++) {
+			energy += blocks_[i];
+		}
+		energy /= static_cast<double>(blocks);
+
+		return energy > 0.0 ? static_cast<float>(energyToLufs(energy)) : silence();
+	}
+
+	float LoudnessMeter::momentary() const {
+		return windowLoudness(kMomentaryBlocks);
+	}
+
+	float LoudnessMeter::shortTerm() const {
+		return windowLoudness(kBlockHistory);
+	}
+
+	float LoudnessMeter::integrated() const {
+		uint64_t count = 0;
+		double energy = 0.0;
+		for (size_t i = 0; i < kHistogramBins; i++) {
+			count += histogramCount_[i];
+			energy += histogramEnergy_[i];
+		}
+		if (count == 0) {
+			return silence();
+		}
+
+		// Bins wholly below the relative gate are dropped.
+		const double gate = energyToLufs(energy / static_cast<double>(count)) + kRelativeGate;
+		const double gateEnergy = lufsToEnergy(gate);
+		count = 0;
+		energy = 0.0;
+		for (size_t i = 0; i < kHistogramBins; i++) {
+			const double binTop = kAbsoluteGate + (i + 1) * kHistogramStep;
+			if (binTop <= gate || histogramCount_[i] == 0) {
+				continue;
+			}
+			if (histogramEnergy_[i] / histogramCount_[i] <= gateEnergy) {
+				continue;
+			}
+			count += histogramCount_[i];
+			energy += histogramEnergy_[i];
+		}
+
+		return count > 0 ? static_cast<float>(energyToLufs(energy / static_cast<double>(count))) : silence();
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,77 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_LOUDNESS_METER_H_
+#define FLUTTER_PLUGIN_MEDIA_LOUDNESS_METER_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	// EBU R128 / ITU-R BS.1770 loudness of one stream. Samples are K-weighted
+	// (high-shelf pre-filter plus RLB high-pass, coefficients derived for the
+	// stream's rate) and summed into 100 ms energy blocks:
+	//   momentary  - last 400 ms
+	//   short-term - last 3 s
+	//   integrated - gated mean since reset (absolute -70 LUFS, relative -10 LU),
+	//                kept as a 0.1 LU histogram so memory stays constant.
+	// Values are LUFS, -infinity while there is not enough audio.
+	class LoudnessMeter {
+	public:
+		LoudnessMeter(uint32_t sampleRate, uint32_t channels);
+
+		uint32_t sampleRate() const { return sampleRate_; }
+
+		uint32_t channels() const { return channels_; }
+
+		// Interleaved int16 samples, frames per channel.
+		void add(const int16_t* samples, size_t frames);
+
+		float momentary() const;
+
+		float shortTerm() const;
+
+		float integrated() const;
+
+		void reset();
+
+	private:
+		struct Biquad {
+			double b0, b1, b2, a1, a2;
+		};
+
+		struct FilterState {
+			double z1 = 0.0;
+			double z2 = 0.0;
+		};
+
+		static constexpr size_t kMaxChannels = 2;
+		// 3 s of 100 ms blocks.
+		static constexpr size_t kBlockHistory = 30;
+		static constexpr size_t kHistogramBins = 1000;
+
+		void finishBlock();
+
+		float windowLoudness(size_t blocks) const;
+
+		const uint32_t sampleRate_;
+		const uint32_t channels_;
+		const size_t blockFrames_;
+		Biquad shelf_;
+		Biquad highPass_;
+		std::array<FilterState, kMaxChannels> shelfState_;
+		std::array<FilterState, kMaxChannels> highPassState_;
+
+		double blockEnergy_;
+		size_t blockFill_;
+		std::array<double, kBlockHistory> blocks_;
+		size_t blockCount_;
+
+		// 400 ms gating blocks per 0.1 LU from -70 LUFS.
+		std::vector<uint32_t> histogramCount_;
+		std::vector<double> histogramEnergy_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_LOUDNESS_METER_H_
@@ -0,0 +1,100 @@
+#include "media/mapped_file.h"
+
+#include <filesystem>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace flutter_zoom_sdk {
+
+#ifdef _WIN32
+	MappedFile::MappedFile() : data_(nullptr), size_(0), file_(INVALID_HANDLE_VALUE), mapping_(nullptr) {}
+#else
+	MappedFile::MappedFile() : data_(nullptr), size_(0) {}
+#endif
+
+	MappedFile::~MappedFile() {
+		close();
+	}
+
+#ifdef _WIN32
+	bool MappedFile::open(const std::string& path) {
+		close();
+
+		// Shared for writing too, so a segment still being archived can be read.
+		file_ = CreateFileW(std::filesystem::u8path(path).c_str(), GENERIC_READ,
+			FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		LARGE_INTEGER size;
+		if (file_ == INVALID_HANDLE_VALUE || !GetFileSizeEx(file_, &size) || size.QuadPart <= 0) {
+			close();
+			return false;
+		}
+
+		mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		data_ = mapping_ ? static_cast<const uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+		if (!data_) {
+			close();
+			return false;
+		}
+		size_ = static_cast<size_t>(size.QuadPart);
+		return true;
+	}
+
+	void MappedFile::close() {
+		if (data_) {
+			UnmapViewOfFile(data_);
+		}
+		if (mapping_) {
+			CloseHandle(mapping_);
+		}
+		if (file_ != INVALID_HANDLE_VALUE) {
+			CloseHandle(file_);
+		}
+		data_ = nullptr;
+		size_ = 0;
+		mapping_ = nullptr;
+		file_ = INVALID_HANDLE_VALUE;
+	}
+#else
+	bool MappedFile::open(const std::string& path) {
+		close();
+
+		const int fd = ::open(std::filesystem::u8path(path).c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0) {
+			return false;
+		}
+
+		struct stat info;
+		if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+			::close(fd);
+			return false;
+		}
+
+		// The mapping keeps the file referenced after the descriptor closes.
+		void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (data == MAP_FAILED) {
+			return false;
+		}
+
+		data_ = static_cast<const uint8_t*>(data);
+		size_ = static_cast<size_t>(info.st_size);
+		return true;
+	}
+
+	void MappedFile::close() {
+		if (data_) {
+			munmap(const_cast<uint8_t*>(data_), size_);
+		}
+		data_ = nullptr;
+		size_ = 0;
+	}
+#endif
+
+}  // namespace flutter_zoom_sdk
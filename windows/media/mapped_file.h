@@ -0,0 +1,42 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_MAPPED_FILE_H_
+#define FLUTTER_PLUGIN_MEDIA_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace flutter_zoom_sdk {
+
+	// Read-only memory mapping of a whole file.
+	class MappedFile {
+	public:
+		MappedFile();
+
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		// path is UTF-8. Empty files fail.
+		bool open(const std::string& path);
+
+		void close();
+
+		bool isOpen() const { return data_ != nullptr; }
+
+		const uint8_t* data() const { return data_; }
+
+		size_t size() const { return size_; }
+
+	private:
+		const uint8_t* data_;
+		size_t size_;
+#ifdef _WIN32
+		void* file_;
+		void* mapping_;
+#endif
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_MAPPED_FILE_H_
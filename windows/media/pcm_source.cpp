@@ -0,0 +1,59 @@
+#include "media/pcm_source.h"
+
+#include <algorithm>
+
+namespace flutter_zoom_sdk {
+
+	WavFilePcmSource::WavFilePcmSource(bool loop) : loop_(loop) {}
+
+	bool WavFilePcmSource::open(const std::string& path) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return reader_.open(path) && reader_.frameCount() > 0;
+	}
+
+	size_t WavFilePcmSource::read(int16_t* samples, size_t frames) {
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		size_t total = reader_.read(samples, frames);
+		while (loop_ && total < frames && reader_.frameCount() > 0) {
+			reader_.rewind();
+			const size_t count = reader_.read(samples + total * reader_.channels(), frames - total);
+			if (count == 0) {
+				break;
+			}
+			total += count;
+		}
+		return total;
+	}
+
+	size_t WavFilePcmSource::bufferedFrames() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return static_cast<size_t>(reader_.framesLeft());
+	}
+
+	bool WavFilePcmSource::finished() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return !loop_ && reader_.framesLeft() == 0;
+	}
+
+	RingPcmSource::RingPcmSource(uint32_t sampleRate, uint32_t channels, size_t capacityFrames)
+		: sampleRate_(sampleRate),
+		channels_(std::max<uint32_t>(channels, 1)),
+		ring_(capacityFrames * std::max<uint32_t>(channels, 1)) {}
+
+	size_t RingPcmSource::push(const int16_t* samples, size_t frames) {
+		// Whole frames only, so the channels never shift.
+		frames = std::min(frames, ring_.writeAvailable() / channels_);
+		return ring_.write(samples, frames * channels_) / channels_;
+	}
+
+	size_t RingPcmSource::read(int16_t* samples, size_t frames) {
+		frames = std::min(frames, ring_.readAvailable() / channels_);
+		return ring_.read(samples, frames * channels_) / channels_;
+	}
+
+	bool RingPcmSource::finished() const {
+		return ended_.load(std::memory_order_acquire) && ring_.readAvailable() < channels_;
+	}
+
+}  // namespace flutter_zoom_sdk
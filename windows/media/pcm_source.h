@@ -0,0 +1,91 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_PCM_SOURCE_H_
+#define FLUTTER_PLUGIN_MEDIA_PCM_SOURCE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "media/spsc_ring.h"
+#include "media/wav_file.h"
+
+namespace flutter_zoom_sdk {
+
+	// Interleaved int16 audio pulled by a sender thread.
+	class IPcmSource {
+	public:
+		virtual ~IPcmSource() {}
+
+		virtual uint32_t sampleRate() const = 0;
+
+		virtual uint32_t channels() const = 0;
+
+		// Reads up to frames frames. Fewer, or none, when the source is starved.
+		virtual size_t read(int16_t* samples, size_t frames) = 0;
+
+		// Frames that read() could return right now.
+		virtual size_t bufferedFrames() const = 0;
+
+		// True once read() will never return audio again.
+		virtual bool finished() const = 0;
+	};
+
+	// Plays a WAV file once or in a loop.
+	class WavFilePcmSource : public IPcmSource {
+	public:
+		explicit WavFilePcmSource(bool loop);
+
+		// path is UTF-8.
+		bool open(const std::string& path);
+
+		uint32_t sampleRate() const override { return reader_.sampleRate(); }
+
+		uint32_t channels() const override { return reader_.channels(); }
+
+		size_t read(int16_t* samples, size_t frames) override;
+
+		size_t bufferedFrames() const override;
+
+		bool finished() const override;
+
+	private:
+		const bool loop_;
+		mutable std::mutex mutex_;
+		WavReader reader_;
+	};
+
+	// Audio pushed from one producer thread (the Dart channel) and read by
+	// one consumer, through a lock-free ring.
+	class RingPcmSource : public IPcmSource {
+	public:
+		RingPcmSource(uint32_t sampleRate, uint32_t channels, size_t capacityFrames);
+
+		uint32_t sampleRate() const override { return sampleRate_; }
+
+		uint32_t channels() const override { return channels_; }
+
+		// Producer side. Returns the frames accepted; the rest did not fit.
+		size_t push(const int16_t* samples, size_t frames);
+
+		// Producer side: no more audio will be pushed.
+		void end() { ended_.store(true, std::memory_order_release); }
+
+		size_t freeFrames() const { return ring_.writeAvailable() / channels_; }
+
+		size_t read(int16_t* samples, size_t frames) override;
+
+		size_t bufferedFrames() const override { return ring_.readAvailable() / channels_; }
+
+		bool finished() const override;
+
+	private:
+		const uint32_t sampleRate_;
+		const uint32_t channels_;
+		SpscRing<int16_t> ring_;
+		std::atomic<bool> ended_{ false };
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_PCM_SOURCE_H_
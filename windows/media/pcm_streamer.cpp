@@ -0,0 +1,245 @@
+#include "media/pcm_streamer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// One second of 48 kHz stereo; the worker drains far more often.
+		constexpr size_t kTapRingSamples = 48000 * 2;
+		constexpr size_t kIdleChunkBuffers = 16;
+		constexpr auto kMinBatch = std::chrono::milliseconds(10);
+		constexpr auto kMaxBatch = std::chrono::milliseconds(2000);
+		// A user who left, or a language no longer interpreted, stops sending;
+		// its ring is dropped after this long without a frame.
+		constexpr auto kIdleStreamTimeout = std::chrono::seconds(10);
+
+		size_t chunkCapacity(size_t prefix, std::chrono::milliseconds batch) {
+			return prefix + kPcmChunkHeaderSize + static_cast<size_t>(48 * 2 * batch.count()) * sizeof(int16_t);
+		}
+
+		template <typename T>
+		void putLE(uint8_t* dst, T value) {
+			std::memcpy(dst, &value, sizeof(T));
+		}
+	}
+
+	PcmStreamer::StreamRing::StreamRing(size_t capacitySamples)
+		: samples(capacitySamples), lastActive(std::chrono::steady_clock::now()) {}
+
+	PcmStreamer::Tap::Tap() : rings_(std::make_shared<const RingMap>()) {}
+
+	void PcmStreamer::Tap::onAudioFrame(const AudioStreamKey& key, const AudioFrame& frame) {
+		auto rings = std::atomic_load(&rings_);
+		auto it = rings->find(key);
+		if (it != rings->end()) {
+			it->second->samples.write(frame);
+			return;
+		}
+
+		// First frame of a stream: allocate once, off the common path.
+		std::shared_ptr<StreamRing> ring;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			auto current = std::atomic_load(&rings_);
+			auto itCurrent = current->find(key);
+			if (itCurrent != current->end()) {
+				ring = itCurrent->second;
+			}
+			else {
+				ring = std::make_shared<StreamRing>(kTapRingSamples);
+				auto next = std::make_shared<RingMap>(*current);
+				next->emplace(key, ring);
+				std::atomic_store(&rings_, std::shared_ptr<const RingMap>(std::move(next)));
+			}
+		}
+
+		ring->samples.write(frame);
+	}
+
+	void PcmStreamer::Tap::streams(std::vector<Stream>& out) {
+		auto rings = std::atomic_load(&rings_);
+		out.insert(out.end(), rings->begin(), rings->end());
+	}
+
+	void PcmStreamer::Tap::drop(const AudioStreamKey& key, const std::shared_ptr<StreamRing>& ring) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto current = std::atomic_load(&rings_);
+		auto it = current->find(key);
+		if (it == current->end() || it->second != ring) {
+			return;
+		}
+
+		auto next = std::make_shared<RingMap>(*current);
+		next->erase(key);
+		std::atomic_store(&rings_, std::shared_ptr<const RingMap>(std::move(next)));
+	}
+
+	PcmStreamer::PcmStreamer(AudioRawDataHub& hub, ChunkSink sink, size_t reservedPrefix)
+		: hub_(hub),
+		sink_(std::move(sink)),
+		reservedPrefix_(reservedPrefix),
+		batch_(100),
+		pool_(BufferPool::create(chunkCapacity(reservedPrefix, std::chrono::milliseconds(100)), kIdleChunkBuffers)),
+		stopping_(false) {
+		worker_ = std::thread(&PcmStreamer::run, this);
+	}
+
+	PcmStreamer::~PcmStreamer() {
+		unsubscribeAll();
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stopping_ = true;
+		}
+		wake_.notify_all();
+		worker_.join();
+	}
+
+	void PcmStreamer::setBatchDuration(std::chrono::milliseconds duration) {
+		duration = std::clamp(duration, std::chrono::milliseconds(kMinBatch), std::chrono::milliseconds(kMaxBatch));
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (duration == batch_) {
+			return;
+		}
+		batch_ = duration;
+		// Buffers of the old size class are freed as they come back.
+		pool_ = BufferPool::create(chunkCapacity(reservedPrefix_, duration), kIdleChunkBuffers);
+		wake_.notify_all();
+	}
+
+	std::chrono::milliseconds PcmStreamer::batchDuration() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return batch_;
+	}
+
+	bool PcmStreamer::subscribe(const AudioStreamKey& key) {
+		std::shared_ptr<Tap> tap;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (taps_.count(key)) {
+				return false;
+			}
+			tap = std::make_shared<Tap>();
+			taps_.emplace(key, tap);
+		}
+
+		hub_.addConsumer(key, tap);
+		return true;
+	}
+
+	bool PcmStreamer::unsubscribe(const AudioStreamKey& key) {
+		std::shared_ptr<Tap> tap;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			auto it = taps_.find(key);
+			if (it == taps_.end()) {
+				return false;
+			}
+			tap = it->second;
+			taps_.erase(it);
+		}
+
+		hub_.removeConsumer(key, tap);
+		return true;
+	}
+
+	void PcmStreamer::unsubscribeAll() {
+		std::unordered_map<AudioStreamKey, std::shared_ptr<Tap>, AudioStreamKeyHash> taps;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			taps.swap(taps_);
+		}
+
+		for (auto& entry : taps) {
+			hub_.removeConsumer(entry.first, entry.second);
+		}
+	}
+
+	size_t PcmStreamer::subscriptionCount() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return taps_.size();
+	}
+
+	void PcmStreamer::run() {
+		std::vector<std::pair<AudioStreamKey, std::shared_ptr<Tap>>> snapshot;
+		std::vector<Stream> streams;
+
+		std::unique_lock<std::mutex> lock(mutex_);
+		while (!stopping_) {
+			// Poll at a quarter of the batch so a chunk leaves at most 25% late.
+			wake_.wait_for(lock, std::max(batch_ / 4, std::chrono::milliseconds(5)));
+			if (stopping_) {
+				break;
+			}
+
+			snapshot.assign(taps_.begin(), taps_.end());
+			const auto batch = batch_;
+			lock.unlock();
+
+			const auto now = std::chrono::steady_clock::now();
+			for (auto& entry : snapshot) {
+				entry.second->streams(streams);
+				for (auto& stream : streams) {
+					StreamRing& ring = *stream.second;
+					if (ring.samples.available() != ring.leftover) {
+						ring.lastActive = now;
+					}
+					else if (now - ring.lastActive >= kIdleStreamTimeout) {
+						entry.second->drop(stream.first, stream.second);
+						continue;
+					}
+
+					const uint32_t rate = ring.samples.sampleRate();
+					if (rate != 0) {
+						drainStream(stream.first, ring.samples, static_cast<size_t>(rate * batch.count() / 1000));
+					}
+					ring.leftover = ring.samples.available();
+				}
+				streams.clear();
+			}
+			snapshot.clear();
+
+			lock.lock();
+		}
+	}
+
+	void PcmStreamer::drainStream(const AudioStreamKey& key, TimestampedAudioRing& ring, size_t batchSamplesPerChannel) {
+		const uint32_t rate = ring.sampleRate();
+		const uint32_t channels = ring.channels();
+		const size_t batchSamples = batchSamplesPerChannel * channels;
+		if (batchSamples == 0) {
+			return;
+		}
+
+		while (ring.available() >= batchSamples) {
+			const size_t count = batchSamples;
+
+			std::shared_ptr<BufferPool> pool;
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				pool = pool_;
+			}
+
+			PooledBuffer chunk = pool->acquire();
+			chunk->resize(reservedPrefix_ + kPcmChunkHeaderSize + count * sizeof(int16_t));
+
+			uint8_t* header = chunk->data() + reservedPrefix_;
+			header[0] = kPcmChunkVersion;
+			header[1] = static_cast<uint8_t>(key.kind);
+			putLE<uint16_t>(header + 2, static_cast<uint16_t>(channels));
+			putLE<uint32_t>(header + 4, key.id);
+			putLE<uint32_t>(header + 8, rate);
+			putLE<uint32_t>(header + 12, ring.takeDropped());
+			putLE<uint64_t>(header + 16, ring.frontTimestamp());
+
+			ring.read(reinterpret_cast<int16_t*>(header + kPcmChunkHeaderSize), count);
+
+			sink_(std::move(chunk));
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
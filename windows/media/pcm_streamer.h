@@ -0,0 +1,125 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_PCM_STREAMER_H_
+#define FLUTTER_PLUGIN_MEDIA_PCM_STREAMER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "media/audio_raw_data_hub.h"
+#include "media/audio_stream.h"
+#include "media/buffer_pool.h"
+#include "media/timestamped_audio_ring.h"
+
+namespace flutter_zoom_sdk {
+
+	// Layout of the header in front of every PCM chunk, all little-endian:
+	//   0  u8   version (kPcmChunkVersion)
+	//   1  u8   AudioStreamKind
+	//   2  u16  channel count
+	//   4  u32  stream id (user id, 0 for mixed)
+	//   8  u32  sample rate
+	//   12 u32  samples dropped on this stream since the previous chunk
+	//   16 u64  timestamp of the first sample, milliseconds
+	//   24      interleaved int16 samples
+	constexpr uint8_t kPcmChunkVersion = 1;
+	constexpr size_t kPcmChunkHeaderSize = 24;
+
+	// Batches raw audio from the hub into fixed-duration PCM chunks. SDK threads
+	// only copy samples into a per-stream ring; a worker thread cuts chunks into
+	// pooled buffers and hands them to the sink. Streams that are not subscribed
+	// have no tap and therefore no cost. A kAnyStreamId subscription is split
+	// into one ring per stream it matches, so each chunk holds one speaker.
+	class PcmStreamer {
+	public:
+		// Receives a finished chunk. The first reservedPrefix bytes of the buffer
+		// are left for the caller (e.g. a channel envelope), the header follows.
+		using ChunkSink = std::function<void(PooledBuffer chunk)>;
+
+		PcmStreamer(AudioRawDataHub& hub, ChunkSink sink, size_t reservedPrefix = 0);
+
+		~PcmStreamer();
+
+		PcmStreamer(const PcmStreamer&) = delete;
+		PcmStreamer& operator=(const PcmStreamer&) = delete;
+
+		void setBatchDuration(std::chrono::milliseconds duration);
+
+		std::chrono::milliseconds batchDuration() const;
+
+		bool subscribe(const AudioStreamKey& key);
+
+		bool unsubscribe(const AudioStreamKey& key);
+
+		void unsubscribeAll();
+
+		size_t subscriptionCount();
+
+	private:
+		// A tap's ring for one concrete stream.
+		struct StreamRing {
+			explicit StreamRing(size_t capacitySamples);
+
+			TimestampedAudioRing samples;
+
+			// Worker thread only: what the last drain left behind, and when the
+			// producer last added to it.
+			size_t leftover = 0;
+			std::chrono::steady_clock::time_point lastActive;
+		};
+
+		using Stream = std::pair<AudioStreamKey, std::shared_ptr<StreamRing>>;
+
+		// Consumer registered with the hub for one subscription, with a ring
+		// per concrete stream so every ring keeps a single producer. The ring
+		// map is copy-on-write: audio threads only load it, and copy it once
+		// per new stream.
+		class Tap : public IAudioStreamConsumer {
+		public:
+			Tap();
+
+			void onAudioFrame(const AudioStreamKey& key, const AudioFrame& frame) override;
+
+			// Appends the streams seen so far to out.
+			void streams(std::vector<Stream>& out);
+
+			// Forgets a stream that went quiet; it gets a fresh ring if it
+			// comes back; a frame already on its way to the old ring is lost.
+			// Worker thread.
+			void drop(const AudioStreamKey& key, const std::shared_ptr<StreamRing>& ring);
+
+		private:
+			using RingMap = std::unordered_map<AudioStreamKey, std::shared_ptr<StreamRing>, AudioStreamKeyHash>;
+
+			// Serializes copies of rings_.
+			std::mutex mutex_;
+			std::shared_ptr<const RingMap> rings_;
+		};
+
+		void run();
+
+		void drainStream(const AudioStreamKey& key, TimestampedAudioRing& ring, size_t batchSamplesPerChannel);
+
+		AudioRawDataHub& hub_;
+		ChunkSink sink_;
+		const size_t reservedPrefix_;
+
+		mutable std::mutex mutex_;
+		std::condition_variable wake_;
+		std::unordered_map<AudioStreamKey, std::shared_ptr<Tap>, AudioStreamKeyHash> taps_;
+		std::chrono::milliseconds batch_;
+		std::shared_ptr<BufferPool> pool_;
+		bool stopping_;
+		std::thread worker_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_PCM_STREAMER_H_
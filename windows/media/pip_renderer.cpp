@@ -0,0 +1,80 @@
+#include "media/pip_renderer.h"
+
+#include <zoom_sdk_raw_data_def.h>
+
+#include "media/i420_image.h"
+#include "media/i420_to_rgba.h"
+
+namespace flutter_zoom_sdk {
+
+	PipRenderer::PipRenderer(FrameReady frameReady)
+		: frameReady_(std::move(frameReady)),
+		frontWidth_(0),
+		frontHeight_(0),
+		destroyed_(false),
+		frames_(0) {}
+
+	void PipRenderer::onRendererBeDestroyed() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		destroyed_ = true;
+	}
+
+	void PipRenderer::onRawDataFrameReceived(YUVRawDataI420* data) {
+		if (!data) {
+			return;
+		}
+
+		const int width = static_cast<int>(data->GetStreamWidth());
+		const int height = static_cast<int>(data->GetStreamHeight());
+		const auto* y = reinterpret_cast<const uint8_t*>(data->GetYBuffer());
+		const auto* u = reinterpret_cast<const uint8_t*>(data->GetUBuffer());
+		const auto* v = reinterpret_cast<const uint8_t*>(data->GetVBuffer());
+		if (!y || !u || !v || width <= 0 || height <= 0) {
+			return;
+		}
+
+		I420ConstPlanes planes = I420ConstPlanes::packed(y, width, height);
+		planes.u = u;
+		planes.v = v;
+		back_.resize(static_cast<size_t>(width) * height * 4);
+		ConvertI420ToRgba(planes, !data->IsLimitedI420(), back_.data());
+
+		{
+			std::lock_guard<std::mutex> lock(frontMutex_);
+			front_.swap(back_);
+			frontWidth_ = static_cast<uint32_t>(width);
+			frontHeight_ = static_cast<uint32_t>(height);
+		}
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			frames_++;
+		}
+		if (frameReady_) {
+			frameReady_();
+		}
+	}
+
+	void PipRenderer::onRawDataStatusChanged(RawDataStatus status) {}
+
+	const uint8_t* PipRenderer::acquireFrame(uint32_t& width, uint32_t& height) {
+		frontMutex_.lock();
+		width = frontWidth_;
+		height = frontHeight_;
+		return front_.empty() ? nullptr : front_.data();
+	}
+
+	void PipRenderer::releaseFrame() {
+		frontMutex_.unlock();
+	}
+
+	bool PipRenderer::destroyed() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return destroyed_;
+	}
+
+	uint64_t PipRenderer::frames() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return frames_;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,61 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_PIP_RENDERER_H_
+#define FLUTTER_PLUGIN_MEDIA_PIP_RENDERER_H_
+
+#include <rawdata/rawdata_renderer_interface.h>
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	// Renderer delegate for the picture-in-picture view. Converts each frame
+	// to Rgba on the SDK thread into a back buffer and swaps it to the front,
+	// where a pixel buffer texture reads it. The texture holds the front
+	// buffer only while copying it; the SDK thread never waits for more than
+	// a swap.
+	class PipRenderer : public ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate {
+	public:
+		// Called on the SDK thread after a new frame reached the front buffer.
+		using FrameReady = std::function<void()>;
+
+		explicit PipRenderer(FrameReady frameReady);
+
+		PipRenderer(const PipRenderer&) = delete;
+		PipRenderer& operator=(const PipRenderer&) = delete;
+
+		void onRendererBeDestroyed() override;
+		void onRawDataFrameReceived(YUVRawDataI420* data) override;
+		void onRawDataStatusChanged(RawDataStatus status) override;
+
+		// Locks the front buffer until releaseFrame(), even when there is no
+		// frame yet and nullptr is returned.
+		const uint8_t* acquireFrame(uint32_t& width, uint32_t& height);
+
+		void releaseFrame();
+
+		// Whether the SDK destroyed the renderer on its own.
+		bool destroyed();
+
+		uint64_t frames();
+
+	private:
+		const FrameReady frameReady_;
+
+		// Only the SDK thread touches the back buffer.
+		std::vector<uint8_t> back_;
+
+		std::mutex frontMutex_;
+		std::vector<uint8_t> front_;
+		uint32_t frontWidth_;
+		uint32_t frontHeight_;
+
+		std::mutex mutex_;
+		bool destroyed_;
+		uint64_t frames_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_PIP_RENDERER_H_
@@ -0,0 +1,51 @@
+#include "media/raw_archive_format.h"
+
+#include <array>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// Slicing-by-4 tables; chunks are megabytes, so the checksum is on the
+		// writer's hot path.
+		using CrcTables = std::array<std::array<uint32_t, 256>, 4>;
+
+		CrcTables makeTables() {
+			CrcTables tables{};
+			for (uint32_t i = 0; i < 256; i++) {
+				uint32_t crc = i;
+				for (int bit = 0; bit < 8; bit++) {
+					crc = crc & 1 ? (crc >> 1) ^ 0xEDB88320u : crc >> 1;
+				}
+				tables[0][i] = crc;
+			}
+			for (uint32_t i = 0; i < 256; i++) {
+				for (size_t t = 1; t < tables.size(); t++) {
+					tables[t][i] = (tables[t - 1][i] >> 8) ^ tables[0][tables[t - 1][i] & 0xFF];
+				}
+			}
+			return tables;
+		}
+
+		const CrcTables& tables() {
+			static const CrcTables instance = makeTables();
+			return instance;
+		}
+	}
+
+	uint32_t RawArchiveCrc32(const uint8_t* data, size_t size, uint32_t crc) {
+		const CrcTables& t = tables();
+		crc = ~crc;
+		while (size >= 4) {
+			crc ^= static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8)
+				| (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+			crc = t[3][crc & 0xFF] ^ t[2][(crc >> 8) & 0xFF] ^ t[1][(crc >> 16) & 0xFF] ^ t[0][crc >> 24];
+			data += 4;
+			size -= 4;
+		}
+		while (size-- > 0) {
+			crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xFF];
+		}
+		return ~crc;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,115 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_RAW_ARCHIVE_FORMAT_H_
+#define FLUTTER_PLUGIN_MEDIA_RAW_ARCHIVE_FORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace flutter_zoom_sdk {
+
+	// Raw media archive segment (.zra), all little-endian.
+	//
+	// Segment header, kRawArchiveHeaderSize bytes:
+	//   0  "ZRAS"
+	//   4  u16  version (kRawArchiveVersion)
+	//   6  u16  header size
+	//   8  u32  segment sequence number, from 1 per archive session
+	//   12 u32  chunk alignment
+	//   16 u64  creation time, Unix milliseconds
+	//   24 u64  reserved
+	//
+	// Chunks follow, each starting at a multiple of the chunk alignment and
+	// written, then flushed to disk, in one piece:
+	//   0  "ZRAC"
+	//   4  u32  record bytes
+	//   8  u32  record count
+	//   12 u32  CRC-32 of the record bytes
+	//   16 u64  lowest record timestamp
+	//   24 u64  highest record timestamp
+	//   32      records, then zero padding to the alignment
+	//
+	// Record, kRawArchiveRecordHeaderSize bytes then the payload padded to 8:
+	//   0  u8   RawArchiveRecordType
+	//   1  u8   AudioStreamKind for audio; 1 for limited-range video
+	//   2  u16  channels for audio
+	//   4  u32  user id, share source id or audio stream id
+	//   8  u64  SDK timestamp, milliseconds
+	//   16 u32  width, or sample rate
+	//   20 u32  height, or interleaved sample count
+	//   24 u32  payload bytes: packed I420 or interleaved s16 PCM
+	//   28 u32  arrival, milliseconds since the segment was created
+	//
+	// A closed segment ends with its index and a footer. A segment cut short
+	// by a crash has neither; its valid chunks are found by scanning.
+	//   Index: "ZRAI", u32 entry count, u32 CRC-32 of the entries, u32 0,
+	//          then RawArchiveIndexEntry sorted by stream, then timestamp.
+	//   Footer, the last kRawArchiveFooterSize bytes: u64 index offset,
+	//          u32 entry count, "ZRAE".
+	constexpr uint16_t kRawArchiveVersion = 1;
+	constexpr size_t kRawArchiveHeaderSize = 32;
+	constexpr size_t kRawArchiveChunkHeaderSize = 32;
+	constexpr size_t kRawArchiveRecordHeaderSize = 32;
+	constexpr size_t kRawArchiveIndexHeaderSize = 16;
+	constexpr size_t kRawArchiveIndexEntrySize = 24;
+	constexpr size_t kRawArchiveFooterSize = 16;
+	constexpr size_t kRawArchiveAlignment = 4096;
+	constexpr char kRawArchiveExtension[] = ".zra";
+
+	constexpr char kRawArchiveSegmentMagic[4] = { 'Z', 'R', 'A', 'S' };
+	constexpr char kRawArchiveChunkMagic[4] = { 'Z', 'R', 'A', 'C' };
+	constexpr char kRawArchiveIndexMagic[4] = { 'Z', 'R', 'A', 'I' };
+	constexpr char kRawArchiveFooterMagic[4] = { 'Z', 'R', 'A', 'E' };
+
+	enum class RawArchiveRecordType : uint8_t {
+		Video = 1,
+		Share = 2,
+		Audio = 3,
+	};
+
+	// Index entry, kRawArchiveIndexEntrySize bytes:
+	//   0  u8   RawArchiveRecordType
+	//   1  u8   AudioStreamKind for audio, else 0
+	//   2  u16  0
+	//   4  u32  stream id
+	//   8  u64  SDK timestamp, milliseconds
+	//   16 u64  file offset of the record header
+	struct RawArchiveIndexEntry {
+		RawArchiveRecordType type = RawArchiveRecordType::Video;
+		uint8_t kind = 0;
+		uint32_t id = 0;
+		uint64_t timestamp = 0;
+		uint64_t offset = 0;
+
+		// Orders by stream, then timestamp.
+		uint64_t stream() const {
+			return (static_cast<uint64_t>(type) << 40) | (static_cast<uint64_t>(kind) << 32) | id;
+		}
+	};
+
+	inline size_t RawArchiveAlign(size_t bytes, size_t alignment) {
+		return (bytes + alignment - 1) / alignment * alignment;
+	}
+
+	// Record size including header and padding.
+	inline size_t RawArchiveRecordSize(size_t payloadBytes) {
+		return kRawArchiveRecordHeaderSize + RawArchiveAlign(payloadBytes, 8);
+	}
+
+	// CRC-32 (IEEE), continuing from crc.
+	uint32_t RawArchiveCrc32(const uint8_t* data, size_t size, uint32_t crc = 0);
+
+	template <typename T>
+	void RawArchivePut(uint8_t* dst, T value) {
+		std::memcpy(dst, &value, sizeof(T));
+	}
+
+	template <typename T>
+	T RawArchiveGet(const uint8_t* src) {
+		T value;
+		std::memcpy(&value, src, sizeof(T));
+		return value;
+	}
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_RAW_ARCHIVE_FORMAT_H_
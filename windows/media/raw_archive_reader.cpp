@@ -0,0 +1,187 @@
+#include "media/raw_archive_reader.h"
+
+#include <algorithm>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		bool byStreamThenTimestamp(const RawArchiveIndexEntry& a, const RawArchiveIndexEntry& b) {
+			return a.stream() != b.stream() ? a.stream() < b.stream() : a.timestamp < b.timestamp;
+		}
+	}
+
+	RawArchiveReader::RawArchiveReader()
+		: sequence_(0),
+		createdUnixMs_(0),
+		alignment_(kRawArchiveAlignment),
+		recovered_(false) {}
+
+	bool RawArchiveReader::open(const std::string& path) {
+		close();
+		if (!file_.open(path)) {
+			return false;
+		}
+
+		const uint8_t* header = file_.data();
+		if (file_.size() < kRawArchiveHeaderSize || std::memcmp(header, kRawArchiveSegmentMagic, 4) != 0
+			|| RawArchiveGet<uint16_t>(header + 4) != kRawArchiveVersion) {
+			close();
+			return false;
+		}
+
+		sequence_ = RawArchiveGet<uint32_t>(header + 8);
+		alignment_ = RawArchiveGet<uint32_t>(header + 12);
+		createdUnixMs_ = RawArchiveGet<uint64_t>(header + 16);
+		if (alignment_ < kRawArchiveHeaderSize || (alignment_ & (alignment_ - 1)) != 0) {
+			close();
+			return false;
+		}
+
+		if (!loadIndex()) {
+			scanChunks();
+		}
+
+		timeline_.reserve(index_.size());
+		for (const RawArchiveIndexEntry& entry : index_) {
+			timeline_.push_back(entry.offset);
+		}
+		std::sort(timeline_.begin(), timeline_.end());
+
+		for (const RawArchiveIndexEntry& entry : index_) {
+			if (streams_.empty() || streams_.back().type != entry.type || streams_.back().kind != entry.kind
+				|| streams_.back().id != entry.id) {
+				RawArchiveStreamInfo info;
+				info.type = entry.type;
+				info.kind = entry.kind;
+				info.id = entry.id;
+				info.firstTimestamp = entry.timestamp;
+				streams_.push_back(info);
+			}
+			streams_.back().records++;
+			streams_.back().lastTimestamp = entry.timestamp;
+		}
+		return true;
+	}
+
+	void RawArchiveReader::close() {
+		file_.close();
+		sequence_ = 0;
+		createdUnixMs_ = 0;
+		recovered_ = false;
+		index_.clear();
+		timeline_.clear();
+		streams_.clear();
+	}
+
+	bool RawArchiveReader::loadIndex() {
+		const size_t size = file_.size();
+		if (size < alignment_ + kRawArchiveIndexHeaderSize + kRawArchiveFooterSize) {
+			return false;
+		}
+
+		const uint8_t* footer = file_.data() + size - kRawArchiveFooterSize;
+		const uint64_t indexOffset = RawArchiveGet<uint64_t>(footer);
+		const uint32_t count = RawArchiveGet<uint32_t>(footer + 8);
+		if (std::memcmp(footer + 12, kRawArchiveFooterMagic, 4) != 0 || indexOffset < alignment_
+			|| indexOffset + kRawArchiveIndexHeaderSize + static_cast<uint64_t>(count) * kRawArchiveIndexEntrySize > size - kRawArchiveFooterSize) {
+			return false;
+		}
+
+		const uint8_t* block = file_.data() + indexOffset;
+		const uint8_t* entries = block + kRawArchiveIndexHeaderSize;
+		if (std::memcmp(block, kRawArchiveIndexMagic, 4) != 0 || RawArchiveGet<uint32_t>(block + 4) != count
+			|| RawArchiveGet<uint32_t>(block + 8) != RawArchiveCrc32(entries, count * kRawArchiveIndexEntrySize)) {
+			return false;
+		}
+
+		index_.resize(count);
+		for (uint32_t i = 0; i < count; i++) {
+			const uint8_t* entry = entries + i * kRawArchiveIndexEntrySize;
+			index_[i].type = static_cast<RawArchiveRecordType>(entry[0]);
+			index_[i].kind = entry[1];
+			index_[i].id = RawArchiveGet<uint32_t>(entry + 4);
+			index_[i].timestamp = RawArchiveGet<uint64_t>(entry + 8);
+			index_[i].offset = RawArchiveGet<uint64_t>(entry + 16);
+		}
+		return true;
+	}
+
+	void RawArchiveReader::scanChunks() {
+		recovered_ = true;
+		const uint8_t* data = file_.data();
+		const size_t size = file_.size();
+
+		size_t offset = alignment_;
+		while (offset + kRawArchiveChunkHeaderSize <= size) {
+			const uint8_t* chunk = data + offset;
+			if (std::memcmp(chunk, kRawArchiveChunkMagic, 4) != 0) {
+				break;
+			}
+
+			const size_t recordBytes = RawArchiveGet<uint32_t>(chunk + 4);
+			const uint8_t* records = chunk + kRawArchiveChunkHeaderSize;
+			if (recordBytes > size - offset - kRawArchiveChunkHeaderSize
+				|| RawArchiveGet<uint32_t>(chunk + 12) != RawArchiveCrc32(records, recordBytes)) {
+				break;
+			}
+
+			size_t position = 0;
+			while (position + kRawArchiveRecordHeaderSize <= recordBytes) {
+				const uint8_t* record = records + position;
+				RawArchiveIndexEntry entry;
+				entry.type = static_cast<RawArchiveRecordType>(record[0]);
+				entry.kind = entry.type == RawArchiveRecordType::Audio ? record[1] : 0;
+				entry.id = RawArchiveGet<uint32_t>(record + 4);
+				entry.timestamp = RawArchiveGet<uint64_t>(record + 8);
+				entry.offset = offset + kRawArchiveChunkHeaderSize + position;
+				index_.push_back(entry);
+				position += RawArchiveRecordSize(RawArchiveGet<uint32_t>(record + 24));
+			}
+
+			offset = RawArchiveAlign(offset + kRawArchiveChunkHeaderSize + recordBytes, alignment_);
+		}
+
+		std::stable_sort(index_.begin(), index_.end(), byStreamThenTimestamp);
+	}
+
+	size_t RawArchiveReader::seek(RawArchiveRecordType type, uint8_t kind, uint32_t id, uint64_t timestamp) const {
+		RawArchiveIndexEntry key;
+		key.type = type;
+		key.kind = type == RawArchiveRecordType::Audio ? kind : 0;
+		key.id = id;
+		key.timestamp = timestamp;
+
+		auto it = std::lower_bound(index_.begin(), index_.end(), key, byStreamThenTimestamp);
+		if (it == index_.end() || it->stream() != key.stream()) {
+			return index_.size();
+		}
+		return static_cast<size_t>(it - index_.begin());
+	}
+
+	bool RawArchiveReader::record(uint64_t offset, RawArchiveRecord& record) const {
+		const size_t size = file_.size();
+		if (offset < alignment_ || offset + kRawArchiveRecordHeaderSize > size) {
+			return false;
+		}
+
+		const uint8_t* header = file_.data() + offset;
+		const uint32_t payloadBytes = RawArchiveGet<uint32_t>(header + 24);
+		if (payloadBytes > size - offset - kRawArchiveRecordHeaderSize) {
+			return false;
+		}
+
+		record.type = static_cast<RawArchiveRecordType>(header[0]);
+		record.kind = header[1];
+		record.channels = RawArchiveGet<uint16_t>(header + 2);
+		record.id = RawArchiveGet<uint32_t>(header + 4);
+		record.timestamp = RawArchiveGet<uint64_t>(header + 8);
+		record.width = RawArchiveGet<uint32_t>(header + 16);
+		record.height = RawArchiveGet<uint32_t>(header + 20);
+		record.arrivalMs = RawArchiveGet<uint32_t>(header + 28);
+		record.payload = header + kRawArchiveRecordHeaderSize;
+		record.payloadBytes = payloadBytes;
+		record.offset = offset;
+		return true;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,97 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_RAW_ARCHIVE_READER_H_
+#define FLUTTER_PLUGIN_MEDIA_RAW_ARCHIVE_READER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "media/mapped_file.h"
+#include "media/raw_archive_format.h"
+
+namespace flutter_zoom_sdk {
+
+	// One record, pointing into the mapped segment.
+	struct RawArchiveRecord {
+		RawArchiveRecordType type = RawArchiveRecordType::Video;
+		// AudioStreamKind for audio; 1 for limited-range video.
+		uint8_t kind = 0;
+		uint16_t channels = 0;
+		uint32_t id = 0;
+		uint64_t timestamp = 0;
+		// Sample rate and interleaved sample count for audio.
+		uint32_t width = 0;
+		uint32_t height = 0;
+		// Since the segment was created.
+		uint32_t arrivalMs = 0;
+		const uint8_t* payload = nullptr;
+		uint32_t payloadBytes = 0;
+		uint64_t offset = 0;
+	};
+
+	struct RawArchiveStreamInfo {
+		RawArchiveRecordType type = RawArchiveRecordType::Video;
+		uint8_t kind = 0;
+		uint32_t id = 0;
+		size_t records = 0;
+		uint64_t firstTimestamp = 0;
+		uint64_t lastTimestamp = 0;
+	};
+
+	// Reads one archive segment through a memory mapping. A closed segment's
+	// index is loaded as written; one cut short by a crash is indexed by
+	// scanning its chunks up to the first that is torn or fails its CRC.
+	class RawArchiveReader {
+	public:
+		RawArchiveReader();
+
+		RawArchiveReader(const RawArchiveReader&) = delete;
+		RawArchiveReader& operator=(const RawArchiveReader&) = delete;
+
+		// path is UTF-8.
+		bool open(const std::string& path);
+
+		void close();
+
+		bool isOpen() const { return file_.isOpen(); }
+
+		uint32_t sequence() const { return sequence_; }
+
+		uint64_t createdUnixMs() const { return createdUnixMs_; }
+
+		// The index was rebuilt by scanning.
+		bool recovered() const { return recovered_; }
+
+		const std::vector<RawArchiveStreamInfo>& streams() const { return streams_; }
+
+		// Sorted by stream, then timestamp.
+		const std::vector<RawArchiveIndexEntry>& index() const { return index_; }
+
+		// Record offsets in the order they were archived.
+		const std::vector<uint64_t>& timeline() const { return timeline_; }
+
+		// Position in index() of the stream's first record at or after
+		// timestamp; index().size() when there is none. O(log n).
+		size_t seek(RawArchiveRecordType type, uint8_t kind, uint32_t id, uint64_t timestamp) const;
+
+		// Fails for an offset that does not hold a whole record.
+		bool record(uint64_t offset, RawArchiveRecord& record) const;
+
+	private:
+		bool loadIndex();
+
+		void scanChunks();
+
+		MappedFile file_;
+		uint32_t sequence_;
+		uint64_t createdUnixMs_;
+		size_t alignment_;
+		bool recovered_;
+		std::vector<RawArchiveIndexEntry> index_;
+		std::vector<uint64_t> timeline_;
+		std::vector<RawArchiveStreamInfo> streams_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_RAW_ARCHIVE_READER_H_
@@ -0,0 +1,242 @@
+#include "media/raw_archive_replayer.h"
+
+#include <zoom_sdk_raw_data_def.h>
+
+#include <algorithm>
+#include <thread>
+#include <unordered_set>
+
+#include "media/audio_stream.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		using Clock = std::chrono::steady_clock;
+		// Longer silences between records, or a damaged arrival, replay as this.
+		constexpr uint64_t kMaxPacingGapMs = 5000;
+
+		uint64_t streamKey(RawArchiveRecordType type, uint32_t id) {
+			RawArchiveIndexEntry entry;
+			entry.type = type;
+			entry.id = id;
+			return entry.stream();
+		}
+
+		// Archived I420, valid until the next record.
+		class ReplayVideoFrame : public YUVRawDataI420 {
+		public:
+			explicit ReplayVideoFrame(const RawArchiveRecord& record) : record_(record) {}
+
+			bool CanAddRef() override { return false; }
+			bool AddRef() override { return false; }
+			int Release() override { return 0; }
+			char* GetYBuffer() override { return plane(0); }
+			char* GetUBuffer() override { return plane(lumaBytes()); }
+			char* GetVBuffer() override { return plane(lumaBytes() + chromaBytes()); }
+			char* GetAlphaBuffer() override { return nullptr; }
+			char* GetBuffer() override { return plane(0); }
+			unsigned int GetBufferLen() override { return record_.payloadBytes; }
+			unsigned int GetAlphaBufferLen() override { return 0; }
+			bool IsLimitedI420() override { return record_.kind != 0; }
+			unsigned int GetStreamWidth() override { return record_.width; }
+			unsigned int GetStreamHeight() override { return record_.height; }
+			unsigned int GetRotation() override { return 0; }
+			unsigned int GetSourceID() override { return record_.id; }
+			unsigned long long GetTimeStamp() override { return record_.timestamp; }
+
+			bool valid() const {
+				return record_.width > 0 && record_.height > 0 && lumaBytes() + 2 * chromaBytes() <= record_.payloadBytes;
+			}
+
+		private:
+			size_t lumaBytes() const { return static_cast<size_t>(record_.width) * record_.height; }
+
+			size_t chromaBytes() const { return static_cast<size_t>((record_.width + 1) / 2) * ((record_.height + 1) / 2); }
+
+			// The SDK interface is not const-correct; delegates only read.
+			char* plane(size_t offset) const { return reinterpret_cast<char*>(const_cast<uint8_t*>(record_.payload + offset)); }
+
+			const RawArchiveRecord& record_;
+		};
+
+		class ReplayAudioFrame : public AudioRawData {
+		public:
+			explicit ReplayAudioFrame(const RawArchiveRecord& record) : record_(record) {}
+
+			bool CanAddRef() override { return false; }
+			bool AddRef() override { return false; }
+			int Release() override { return 0; }
+			char* GetBuffer() override { return reinterpret_cast<char*>(const_cast<uint8_t*>(record_.payload)); }
+			unsigned int GetBufferLen() override { return std::min<unsigned int>(record_.payloadBytes, record_.height * sizeof(int16_t)); }
+			unsigned int GetSampleRate() override { return record_.width; }
+			unsigned int GetChannelNum() override { return record_.channels; }
+			unsigned long long GetTimeStamp() override { return record_.timestamp; }
+
+		private:
+			const RawArchiveRecord& record_;
+		};
+	}
+
+	RawArchiveReplayer::RawArchiveReplayer() : audio_(nullptr), cancelled_(false) {}
+
+	bool RawArchiveReplayer::open(const std::vector<std::string>& paths) {
+		segments_.clear();
+		for (const std::string& path : paths) {
+			auto reader = std::make_unique<RawArchiveReader>();
+			if (!reader->open(path)) {
+				segments_.clear();
+				return false;
+			}
+			segments_.push_back(std::move(reader));
+		}
+
+		std::stable_sort(segments_.begin(), segments_.end(), [](const auto& a, const auto& b) {
+			return a->createdUnixMs() != b->createdUnixMs() ? a->createdUnixMs() < b->createdUnixMs() : a->sequence() < b->sequence();
+		});
+		return true;
+	}
+
+	std::vector<RawArchiveStreamInfo> RawArchiveReplayer::streams() const {
+		std::vector<RawArchiveStreamInfo> streams;
+		for (const auto& segment : segments_) {
+			for (const RawArchiveStreamInfo& info : segment->streams()) {
+				auto it = std::find_if(streams.begin(), streams.end(), [&info](const RawArchiveStreamInfo& other) {
+					return other.type == info.type && other.kind == info.kind && other.id == info.id;
+				});
+				if (it == streams.end()) {
+					streams.push_back(info);
+					continue;
+				}
+				it->records += info.records;
+				it->firstTimestamp = std::min(it->firstTimestamp, info.firstTimestamp);
+				it->lastTimestamp = std::max(it->lastTimestamp, info.lastTimestamp);
+			}
+		}
+		return streams;
+	}
+
+	void RawArchiveReplayer::setVideoDelegate(RawArchiveRecordType type, uint32_t id, ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate* delegate) {
+		if (delegate) {
+			video_[streamKey(type, id)] = delegate;
+		}
+		else {
+			video_.erase(streamKey(type, id));
+		}
+	}
+
+	void RawArchiveReplayer::setAudioDelegate(ZOOM_SDK_NAMESPACE::IZoomSDKAudioRawDataDelegate* delegate) {
+		audio_ = delegate;
+	}
+
+	void RawArchiveReplayer::cancel() {
+		cancelled_.store(true, std::memory_order_relaxed);
+	}
+
+	RawArchiveReplayStats RawArchiveReplayer::run(const RawArchiveReplayOptions& options) {
+		RawArchiveReplayStats stats;
+		cancelled_.store(false, std::memory_order_relaxed);
+
+		const Clock::time_point start = Clock::now();
+		bool haveLast = false;
+		uint64_t lastMs = 0;
+		uint64_t pacedMs = 0;
+		std::unordered_set<uint64_t> started;
+
+		for (const auto& segment : segments_) {
+			// Each stream's first record at or after fromTimestamp; the earliest
+			// of those in the file is where this segment starts.
+			uint64_t firstOffset = UINT64_MAX;
+			if (options.fromTimestamp == 0) {
+				firstOffset = 0;
+			}
+			else {
+				for (const RawArchiveStreamInfo& info : segment->streams()) {
+					const size_t position = segment->seek(info.type, info.kind, info.id, options.fromTimestamp);
+					if (position < segment->index().size()) {
+						firstOffset = std::min(firstOffset, segment->index()[position].offset);
+					}
+				}
+			}
+
+			const std::vector<uint64_t>& timeline = segment->timeline();
+			auto it = std::lower_bound(timeline.begin(), timeline.end(), firstOffset);
+			for (; it != timeline.end(); ++it) {
+				if (cancelled_.load(std::memory_order_relaxed)) {
+					break;
+				}
+
+				RawArchiveRecord record;
+				if (!segment->record(*it, record) || record.timestamp < options.fromTimestamp) {
+					continue;
+				}
+
+				if (options.speed > 0.0) {
+					const uint64_t archivedMs = segment->createdUnixMs() + record.arrivalMs;
+					if (haveLast && archivedMs > lastMs) {
+						pacedMs += std::min(archivedMs - lastMs, kMaxPacingGapMs);
+					}
+					lastMs = haveLast ? std::max(lastMs, archivedMs) : archivedMs;
+					haveLast = true;
+					const auto due = start + std::chrono::duration_cast<Clock::duration>(
+						std::chrono::duration<double, std::milli>(pacedMs / options.speed));
+					const Clock::time_point now = Clock::now();
+					if (due > now) {
+						std::this_thread::sleep_until(due);
+					}
+					else {
+						stats.maxLate = std::max(stats.maxLate, std::chrono::duration_cast<std::chrono::microseconds>(now - due));
+					}
+				}
+
+				if (record.type == RawArchiveRecordType::Audio) {
+					ReplayAudioFrame frame(record);
+					const auto kind = static_cast<AudioStreamKind>(record.kind);
+					if (!audio_ || record.width == 0 || record.channels == 0) {
+						stats.skippedRecords++;
+						continue;
+					}
+					if (kind == AudioStreamKind::Mixed) {
+						audio_->onMixedAudioRawDataReceived(&frame);
+					}
+					else if (kind == AudioStreamKind::OneWay) {
+						audio_->onOneWayAudioRawDataReceived(&frame, record.id);
+					}
+					else if (kind == AudioStreamKind::Share) {
+						audio_->onShareAudioRawDataReceived(&frame, record.id);
+					}
+					else {
+						stats.skippedRecords++;
+						continue;
+					}
+					stats.audioFrames++;
+				}
+				else {
+					ReplayVideoFrame frame(record);
+					const uint64_t key = streamKey(record.type, record.id);
+					auto delegate = video_.find(key);
+					if (delegate == video_.end() || !frame.valid()) {
+						stats.skippedRecords++;
+						continue;
+					}
+					if (started.insert(key).second) {
+						delegate->second->onRawDataStatusChanged(ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate::RawData_On);
+					}
+					delegate->second->onRawDataFrameReceived(&frame);
+					stats.videoFrames++;
+				}
+				stats.payloadBytes += record.payloadBytes;
+			}
+		}
+
+		for (uint64_t key : started) {
+			auto delegate = video_.find(key);
+			if (delegate != video_.end()) {
+				delegate->second->onRawDataStatusChanged(ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate::RawData_Off);
+			}
+		}
+
+		stats.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+		return stats;
+	}
+
+}  // namespace flutter_zoom_sdk
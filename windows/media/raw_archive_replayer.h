@@ -0,0 +1,78 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_RAW_ARCHIVE_REPLAYER_H_
+#define FLUTTER_PLUGIN_MEDIA_RAW_ARCHIVE_REPLAYER_H_
+
+#include <rawdata/rawdata_audio_helper_interface.h>
+#include <rawdata/rawdata_renderer_interface.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "media/raw_archive_reader.h"
+
+namespace flutter_zoom_sdk {
+
+	struct RawArchiveReplayOptions {
+		// 1 replays at the pace the records were archived, 2 twice as fast;
+		// 0 as fast as the delegates take them.
+		double speed = 1.0;
+		// SDK timestamp to start from; each stream starts at its first record
+		// at or after it.
+		uint64_t fromTimestamp = 0;
+	};
+
+	struct RawArchiveReplayStats {
+		uint64_t videoFrames = 0;
+		uint64_t audioFrames = 0;
+		// No delegate, or a stream the SDK delegates cannot carry.
+		uint64_t skippedRecords = 0;
+		uint64_t payloadBytes = 0;
+		// Longest a record was handed over after it was due, at speeds above 0.
+		std::chrono::microseconds maxLate{ 0 };
+		std::chrono::microseconds elapsed{ 0 };
+	};
+
+	// Feeds archived segments back through the SDK's raw data delegate
+	// interfaces, in the order they were archived, so every downstream stage
+	// can be run and measured offline. Frames point straight into the
+	// mapped segments. Interpreter audio and plugin mixes are skipped: the
+	// archive keeps neither language names nor anything the SDK delivers
+	// for mixes.
+	class RawArchiveReplayer {
+	public:
+		RawArchiveReplayer();
+
+		RawArchiveReplayer(const RawArchiveReplayer&) = delete;
+		RawArchiveReplayer& operator=(const RawArchiveReplayer&) = delete;
+
+		// Segments play in sequence order. Fails if any cannot be read.
+		bool open(const std::vector<std::string>& paths);
+
+		// Across all segments.
+		std::vector<RawArchiveStreamInfo> streams() const;
+
+		// type is Video or Share. The delegate must outlive run().
+		void setVideoDelegate(RawArchiveRecordType type, uint32_t id, ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate* delegate);
+
+		void setAudioDelegate(ZOOM_SDK_NAMESPACE::IZoomSDKAudioRawDataDelegate* delegate);
+
+		// Replays on the calling thread until the end or cancel().
+		RawArchiveReplayStats run(const RawArchiveReplayOptions& options);
+
+		// From any thread.
+		void cancel();
+
+	private:
+		std::vector<std::unique_ptr<RawArchiveReader>> segments_;
+		std::unordered_map<uint64_t, ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate*> video_;
+		ZOOM_SDK_NAMESPACE::IZoomSDKAudioRawDataDelegate* audio_;
+		std::atomic<bool> cancelled_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_RAW_ARCHIVE_REPLAYER_H_
@@ -0,0 +1,437 @@
+#include "media/raw_archiver.h"
+
+#include <zoom_sdk_raw_data_def.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr auto kMinSegmentDuration = std::chrono::seconds(5);
+		constexpr auto kMaxSegmentDuration = std::chrono::seconds(3600);
+		constexpr size_t kMinChunkBytes = 64 * 1024;
+		constexpr size_t kMaxChunkBytes = 64 << 20;
+		constexpr auto kMinFlushInterval = std::chrono::milliseconds(100);
+		constexpr auto kMaxFlushInterval = std::chrono::milliseconds(10000);
+		constexpr size_t kMinQueuedBytes = 4 << 20;
+
+		// 720p I420 and 20 ms of 48 kHz stereo, with headers.
+		constexpr size_t kVideoRecordBytes = kRawArchiveRecordHeaderSize + 1280 * 720 * 3 / 2;
+		constexpr size_t kAudioRecordBytes = kRawArchiveRecordHeaderSize + 960 * 2 * sizeof(int16_t);
+		constexpr size_t kIdleVideoRecords = 16;
+		constexpr size_t kIdleAudioRecords = 64;
+
+		uint32_t steadyMs(std::chrono::steady_clock::time_point time) {
+			return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count());
+		}
+
+		uint64_t unixMs() {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+				std::chrono::system_clock::now().time_since_epoch()).count());
+		}
+
+		void copyPlane(uint8_t* dst, const char* src, size_t bytes) {
+			if (src) {
+				std::memcpy(dst, src, bytes);
+			}
+			else {
+				std::memset(dst, 0, bytes);
+			}
+		}
+	}
+
+	RawArchiveConfig RawArchiveConfig::normalized() const {
+		RawArchiveConfig config = *this;
+		config.segmentDuration = std::clamp(segmentDuration, kMinSegmentDuration, kMaxSegmentDuration);
+		config.chunkBytes = std::clamp(chunkBytes, kMinChunkBytes, kMaxChunkBytes);
+		config.flushInterval = std::clamp(flushInterval, kMinFlushInterval, kMaxFlushInterval);
+		config.maxQueuedBytes = std::max(maxQueuedBytes, std::max(kMinQueuedBytes, config.chunkBytes * 2));
+		return config;
+	}
+
+	void RawArchiver::AudioSink::onAudioFrame(const AudioStreamKey& key, const AudioFrame& frame) {
+		const size_t payloadBytes = frame.sampleCount * sizeof(int16_t);
+		PooledBuffer record = archiver_.acquireRecord(archiver_.audioPool_, payloadBytes);
+		if (!record) {
+			return;
+		}
+
+		uint8_t* header = record->data();
+		header[0] = static_cast<uint8_t>(RawArchiveRecordType::Audio);
+		header[1] = static_cast<uint8_t>(key.kind);
+		RawArchivePut<uint16_t>(header + 2, static_cast<uint16_t>(frame.channels));
+		RawArchivePut<uint32_t>(header + 4, key.id);
+		RawArchivePut<uint64_t>(header + 8, frame.timestamp);
+		RawArchivePut<uint32_t>(header + 16, frame.sampleRate);
+		RawArchivePut<uint32_t>(header + 20, static_cast<uint32_t>(frame.sampleCount));
+		std::memcpy(header + kRawArchiveRecordHeaderSize, frame.samples, payloadBytes);
+		archiver_.enqueue(std::move(record));
+	}
+
+	RawArchiver::VideoTap::VideoTap(RawArchiver& archiver, uint32_t id, RawArchiveRecordType type)
+		: archiver_(archiver),
+		id_(id),
+		type_(type),
+		destroyed_(false) {}
+
+	void RawArchiver::VideoTap::onRendererBeDestroyed() {
+		destroyed_.store(true, std::memory_order_release);
+	}
+
+	void RawArchiver::VideoTap::onRawDataFrameReceived(YUVRawDataI420* data) {
+		if (!data) {
+			return;
+		}
+
+		const size_t width = data->GetStreamWidth();
+		const size_t height = data->GetStreamHeight();
+		if (width == 0 || height == 0) {
+			return;
+		}
+
+		const size_t lumaBytes = width * height;
+		const size_t chromaBytes = ((width + 1) / 2) * ((height + 1) / 2);
+		PooledBuffer record = archiver_.acquireRecord(archiver_.videoPool_, lumaBytes + 2 * chromaBytes);
+		if (!record) {
+			return;
+		}
+
+		uint8_t* header = record->data();
+		header[0] = static_cast<uint8_t>(type_);
+		header[1] = data->IsLimitedI420() ? 1 : 0;
+		RawArchivePut<uint32_t>(header + 4, id_);
+		RawArchivePut<uint64_t>(header + 8, data->GetTimeStamp());
+		RawArchivePut<uint32_t>(header + 16, static_cast<uint32_t>(width));
+		RawArchivePut<uint32_t>(header + 20, static_cast<uint32_t>(height));
+
+		uint8_t* payload = header + kRawArchiveRecordHeaderSize;
+		copyPlane(payload, data->GetYBuffer(), lumaBytes);
+		copyPlane(payload + lumaBytes, data->GetUBuffer(), chromaBytes);
+		copyPlane(payload + lumaBytes + chromaBytes, data->GetVBuffer(), chromaBytes);
+		archiver_.enqueue(std::move(record));
+	}
+
+	RawArchiver::RawArchiver(AudioRawDataHub& hub)
+		: hub_(hub),
+		audioSink_(std::make_shared<AudioSink>(*this)),
+		videoPool_(BufferPool::create(kVideoRecordBytes, kIdleVideoRecords)),
+		audioPool_(BufferPool::create(kAudioRecordBytes, kIdleAudioRecords)),
+		archiving_(false),
+		queuedBytes_(0),
+		droppedRecords_(0),
+		maxQueuedBytes_(0),
+		sessionUnixMs_(0),
+		sequence_(0),
+		closedRecords_(0),
+		closedChunks_(0),
+		closedBytes_(0) {}
+
+	RawArchiver::~RawArchiver() {
+		stop();
+	}
+
+	bool RawArchiver::start(const std::string& directory, const RawArchiveConfig& config, const std::vector<AudioStreamKey>& audioStreams) {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (archiving_.load() || writer_.joinable()) {
+				return false;
+			}
+
+			std::error_code error;
+			if (!std::filesystem::is_directory(std::filesystem::u8path(directory), error)) {
+				return false;
+			}
+
+			config_ = config.normalized();
+			directory_ = directory;
+			audioStreams_ = audioStreams;
+			queue_.clear();
+			stats_ = RawArchiveStats();
+			queuedBytes_ = 0;
+			droppedRecords_ = 0;
+			maxQueuedBytes_ = config_.maxQueuedBytes;
+			sessionUnixMs_ = unixMs();
+			sequence_ = 0;
+			closedRecords_ = 0;
+			closedChunks_ = 0;
+			closedBytes_ = 0;
+			sessionSegments_.clear();
+			archiving_.store(true, std::memory_order_release);
+			writer_ = std::thread(&RawArchiver::run, this);
+		}
+
+		for (const auto& key : audioStreams) {
+			hub_.addConsumer(key, audioSink_);
+		}
+		return true;
+	}
+
+	std::vector<std::string> RawArchiver::stop() {
+		std::vector<AudioStreamKey> streams;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!archiving_.load()) {
+				return {};
+			}
+			streams.swap(audioStreams_);
+			archiving_.store(false, std::memory_order_release);
+		}
+
+		for (const auto& key : streams) {
+			hub_.removeConsumer(key, audioSink_);
+		}
+
+		wake_.notify_all();
+		writer_.join();
+
+		std::vector<std::string> paths;
+		for (const auto& path : sessionSegments_) {
+			std::error_code error;
+			if (std::filesystem::exists(std::filesystem::u8path(path), error)) {
+				paths.push_back(path);
+			}
+		}
+		return paths;
+	}
+
+	bool RawArchiver::isArchiving() {
+		return archiving_.load(std::memory_order_acquire);
+	}
+
+	ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate* RawArchiver::addVideo(uint32_t id, RawArchiveRecordType type) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (!archiving_.load() || type == RawArchiveRecordType::Audio) {
+			return nullptr;
+		}
+
+		auto& tap = taps_[id];
+		if (tap) {
+			return nullptr;
+		}
+
+		tap = std::make_unique<VideoTap>(*this, id, type);
+		return tap.get();
+	}
+
+	bool RawArchiver::removeVideo(uint32_t id) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return taps_.erase(id) > 0;
+	}
+
+	bool RawArchiver::rendererDestroyed(uint32_t id) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto it = taps_.find(id);
+		return it != taps_.end() && it->second->destroyed();
+	}
+
+	std::vector<uint32_t> RawArchiver::videoIds() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		std::vector<uint32_t> ids;
+		ids.reserve(taps_.size());
+		for (const auto& entry : taps_) {
+			ids.push_back(entry.first);
+		}
+		return ids;
+	}
+
+	RawArchiveStats RawArchiver::stats() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		RawArchiveStats stats = stats_;
+		stats.archiving = archiving_.load();
+		stats.queuedBytes = queuedBytes_.load();
+		stats.droppedRecords = droppedRecords_.load();
+		return stats;
+	}
+
+	PooledBuffer RawArchiver::acquireRecord(const std::shared_ptr<BufferPool>& pool, size_t payloadBytes) {
+		if (!archiving_.load(std::memory_order_acquire)) {
+			return nullptr;
+		}
+
+		const size_t size = RawArchiveRecordSize(payloadBytes);
+		if (queuedBytes_.load(std::memory_order_relaxed) + size > maxQueuedBytes_.load(std::memory_order_relaxed)) {
+			droppedRecords_.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		PooledBuffer record = pool->acquire();
+		record->resize(size);
+		uint8_t* header = record->data();
+		std::memset(header, 0, kRawArchiveRecordHeaderSize);
+		RawArchivePut<uint32_t>(header + 24, static_cast<uint32_t>(payloadBytes));
+		RawArchivePut<uint32_t>(header + 28, steadyMs(std::chrono::steady_clock::now()));
+		// Padding after the payload.
+		std::memset(header + kRawArchiveRecordHeaderSize + payloadBytes, 0, size - kRawArchiveRecordHeaderSize - payloadBytes);
+		return record;
+	}
+
+	void RawArchiver::enqueue(PooledBuffer record) {
+		const size_t size = record->size();
+		bool wake = false;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			const size_t before = queuedBytes_.fetch_add(size, std::memory_order_relaxed);
+			// Wake the writer once per chunk's worth, not per frame.
+			wake = before < config_.chunkBytes && before + size >= config_.chunkBytes;
+			queue_.push_back(std::move(record));
+		}
+		if (wake) {
+			wake_.notify_one();
+		}
+	}
+
+	bool RawArchiver::openSegment() {
+		char name[48];
+		std::snprintf(name, sizeof(name), "archive-%013llu-%06u", static_cast<unsigned long long>(sessionUnixMs_), sequence_ + 1);
+		const std::string path = (std::filesystem::u8path(directory_) / (std::string(name) + kRawArchiveExtension)).u8string();
+		if (!segment_.open(path, sequence_ + 1, unixMs(), config_.chunkBytes)) {
+			return false;
+		}
+
+		sequence_++;
+		segmentStart_ = std::chrono::steady_clock::now();
+		sessionSegments_.push_back(path);
+		return true;
+	}
+
+	void RawArchiver::closeSegment() {
+		if (!segment_.isOpen()) {
+			return;
+		}
+
+		closedRecords_ += segment_.records();
+		closedChunks_ += segment_.chunks();
+		const bool closed = segment_.close();
+		closedBytes_ += segment_.bytes();
+		if (!closed) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			stats_.writeErrors++;
+		}
+	}
+
+	void RawArchiver::applyRetention() {
+		if (config_.maxBytes == 0 && config_.maxSegments == 0) {
+			return;
+		}
+
+		struct Segment {
+			std::filesystem::path path;
+			uint64_t size;
+		};
+
+		std::vector<Segment> segments;
+		uint64_t total = 0;
+		std::error_code error;
+		for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::u8path(directory_), error)) {
+			if (entry.path().extension() != kRawArchiveExtension || !entry.is_regular_file(error)) {
+				continue;
+			}
+			const uint64_t size = entry.file_size(error);
+			segments.push_back({ entry.path(), error ? 0 : size });
+			total += segments.back().size;
+		}
+		// Names sort oldest first.
+		std::sort(segments.begin(), segments.end(), [](const Segment& a, const Segment& b) {
+			return a.path.filename() < b.path.filename();
+		});
+
+		const std::filesystem::path current = std::filesystem::u8path(segment_.path());
+		uint32_t deleted = 0;
+		size_t count = segments.size();
+		for (const Segment& segment : segments) {
+			const bool overBytes = config_.maxBytes > 0 && total > config_.maxBytes;
+			const bool overCount = config_.maxSegments > 0 && count > config_.maxSegments;
+			if (!overBytes && !overCount) {
+				break;
+			}
+			if (segment.path.filename() == current.filename() || !std::filesystem::remove(segment.path, error)) {
+				continue;
+			}
+			total -= segment.size;
+			count--;
+			deleted++;
+		}
+
+		if (deleted > 0) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			stats_.deletedSegments += deleted;
+		}
+	}
+
+	void RawArchiver::run() {
+		std::unique_lock<std::mutex> lock(mutex_);
+		const RawArchiveConfig config = config_;
+		lock.unlock();
+
+		bool opened = openSegment();
+		applyRetention();
+		auto nextFlush = std::chrono::steady_clock::now() + config.flushInterval;
+
+		lock.lock();
+		while (true) {
+			wake_.wait_until(lock, nextFlush, [this, &config] {
+				return !archiving_.load() || queuedBytes_.load() >= config.chunkBytes;
+			});
+			const bool stopping = !archiving_.load();
+			std::deque<PooledBuffer> records;
+			records.swap(queue_);
+			lock.unlock();
+
+			uint32_t errors = 0;
+			for (PooledBuffer& record : records) {
+				queuedBytes_.fetch_sub(record->size(), std::memory_order_relaxed);
+				if (!opened) {
+					droppedRecords_.fetch_add(1, std::memory_order_relaxed);
+					continue;
+				}
+
+				// Arrival becomes relative to the segment; records queued before a
+				// roll land at its start rather than wrapping around.
+				uint8_t* arrival = record->data() + 28;
+				const auto relative = static_cast<int32_t>(RawArchiveGet<uint32_t>(arrival) - steadyMs(segmentStart_));
+				RawArchivePut<uint32_t>(arrival, static_cast<uint32_t>(std::max<int32_t>(relative, 0)));
+				if (!segment_.append(record->data(), record->size())) {
+					errors++;
+				}
+			}
+			records.clear();
+
+			const auto now = std::chrono::steady_clock::now();
+			if (now >= nextFlush || stopping) {
+				if (opened && !segment_.flush()) {
+					errors++;
+				}
+				nextFlush = now + config.flushInterval;
+			}
+
+			if (!stopping && (!opened || now - segmentStart_ >= config.segmentDuration)) {
+				closeSegment();
+				opened = openSegment();
+				applyRetention();
+			}
+
+			lock.lock();
+			stats_.writeErrors += errors;
+			stats_.segments = sequence_;
+			stats_.segmentPath = opened ? segment_.path() : std::string();
+			stats_.records = closedRecords_ + segment_.records();
+			stats_.chunks = closedChunks_ + segment_.chunks();
+			stats_.bytesWritten = closedBytes_ + (opened ? segment_.bytes() : 0);
+			if (stopping) {
+				break;
+			}
+		}
+		lock.unlock();
+
+		closeSegment();
+
+		lock.lock();
+		stats_.records = closedRecords_;
+		stats_.chunks = closedChunks_;
+		stats_.bytesWritten = closedBytes_;
+		stats_.segmentPath.clear();
+	}
+
+}  // namespace flutter_zoom_sdk
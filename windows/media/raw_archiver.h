@@ -0,0 +1,171 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_RAW_ARCHIVER_H_
+#define FLUTTER_PLUGIN_MEDIA_RAW_ARCHIVER_H_
+
+#include <rawdata/rawdata_renderer_interface.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "media/audio_raw_data_hub.h"
+#include "media/audio_stream.h"
+#include "media/buffer_pool.h"
+#include "media/raw_archive_format.h"
+#include "media/raw_segment_writer.h"
+
+namespace flutter_zoom_sdk {
+
+	struct RawArchiveConfig {
+		std::chrono::seconds segmentDuration{ 60 };
+		// Records are written out in chunks of about this size, or every
+		// flushInterval, whichever comes first; each is synced to disk.
+		size_t chunkBytes = 1 << 20;
+		std::chrono::milliseconds flushInterval{ 1000 };
+		// Oldest segments in the directory are deleted past either limit;
+		// 0 leaves a limit out.
+		uint64_t maxBytes = 0;
+		uint32_t maxSegments = 0;
+		// Records are dropped while this much is waiting for the writer.
+		size_t maxQueuedBytes = 64 << 20;
+
+		// Clamps every field into its supported range.
+		RawArchiveConfig normalized() const;
+	};
+
+	struct RawArchiveStats {
+		bool archiving = false;
+		uint32_t segments = 0;
+		uint64_t records = 0;
+		uint64_t bytesWritten = 0;
+		uint64_t chunks = 0;
+		uint64_t droppedRecords = 0;
+		uint32_t deletedSegments = 0;
+		uint32_t writeErrors = 0;
+		size_t queuedBytes = 0;
+		std::string segmentPath;
+	};
+
+	// Archives raw video and audio into a directory of fixed-duration
+	// segments (see raw_archive_format.h). SDK threads copy each frame into a
+	// pooled record and queue it; a writer thread gathers records into
+	// chunks, writes and syncs them, rolls segments and applies retention.
+	class RawArchiver {
+	public:
+		explicit RawArchiver(AudioRawDataHub& hub);
+
+		~RawArchiver();
+
+		RawArchiver(const RawArchiver&) = delete;
+		RawArchiver& operator=(const RawArchiver&) = delete;
+
+		// directory is UTF-8 and must exist. Fails if already archiving.
+		bool start(const std::string& directory, const RawArchiveConfig& config, const std::vector<AudioStreamKey>& audioStreams);
+
+		// Closes the current segment and returns the paths of this session's
+		// segments still on disk. Remove video streams first.
+		std::vector<std::string> stop();
+
+		bool isArchiving();
+
+		// Delegate to create the renderer for id with, owned by the archiver
+		// until removeVideo(id). type is Video or Share. nullptr when not
+		// archiving or id is already added.
+		ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate* addVideo(uint32_t id, RawArchiveRecordType type);
+
+		// Destroy the renderer before removing its delegate.
+		bool removeVideo(uint32_t id);
+
+		// Whether the SDK destroyed the renderer for id on its own.
+		bool rendererDestroyed(uint32_t id);
+
+		std::vector<uint32_t> videoIds();
+
+		RawArchiveStats stats();
+
+	private:
+		class AudioSink : public IAudioStreamConsumer {
+		public:
+			explicit AudioSink(RawArchiver& archiver) : archiver_(archiver) {}
+
+			void onAudioFrame(const AudioStreamKey& key, const AudioFrame& frame) override;
+
+		private:
+			RawArchiver& archiver_;
+		};
+
+		class VideoTap : public ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate {
+		public:
+			VideoTap(RawArchiver& archiver, uint32_t id, RawArchiveRecordType type);
+
+			void onRendererBeDestroyed() override;
+			void onRawDataFrameReceived(YUVRawDataI420* data) override;
+			void onRawDataStatusChanged(RawDataStatus status) override {}
+
+			bool destroyed() const { return destroyed_.load(std::memory_order_acquire); }
+
+		private:
+			RawArchiver& archiver_;
+			const uint32_t id_;
+			const RawArchiveRecordType type_;
+			std::atomic<bool> destroyed_;
+		};
+
+		// A pooled record with its header filled in, or nullptr when the
+		// queue is full.
+		PooledBuffer acquireRecord(const std::shared_ptr<BufferPool>& pool, size_t payloadBytes);
+
+		void enqueue(PooledBuffer record);
+
+		void run();
+
+		bool openSegment();
+
+		void closeSegment();
+
+		// Deletes the oldest segments in the directory past the limits, never
+		// the open one.
+		void applyRetention();
+
+		AudioRawDataHub& hub_;
+		std::shared_ptr<AudioSink> audioSink_;
+		std::shared_ptr<BufferPool> videoPool_;
+		std::shared_ptr<BufferPool> audioPool_;
+		std::atomic<bool> archiving_;
+		std::atomic<size_t> queuedBytes_;
+		std::atomic<uint64_t> droppedRecords_;
+		std::atomic<size_t> maxQueuedBytes_;
+
+		std::mutex mutex_;
+		std::condition_variable wake_;
+		std::deque<PooledBuffer> queue_;
+		RawArchiveConfig config_;
+		std::string directory_;
+		std::vector<AudioStreamKey> audioStreams_;
+		std::unordered_map<uint32_t, std::unique_ptr<VideoTap>> taps_;
+		RawArchiveStats stats_;
+
+		// Writer-thread owned.
+		RawSegmentWriter segment_;
+		std::chrono::steady_clock::time_point segmentStart_;
+		uint64_t sessionUnixMs_;
+		uint32_t sequence_;
+		uint64_t closedRecords_;
+		uint64_t closedChunks_;
+		uint64_t closedBytes_;
+		std::vector<std::string> sessionSegments_;
+
+		std::thread writer_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_RAW_ARCHIVER_H_
@@ -0,0 +1,139 @@
+#include "media/raw_segment_writer.h"
+
+#include <algorithm>
+
+namespace flutter_zoom_sdk {
+
+	RawSegmentWriter::RawSegmentWriter()
+		: chunkBytes_(0),
+		chunkRecords_(0),
+		chunkMinTimestamp_(UINT64_MAX),
+		chunkMaxTimestamp_(0),
+		chunks_(0) {}
+
+	RawSegmentWriter::~RawSegmentWriter() {
+		close();
+	}
+
+	bool RawSegmentWriter::open(const std::string& path, uint32_t sequence, uint64_t createdUnixMs, size_t chunkBytes) {
+		close();
+		if (!file_.open(path)) {
+			return false;
+		}
+
+		path_ = path;
+		chunkBytes_ = chunkBytes;
+		chunk_.clear();
+		chunk_.reserve(kRawArchiveChunkHeaderSize + chunkBytes + kRawArchiveAlignment);
+		chunk_.resize(kRawArchiveChunkHeaderSize);
+		chunkRecords_ = 0;
+		chunkMinTimestamp_ = UINT64_MAX;
+		chunkMaxTimestamp_ = 0;
+		chunks_ = 0;
+		index_.clear();
+
+		// The header takes a whole block so every chunk starts aligned.
+		std::vector<uint8_t> header(kRawArchiveAlignment, 0);
+		std::memcpy(header.data(), kRawArchiveSegmentMagic, 4);
+		RawArchivePut<uint16_t>(header.data() + 4, kRawArchiveVersion);
+		RawArchivePut<uint16_t>(header.data() + 6, static_cast<uint16_t>(kRawArchiveHeaderSize));
+		RawArchivePut<uint32_t>(header.data() + 8, sequence);
+		RawArchivePut<uint32_t>(header.data() + 12, static_cast<uint32_t>(kRawArchiveAlignment));
+		RawArchivePut<uint64_t>(header.data() + 16, createdUnixMs);
+		if (!file_.write(header.data(), header.size()) || !file_.sync()) {
+			file_.close();
+			return false;
+		}
+		return true;
+	}
+
+	bool RawSegmentWriter::append(const uint8_t* record, size_t size) {
+		if (!file_.isOpen() || size < kRawArchiveRecordHeaderSize) {
+			return false;
+		}
+		if (chunkRecords_ > 0 && pendingBytes() + size > chunkBytes_ && !flush()) {
+			return false;
+		}
+
+		RawArchiveIndexEntry entry;
+		entry.type = static_cast<RawArchiveRecordType>(record[0]);
+		entry.kind = entry.type == RawArchiveRecordType::Audio ? record[1] : 0;
+		entry.id = RawArchiveGet<uint32_t>(record + 4);
+		entry.timestamp = RawArchiveGet<uint64_t>(record + 8);
+		// Chunks are written whole, so the pending one starts at the file's end.
+		entry.offset = file_.size() + chunk_.size();
+		index_.push_back(entry);
+
+		chunk_.insert(chunk_.end(), record, record + size);
+		chunkRecords_++;
+		chunkMinTimestamp_ = std::min(chunkMinTimestamp_, entry.timestamp);
+		chunkMaxTimestamp_ = std::max(chunkMaxTimestamp_, entry.timestamp);
+		return true;
+	}
+
+	bool RawSegmentWriter::flush() {
+		if (!file_.isOpen()) {
+			return false;
+		}
+		if (chunkRecords_ == 0) {
+			return true;
+		}
+
+		const size_t recordBytes = pendingBytes();
+		uint8_t* header = chunk_.data();
+		std::memcpy(header, kRawArchiveChunkMagic, 4);
+		RawArchivePut<uint32_t>(header + 4, static_cast<uint32_t>(recordBytes));
+		RawArchivePut<uint32_t>(header + 8, chunkRecords_);
+		RawArchivePut<uint32_t>(header + 12, RawArchiveCrc32(header + kRawArchiveChunkHeaderSize, recordBytes));
+		RawArchivePut<uint64_t>(header + 16, chunkMinTimestamp_);
+		RawArchivePut<uint64_t>(header + 24, chunkMaxTimestamp_);
+		chunk_.resize(RawArchiveAlign(chunk_.size(), kRawArchiveAlignment), 0);
+
+		const bool written = file_.write(chunk_.data(), chunk_.size()) && file_.sync();
+		chunk_.resize(kRawArchiveChunkHeaderSize);
+		chunkRecords_ = 0;
+		chunkMinTimestamp_ = UINT64_MAX;
+		chunkMaxTimestamp_ = 0;
+		chunks_++;
+		return written;
+	}
+
+	bool RawSegmentWriter::close() {
+		if (!file_.isOpen()) {
+			return true;
+		}
+
+		bool ok = flush();
+
+		std::stable_sort(index_.begin(), index_.end(), [](const RawArchiveIndexEntry& a, const RawArchiveIndexEntry& b) {
+			return a.stream() != b.stream() ? a.stream() < b.stream() : a.timestamp < b.timestamp;
+		});
+
+		const uint64_t indexOffset = file_.size();
+		const size_t entryBytes = index_.size() * kRawArchiveIndexEntrySize;
+		std::vector<uint8_t> block(RawArchiveAlign(kRawArchiveIndexHeaderSize + entryBytes + kRawArchiveFooterSize, kRawArchiveAlignment), 0);
+		uint8_t* entry = block.data() + kRawArchiveIndexHeaderSize;
+		for (const RawArchiveIndexEntry& item : index_) {
+			entry[0] = static_cast<uint8_t>(item.type);
+			entry[1] = item.kind;
+			RawArchivePut<uint32_t>(entry + 4, item.id);
+			RawArchivePut<uint64_t>(entry + 8, item.timestamp);
+			RawArchivePut<uint64_t>(entry + 16, item.offset);
+			entry += kRawArchiveIndexEntrySize;
+		}
+		std::memcpy(block.data(), kRawArchiveIndexMagic, 4);
+		RawArchivePut<uint32_t>(block.data() + 4, static_cast<uint32_t>(index_.size()));
+		RawArchivePut<uint32_t>(block.data() + 8, RawArchiveCrc32(block.data() + kRawArchiveIndexHeaderSize, entryBytes));
+
+		uint8_t* footer = block.data() + block.size() - kRawArchiveFooterSize;
+		RawArchivePut<uint64_t>(footer, indexOffset);
+		RawArchivePut<uint32_t>(footer + 8, static_cast<uint32_t>(index_.size()));
+		std::memcpy(footer + 12, kRawArchiveFooterMagic, 4);
+
+		ok = file_.write(block.data(), block.size()) && file_.sync() && ok;
+		ok = file_.close() && ok;
+		index_.clear();
+		return ok;
+	}
+
+}  // namespace flutter_zoom_sdk
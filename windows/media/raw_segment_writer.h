@@ -0,0 +1,67 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_RAW_SEGMENT_WRITER_H_
+#define FLUTTER_PLUGIN_MEDIA_RAW_SEGMENT_WRITER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "media/durable_file.h"
+#include "media/raw_archive_format.h"
+
+namespace flutter_zoom_sdk {
+
+	// Writes one archive segment: records are gathered into an aligned chunk
+	// that goes to disk in a single write followed by a sync, and close()
+	// appends the index. Not thread-safe.
+	class RawSegmentWriter {
+	public:
+		RawSegmentWriter();
+
+		~RawSegmentWriter();
+
+		RawSegmentWriter(const RawSegmentWriter&) = delete;
+		RawSegmentWriter& operator=(const RawSegmentWriter&) = delete;
+
+		// path is UTF-8. chunkBytes is where a chunk is written out; a single
+		// larger record gets a chunk of its own.
+		bool open(const std::string& path, uint32_t sequence, uint64_t createdUnixMs, size_t chunkBytes);
+
+		// record is a whole record, header and padded payload.
+		bool append(const uint8_t* record, size_t size);
+
+		// Writes and syncs the pending chunk, if any.
+		bool flush();
+
+		// Flushes, then writes the index and footer.
+		bool close();
+
+		bool isOpen() const { return file_.isOpen(); }
+
+		const std::string& path() const { return path_; }
+
+		// On disk plus pending.
+		uint64_t bytes() const { return file_.size() + pendingBytes(); }
+
+		size_t pendingBytes() const { return chunk_.size() - kRawArchiveChunkHeaderSize; }
+
+		uint64_t records() const { return index_.size(); }
+
+		uint64_t chunks() const { return chunks_; }
+
+	private:
+		DurableFile file_;
+		std::string path_;
+		size_t chunkBytes_;
+		// Chunk header space, then records.
+		std::vector<uint8_t> chunk_;
+		uint32_t chunkRecords_;
+		uint64_t chunkMinTimestamp_;
+		uint64_t chunkMaxTimestamp_;
+		uint64_t chunks_;
+		std::vector<RawArchiveIndexEntry> index_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_RAW_SEGMENT_WRITER_H_
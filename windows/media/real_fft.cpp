@@ -0,0 +1,275 @@
+#include "media/real_fft.h"
+
+#include <cmath>
+#include <utility>
+
+#include "media/simd.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr double kPi = 3.14159265358979323846;
+		constexpr size_t kMinSize = 64;
+		constexpr size_t kMaxSize = 16384;
+
+#if defined(FLUTTER_ZOOM_SDK_SSE2) || defined(FLUTTER_ZOOM_SDK_NEON)
+#define FLUTTER_ZOOM_SDK_FFT_VECTOR 1
+		// Four-lane float helpers so the butterflies are written once.
+#if defined(FLUTTER_ZOOM_SDK_SSE2)
+		using Vec4 = __m128;
+		inline Vec4 load4(const float* p) { return _mm_loadu_ps(p); }
+		inline void store4(float* p, Vec4 v) { _mm_storeu_ps(p, v); }
+		inline Vec4 splat4(float v) { return _mm_set1_ps(v); }
+		inline Vec4 add4(Vec4 a, Vec4 b) { return _mm_add_ps(a, b); }
+		inline Vec4 sub4(Vec4 a, Vec4 b) { return _mm_sub_ps(a, b); }
+		inline Vec4 mul4(Vec4 a, Vec4 b) { return _mm_mul_ps(a, b); }
+		inline void transpose4(Vec4& r0, Vec4& r1, Vec4& r2, Vec4& r3) { _MM_TRANSPOSE4_PS(r0, r1, r2, r3); }
+#else
+		using Vec4 = float32x4_t;
+		inline Vec4 load4(const float* p) { return vld1q_f32(p); }
+		inline void store4(float* p, Vec4 v) { vst1q_f32(p, v); }
+		inline Vec4 splat4(float v) { return vdupq_n_f32(v); }
+		inline Vec4 add4(Vec4 a, Vec4 b) { return vaddq_f32(a, b); }
+		inline Vec4 sub4(Vec4 a, Vec4 b) { return vsubq_f32(a, b); }
+		inline Vec4 mul4(Vec4 a, Vec4 b) { return vmulq_f32(a, b); }
+		inline void transpose4(Vec4& r0, Vec4& r1, Vec4& r2, Vec4& r3) {
+			const float32x4x2_t t01 = vtrnq_f32(r0, r1);
+			const float32x4x2_t t23 = vtrnq_f32(r2, r3);
+			r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+			r1 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+			r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+			r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+		}
+#endif
+
+		// (ar + i ai) * (br + i bi)
+		inline void cmul4(Vec4 ar, Vec4 ai, Vec4 br, Vec4 bi, Vec4& outR, Vec4& outI) {
+			outR = sub4(mul4(ar, br), mul4(ai, bi));
+			outI = add4(mul4(ar, bi), mul4(ai, br));
+		}
+
+		// One radix-4 butterfly on four lanes. a..d are the inputs, w1..w3 the
+		// twiddles; results land in y0..y3 (re, im).
+		inline void butterfly4(
+			Vec4 ar, Vec4 ai, Vec4 br, Vec4 bi, Vec4 cr, Vec4 ci, Vec4 dr, Vec4 di,
+			Vec4 w1r, Vec4 w1i, Vec4 w2r, Vec4 w2i, Vec4 w3r, Vec4 w3i,
+			Vec4& y0r, Vec4& y0i, Vec4& y1r, Vec4& y1i, Vec4& y2r, Vec4& y2i, Vec4& y3r, Vec4& y3i) {
+			const Vec4 apcR = add4(ar, cr), apcI = add4(ai, ci);
+			const Vec4 amcR = sub4(ar, cr), amcI = sub4(ai, ci);
+			const Vec4 bpdR = add4(br, dr), bpdI = add4(bi, di);
+			const Vec4 bmdR = sub4(br, dr), bmdI = sub4(bi, di);
+
+			y0r = add4(apcR, bpdR);
+			y0i = add4(apcI, bpdI);
+			// amc - j * bmd, apc - bpd, amc + j * bmd
+			cmul4(add4(amcR, bmdI), sub4(amcI, bmdR), w1r, w1i, y1r, y1i);
+			cmul4(sub4(apcR, bpdR), sub4(apcI, bpdI), w2r, w2i, y2r, y2i);
+			cmul4(sub4(amcR, bmdI), add4(amcI, bmdR), w3r, w3i, y3r, y3i);
+		}
+#endif
+	}
+
+	RealFft::RealFft(size_t size, bool vectorized)
+		: size_(isValidSize(size) ? size : 1024),
+		vectorized_(vectorized),
+		finalRadix2_(false) {
+		const size_t points = size_ / 2;
+
+		size_t n = points;
+		size_t stride = 1;
+		while (n >= 4) {
+			Stage stage;
+			stage.n = n;
+			stage.stride = stride;
+
+			const size_t quarter = n / 4;
+			stage.twiddles.resize(6 * quarter);
+			for (size_t p = 0; p < quarter; p++) {
+				for (size_t k = 1; k <= 3; k++) {
+					const double angle = -2.0 * kPi * static_cast<double>(k * p) / static_cast<double>(n);
+					stage.twiddles[(2 * (k - 1)) * quarter + p] = static_cast<float>(std::cos(angle));
+					stage.twiddles[(2 * (k - 1) + 1) * quarter + p] = static_cast<float>(std::sin(angle));
+				}
+			}
+
+			stages_.push_back(std::move(stage));
+			n /= 4;
+			stride *= 4;
+		}
+		finalRadix2_ = n == 2;
+
+		unpackCos_.resize(points);
+		unpackSin_.resize(points);
+		for (size_t k = 0; k < points; k++) {
+			const double angle = -2.0 * kPi * static_cast<double>(k) / static_cast<double>(size_);
+			unpackCos_[k] = static_cast<float>(std::cos(angle));
+			unpackSin_[k] = static_cast<float>(std::sin(angle));
+		}
+
+		bufferA_.resize(2 * points);
+		bufferB_.resize(2 * points);
+	}
+
+	bool RealFft::isValidSize(size_t size) {
+		return size >= kMinSize && size <= kMaxSize && (size & (size - 1)) == 0;
+	}
+
+	void RealFft::radix4(const Stage& stage, const float* xr, const float* xi, float* yr, float* yi) const {
+		const size_t n = stage.n;
+		const size_t s = stage.stride;
+		const size_t quarter = n / 4;
+		const float* w1r = stage.twiddles.data();
+		const float* w1i = w1r + quarter;
+		const float* w2r = w1i + quarter;
+		const float* w2i = w2r + quarter;
+		const float* w3r = w2i + quarter;
+		const float* w3i = w3r + quarter;
+
+		size_t pStart = 0;
+
+#if defined(FLUTTER_ZOOM_SDK_FFT_VECTOR)
+		if (vectorized_ && s >= 4) {
+			// Later stages: the inner run over q is contiguous.
+			for (size_t p = 0; p < quarter; p++) {
+				const Vec4 t1r = splat4(w1r[p]), t1i = splat4(w1i[p]);
+				const Vec4 t2r = splat4(w2r[p]), t2i = splat4(w2i[p]);
+				const Vec4 t3r = splat4(w3r[p]), t3i = splat4(w3i[p]);
+				for (size_t q = 0; q < s; q += 4) {
+					const size_t in = q + s * p;
+					const size_t out = q + s * 4 * p;
+					Vec4 y0r, y0i, y1r, y1i, y2r, y2i, y3r, y3i;
+					butterfly4(
+						load4(xr + in), load4(xi + in),
+						load4(xr + in + s * quarter), load4(xi + in + s * quarter),
+						load4(xr + in + 2 * s * quarter), load4(xi + in + 2 * s * quarter),
+						load4(xr + in + 3 * s * quarter), load4(xi + in + 3 * s * quarter),
+						t1r, t1i, t2r, t2i, t3r, t3i,
+						y0r, y0i, y1r, y1i, y2r, y2i, y3r, y3i);
+					store4(yr + out, y0r); store4(yi + out, y0i);
+					store4(yr + out + s, y1r); store4(yi + out + s, y1i);
+					store4(yr + out + 2 * s, y2r); store4(yi + out + 2 * s, y2i);
+					store4(yr + out + 3 * s, y3r); store4(yi + out + 3 * s, y3i);
+				}
+			}
+			return;
+		}
+
+		if (vectorized_ && s == 1) {
+			// First stage: run over four p at once and transpose so that the four
+			// outputs of each butterfly are stored next to each other.
+			for (; pStart + 4 <= quarter; pStart += 4) {
+				const size_t p = pStart;
+				Vec4 y0r, y0i, y1r, y1i, y2r, y2i, y3r, y3i;
+				butterfly4(
+					load4(xr + p), load4(xi + p),
+					load4(xr + p + quarter), load4(xi + p + quarter),
+					load4(xr + p + 2 * quarter), load4(xi + p + 2 * quarter),
+					load4(xr + p + 3 * quarter), load4(xi + p + 3 * quarter),
+					load4(w1r + p), load4(w1i + p), load4(w2r + p), load4(w2i + p), load4(w3r + p), load4(w3i + p),
+					y0r, y0i, y1r, y1i, y2r, y2i, y3r, y3i);
+				transpose4(y0r, y1r, y2r, y3r);
+				transpose4(y0i, y1i, y2i, y3i);
+				store4(yr + 4 * p, y0r); store4(yi + 4 * p, y0i);
+				store4(yr + 4 * p + 4, y1r); store4(yi + 4 * p + 4, y1i);
+				store4(yr + 4 * p + 8, y2r); store4(yi + 4 * p + 8, y2i);
+				store4(yr + 4 * p + 12, y3r); store4(yi + 4 * p + 12, y3i);
+			}
+		}
+#endif
+
+		for (size_t p = pStart; p < quarter; p++) {
+			for (size_t q = 0; q < s; q++) {
+				const size_t in = q + s * p;
+				const float ar = xr[in], ai = xi[in];
+				const float br = xr[in + s * quarter], bi = xi[in + s * quarter];
+				const float cr = xr[in + 2 * s * quarter], ci = xi[in + 2 * s * quarter];
+				const float dr = xr[in + 3 * s * quarter], di = xi[in + 3 * s * quarter];
+
+				const float apcR = ar + cr, apcI = ai + ci;
+				const float amcR = ar - cr, amcI = ai - ci;
+				const float bpdR = br + dr, bpdI = bi + di;
+				const float bmdR = br - dr, bmdI = bi - di;
+
+				const float t1r = amcR + bmdI, t1i = amcI - bmdR;
+				const float t2r = apcR - bpdR, t2i = apcI - bpdI;
+				const float t3r = amcR - bmdI, t3i = amcI + bmdR;
+
+				const size_t out = q + s * 4 * p;
+				yr[out] = apcR + bpdR;
+				yi[out] = apcI + bpdI;
+				yr[out + s] = t1r * w1r[p] - t1i * w1i[p];
+				yi[out + s] = t1r * w1i[p] + t1i * w1r[p];
+				yr[out + 2 * s] = t2r * w2r[p] - t2i * w2i[p];
+				yi[out + 2 * s] = t2r * w2i[p] + t2i * w2r[p];
+				yr[out + 3 * s] = t3r * w3r[p] - t3i * w3i[p];
+				yi[out + 3 * s] = t3r * w3i[p] + t3i * w3r[p];
+			}
+		}
+	}
+
+	void RealFft::radix2(size_t stride, float* xr, float* xi) const {
+		size_t q = 0;
+
+#if defined(FLUTTER_ZOOM_SDK_FFT_VECTOR)
+		if (vectorized_) {
+			for (; q + 4 <= stride; q += 4) {
+				const Vec4 ar = load4(xr + q), ai = load4(xi + q);
+				const Vec4 br = load4(xr + q + stride), bi = load4(xi + q + stride);
+				store4(xr + q, add4(ar, br)); store4(xi + q, add4(ai, bi));
+				store4(xr + q + stride, sub4(ar, br)); store4(xi + q + stride, sub4(ai, bi));
+			}
+		}
+#endif
+
+		for (; q < stride; q++) {
+			const float ar = xr[q], ai = xi[q];
+			const float br = xr[q + stride], bi = xi[q + stride];
+			xr[q] = ar + br;
+			xi[q] = ai + bi;
+			xr[q + stride] = ar - br;
+			xi[q + stride] = ai - bi;
+		}
+	}
+
+	void RealFft::forward(const float* in, float* re, float* im) {
+		const size_t points = size_ / 2;
+
+		// Even samples become the real part, odd ones the imaginary part.
+		float* xr = bufferA_.data();
+		float* xi = xr + points;
+		float* yr = bufferB_.data();
+		float* yi = yr + points;
+		for (size_t k = 0; k < points; k++) {
+			xr[k] = in[2 * k];
+			xi[k] = in[2 * k + 1];
+		}
+
+		for (const Stage& stage : stages_) {
+			radix4(stage, xr, xi, yr, yi);
+			std::swap(xr, yr);
+			std::swap(xi, yi);
+		}
+		if (finalRadix2_) {
+			radix2(points / 2, xr, xi);
+		}
+
+		// X[k] = E[k] + W^k O[k] with E, O the spectra of the even and odd
+		// samples, recovered from Z[k] and conj(Z[points - k]).
+		re[0] = xr[0] + xi[0];
+		im[0] = 0.0f;
+		re[points] = xr[0] - xi[0];
+		im[points] = 0.0f;
+		for (size_t k = 1; k < points; k++) {
+			const float ar = xr[k], ai = xi[k];
+			const float br = xr[points - k], bi = -xi[points - k];
+
+			const float er = 0.5f * (ar + br), ei = 0.5f * (ai + bi);
+			const float orr = 0.5f * (ai - bi), oi = -0.5f * (ar - br);
+
+			const float wr = unpackCos_[k], wi = unpackSin_[k];
+			re[k] = er + orr * wr - oi * wi;
+			im[k] = ei + orr * wi + oi * wr;
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,53 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_REAL_FFT_H_
+#define FLUTTER_PLUGIN_MEDIA_REAL_FFT_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	// Forward FFT of a real signal. The N real samples are packed into an N/2
+	// point complex FFT (split re/im arrays, radix-4 Stockham stages with a
+	// final radix-2 stage when needed) and unpacked into N/2 + 1 bins. All
+	// twiddles are computed once in the constructor. Not thread-safe: each
+	// analysis stream owns its instance.
+	class RealFft {
+	public:
+		// size must be a power of two between 64 and 16384.
+		explicit RealFft(size_t size, bool vectorized = true);
+
+		static bool isValidSize(size_t size);
+
+		size_t size() const { return size_; }
+
+		size_t binCount() const { return size_ / 2 + 1; }
+
+		// in: size() samples. re, im: binCount() values each.
+		void forward(const float* in, float* re, float* im);
+
+	private:
+		struct Stage {
+			size_t n;
+			size_t stride;
+			// w1 re, w1 im, w2 re, w2 im, w3 re, w3 im, n / 4 values each.
+			std::vector<float> twiddles;
+		};
+
+		void radix4(const Stage& stage, const float* xr, const float* xi, float* yr, float* yi) const;
+
+		void radix2(size_t stride, float* xr, float* xi) const;
+
+		const size_t size_;
+		const bool vectorized_;
+		std::vector<Stage> stages_;
+		bool finalRadix2_;
+		// e^{-2 pi i k / size} for the real unpacking, k in [0, size / 2).
+		std::vector<float> unpackCos_;
+		std::vector<float> unpackSin_;
+		std::vector<float> bufferA_;
+		std::vector<float> bufferB_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_REAL_FFT_H_
@@ -0,0 +1,122 @@
+#include "media/resampler.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr double kPi = 3.14159265358979323846;
+
+		double sinc(double x) {
+			return x == 0.0 ? 1.0 : std::sin(kPi * x) / (kPi * x);
+		}
+
+		// Blackman window over [-1, 1].
+		double window(double x) {
+			if (x <= -1.0 || x >= 1.0) {
+				return 0.0;
+			}
+			const double t = (x + 1.0) / 2.0;
+			return 0.42 - 0.5 * std::cos(2.0 * kPi * t) + 0.08 * std::cos(4.0 * kPi * t);
+		}
+
+		int16_t toSample(float value) {
+			return static_cast<int16_t>(std::lround(std::clamp(value, -32768.0f, 32767.0f)));
+		}
+	}
+
+	Resampler::Resampler(uint32_t inputRate, uint32_t outputRate, uint32_t channels)
+		: inputRate_(std::max<uint32_t>(inputRate, 1)),
+		outputRate_(std::max<uint32_t>(outputRate, 1)),
+		channels_(std::max<uint32_t>(channels, 1)),
+		step_(static_cast<double>(inputRate_) / static_cast<double>(outputRate_)),
+		position_(0.0) {
+		constexpr size_t half = kTaps / 2;
+		// A little below Nyquist leaves room for the transition band.
+		const double cutoff = 0.92 * std::min(1.0, static_cast<double>(outputRate_) / inputRate_);
+
+		table_.resize((kPhases + 1) * kTaps);
+		for (size_t phase = 0; phase <= kPhases; phase++) {
+			const double fraction = static_cast<double>(phase) / kPhases;
+			float* row = table_.data() + phase * kTaps;
+			double sum = 0.0;
+			for (size_t k = 0; k < kTaps; k++) {
+				// Tap k sits at floor(position) - half + 1 + k.
+				const double distance = fraction + static_cast<double>(half - 1) - static_cast<double>(k);
+				const double h = cutoff * sinc(cutoff * distance) * window(distance / half);
+				row[k] = static_cast<float>(h);
+				sum += h;
+			}
+			// Unity gain at DC for every phase.
+			for (size_t k = 0; k < kTaps; k++) {
+				row[k] = static_cast<float>(row[k] / sum);
+			}
+		}
+
+		reset();
+	}
+
+	void Resampler::reset() {
+		// Leading silence so the first output lines up with the first input.
+		history_.assign((kTaps / 2 - 1) * channels_, 0.0f);
+		position_ = static_cast<double>(kTaps / 2 - 1);
+	}
+
+	size_t Resampler::inputFramesFor(size_t outputFrames) const {
+		if (inputRate_ == outputRate_) {
+			return outputFrames;
+		}
+
+		// The last output needs half taps of lookahead past its position.
+		const double last = position_ + static_cast<double>(outputFrames - 1) * step_;
+		const size_t needed = static_cast<size_t>(last) + kTaps / 2 + 1;
+		const size_t buffered = history_.size() / channels_;
+		return needed > buffered ? needed - buffered : 0;
+	}
+
+	void Resampler::process(const int16_t* input, size_t frames, std::vector<int16_t>& out) {
+		if (inputRate_ == outputRate_) {
+			out.insert(out.end(), input, input + frames * channels_);
+			return;
+		}
+
+		constexpr size_t half = kTaps / 2;
+		const size_t previous = history_.size();
+		history_.resize(previous + frames * channels_);
+		std::transform(input, input + frames * channels_, history_.begin() + previous,
+			[](int16_t sample) { return static_cast<float>(sample); });
+
+		const size_t available = history_.size() / channels_;
+		for (;;) {
+			const size_t base = static_cast<size_t>(position_);
+			if (base + half >= available) {
+				break;
+			}
+
+			const double phasePosition = (position_ - static_cast<double>(base)) * kPhases;
+			const size_t phase = std::min(static_cast<size_t>(phasePosition), kPhases - 1);
+			const float blend = static_cast<float>(phasePosition - static_cast<double>(phase));
+			const float* lower = table_.data() + phase * kTaps;
+			const float* upper = lower + kTaps;
+			const float* first = history_.data() + (base + 1 - half) * channels_;
+
+			for (uint32_t c = 0; c < channels_; c++) {
+				float acc = 0.0f;
+				for (size_t k = 0; k < kTaps; k++) {
+					const float coefficient = lower[k] + (upper[k] - lower[k]) * blend;
+					acc += first[k * channels_ + c] * coefficient;
+				}
+				out.push_back(toSample(acc));
+			}
+
+			position_ += step_;
+		}
+
+		// Keep half - 1 frames before the next output position.
+		const size_t consumed = std::min(static_cast<size_t>(position_) - (half - 1), available);
+		history_.erase(history_.begin(), history_.begin() + consumed * channels_);
+		position_ -= static_cast<double>(consumed);
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,50 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_RESAMPLER_H_
+#define FLUTTER_PLUGIN_MEDIA_RESAMPLER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	// Streaming int16 sample-rate converter. Windowed-sinc polyphase filter
+	// (16 taps, 128 phases with linear interpolation between them), cut off
+	// below the lower of the two Nyquist rates. Keeps its history between
+	// calls, so audio can be fed in any block size. Equal rates pass through.
+	class Resampler {
+	public:
+		Resampler(uint32_t inputRate, uint32_t outputRate, uint32_t channels);
+
+		uint32_t inputRate() const { return inputRate_; }
+
+		uint32_t outputRate() const { return outputRate_; }
+
+		uint32_t channels() const { return channels_; }
+
+		// Appends the output for frames interleaved input frames to out.
+		void process(const int16_t* input, size_t frames, std::vector<int16_t>& out);
+
+		// Input frames needed for at least outputFrames more output frames.
+		size_t inputFramesFor(size_t outputFrames) const;
+
+		void reset();
+
+	private:
+		static constexpr size_t kTaps = 16;
+		static constexpr size_t kPhases = 128;
+
+		const uint32_t inputRate_;
+		const uint32_t outputRate_;
+		const uint32_t channels_;
+		const double step_;
+		// (kPhases + 1) rows of kTaps coefficients.
+		std::vector<float> table_;
+		// Interleaved input not yet fully consumed, starting kTaps / 2 - 1
+		// frames before the next output position.
+		std::vector<float> history_;
+		double position_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_RESAMPLER_H_
@@ -0,0 +1,227 @@
+#include "media/rgba_to_i420.h"
+
+#include <algorithm>
+
+#include "media/simd.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// BT.601 in 8-bit fixed point, as libyuv and most encoders use.
+		struct Coefficients {
+			int yr, yg, yb, yOffset;
+			int ur, ug, ub;
+			int vr, vg, vb;
+		};
+
+		constexpr Coefficients kLimited = { 66, 129, 25, 16, -38, -74, 112, 112, -94, -18 };
+		constexpr Coefficients kFull = { 77, 150, 29, 0, -43, -85, 128, 128, -107, -21 };
+
+		inline uint8_t luma(const Coefficients& c, int r, int g, int b) {
+			return static_cast<uint8_t>(((c.yr * r + c.yg * g + c.yb * b + 128) >> 8) + c.yOffset);
+		}
+
+		inline uint8_t chroma(int cr, int cg, int cb, int r, int g, int b) {
+			return static_cast<uint8_t>(std::clamp(((cr * r + cg * g + cb * b + 128) >> 8) + 128, 0, 255));
+		}
+
+		// Converts columns [x, width) of one row pair; row1 is null for a
+		// last odd row.
+		void convertScalar(const uint8_t* row0, const uint8_t* row1, int x, int width, int rIndex, int bIndex,
+			const Coefficients& c, uint8_t* y0, uint8_t* y1, uint8_t* u, uint8_t* v) {
+			for (; x < width; x += 2) {
+				int r = 0;
+				int g = 0;
+				int b = 0;
+				int count = 0;
+				for (int row = 0; row < 2; row++) {
+					const uint8_t* pixels = row ? row1 : row0;
+					uint8_t* yOut = row ? y1 : y0;
+					if (!pixels) {
+						continue;
+					}
+					for (int dx = 0; dx < 2 && x + dx < width; dx++) {
+						const uint8_t* p = pixels + 4 * (x + dx);
+						yOut[x + dx] = luma(c, p[rIndex], p[1], p[bIndex]);
+						r += p[rIndex];
+						g += p[1];
+						b += p[bIndex];
+						count++;
+					}
+				}
+				r = (r + count / 2) / count;
+				g = (g + count / 2) / count;
+				b = (b + count / 2) / count;
+				u[x / 2] = chroma(c.ur, c.ug, c.ub, r, g, b);
+				v[x / 2] = chroma(c.vr, c.vg, c.vb, r, g, b);
+			}
+		}
+
+#if defined(FLUTTER_ZOOM_SDK_SSE2)
+		// Byte k of each 32-bit pixel of v, as 32-bit lanes.
+		inline __m128i channel(__m128i v, int k) {
+			const __m128i mask = _mm_set1_epi32(0xFF);
+			switch (k) {
+			case 0: return _mm_and_si128(v, mask);
+			case 1: return _mm_and_si128(_mm_srli_epi32(v, 8), mask);
+			default: return _mm_and_si128(_mm_srli_epi32(v, 16), mask);
+			}
+		}
+
+		struct Planar8 {
+			__m128i r, g, b;
+		};
+
+		// Eight pixels as 16-bit lanes per channel.
+		inline Planar8 load8(const uint8_t* p, int rIndex, int bIndex) {
+			const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16));
+			Planar8 out;
+			out.r = _mm_packs_epi32(channel(v0, rIndex), channel(v1, rIndex));
+			out.g = _mm_packs_epi32(channel(v0, 1), channel(v1, 1));
+			out.b = _mm_packs_epi32(channel(v0, bIndex), channel(v1, bIndex));
+			return out;
+		}
+
+		inline __m128i luma8(const Planar8& p, const Coefficients& c) {
+			// At most 256 * 255 + 128: wraps as signed but not as unsigned.
+			__m128i y = _mm_add_epi16(_mm_mullo_epi16(p.r, _mm_set1_epi16(static_cast<short>(c.yr))),
+				_mm_mullo_epi16(p.g, _mm_set1_epi16(static_cast<short>(c.yg))));
+			y = _mm_add_epi16(y, _mm_mullo_epi16(p.b, _mm_set1_epi16(static_cast<short>(c.yb))));
+			y = _mm_srli_epi16(_mm_add_epi16(y, _mm_set1_epi16(128)), 8);
+			return _mm_add_epi16(y, _mm_set1_epi16(static_cast<short>(c.yOffset)));
+		}
+
+		// Rounded averages of horizontal pairs of two rows' sums, for eight
+		// pixels at a and eight at b: eight 16-bit lanes.
+		inline __m128i average2x2(__m128i a, __m128i b) {
+			const __m128i ones = _mm_set1_epi16(1);
+			const __m128i two = _mm_set1_epi32(2);
+			const __m128i lo = _mm_srli_epi32(_mm_add_epi32(_mm_madd_epi16(a, ones), two), 2);
+			const __m128i hi = _mm_srli_epi32(_mm_add_epi32(_mm_madd_epi16(b, ones), two), 2);
+			return _mm_packs_epi32(lo, hi);
+		}
+
+		inline __m128i pair(int low, int high) {
+			return _mm_set1_epi32(static_cast<int>((static_cast<uint32_t>(high) << 16) | (static_cast<uint32_t>(low) & 0xFFFF)));
+		}
+
+		// Eight chroma bytes (in the low half) from averaged r, g and b.
+		inline __m128i chroma8(__m128i r, __m128i g, __m128i b, int cr, int cg, int cb) {
+			const __m128i ones = _mm_set1_epi16(1);
+			const __m128i rg = pair(cr, cg);
+			const __m128i b1 = pair(cb, 128);
+			const __m128i bias = _mm_set1_epi32(128);
+			__m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(r, g), rg), _mm_madd_epi16(_mm_unpacklo_epi16(b, ones), b1));
+			__m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(r, g), rg), _mm_madd_epi16(_mm_unpackhi_epi16(b, ones), b1));
+			lo = _mm_add_epi32(_mm_srai_epi32(lo, 8), bias);
+			hi = _mm_add_epi32(_mm_srai_epi32(hi, 8), bias);
+			const __m128i packed = _mm_packs_epi32(lo, hi);
+			return _mm_packus_epi16(packed, packed);
+		}
+#endif
+	}
+
+	void ConvertRgbaToI420(const uint8_t* src, int srcStride, PixelOrder order, bool fullRange,
+		const I420Planes& dst, bool vectorized) {
+		const Coefficients& c = fullRange ? kFull : kLimited;
+		const int rIndex = order == PixelOrder::Rgba ? 0 : 2;
+		const int bIndex = 2 - rIndex;
+		const int width = dst.width;
+		const int height = dst.height;
+
+		for (int y = 0; y < height; y += 2) {
+			const uint8_t* row0 = src + static_cast<size_t>(y) * srcStride;
+			const uint8_t* row1 = y + 1 < height ? row0 + srcStride : nullptr;
+			uint8_t* y0 = dst.y + static_cast<size_t>(y) * dst.strideY;
+			uint8_t* y1 = row1 ? y0 + dst.strideY : nullptr;
+			uint8_t* u = dst.u + static_cast<size_t>(y / 2) * dst.strideU;
+			uint8_t* v = dst.v + static_cast<size_t>(y / 2) * dst.strideV;
+			int x = 0;
+
+#if defined(FLUTTER_ZOOM_SDK_SSE2)
+			// Whole 2x2 blocks only; the edges go through the scalar path.
+			if (vectorized && row1) {
+				for (; x + 16 <= width; x += 16) {
+					const Planar8 a0 = load8(row0 + 4 * x, rIndex, bIndex);
+					const Planar8 b0 = load8(row0 + 4 * x + 32, rIndex, bIndex);
+					const Planar8 a1 = load8(row1 + 4 * x, rIndex, bIndex);
+					const Planar8 b1 = load8(row1 + 4 * x + 32, rIndex, bIndex);
+
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(y0 + x), _mm_packus_epi16(luma8(a0, c), luma8(b0, c)));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(y1 + x), _mm_packus_epi16(luma8(a1, c), luma8(b1, c)));
+
+					const __m128i r = average2x2(_mm_add_epi16(a0.r, a1.r), _mm_add_epi16(b0.r, b1.r));
+					const __m128i g = average2x2(_mm_add_epi16(a0.g, a1.g), _mm_add_epi16(b0.g, b1.g));
+					const __m128i b = average2x2(_mm_add_epi16(a0.b, a1.b), _mm_add_epi16(b0.b, b1.b));
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(u + x / 2), chroma8(r, g, b, c.ur, c.ug, c.ub));
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(v + x / 2), chroma8(r, g, b, c.vr, c.vg, c.vb));
+				}
+			}
+#elif defined(FLUTTER_ZOOM_SDK_NEON)
+			if (vectorized && row1) {
+				const uint8x8_t yr = vdup_n_u8(static_cast<uint8_t>(c.yr));
+				const uint8x8_t yg = vdup_n_u8(static_cast<uint8_t>(c.yg));
+				const uint8x8_t yb = vdup_n_u8(static_cast<uint8_t>(c.yb));
+				const uint16x8_t yBias = vdupq_n_u16(128);
+				const uint8x8_t yOffset = vdup_n_u8(static_cast<uint8_t>(c.yOffset));
+				for (; x + 16 <= width; x += 16) {
+					const uint8x16x4_t p0 = vld4q_u8(row0 + 4 * x);
+					const uint8x16x4_t p1 = vld4q_u8(row1 + 4 * x);
+					const uint8x16_t* rows[2] = { p0.val, p1.val };
+					uint8_t* yRows[2] = { y0, y1 };
+					for (int row = 0; row < 2; row++) {
+						const uint8x16_t r = rows[row][rIndex];
+						const uint8x16_t g = rows[row][1];
+						const uint8x16_t b = rows[row][bIndex];
+						uint16x8_t lo = vmlal_u8(vmlal_u8(vmlal_u8(yBias, vget_low_u8(r), yr), vget_low_u8(g), yg), vget_low_u8(b), yb);
+						uint16x8_t hi = vmlal_u8(vmlal_u8(vmlal_u8(yBias, vget_high_u8(r), yr), vget_high_u8(g), yg), vget_high_u8(b), yb);
+						vst1q_u8(yRows[row] + x, vcombine_u8(vadd_u8(vshrn_n_u16(lo, 8), yOffset), vadd_u8(vshrn_n_u16(hi, 8), yOffset)));
+					}
+
+					const int16x8_t r = vreinterpretq_s16_u16(vrshrq_n_u16(vaddq_u16(vpaddlq_u8(p0.val[rIndex]), vpaddlq_u8(p1.val[rIndex])), 2));
+					const int16x8_t g = vreinterpretq_s16_u16(vrshrq_n_u16(vaddq_u16(vpaddlq_u8(p0.val[1]), vpaddlq_u8(p1.val[1])), 2));
+					const int16x8_t b = vreinterpretq_s16_u16(vrshrq_n_u16(vaddq_u16(vpaddlq_u8(p0.val[bIndex]), vpaddlq_u8(p1.val[bIndex])), 2));
+					const int coefficients[2][3] = { { c.ur, c.ug, c.ub }, { c.vr, c.vg, c.vb } };
+					uint8_t* outs[2] = { u + x / 2, v + x / 2 };
+					for (int k = 0; k < 2; k++) {
+						const int16_t cr = static_cast<int16_t>(coefficients[k][0]);
+						const int16_t cg = static_cast<int16_t>(coefficients[k][1]);
+						const int16_t cb = static_cast<int16_t>(coefficients[k][2]);
+						int32x4_t lo = vmlal_n_s16(vmlal_n_s16(vmull_n_s16(vget_low_s16(r), cr), vget_low_s16(g), cg), vget_low_s16(b), cb);
+						int32x4_t hi = vmlal_n_s16(vmlal_n_s16(vmull_n_s16(vget_high_s16(r), cr), vget_high_s16(g), cg), vget_high_s16(b), cb);
+						lo = vaddq_s32(vshrq_n_s32(vaddq_s32(lo, vdupq_n_s32(128)), 8), vdupq_n_s32(128));
+						hi = vaddq_s32(vshrq_n_s32(vaddq_s32(hi, vdupq_n_s32(128)), 8), vdupq_n_s32(128));
+						vst1_u8(outs[k], vqmovun_s16(vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi))));
+					}
+				}
+			}
+#endif
+
+			convertScalar(row0, row1, x, width, rIndex, bIndex, c, y0, y1, u, v);
+		}
+	}
+
+	RgbaToI420Converter::RgbaToI420Converter(size_t maxIdle) : maxIdle_(maxIdle) {}
+
+	PooledBuffer RgbaToI420Converter::convert(const uint8_t* src, int srcStride, int width, int height,
+		PixelOrder order, bool fullRange) {
+		const size_t size = I420BufferSize(width, height);
+
+		std::shared_ptr<BufferPool> pool;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!pool_ || pool_->bufferSize() != size) {
+				pool_ = BufferPool::create(size, maxIdle_);
+			}
+			pool = pool_;
+		}
+
+		PooledBuffer buffer = pool->acquire();
+		buffer->resize(size);
+		ConvertRgbaToI420(src, srcStride > 0 ? srcStride : 4 * width, order, fullRange,
+			I420Planes::packed(buffer->data(), width, height));
+		return buffer;
+	}
+
+}  // namespace flutter_zoom_sdk
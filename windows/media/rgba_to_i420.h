@@ -0,0 +1,49 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_RGBA_TO_I420_H_
+#define FLUTTER_PLUGIN_MEDIA_RGBA_TO_I420_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "media/buffer_pool.h"
+#include "media/i420_image.h"
+
+namespace flutter_zoom_sdk {
+
+	// Byte order of a 32-bit pixel in memory. Flutter's rawRgba snapshots
+	// are Rgba; Windows bitmaps are Bgra.
+	enum class PixelOrder {
+		Rgba,
+		Bgra,
+	};
+
+	// BT.601 conversion of width x height pixels into dst, whose size must
+	// match. Alpha is ignored, so translucent pixels come out as if over
+	// black. Each chroma sample converts the average of its 2x2 block; at an
+	// odd right or bottom edge the block is the pixels that exist. The scalar
+	// path (vectorized = false) produces the same bytes.
+	void ConvertRgbaToI420(const uint8_t* src, int srcStride, PixelOrder order, bool fullRange,
+		const I420Planes& dst, bool vectorized = true);
+
+	// Converts into packed I420 buffers from a pool, so steady-state frames
+	// of one size do not allocate.
+	class RgbaToI420Converter {
+	public:
+		explicit RgbaToI420Converter(size_t maxIdle = 3);
+
+		RgbaToI420Converter(const RgbaToI420Converter&) = delete;
+		RgbaToI420Converter& operator=(const RgbaToI420Converter&) = delete;
+
+		// srcStride 0 means tightly packed rows.
+		PooledBuffer convert(const uint8_t* src, int srcStride, int width, int height, PixelOrder order, bool fullRange);
+
+	private:
+		const size_t maxIdle_;
+		std::mutex mutex_;
+		std::shared_ptr<BufferPool> pool_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_RGBA_TO_I420_H_
@@ -0,0 +1,203 @@
+#include "media/share_audio_pump.h"
+
+#include <algorithm>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// Behind by more than this (a suspended machine, a debugger) the
+		// schedule restarts from now instead of bursting to catch up.
+		constexpr auto kMaxBacklog = std::chrono::milliseconds(200);
+
+		void toStereo(const int16_t* input, size_t frames, size_t channels, std::vector<int16_t>& stereo) {
+			stereo.resize(frames * 2);
+			if (channels == 2) {
+				std::copy(input, input + frames * 2, stereo.begin());
+				return;
+			}
+			for (size_t i = 0; i < frames; i++) {
+				// Mono is duplicated; beyond stereo only the front pair is kept.
+				stereo[2 * i] = input[i * channels];
+				stereo[2 * i + 1] = input[i * channels + (channels > 1 ? 1 : 0)];
+			}
+		}
+	}
+
+	ShareAudioPump::ShareAudioPump(const ShareAudioPumpConfig& config)
+		: config_(config),
+		chunkFrames_(std::max<size_t>(static_cast<size_t>(config.sampleRate * config.chunk.count() / 1000), 1)),
+		stopping_(false),
+		prebuffering_(true),
+		finishReported_(false) {
+		chunk_.resize(chunkFrames_ * 2);
+	}
+
+	ShareAudioPump::~ShareAudioPump() {
+		stopThread();
+	}
+
+	void ShareAudioPump::setSource(std::shared_ptr<IPcmSource> source) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		source_ = std::move(source);
+		stats_.finished = false;
+	}
+
+	void ShareAudioPump::setFinishedCallback(FinishedCallback callback) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		finishedCallback_ = std::move(callback);
+	}
+
+	ShareAudioPumpStats ShareAudioPump::stats() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return stats_;
+	}
+
+	void ShareAudioPump::onStartSendAudio(ZOOM_SDK_NAMESPACE::IZoomSDKShareAudioSender* pShareAudioSender) {
+		stopThread();
+		if (!pShareAudioSender) {
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		stopping_ = false;
+		stats_.sending = true;
+		worker_ = std::thread(&ShareAudioPump::run, this, pShareAudioSender);
+	}
+
+	void ShareAudioPump::onStopSendAudio() {
+		stopThread();
+	}
+
+	void ShareAudioPump::stopThread() {
+		std::thread worker;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stopping_ = true;
+			stats_.sending = false;
+			worker.swap(worker_);
+		}
+		wake_.notify_all();
+
+		if (worker.joinable()) {
+			worker.join();
+		}
+	}
+
+	ShareAudioPump::Fill ShareAudioPump::fillChunk() {
+		Fill fill;
+
+		std::shared_ptr<IPcmSource> source;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			source = source_;
+		}
+		if (source != current_) {
+			current_ = std::move(source);
+			resampler_.reset();
+			if (current_ && current_->sampleRate() > 0) {
+				resampler_ = std::make_unique<Resampler>(current_->sampleRate(), config_.sampleRate, 2);
+			}
+			pending_.clear();
+			prebuffering_ = true;
+			finishReported_ = false;
+		}
+
+		if (resampler_) {
+			const size_t channels = std::max<uint32_t>(current_->channels(), 1);
+
+			if (prebuffering_) {
+				const size_t prebufferFrames = static_cast<size_t>(current_->sampleRate() * config_.prebuffer.count() / 1000);
+				prebuffering_ = current_->bufferedFrames() < prebufferFrames && !current_->finished();
+			}
+
+			while (!prebuffering_ && pending_.size() < chunkFrames_ * 2) {
+				const size_t wanted = resampler_->inputFramesFor(chunkFrames_ - pending_.size() / 2);
+				input_.resize(wanted * channels);
+				const size_t count = current_->read(input_.data(), wanted);
+				if (count == 0) {
+					break;
+				}
+				toStereo(input_.data(), count, channels, stereo_);
+				resampler_->process(stereo_.data(), count, pending_);
+			}
+
+			fill.buffered = current_->bufferedFrames() * 1000 / current_->sampleRate()
+				+ pending_.size() / 2 * 1000 / config_.sampleRate;
+		}
+
+		fill.frames = std::min(pending_.size() / 2, chunkFrames_);
+		std::copy(pending_.begin(), pending_.begin() + fill.frames * 2, chunk_.begin());
+		std::fill(chunk_.begin() + fill.frames * 2, chunk_.end(), int16_t(0));
+		pending_.erase(pending_.begin(), pending_.begin() + fill.frames * 2);
+
+		if (fill.frames < chunkFrames_ && current_) {
+			if (current_->finished()) {
+				fill.finished = !finishReported_;
+				finishReported_ = true;
+			}
+			else if (!prebuffering_) {
+				// Starved mid-stream: count it and build up a cushion again.
+				fill.underrun = true;
+				prebuffering_ = true;
+			}
+		}
+		return fill;
+	}
+
+	void ShareAudioPump::run(ZOOM_SDK_NAMESPACE::IZoomSDKShareAudioSender* sender) {
+		const auto chunkDuration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+			std::chrono::duration<double>(static_cast<double>(chunkFrames_) / config_.sampleRate));
+		const unsigned int chunkBytes = static_cast<unsigned int>(chunk_.size() * sizeof(int16_t));
+
+		auto next = std::chrono::steady_clock::now();
+
+		std::unique_lock<std::mutex> lock(mutex_);
+		while (!stopping_) {
+			lock.unlock();
+
+			const Fill fill = fillChunk();
+			const ZOOM_SDK_NAMESPACE::SDKError err = sender->sendShareAudio(
+				reinterpret_cast<char*>(chunk_.data()), chunkBytes,
+				static_cast<int>(config_.sampleRate), ZOOM_SDK_NAMESPACE::ZoomSDKAudioChannel_Stereo);
+
+			lock.lock();
+			if (err == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+				stats_.chunksSent++;
+			}
+			else {
+				stats_.sendErrors++;
+			}
+			stats_.silentFrames += chunkFrames_ - fill.frames;
+			stats_.underruns += fill.underrun ? 1 : 0;
+			stats_.bufferedMs = static_cast<uint32_t>(fill.buffered);
+			FinishedCallback finished;
+			if (fill.finished) {
+				stats_.finished = true;
+				finished = finishedCallback_;
+			}
+
+			if (finished) {
+				lock.unlock();
+				finished();
+				lock.lock();
+			}
+
+			next += chunkDuration;
+			if (std::chrono::steady_clock::now() - next > kMaxBacklog) {
+				next = std::chrono::steady_clock::now();
+			}
+
+			if (wake_.wait_until(lock, next, [this]() { return stopping_; })) {
+				break;
+			}
+
+			const auto lateness = std::chrono::steady_clock::now() - next;
+			const auto latenessUs = std::chrono::duration_cast<std::chrono::microseconds>(lateness).count();
+			stats_.maxLatenessUs = std::max(stats_.maxLatenessUs, static_cast<uint32_t>(std::max<int64_t>(latenessUs, 0)));
+			if (lateness > chunkDuration) {
+				stats_.lateTicks++;
+			}
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
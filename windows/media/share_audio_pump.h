@@ -0,0 +1,117 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_SHARE_AUDIO_PUMP_H_
+#define FLUTTER_PLUGIN_MEDIA_SHARE_AUDIO_PUMP_H_
+
+#include <rawdata/rawdata_share_source_helper_interface.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "media/pcm_source.h"
+#include "media/resampler.h"
+
+namespace flutter_zoom_sdk {
+
+	struct ShareAudioPumpConfig {
+		// Stereo rate handed to sendShareAudio; 48 kHz is supported for stereo.
+		uint32_t sampleRate = 48000;
+		std::chrono::milliseconds chunk{ 10 };
+		// After a start or an underrun, sending resumes once this much audio is
+		// buffered (or the source has finished), so a slow producer causes one
+		// gap rather than a stutter.
+		std::chrono::milliseconds prebuffer{ 60 };
+	};
+
+	struct ShareAudioPumpStats {
+		bool sending = false;
+		bool finished = false;
+		uint64_t chunksSent = 0;
+		uint64_t sendErrors = 0;
+		// Chunks that could not be filled from the source.
+		uint64_t underruns = 0;
+		// Frames of silence sent in place of missing audio.
+		uint64_t silentFrames = 0;
+		// Audio waiting in the source and the pump, in milliseconds.
+		uint32_t bufferedMs = 0;
+		// Ticks that woke more than a chunk late, and the worst lateness.
+		uint64_t lateTicks = 0;
+		uint32_t maxLatenessUs = 0;
+	};
+
+	// External share audio source for setSharePureAudioSource (or alongside
+	// an external share source). Between onStartSendAudio and
+	// onStopSendAudio a dedicated thread sends one stereo chunk per chunk
+	// duration, on an absolute schedule so late wake-ups are caught up rather
+	// than slowing the stream. Audio is pulled from an IPcmSource, converted
+	// to stereo and resampled to the configured rate; missing audio is sent as
+	// silence and counted.
+	class ShareAudioPump : public ZOOM_SDK_NAMESPACE::IZoomSDKShareAudioSource {
+	public:
+		// Called once on the pump thread when a finite source has been sent.
+		using FinishedCallback = std::function<void()>;
+
+		explicit ShareAudioPump(const ShareAudioPumpConfig& config = ShareAudioPumpConfig());
+
+		~ShareAudioPump();
+
+		ShareAudioPump(const ShareAudioPump&) = delete;
+		ShareAudioPump& operator=(const ShareAudioPump&) = delete;
+
+		// Takes effect on the next chunk.
+		void setSource(std::shared_ptr<IPcmSource> source);
+
+		void setFinishedCallback(FinishedCallback callback);
+
+		ShareAudioPumpStats stats();
+
+		void onStartSendAudio(ZOOM_SDK_NAMESPACE::IZoomSDKShareAudioSender* pShareAudioSender) override;
+
+		void onStopSendAudio() override;
+
+	private:
+		struct Fill {
+			// Frames that came from the source; the rest of the chunk is silence.
+			size_t frames = 0;
+			size_t buffered = 0;
+			bool underrun = false;
+			// Set once, on the chunk where a finite source ran out.
+			bool finished = false;
+		};
+
+		void run(ZOOM_SDK_NAMESPACE::IZoomSDKShareAudioSender* sender);
+
+		void stopThread();
+
+		// Fills chunk_ with chunkFrames_ stereo frames.
+		Fill fillChunk();
+
+		const ShareAudioPumpConfig config_;
+		const size_t chunkFrames_;
+
+		std::mutex mutex_;
+		std::condition_variable wake_;
+		std::shared_ptr<IPcmSource> source_;
+		FinishedCallback finishedCallback_;
+		ShareAudioPumpStats stats_;
+		bool stopping_;
+		std::thread worker_;
+
+		// Pump-thread owned.
+		std::shared_ptr<IPcmSource> current_;
+		std::unique_ptr<Resampler> resampler_;
+		bool prebuffering_;
+		bool finishReported_;
+		std::vector<int16_t> input_;
+		std::vector<int16_t> stereo_;
+		std::vector<int16_t> pending_;
+		std::vector<int16_t> chunk_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_SHARE_AUDIO_PUMP_H_
@@ -0,0 +1,16 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_SIMD_H_
+#define FLUTTER_PLUGIN_MEDIA_SIMD_H_
+
+// Instruction sets the media kernels may assume at compile time. SSE2 is part
+// of the x64 baseline and NEON of the arm64 one, so neither needs runtime
+// dispatch. Every kernel keeps a scalar path for other targets and as the
+// reference the vector paths are benchmarked against.
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#define FLUTTER_ZOOM_SDK_SSE2 1
+#include <emmintrin.h>
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define FLUTTER_ZOOM_SDK_NEON 1
+#include <arm_neon.h>
+#endif
+
+#endif  // FLUTTER_PLUGIN_MEDIA_SIMD_H_
@@ -0,0 +1,105 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_SPSC_RING_H_
+#define FLUTTER_PLUGIN_MEDIA_SPSC_RING_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace flutter_zoom_sdk {
+
+	// Lock-free single-producer/single-consumer ring of trivially copyable
+	// elements. The producer is an SDK callback thread, the consumer a plugin
+	// worker, so neither side ever blocks the other. Capacity is rounded up to a
+	// power of two and the read/write counters run freely, which keeps the full
+	// and empty cases distinct without sacrificing a slot.
+	template <typename T>
+	class SpscRing {
+		static_assert(std::is_trivially_copyable<T>::value, "SpscRing stores raw elements");
+
+	public:
+		explicit SpscRing(size_t minCapacity) {
+			capacity_ = 1;
+			while (capacity_ < minCapacity) {
+				capacity_ <<= 1;
+			}
+			mask_ = capacity_ - 1;
+			data_ = std::make_unique<T[]>(capacity_);
+		}
+
+		SpscRing(const SpscRing&) = delete;
+		SpscRing& operator=(const SpscRing&) = delete;
+
+		size_t capacity() const { return capacity_; }
+
+		size_t readAvailable() const {
+			return writePos_.load(std::memory_order_acquire) - readPos_.load(std::memory_order_acquire);
+		}
+
+		size_t writeAvailable() const {
+			return capacity_ - readAvailable();
+		}
+
+		// Producer side. Writes as many elements as fit and returns that count.
+		size_t write(const T* src, size_t count) {
+			const size_t w = writePos_.load(std::memory_order_relaxed);
+			const size_t r = readPos_.load(std::memory_order_acquire);
+			count = std::min(count, capacity_ - (w - r));
+			copyIn(w, src, count);
+			writePos_.store(w + count, std::memory_order_release);
+			return count;
+		}
+
+		// Consumer side. Reads up to count elements and returns how many were read.
+		size_t read(T* dst, size_t count) {
+			count = peek(dst, count);
+			readPos_.store(readPos_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+			return count;
+		}
+
+		// Consumer side. Copies without consuming.
+		size_t peek(T* dst, size_t count) const {
+			const size_t r = readPos_.load(std::memory_order_relaxed);
+			const size_t w = writePos_.load(std::memory_order_acquire);
+			count = std::min(count, w - r);
+			copyOut(r, dst, count);
+			return count;
+		}
+
+		// Consumer side. Drops up to count elements.
+		size_t skip(size_t count) {
+			const size_t r = readPos_.load(std::memory_order_relaxed);
+			count = std::min(count, writePos_.load(std::memory_order_acquire) - r);
+			readPos_.store(r + count, std::memory_order_release);
+			return count;
+		}
+
+	private:
+		void copyIn(size_t pos, const T* src, size_t count) {
+			const size_t offset = pos & mask_;
+			const size_t first = std::min(count, capacity_ - offset);
+			std::memcpy(data_.get() + offset, src, first * sizeof(T));
+			std::memcpy(data_.get(), src + first, (count - first) * sizeof(T));
+		}
+
+		void copyOut(size_t pos, T* dst, size_t count) const {
+			const size_t offset = pos & mask_;
+			const size_t first = std::min(count, capacity_ - offset);
+			std::memcpy(dst, data_.get() + offset, first * sizeof(T));
+			std::memcpy(dst + first, data_.get(), (count - first) * sizeof(T));
+		}
+
+		size_t capacity_;
+		size_t mask_;
+		std::unique_ptr<T[]> data_;
+
+		// Separate cache lines so producer and consumer do not false-share.
+		alignas(64) std::atomic<size_t> writePos_{ 0 };
+		alignas(64) std::atomic<size_t> readPos_{ 0 };
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_SPSC_RING_H_
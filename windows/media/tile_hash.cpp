@@ -0,0 +1,104 @@
+#include "media/tile_hash.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr uint64_t kMultiplier = 0x9E3779B97F4A7C15ull;
+		constexpr int kMinTileSize = 8;
+
+		inline uint64_t mix(uint64_t h, uint64_t v) {
+			h = (h ^ v) * kMultiplier;
+			return h ^ (h >> 29);
+		}
+
+		inline uint64_t load64(const uint8_t* p) {
+			uint64_t v;
+			std::memcpy(&v, p, sizeof(v));
+			return v;
+		}
+
+		// Folds count bytes into h. Four independent lanes keep the multiplies
+		// from serializing.
+		uint64_t hashBytes(uint64_t h, const uint8_t* p, size_t count) {
+			uint64_t lanes[4] = { h, h + 1, h + 2, h + 3 };
+			size_t i = 0;
+			for (; i + 32 <= count; i += 32) {
+				lanes[0] = mix(lanes[0], load64(p + i));
+				lanes[1] = mix(lanes[1], load64(p + i + 8));
+				lanes[2] = mix(lanes[2], load64(p + i + 16));
+				lanes[3] = mix(lanes[3], load64(p + i + 24));
+			}
+			for (; i + 8 <= count; i += 8) {
+				lanes[0] = mix(lanes[0], load64(p + i));
+			}
+			uint64_t tail = 0;
+			std::memcpy(&tail, p + i, count - i);
+			lanes[1] = mix(lanes[1], tail ^ (static_cast<uint64_t>(count) << 56));
+			return mix(mix(lanes[0], lanes[1]), mix(lanes[2], lanes[3]));
+		}
+	}
+
+	uint64_t HashPlane(const uint8_t* pixels, int stride, int width, int height, int rowStep) {
+		uint64_t h = static_cast<uint64_t>(width) << 32 | static_cast<uint32_t>(height);
+		for (int y = 0; y < height; y += std::max(rowStep, 1)) {
+			h = hashBytes(h, pixels + static_cast<size_t>(y) * stride, static_cast<size_t>(width));
+		}
+		return h;
+	}
+
+	TileHasher::TileHasher(int tileSize)
+		: tileSize_(std::max(tileSize, kMinTileSize)), width_(0), height_(0), bytesPerPixel_(0) {}
+
+	void TileHasher::reset() {
+		width_ = 0;
+		height_ = 0;
+		bytesPerPixel_ = 0;
+		hashes_.clear();
+	}
+
+	size_t TileHasher::update(const uint8_t* pixels, int stride, int width, int height, int bytesPerPixel) {
+		const int columns = (width + tileSize_ - 1) / tileSize_;
+		const int rows = (height + tileSize_ - 1) / tileSize_;
+		const bool resized = width != width_ || height != height_ || bytesPerPixel != bytesPerPixel_;
+		if (resized) {
+			width_ = width;
+			height_ = height;
+			bytesPerPixel_ = bytesPerPixel;
+			hashes_.assign(static_cast<size_t>(columns) * rows, 0);
+		}
+		row_.resize(columns);
+
+		size_t changed = 0;
+		for (int tileRow = 0; tileRow < rows; tileRow++) {
+			for (int column = 0; column < columns; column++) {
+				row_[column] = static_cast<uint64_t>(tileRow * columns + column);
+			}
+
+			// Rows of pixels in order, each split across the tiles it crosses.
+			const int top = tileRow * tileSize_;
+			const int bottom = std::min(top + tileSize_, height);
+			for (int y = top; y < bottom; y++) {
+				const uint8_t* line = pixels + static_cast<size_t>(y) * stride;
+				for (int column = 0; column < columns; column++) {
+					const int left = column * tileSize_;
+					const int right = std::min(left + tileSize_, width);
+					row_[column] = hashBytes(row_[column], line + static_cast<size_t>(left) * bytesPerPixel,
+						static_cast<size_t>(right - left) * bytesPerPixel);
+				}
+			}
+
+			uint64_t* previous = hashes_.data() + static_cast<size_t>(tileRow) * columns;
+			for (int column = 0; column < columns; column++) {
+				if (resized || previous[column] != row_[column]) {
+					changed++;
+				}
+				previous[column] = row_[column];
+			}
+		}
+		return changed;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,41 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_TILE_HASH_H_
+#define FLUTTER_PLUGIN_MEDIA_TILE_HASH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	// One hash of a whole plane, reading every rowStep-th row. Enough to
+	// tell a repeated frame from a new one at a fraction of a copy's cost.
+	uint64_t HashPlane(const uint8_t* pixels, int stride, int width, int height, int rowStep = 1);
+
+	// Detects which parts of an image changed between calls by hashing it in
+	// square tiles, without keeping a copy of the previous image.
+	class TileHasher {
+	public:
+		// tileSize in pixels, at least 8.
+		explicit TileHasher(int tileSize = 32);
+
+		// Hashes the image and returns how many tiles differ from the previous
+		// call; every tile after reset() or a size change.
+		size_t update(const uint8_t* pixels, int stride, int width, int height, int bytesPerPixel);
+
+		void reset();
+
+		size_t tileCount() const { return hashes_.size(); }
+
+	private:
+		int tileSize_;
+		int width_;
+		int height_;
+		int bytesPerPixel_;
+		std::vector<uint64_t> hashes_;
+		// Per-tile hashes of the current image, built a row of tiles at a time.
+		std::vector<uint64_t> row_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_TILE_HASH_H_
@@ -0,0 +1,98 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_TIMESTAMPED_AUDIO_RING_H_
+#define FLUTTER_PLUGIN_MEDIA_TIMESTAMPED_AUDIO_RING_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "media/audio_stream.h"
+#include "media/spsc_ring.h"
+
+namespace flutter_zoom_sdk {
+
+	// SPSC sample ring that remembers the SDK timestamp of each callback, so the
+	// consumer can tell the time of any sample it reads. The producer pushes
+	// whole AudioFrames; the consumer reads, skips and asks for the timestamp of
+	// the next unread sample.
+	class TimestampedAudioRing {
+	public:
+		explicit TimestampedAudioRing(size_t capacitySamples, size_t capacityMarks = 256)
+			: samples_(capacitySamples), marks_(capacityMarks) {}
+
+		// Producer side. Returns false if samples had to be dropped.
+		bool write(const AudioFrame& frame) {
+			sampleRate_.store(frame.sampleRate, std::memory_order_relaxed);
+			channels_.store(frame.channels, std::memory_order_relaxed);
+
+			const Mark mark{ written_, frame.timestamp };
+			marks_.write(&mark, 1);
+
+			const size_t accepted = samples_.write(frame.samples, frame.sampleCount);
+			written_ += accepted;
+			if (accepted < frame.sampleCount) {
+				dropped_.fetch_add(static_cast<uint32_t>(frame.sampleCount - accepted), std::memory_order_relaxed);
+				return false;
+			}
+			return true;
+		}
+
+		uint32_t sampleRate() const { return sampleRate_.load(std::memory_order_relaxed); }
+
+		uint32_t channels() const { return channels_.load(std::memory_order_relaxed); }
+
+		// Samples dropped by the producer since the last call.
+		uint32_t takeDropped() { return dropped_.exchange(0, std::memory_order_relaxed); }
+
+		// Consumer side.
+		size_t available() const { return samples_.readAvailable(); }
+
+		size_t read(int16_t* dst, size_t count) {
+			count = samples_.read(dst, count);
+			consumed_ += count;
+			return count;
+		}
+
+		size_t skip(size_t count) {
+			count = samples_.skip(count);
+			consumed_ += count;
+			return count;
+		}
+
+		// Timestamp in milliseconds of the next sample read() would return,
+		// interpolated from the newest callback mark at or before it.
+		uint64_t frontTimestamp() {
+			Mark next;
+			while (marks_.peek(&next, 1) == 1 && next.sampleIndex <= consumed_) {
+				lastMark_ = next;
+				marks_.skip(1);
+			}
+
+			const uint64_t samplesPerSecond = static_cast<uint64_t>(sampleRate()) * channels();
+			if (samplesPerSecond == 0) {
+				return lastMark_.timestamp;
+			}
+			return lastMark_.timestamp + (consumed_ - lastMark_.sampleIndex) * 1000 / samplesPerSecond;
+		}
+
+	private:
+		struct Mark {
+			uint64_t sampleIndex;
+			uint64_t timestamp;
+		};
+
+		SpscRing<int16_t> samples_;
+		SpscRing<Mark> marks_;
+		std::atomic<uint32_t> sampleRate_{ 0 };
+		std::atomic<uint32_t> channels_{ 1 };
+		std::atomic<uint32_t> dropped_{ 0 };
+
+		// Producer-owned.
+		uint64_t written_ = 0;
+		// Consumer-owned.
+		uint64_t consumed_ = 0;
+		Mark lastMark_{ 0, 0 };
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_TIMESTAMPED_AUDIO_RING_H_
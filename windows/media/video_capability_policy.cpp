@@ -0,0 +1,224 @@
+#include "media/video_capability_policy.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// Used when a capability has no rate.
+		constexpr uint32_t kDefaultFps = 30;
+		constexpr uint32_t kMaxFps = 60;
+		// Until the first frame is measured: bilinear scaling plus the SDK's
+		// copy on a typical desktop core.
+		constexpr double kInitialNanosecondsPerPixel = 3.0;
+		constexpr double kCostGain = 1.0 / 16;
+		// Stepping up to a larger capability needs this much CPU headroom, so
+		// a load near the budget does not flip between two sizes.
+		constexpr double kStepUpHeadroom = 0.85;
+		// Packet loss, in percent, that counts as congested and as clean.
+		constexpr float kLossyPercent = 8.0f;
+		constexpr float kCleanPercent = 2.0f;
+		// Consecutive statistics samples before the network limit moves.
+		constexpr uint32_t kLossySamples = 2;
+		constexpr uint32_t kUnderfedSamples = 3;
+		constexpr uint32_t kCleanSamples = 8;
+		// A network limit above 4K is no limit.
+		constexpr uint64_t kUnlimitedArea = 3840ull * 2160;
+
+		uint64_t area(const ZOOM_SDK_NAMESPACE::VideoSourceCapability& capability) {
+			return static_cast<uint64_t>(capability.width) * capability.height;
+		}
+	}
+
+	const char* VideoCapabilityLimitName(VideoCapabilityLimit limit) {
+		switch (limit) {
+		case VideoCapabilityLimit::Suggested:
+			return "suggested";
+		case VideoCapabilityLimit::Source:
+			return "source";
+		case VideoCapabilityLimit::Budget:
+			return "budget";
+		case VideoCapabilityLimit::Cpu:
+			return "cpu";
+		case VideoCapabilityLimit::Network:
+			return "network";
+		default:
+			return "none";
+		}
+	}
+
+	VideoCapabilityPolicy::VideoCapabilityPolicy()
+		: nanosecondsPerPixel_(kInitialNanosecondsPerPixel),
+		measured_(false),
+		networkLimit_(0),
+		lossySamples_(0),
+		cleanSamples_(0),
+		underfedSamples_(0) {}
+
+	void VideoCapabilityPolicy::setBudget(const VideoCapabilityBudget& budget) {
+		budget_ = budget;
+	}
+
+	void VideoCapabilityPolicy::recordSendCost(uint32_t width, uint32_t height, std::chrono::microseconds cost) {
+		const uint64_t pixels = static_cast<uint64_t>(width) * height;
+		if (pixels == 0) {
+			return;
+		}
+
+		const double sample = static_cast<double>(cost.count()) * 1000.0 / static_cast<double>(pixels);
+		nanosecondsPerPixel_ = measured_ ? nanosecondsPerPixel_ + (sample - nanosecondsPerPixel_) * kCostGain : sample;
+		measured_ = true;
+	}
+
+	bool VideoCapabilityPolicy::recordStatistics(const VideoSendStatistics& statistics,
+		const ZOOM_SDK_NAMESPACE::VideoSourceCapability& current) {
+		const uint64_t currentArea = area(current);
+		const uint64_t sentArea = static_cast<uint64_t>(statistics.width) * statistics.height;
+
+		if (statistics.packetLossPercent >= kLossyPercent) {
+			lossySamples_++;
+			cleanSamples_ = 0;
+		}
+		else if (statistics.packetLossPercent <= kCleanPercent) {
+			lossySamples_ = 0;
+			cleanSamples_++;
+		}
+		else {
+			lossySamples_ = 0;
+			cleanSamples_ = 0;
+		}
+		// The SDK encodes well below what it is fed when it is short of
+		// bandwidth; anything larger is scaled for nothing.
+		underfedSamples_ = sentArea > 0 && sentArea * 4 < currentArea * 3 ? underfedSamples_ + 1 : 0;
+
+		// Congestion only lowers the limit; a run of clean samples doubles it.
+		uint64_t limit = networkLimit_;
+		const auto lower = [&limit](uint64_t area) {
+			limit = limit == 0 ? area : std::min(limit, area);
+		};
+		if (lossySamples_ >= kLossySamples && currentArea > 0) {
+			lower(currentArea / 2);
+			lossySamples_ = 0;
+		}
+		else if (underfedSamples_ >= kUnderfedSamples) {
+			lower(sentArea);
+			underfedSamples_ = 0;
+		}
+		else if (cleanSamples_ >= kCleanSamples && networkLimit_ > 0) {
+			limit = networkLimit_ * 2 >= kUnlimitedArea ? 0 : networkLimit_ * 2;
+			cleanSamples_ = 0;
+		}
+
+		const bool changed = limit != networkLimit_;
+		networkLimit_ = limit;
+		return changed;
+	}
+
+	VideoCapabilityChoice VideoCapabilityPolicy::choose(
+		const std::vector<ZOOM_SDK_NAMESPACE::VideoSourceCapability>& capabilities,
+		const ZOOM_SDK_NAMESPACE::VideoSourceCapability& suggested,
+		int sourceWidth, int sourceHeight, double sourceFps,
+		const ZOOM_SDK_NAMESPACE::VideoSourceCapability& current) const {
+		const uint64_t sourceArea = sourceWidth > 0 && sourceHeight > 0
+			? static_cast<uint64_t>(sourceWidth) * sourceHeight : 0;
+
+		struct Candidate {
+			ZOOM_SDK_NAMESPACE::VideoSourceCapability capability;
+			uint32_t sentFps;
+			double cpuPercent;
+			int64_t score;
+			VideoCapabilityLimit excludedBy;
+		};
+
+		std::vector<Candidate> candidates;
+		candidates.reserve(capabilities.size());
+		for (const auto& offered : capabilities) {
+			if (area(offered) == 0) {
+				continue;
+			}
+
+			Candidate candidate;
+			candidate.capability = offered;
+			uint32_t fps = offered.frame > 0 ? offered.frame : kDefaultFps;
+			if (budget_.maxFps > 0) {
+				fps = std::min(fps, budget_.maxFps);
+			}
+			fps = std::clamp<uint32_t>(fps, 1, kMaxFps);
+			candidate.capability.frame = fps;
+			candidate.sentFps = sourceFps > 0.0
+				? std::min(fps, static_cast<uint32_t>(std::ceil(sourceFps))) : fps;
+
+			const uint64_t pixels = area(offered);
+			const uint64_t delivered = sourceArea > 0 ? std::min(pixels, sourceArea) : pixels;
+			candidate.score = (static_cast<int64_t>(delivered) - static_cast<int64_t>(pixels - delivered)) * candidate.sentFps;
+			candidate.cpuPercent = nanosecondsPerPixel_ * static_cast<double>(pixels) * candidate.sentFps / 1e7;
+
+			const double cpuAllowed = pixels > area(current) ? budget_.cpuPercent * kStepUpHeadroom : budget_.cpuPercent;
+			if ((budget_.maxWidth > 0 && offered.width > budget_.maxWidth)
+				|| (budget_.maxHeight > 0 && offered.height > budget_.maxHeight)) {
+				candidate.excludedBy = VideoCapabilityLimit::Budget;
+			}
+			else if (area(suggested) > 0 && pixels > area(suggested)) {
+				candidate.excludedBy = VideoCapabilityLimit::Suggested;
+			}
+			else if (networkLimit_ > 0 && pixels > networkLimit_) {
+				candidate.excludedBy = VideoCapabilityLimit::Network;
+			}
+			else if (budget_.cpuPercent > 0 && candidate.cpuPercent > cpuAllowed) {
+				candidate.excludedBy = VideoCapabilityLimit::Cpu;
+			}
+			else {
+				candidate.excludedBy = VideoCapabilityLimit::None;
+			}
+			candidates.push_back(candidate);
+		}
+
+		VideoCapabilityChoice choice;
+		if (candidates.empty()) {
+			choice.capability = suggested;
+			choice.limit = VideoCapabilityLimit::Suggested;
+			return choice;
+		}
+
+		// Highest score; on a tie the cheaper one.
+		const Candidate* best = nullptr;
+		for (const Candidate& candidate : candidates) {
+			if (candidate.excludedBy == VideoCapabilityLimit::None
+				&& (!best || candidate.score > best->score
+					|| (candidate.score == best->score && candidate.cpuPercent < best->cpuPercent))) {
+				best = &candidate;
+			}
+		}
+
+		if (!best) {
+			for (const Candidate& candidate : candidates) {
+				if (!best || candidate.cpuPercent < best->cpuPercent) {
+					best = &candidate;
+				}
+			}
+			choice.capability = best->capability;
+			choice.limit = best->excludedBy;
+			choice.predictedCpuPercent = best->cpuPercent;
+			return choice;
+		}
+
+		// The reason is whatever kept the next size up from being used.
+		const Candidate* nextUp = nullptr;
+		for (const Candidate& candidate : candidates) {
+			if (area(candidate.capability) > area(best->capability)
+				&& (!nextUp || area(candidate.capability) < area(nextUp->capability))) {
+				nextUp = &candidate;
+			}
+		}
+
+		choice.capability = best->capability;
+		choice.predictedCpuPercent = best->cpuPercent;
+		if (nextUp) {
+			choice.limit = nextUp->excludedBy == VideoCapabilityLimit::None
+				? VideoCapabilityLimit::Source : nextUp->excludedBy;
+		}
+		return choice;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,104 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_VIDEO_CAPABILITY_POLICY_H_
+#define FLUTTER_PLUGIN_MEDIA_VIDEO_CAPABILITY_POLICY_H_
+
+#include <rawdata/rawdata_video_source_helper_interface.h>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	// Limits set by the app. 0 leaves a limit out.
+	struct VideoCapabilityBudget {
+		// Share of one core the sender may spend scaling and sending, in
+		// percent.
+		uint32_t cpuPercent = 0;
+		uint32_t maxWidth = 0;
+		uint32_t maxHeight = 0;
+		uint32_t maxFps = 0;
+	};
+
+	// What the SDK reports about the video it sends, from
+	// QueryVideoStatisticInfo.
+	struct VideoSendStatistics {
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t fps = 0;
+		float packetLossPercent = 0.0f;
+	};
+
+	// Why nothing larger was chosen.
+	enum class VideoCapabilityLimit {
+		// The largest capability offered was chosen.
+		None,
+		Suggested,
+		Source,
+		Budget,
+		Cpu,
+		Network,
+	};
+
+	const char* VideoCapabilityLimitName(VideoCapabilityLimit limit);
+
+	struct VideoCapabilityChoice {
+		ZOOM_SDK_NAMESPACE::VideoSourceCapability capability;
+		VideoCapabilityLimit limit = VideoCapabilityLimit::None;
+		// Expected sender load at the chosen size and rate.
+		double predictedCpuPercent = 0.0;
+	};
+
+	// Picks the capability to send from those the SDK offers. Capabilities
+	// larger than the SDK's suggestion, the app's budget or what the network
+	// currently carries are ruled out, as are those whose predicted cost
+	// exceeds the CPU budget. Of the rest, the one delivering the most source
+	// pixels per second wins; upscaling past the source's native size or
+	// sending faster than its native rate counts against a capability rather
+	// than for it. When everything is ruled out the cheapest capability is
+	// used.
+	//
+	// The cost model is linear in pixels sent per second, calibrated from the
+	// measured cost of the frames actually sent. Network limits step down by
+	// half the area on sustained packet loss or when the SDK encodes smaller
+	// than it is fed, and step back up after a run of clean samples.
+	class VideoCapabilityPolicy {
+	public:
+		VideoCapabilityPolicy();
+
+		void setBudget(const VideoCapabilityBudget& budget);
+
+		const VideoCapabilityBudget& budget() const { return budget_; }
+
+		// Cost of scaling and sending one frame of the given size.
+		void recordSendCost(uint32_t width, uint32_t height, std::chrono::microseconds cost);
+
+		// Returns true when the network limit changed.
+		bool recordStatistics(const VideoSendStatistics& statistics, const ZOOM_SDK_NAMESPACE::VideoSourceCapability& current);
+
+		// Mean measured cost per sent pixel.
+		double nanosecondsPerPixel() const { return nanosecondsPerPixel_; }
+
+		// Largest area the network currently carries; 0 is unlimited.
+		uint64_t networkLimit() const { return networkLimit_; }
+
+		// A source size or rate of 0 is unknown and does not limit the choice.
+		// current is the capability in use, which larger ones must beat with
+		// some CPU headroom to spare.
+		VideoCapabilityChoice choose(const std::vector<ZOOM_SDK_NAMESPACE::VideoSourceCapability>& capabilities,
+			const ZOOM_SDK_NAMESPACE::VideoSourceCapability& suggested,
+			int sourceWidth, int sourceHeight, double sourceFps,
+			const ZOOM_SDK_NAMESPACE::VideoSourceCapability& current) const;
+
+	private:
+		VideoCapabilityBudget budget_;
+		double nanosecondsPerPixel_;
+		bool measured_;
+		uint64_t networkLimit_;
+		uint32_t lossySamples_;
+		uint32_t cleanSamples_;
+		uint32_t underfedSamples_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_VIDEO_CAPABILITY_POLICY_H_
@@ -0,0 +1,123 @@
+#include "media/video_filter_chain.h"
+
+#include <algorithm>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		using Clock = std::chrono::steady_clock;
+
+		uint32_t elapsedUs(Clock::time_point start, Clock::time_point end) {
+			return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+		}
+	}
+
+	VideoFilterChain::VideoFilterChain(std::chrono::microseconds budget)
+		: budgetUs_(static_cast<uint32_t>(budget.count())),
+		frames_(0),
+		totalUs_(0),
+		lastUs_(0),
+		maxUs_(0),
+		overBudget_(0),
+		width_(0),
+		height_(0) {}
+
+	void VideoFilterChain::setFilters(std::vector<std::unique_ptr<IVideoFilter>> filters) {
+		std::vector<Slot> slots(filters.size());
+		for (size_t i = 0; i < filters.size(); i++) {
+			slots[i].filter = std::move(filters[i]);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			slots_.swap(slots);
+			frames_ = 0;
+			totalUs_ = 0;
+			lastUs_ = 0;
+			maxUs_ = 0;
+			overBudget_ = 0;
+		}
+		// The old filters are destroyed here, outside the lock.
+	}
+
+	void VideoFilterChain::setBudget(std::chrono::microseconds budget) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		budgetUs_ = static_cast<uint32_t>(budget.count());
+	}
+
+	bool VideoFilterChain::empty() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return slots_.empty();
+	}
+
+	VideoFilterChainStats VideoFilterChain::stats() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		VideoFilterChainStats stats;
+		stats.frames = frames_;
+		stats.lastUs = lastUs_;
+		stats.meanUs = frames_ > 0 ? static_cast<uint32_t>(totalUs_ / frames_) : 0;
+		stats.maxUs = maxUs_;
+		stats.budgetUs = budgetUs_;
+		stats.overBudget = overBudget_;
+		stats.width = width_;
+		stats.height = height_;
+		for (const auto& slot : slots_) {
+			VideoFilterTiming timing;
+			timing.name = slot.filter->name();
+			timing.lastUs = slot.lastUs;
+			timing.meanUs = frames_ > 0 ? static_cast<uint32_t>(slot.totalUs / frames_) : 0;
+			timing.maxUs = slot.maxUs;
+			stats.filters.push_back(timing);
+		}
+		return stats;
+	}
+
+	void VideoFilterChain::process(const I420Planes& frame, bool limitedRange) {
+		if (!frame.y || !frame.u || !frame.v || frame.width <= 0 || frame.height <= 0) {
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (slots_.empty()) {
+			return;
+		}
+
+		const Clock::time_point start = Clock::now();
+		Clock::time_point stageStart = start;
+		for (auto& slot : slots_) {
+			slot.filter->apply(frame, limitedRange);
+
+			const Clock::time_point stageEnd = Clock::now();
+			slot.lastUs = elapsedUs(stageStart, stageEnd);
+			slot.totalUs += slot.lastUs;
+			slot.maxUs = std::max(slot.maxUs, slot.lastUs);
+			stageStart = stageEnd;
+		}
+
+		frames_++;
+		lastUs_ = elapsedUs(start, stageStart);
+		totalUs_ += lastUs_;
+		maxUs_ = std::max(maxUs_, lastUs_);
+		overBudget_ += lastUs_ > budgetUs_ ? 1 : 0;
+		width_ = static_cast<uint32_t>(frame.width);
+		height_ = static_cast<uint32_t>(frame.height);
+	}
+
+	void VideoFilterChain::onPreProcessRawData(YUVProcessDataI420* rawData) {
+		if (!rawData) {
+			return;
+		}
+
+		I420Planes frame;
+		frame.y = reinterpret_cast<uint8_t*>(rawData->GetYBuffer());
+		frame.u = reinterpret_cast<uint8_t*>(rawData->GetUBuffer());
+		frame.v = reinterpret_cast<uint8_t*>(rawData->GetVBuffer());
+		frame.strideY = static_cast<int>(rawData->GetYStride());
+		frame.strideU = static_cast<int>(rawData->GetUStride());
+		frame.strideV = static_cast<int>(rawData->GetVStride());
+		frame.width = static_cast<int>(rawData->GetWidth());
+		frame.height = static_cast<int>(rawData->GetHeight());
+		process(frame, rawData->IsLimitedI420());
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,89 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_VIDEO_FILTER_CHAIN_H_
+#define FLUTTER_PLUGIN_MEDIA_VIDEO_FILTER_CHAIN_H_
+
+#include <rawdata/rawdata_video_source_helper_interface.h>
+#include <zoom_sdk_raw_data_def.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "media/i420_image.h"
+#include "media/video_filters.h"
+
+namespace flutter_zoom_sdk {
+
+	struct VideoFilterTiming {
+		std::string name;
+		uint32_t lastUs = 0;
+		uint32_t meanUs = 0;
+		uint32_t maxUs = 0;
+	};
+
+	struct VideoFilterChainStats {
+		uint64_t frames = 0;
+		// Whole chain.
+		uint32_t lastUs = 0;
+		uint32_t meanUs = 0;
+		uint32_t maxUs = 0;
+		uint32_t budgetUs = 0;
+		// Frames the chain took longer than the budget on.
+		uint64_t overBudget = 0;
+		uint32_t width = 0;
+		uint32_t height = 0;
+		std::vector<VideoFilterTiming> filters;
+	};
+
+	// Runs filters in order, in place, on each camera frame before it is
+	// encoded (setPreProcessor). Each filter is timed separately so a chain
+	// that no longer fits the frame budget shows which stage to drop.
+	class VideoFilterChain : public ZOOM_SDK_NAMESPACE::IZoomSDKPreProcessor {
+	public:
+		// The default budget is a quarter of a 30 fps frame, leaving the rest
+		// to capture and encoding.
+		explicit VideoFilterChain(std::chrono::microseconds budget = std::chrono::microseconds(8333));
+
+		VideoFilterChain(const VideoFilterChain&) = delete;
+		VideoFilterChain& operator=(const VideoFilterChain&) = delete;
+
+		// Replaces the filters and resets the statistics. Waits for a frame in
+		// progress.
+		void setFilters(std::vector<std::unique_ptr<IVideoFilter>> filters);
+
+		void setBudget(std::chrono::microseconds budget);
+
+		bool empty();
+
+		VideoFilterChainStats stats();
+
+		// Runs the chain on planes the caller owns.
+		void process(const I420Planes& frame, bool limitedRange);
+
+		void onPreProcessRawData(YUVProcessDataI420* rawData) override;
+
+	private:
+		struct Slot {
+			std::unique_ptr<IVideoFilter> filter;
+			uint64_t totalUs = 0;
+			uint32_t lastUs = 0;
+			uint32_t maxUs = 0;
+		};
+
+		std::mutex mutex_;
+		std::vector<Slot> slots_;
+		uint32_t budgetUs_;
+		uint64_t frames_;
+		uint64_t totalUs_;
+		uint32_t lastUs_;
+		uint32_t maxUs_;
+		uint64_t overBudget_;
+		uint32_t width_;
+		uint32_t height_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_VIDEO_FILTER_CHAIN_H_
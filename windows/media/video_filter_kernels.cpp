@@ -0,0 +1,306 @@
+#include "media/video_filter_kernels.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "media/simd.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		inline uint8_t affine(uint8_t p, int gainQ10, int pivot, int offset, uint8_t low, uint8_t high) {
+			const int value = (((p - pivot) * gainQ10) >> 10) + pivot + offset;
+			return static_cast<uint8_t>(std::clamp(value, static_cast<int>(low), static_cast<int>(high)));
+		}
+
+		inline uint8_t box3(int a, int b, int c) {
+			// Rounded (a + b + c) / 3, in the form the vector paths compute it.
+			return static_cast<uint8_t>((((a + b + c) * 43691 >> 16) + 1) >> 1);
+		}
+
+		inline uint8_t gaussian3(int a, int b, int c) {
+			return static_cast<uint8_t>((a + 2 * b + c + 2) >> 2);
+		}
+
+		inline uint8_t blend(int dst, int src, int alpha) {
+			const int t = dst * (255 - alpha) + src * alpha + 128;
+			return static_cast<uint8_t>((t + (t >> 8)) >> 8);
+		}
+
+		// Applies the 3-tap kernel to a, b and c, count bytes, into out.
+		void blurRow(const uint8_t* a, const uint8_t* b, const uint8_t* c, uint8_t* out, int count,
+			BlurKernel kernel, bool vectorized) {
+			int x = 0;
+
+#if defined(FLUTTER_ZOOM_SDK_SSE2)
+			if (vectorized) {
+				const __m128i zero = _mm_setzero_si128();
+				const __m128i two = _mm_set1_epi16(2);
+				const __m128i one = _mm_set1_epi16(1);
+				const __m128i third = _mm_set1_epi16(static_cast<short>(43691));
+				for (; x + 16 <= count; x += 16) {
+					const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + x));
+					const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + x));
+					const __m128i vc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c + x));
+					__m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(va, zero), _mm_unpacklo_epi8(vc, zero));
+					__m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(va, zero), _mm_unpackhi_epi8(vc, zero));
+					const __m128i blo = _mm_unpacklo_epi8(vb, zero);
+					const __m128i bhi = _mm_unpackhi_epi8(vb, zero);
+					if (kernel == BlurKernel::Gaussian) {
+						lo = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(lo, _mm_slli_epi16(blo, 1)), two), 2);
+						hi = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(hi, _mm_slli_epi16(bhi, 1)), two), 2);
+					}
+					else {
+						lo = _mm_srli_epi16(_mm_add_epi16(_mm_mulhi_epu16(_mm_add_epi16(lo, blo), third), one), 1);
+						hi = _mm_srli_epi16(_mm_add_epi16(_mm_mulhi_epu16(_mm_add_epi16(hi, bhi), third), one), 1);
+					}
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), _mm_packus_epi16(lo, hi));
+				}
+			}
+#elif defined(FLUTTER_ZOOM_SDK_NEON)
+			if (vectorized) {
+				const uint16x4_t third = vdup_n_u16(43691);
+				for (; x + 16 <= count; x += 16) {
+					const uint8x16_t va = vld1q_u8(a + x);
+					const uint8x16_t vb = vld1q_u8(b + x);
+					const uint8x16_t vc = vld1q_u8(c + x);
+					uint16x8_t lo = vaddl_u8(vget_low_u8(va), vget_low_u8(vc));
+					uint16x8_t hi = vaddl_u8(vget_high_u8(va), vget_high_u8(vc));
+					uint8x8_t outLo;
+					uint8x8_t outHi;
+					if (kernel == BlurKernel::Gaussian) {
+						lo = vaddq_u16(lo, vshll_n_u8(vget_low_u8(vb), 1));
+						hi = vaddq_u16(hi, vshll_n_u8(vget_high_u8(vb), 1));
+						outLo = vrshrn_n_u16(lo, 2);
+						outHi = vrshrn_n_u16(hi, 2);
+					}
+					else {
+						lo = vaddw_u8(lo, vget_low_u8(vb));
+						hi = vaddw_u8(hi, vget_high_u8(vb));
+						const uint16x8_t qlo = vcombine_u16(
+							vshrn_n_u32(vmull_u16(vget_low_u16(lo), third), 16),
+							vshrn_n_u32(vmull_u16(vget_high_u16(lo), third), 16));
+						const uint16x8_t qhi = vcombine_u16(
+							vshrn_n_u32(vmull_u16(vget_low_u16(hi), third), 16),
+							vshrn_n_u32(vmull_u16(vget_high_u16(hi), third), 16));
+						outLo = vrshrn_n_u16(qlo, 1);
+						outHi = vrshrn_n_u16(qhi, 1);
+					}
+					vst1q_u8(out + x, vcombine_u8(outLo, outHi));
+				}
+			}
+#endif
+
+			if (kernel == BlurKernel::Gaussian) {
+				for (; x < count; x++) {
+					out[x] = gaussian3(a[x], b[x], c[x]);
+				}
+			}
+			else {
+				for (; x < count; x++) {
+					out[x] = box3(a[x], b[x], c[x]);
+				}
+			}
+		}
+	}
+
+	void AffinePlane(uint8_t* plane, int stride, int width, int height,
+		int gainQ10, int pivot, int offset, uint8_t low, uint8_t high, bool vectorized) {
+		gainQ10 = std::clamp(gainQ10, 0, 32767);
+
+		for (int row = 0; row < height; row++) {
+			uint8_t* p = plane + static_cast<size_t>(row) * stride;
+			int x = 0;
+
+#if defined(FLUTTER_ZOOM_SDK_SSE2)
+			if (vectorized) {
+				const __m128i zero = _mm_setzero_si128();
+				const __m128i vpivot = _mm_set1_epi16(static_cast<short>(pivot));
+				const __m128i vbias = _mm_set1_epi16(static_cast<short>(pivot + offset));
+				const __m128i vgain = _mm_set1_epi16(static_cast<short>(gainQ10));
+				const __m128i vlow = _mm_set1_epi8(static_cast<char>(low));
+				const __m128i vhigh = _mm_set1_epi8(static_cast<char>(high));
+				for (; x + 16 <= width; x += 16) {
+					const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + x));
+					// (d << 6) * g >> 16 is d * g >> 10, and d << 6 fits in 16 bits.
+					__m128i lo = _mm_slli_epi16(_mm_sub_epi16(_mm_unpacklo_epi8(v, zero), vpivot), 6);
+					__m128i hi = _mm_slli_epi16(_mm_sub_epi16(_mm_unpackhi_epi8(v, zero), vpivot), 6);
+					lo = _mm_add_epi16(_mm_mulhi_epi16(lo, vgain), vbias);
+					hi = _mm_add_epi16(_mm_mulhi_epi16(hi, vgain), vbias);
+					__m128i out = _mm_packus_epi16(lo, hi);
+					out = _mm_min_epu8(_mm_max_epu8(out, vlow), vhigh);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(p + x), out);
+				}
+			}
+#elif defined(FLUTTER_ZOOM_SDK_NEON)
+			if (vectorized) {
+				const int16x8_t vpivot = vdupq_n_s16(static_cast<int16_t>(pivot));
+				const int16x8_t vbias = vdupq_n_s16(static_cast<int16_t>(pivot + offset));
+				const int16x4_t vgain = vdup_n_s16(static_cast<int16_t>(gainQ10));
+				const uint8x16_t vlow = vdupq_n_u8(low);
+				const uint8x16_t vhigh = vdupq_n_u8(high);
+				for (; x + 16 <= width; x += 16) {
+					const uint8x16_t v = vld1q_u8(p + x);
+					const int16x8_t dlo = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(v))), vpivot);
+					const int16x8_t dhi = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(v))), vpivot);
+					const int16x8_t lo = vaddq_s16(vcombine_s16(
+						vshrn_n_s32(vmull_s16(vget_low_s16(dlo), vgain), 10),
+						vshrn_n_s32(vmull_s16(vget_high_s16(dlo), vgain), 10)), vbias);
+					const int16x8_t hi = vaddq_s16(vcombine_s16(
+						vshrn_n_s32(vmull_s16(vget_low_s16(dhi), vgain), 10),
+						vshrn_n_s32(vmull_s16(vget_high_s16(dhi), vgain), 10)), vbias);
+					uint8x16_t out = vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi));
+					out = vminq_u8(vmaxq_u8(out, vlow), vhigh);
+					vst1q_u8(p + x, out);
+				}
+			}
+#endif
+
+			for (; x < width; x++) {
+				p[x] = affine(p[x], gainQ10, pivot, offset, low, high);
+			}
+		}
+	}
+
+	void LookupPlane(uint8_t* plane, int stride, int width, int height, const uint8_t* lut, bool vectorized) {
+#if defined(FLUTTER_ZOOM_SDK_NEON)
+		uint8x16x4_t tables[4];
+		for (int t = 0; t < 4; t++) {
+			tables[t] = vld1q_u8_x4(lut + 64 * t);
+		}
+		const uint8x16_t step = vdupq_n_u8(64);
+#else
+		(void)vectorized;
+#endif
+
+		for (int row = 0; row < height; row++) {
+			uint8_t* p = plane + static_cast<size_t>(row) * stride;
+			int x = 0;
+
+#if defined(FLUTTER_ZOOM_SDK_NEON)
+			if (vectorized) {
+				for (; x + 16 <= width; x += 16) {
+					// Each lookup covers 64 entries; out-of-range indices keep the
+					// previous result.
+					uint8x16_t index = vld1q_u8(p + x);
+					uint8x16_t out = vqtbl4q_u8(tables[0], index);
+					for (int t = 1; t < 4; t++) {
+						index = vsubq_u8(index, step);
+						out = vqtbx4q_u8(out, tables[t], index);
+					}
+					vst1q_u8(p + x, out);
+				}
+			}
+#endif
+			// Four lookups per iteration already run at memory speed for a
+			// 256-entry table.
+			for (; x + 4 <= width; x += 4) {
+				const uint8_t a = lut[p[x]];
+				const uint8_t b = lut[p[x + 1]];
+				const uint8_t c = lut[p[x + 2]];
+				const uint8_t d = lut[p[x + 3]];
+				p[x] = a;
+				p[x + 1] = b;
+				p[x + 2] = c;
+				p[x + 3] = d;
+			}
+			for (; x < width; x++) {
+				p[x] = lut[p[x]];
+			}
+		}
+	}
+
+	bool LookupPlaneHasVectorPath() {
+#if defined(FLUTTER_ZOOM_SDK_NEON)
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	void BlurPlane(uint8_t* plane, int stride, int width, int height, BlurKernel kernel,
+		uint8_t* scratch, bool vectorized) {
+		if (width <= 0 || height <= 0) {
+			return;
+		}
+
+		// Horizontal: each row is copied with its edge pixels repeated, then
+		// filtered back into place.
+		uint8_t* padded = scratch;
+		for (int row = 0; row < height; row++) {
+			uint8_t* p = plane + static_cast<size_t>(row) * stride;
+			padded[0] = p[0];
+			std::memcpy(padded + 1, p, width);
+			padded[width + 1] = p[width - 1];
+			blurRow(padded, padded + 1, padded + 2, p, width, kernel, vectorized);
+		}
+
+		// Vertical: only the row above has been overwritten by the time a row
+		// is filtered, so one saved copy of it is enough.
+		uint8_t* above = scratch + width + 2;
+		uint8_t* current = above + width + 2;
+		std::memcpy(above, plane, width);
+		for (int row = 0; row < height; row++) {
+			uint8_t* p = plane + static_cast<size_t>(row) * stride;
+			const uint8_t* below = row + 1 < height ? p + stride : p;
+			std::memcpy(current, p, width);
+			blurRow(above, current, row + 1 < height ? below : current, p, width, kernel, vectorized);
+			std::swap(above, current);
+		}
+	}
+
+	void BlendPlane(uint8_t* dst, int dstStride, const uint8_t* src, int srcStride,
+		const uint8_t* alpha, int alphaStride, int width, int height, bool vectorized) {
+		for (int row = 0; row < height; row++) {
+			uint8_t* d = dst + static_cast<size_t>(row) * dstStride;
+			const uint8_t* s = src + static_cast<size_t>(row) * srcStride;
+			const uint8_t* a = alpha + static_cast<size_t>(row) * alphaStride;
+			int x = 0;
+
+#if defined(FLUTTER_ZOOM_SDK_SSE2)
+			if (vectorized) {
+				const __m128i zero = _mm_setzero_si128();
+				const __m128i max = _mm_set1_epi16(255);
+				const __m128i round = _mm_set1_epi16(128);
+				for (; x + 16 <= width; x += 16) {
+					const __m128i vd = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d + x));
+					const __m128i vs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + x));
+					const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + x));
+					__m128i out[2];
+					for (int half = 0; half < 2; half++) {
+						const __m128i d16 = half ? _mm_unpackhi_epi8(vd, zero) : _mm_unpacklo_epi8(vd, zero);
+						const __m128i s16 = half ? _mm_unpackhi_epi8(vs, zero) : _mm_unpacklo_epi8(vs, zero);
+						const __m128i a16 = half ? _mm_unpackhi_epi8(va, zero) : _mm_unpacklo_epi8(va, zero);
+						// At most 255 * 255 + 128, which fits in 16 unsigned bits.
+						__m128i t = _mm_add_epi16(_mm_mullo_epi16(d16, _mm_sub_epi16(max, a16)), _mm_mullo_epi16(s16, a16));
+						t = _mm_add_epi16(t, round);
+						out[half] = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+					}
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(d + x), _mm_packus_epi16(out[0], out[1]));
+				}
+			}
+#elif defined(FLUTTER_ZOOM_SDK_NEON)
+			if (vectorized) {
+				for (; x + 16 <= width; x += 16) {
+					const uint8x16_t vd = vld1q_u8(d + x);
+					const uint8x16_t vs = vld1q_u8(s + x);
+					const uint8x16_t va = vld1q_u8(a + x);
+					const uint8x16_t vinv = vmvnq_u8(va);
+					uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(vd), vget_low_u8(vinv)), vget_low_u8(vs), vget_low_u8(va));
+					uint16x8_t hi = vmlal_u8(vmull_u8(vget_high_u8(vd), vget_high_u8(vinv)), vget_high_u8(vs), vget_high_u8(va));
+					lo = vaddq_u16(lo, vdupq_n_u16(128));
+					hi = vaddq_u16(hi, vdupq_n_u16(128));
+					const uint8x8_t outLo = vshrn_n_u16(vsraq_n_u16(lo, lo, 8), 8);
+					const uint8x8_t outHi = vshrn_n_u16(vsraq_n_u16(hi, hi, 8), 8);
+					vst1q_u8(d + x, vcombine_u8(outLo, outHi));
+				}
+			}
+#endif
+
+			for (; x < width; x++) {
+				d[x] = blend(d[x], s[x], a[x]);
+			}
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
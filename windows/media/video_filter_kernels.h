@@ -0,0 +1,48 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_VIDEO_FILTER_KERNELS_H_
+#define FLUTTER_PLUGIN_MEDIA_VIDEO_FILTER_KERNELS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace flutter_zoom_sdk {
+
+	// In-place kernels on one 8-bit plane with a row stride. Every kernel has
+	// a scalar path, selected with vectorized = false, that produces the same
+	// bytes as the vector one, where there is one.
+
+	// Fixed-point gain: 1024 is unity.
+	constexpr int kUnityGainQ10 = 1024;
+
+	// p = clamp(((p - pivot) * gainQ10 >> 10) + pivot + offset, low, high).
+	// gainQ10 is at most 32767 (just under 32x).
+	void AffinePlane(uint8_t* plane, int stride, int width, int height,
+		int gainQ10, int pivot, int offset, uint8_t low, uint8_t high, bool vectorized = true);
+
+	// p = lut[p]. Vectorized only with NEON's table lookups: SSE2 has no byte
+	// shuffle, so elsewhere the flag is ignored.
+	void LookupPlane(uint8_t* plane, int stride, int width, int height, const uint8_t* lut, bool vectorized = true);
+
+	// Whether LookupPlane has a vector path on this target.
+	bool LookupPlaneHasVectorPath();
+
+	enum class BlurKernel {
+		// [1 1 1] / 3
+		Box,
+		// [1 2 1] / 4
+		Gaussian,
+	};
+
+	// Bytes of scratch BlurPlane needs for a plane width pixels wide.
+	inline size_t BlurScratchSize(int width) { return 3 * (static_cast<size_t>(width) + 2); }
+
+	// One separable 3x3 pass, with edge pixels repeated.
+	void BlurPlane(uint8_t* plane, int stride, int width, int height, BlurKernel kernel,
+		uint8_t* scratch, bool vectorized = true);
+
+	// dst = (dst * (255 - a) + src * a) / 255, rounded.
+	void BlendPlane(uint8_t* dst, int dstStride, const uint8_t* src, int srcStride,
+		const uint8_t* alpha, int alphaStride, int width, int height, bool vectorized = true);
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_VIDEO_FILTER_KERNELS_H_
@@ -0,0 +1,124 @@
+#include "media/video_filters.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr uint8_t kLimitedLumaLow = 16;
+		constexpr uint8_t kLimitedLumaHigh = 235;
+		constexpr int kMaxBlurPasses = 4;
+
+		void buildGammaLut(float gamma, uint8_t low, uint8_t high, uint8_t* lut) {
+			const float range = static_cast<float>(high - low);
+			for (int i = 0; i < 256; i++) {
+				const float normalized = std::clamp((i - low) / range, 0.0f, 1.0f);
+				lut[i] = static_cast<uint8_t>(std::lround(low + range * std::pow(normalized, 1.0f / gamma)));
+			}
+		}
+	}
+
+	BrightnessContrastFilter::BrightnessContrastFilter(float brightness, float contrast)
+		: brightness_(std::clamp(brightness, -1.0f, 1.0f)),
+		gainQ10_(static_cast<int>(std::lround(std::clamp(contrast, 0.0f, 4.0f) * kUnityGainQ10))) {}
+
+	void BrightnessContrastFilter::apply(const I420Planes& frame, bool limitedRange) {
+		const uint8_t low = limitedRange ? kLimitedLumaLow : 0;
+		const uint8_t high = limitedRange ? kLimitedLumaHigh : 255;
+		const int offset = static_cast<int>(std::lround(brightness_ * (high - low)));
+		AffinePlane(frame.y, frame.strideY, frame.width, frame.height, gainQ10_, 128, offset, low, high);
+	}
+
+	GammaFilter::GammaFilter(float gamma) {
+		gamma = std::clamp(gamma, 0.1f, 10.0f);
+		buildGammaLut(gamma, 0, 255, fullLut_);
+		buildGammaLut(gamma, kLimitedLumaLow, kLimitedLumaHigh, limitedLut_);
+	}
+
+	void GammaFilter::apply(const I420Planes& frame, bool limitedRange) {
+		LookupPlane(frame.y, frame.strideY, frame.width, frame.height, limitedRange ? limitedLut_ : fullLut_);
+	}
+
+	ChromaBlurFilter::ChromaBlurFilter(BlurKernel kernel, int passes)
+		: kernel_(kernel), passes_(std::clamp(passes, 1, kMaxBlurPasses)) {}
+
+	void ChromaBlurFilter::apply(const I420Planes& frame, bool limitedRange) {
+		const int width = I420ChromaWidth(frame.width);
+		const int height = I420ChromaHeight(frame.height);
+		// Grows to the largest frame seen, then stays.
+		if (scratch_.size() < BlurScratchSize(width)) {
+			scratch_.resize(BlurScratchSize(width));
+		}
+
+		for (int pass = 0; pass < passes_; pass++) {
+			BlurPlane(frame.u, frame.strideU, width, height, kernel_, scratch_.data());
+			BlurPlane(frame.v, frame.strideV, width, height, kernel_, scratch_.data());
+		}
+	}
+
+	WatermarkFilter::WatermarkFilter(const uint8_t* image, const uint8_t* alpha, int width, int height, int x, int y, float opacity)
+		: width_(width), height_(height), x_(x), y_(y),
+		image_(image, image + I420BufferSize(width, height)),
+		alpha_(static_cast<size_t>(width) * height) {
+		const int scale = static_cast<int>(std::lround(std::clamp(opacity, 0.0f, 1.0f) * 256));
+		for (size_t i = 0; i < alpha_.size(); i++) {
+			alpha_[i] = static_cast<uint8_t>((alpha[i] * scale + 128) >> 8);
+		}
+
+		const int chromaWidth = I420ChromaWidth(width);
+		const int chromaHeight = I420ChromaHeight(height);
+		chromaAlpha_.resize(static_cast<size_t>(chromaWidth) * chromaHeight);
+		for (int cy = 0; cy < chromaHeight; cy++) {
+			for (int cx = 0; cx < chromaWidth; cx++) {
+				// Odd edges average the pixels that exist.
+				int sum = 0;
+				int count = 0;
+				for (int dy = 0; dy < 2 && 2 * cy + dy < height; dy++) {
+					for (int dx = 0; dx < 2 && 2 * cx + dx < width; dx++) {
+						sum += alpha_[static_cast<size_t>(2 * cy + dy) * width + 2 * cx + dx];
+						count++;
+					}
+				}
+				chromaAlpha_[static_cast<size_t>(cy) * chromaWidth + cx] = static_cast<uint8_t>((sum + count / 2) / count);
+			}
+		}
+	}
+
+	void WatermarkFilter::apply(const I420Planes& frame, bool limitedRange) {
+		// Where the image lands, clipped to the frame; left and top may cut
+		// into the image.
+		const int left = (x_ >= 0 ? x_ : frame.width - width_ + x_) & ~1;
+		const int top = (y_ >= 0 ? y_ : frame.height - height_ + y_) & ~1;
+		const int skipX = std::max(-left, 0) & ~1;
+		const int skipY = std::max(-top, 0) & ~1;
+		const int dstX = left + skipX;
+		const int dstY = top + skipY;
+		const int width = std::min(width_ - skipX, frame.width - dstX);
+		const int height = std::min(height_ - skipY, frame.height - dstY);
+		if (width <= 0 || height <= 0) {
+			return;
+		}
+
+		const I420ConstPlanes image = I420ConstPlanes::packed(image_.data(), width_, height_);
+		BlendPlane(frame.y + static_cast<size_t>(dstY) * frame.strideY + dstX, frame.strideY,
+			image.y + static_cast<size_t>(skipY) * image.strideY + skipX, image.strideY,
+			alpha_.data() + static_cast<size_t>(skipY) * width_ + skipX, width_, width, height);
+
+		const int chromaWidth = I420ChromaWidth(width);
+		const int chromaHeight = I420ChromaHeight(height);
+		const int imageChromaWidth = I420ChromaWidth(width_);
+		const size_t alphaOffset = static_cast<size_t>(skipY / 2) * imageChromaWidth + skipX / 2;
+		BlendPlane(frame.u + static_cast<size_t>(dstY / 2) * frame.strideU + dstX / 2, frame.strideU,
+			image.u + static_cast<size_t>(skipY / 2) * image.strideU + skipX / 2, image.strideU,
+			chromaAlpha_.data() + alphaOffset, imageChromaWidth,
+			std::min(chromaWidth, I420ChromaWidth(frame.width) - dstX / 2),
+			std::min(chromaHeight, I420ChromaHeight(frame.height) - dstY / 2));
+		BlendPlane(frame.v + static_cast<size_t>(dstY / 2) * frame.strideV + dstX / 2, frame.strideV,
+			image.v + static_cast<size_t>(skipY / 2) * image.strideV + skipX / 2, image.strideV,
+			chromaAlpha_.data() + alphaOffset, imageChromaWidth,
+			std::min(chromaWidth, I420ChromaWidth(frame.width) - dstX / 2),
+			std::min(chromaHeight, I420ChromaHeight(frame.height) - dstY / 2));
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,98 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_VIDEO_FILTERS_H_
+#define FLUTTER_PLUGIN_MEDIA_VIDEO_FILTERS_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "media/i420_image.h"
+#include "media/video_filter_kernels.h"
+
+namespace flutter_zoom_sdk {
+
+	// One in-place stage of a VideoFilterChain. apply() runs on the SDK's
+	// capture thread and must not allocate once it has seen a frame size.
+	class IVideoFilter {
+	public:
+		virtual ~IVideoFilter() {}
+
+		// Stable identifier reported with the filter's timing.
+		virtual const char* name() const = 0;
+
+		// limitedRange: luma spans 16-235 and chroma 16-240 rather than 0-255.
+		virtual void apply(const I420Planes& frame, bool limitedRange) = 0;
+	};
+
+	// Luma only, around mid grey. brightness is a fraction of the luma range
+	// (-1 to 1); contrast is a gain (0 to 4).
+	class BrightnessContrastFilter : public IVideoFilter {
+	public:
+		BrightnessContrastFilter(float brightness, float contrast);
+
+		const char* name() const override { return "brightnessContrast"; }
+
+		void apply(const I420Planes& frame, bool limitedRange) override;
+
+	private:
+		const float brightness_;
+		const int gainQ10_;
+	};
+
+	// Luma only, through a table built for each range up front.
+	class GammaFilter : public IVideoFilter {
+	public:
+		// gamma between 0.1 and 10; above 1 brightens the mid tones.
+		explicit GammaFilter(float gamma);
+
+		const char* name() const override { return "gamma"; }
+
+		void apply(const I420Planes& frame, bool limitedRange) override;
+
+	private:
+		uint8_t fullLut_[256];
+		uint8_t limitedLut_[256];
+	};
+
+	// Chroma noise reduction: passes of a 3x3 kernel over U and V. Repeated
+	// gaussian passes approach a wider gaussian.
+	class ChromaBlurFilter : public IVideoFilter {
+	public:
+		ChromaBlurFilter(BlurKernel kernel, int passes);
+
+		const char* name() const override { return "chromaBlur"; }
+
+		void apply(const I420Planes& frame, bool limitedRange) override;
+
+	private:
+		const BlurKernel kernel_;
+		const int passes_;
+		std::vector<uint8_t> scratch_;
+	};
+
+	// Blends an I420 image with a full-resolution alpha plane onto the frame.
+	// x and y place its top-left corner; negative values are instead margins
+	// from the right and bottom edges. The position is rounded down to even
+	// so chroma lines up.
+	class WatermarkFilter : public IVideoFilter {
+	public:
+		// image is packed I420; alpha is width * height bytes, scaled by
+		// opacity (0 to 1) here once.
+		WatermarkFilter(const uint8_t* image, const uint8_t* alpha, int width, int height, int x, int y, float opacity);
+
+		const char* name() const override { return "watermark"; }
+
+		void apply(const I420Planes& frame, bool limitedRange) override;
+
+	private:
+		const int width_;
+		const int height_;
+		const int x_;
+		const int y_;
+		std::vector<uint8_t> image_;
+		std::vector<uint8_t> alpha_;
+		// Alpha averaged over each 2x2 block, for the chroma planes.
+		std::vector<uint8_t> chromaAlpha_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_VIDEO_FILTERS_H_
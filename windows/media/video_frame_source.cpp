@@ -0,0 +1,174 @@
+#include "media/video_frame_source.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// Y4M files without a rate are played at this one.
+		constexpr double kDefaultFrameRate = 30.0;
+		// Idle buffers kept per pushed frame size; the queue plus one in use.
+		constexpr size_t kExtraIdle = 2;
+	}
+
+	Y4mVideoSource::Y4mVideoSource(bool loop)
+		: loop_(loop), frameRate_(kDefaultFrameRate), next_(0), finished_(false) {}
+
+	bool Y4mVideoSource::open(const std::string& path) {
+		if (!reader_.open(path)) {
+			return false;
+		}
+
+		frameRate_ = reader_.frameRate() > 0.0 ? reader_.frameRate() : kDefaultFrameRate;
+		frame_.resize(reader_.frameSize());
+		next_ = 0;
+		finished_.store(false, std::memory_order_release);
+		// A file without a single frame is not worth sending.
+		return advance(true);
+	}
+
+	bool Y4mVideoSource::advance(bool decode) {
+		for (int attempt = 0; attempt < 2; attempt++) {
+			if (decode ? reader_.read(frame_.data()) : reader_.skip()) {
+				next_++;
+				return true;
+			}
+			if (!loop_ || !reader_.rewind()) {
+				break;
+			}
+		}
+		return false;
+	}
+
+	bool Y4mVideoSource::frameAt(std::chrono::microseconds mediaTime, VideoFrame& frame) {
+		if (!reader_.isOpen()) {
+			return false;
+		}
+
+		const uint64_t target = static_cast<uint64_t>(std::max<double>(
+			std::floor(mediaTime.count() * frameRate_ / 1e6), 0.0));
+
+		// Frames before the target are skipped; only the target is decoded.
+		while (next_ <= target && !finished()) {
+			if (!advance(next_ == target)) {
+				finished_.store(true, std::memory_order_release);
+			}
+		}
+
+		frame.planes = I420ConstPlanes::packed(frame_.data(), reader_.width(), reader_.height());
+		frame.fullRange = reader_.fullRange();
+		frame.sequence = next_ - 1;
+		return true;
+	}
+
+	RingVideoSource::RingVideoSource(int width, int height, double frameRate, size_t capacity)
+		: frameRate_(frameRate),
+		capacity_(std::max<size_t>(capacity, 1)),
+		width_(width),
+		height_(height),
+		dropped_(0),
+		ended_(false),
+		sequence_(0) {}
+
+	void RingVideoSource::push(const I420ConstPlanes& planes, bool fullRange) {
+		const size_t size = I420BufferSize(planes.width, planes.height);
+
+		std::shared_ptr<BufferPool> pool;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!pool_ || pool_->bufferSize() != size) {
+				pool_ = BufferPool::create(size, capacity_ + kExtraIdle);
+			}
+			pool = pool_;
+		}
+
+		// Copied outside the lock so the sender thread is never held up.
+		Entry entry;
+		entry.data = pool->acquire();
+		entry.data->resize(size);
+		entry.width = planes.width;
+		entry.height = planes.height;
+		entry.fullRange = fullRange;
+		CopyI420(planes, I420Planes::packed(entry.data->data(), planes.width, planes.height));
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (queue_.size() >= capacity_) {
+			queue_.pop_front();
+			dropped_++;
+		}
+		width_ = planes.width;
+		height_ = planes.height;
+		queue_.push_back(std::move(entry));
+	}
+
+	void RingVideoSource::push(PooledBuffer frame, int width, int height, bool fullRange) {
+		if (!frame || frame->size() < I420BufferSize(width, height)) {
+			return;
+		}
+
+		Entry entry;
+		entry.data = std::move(frame);
+		entry.width = width;
+		entry.height = height;
+		entry.fullRange = fullRange;
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (queue_.size() >= capacity_) {
+			queue_.pop_front();
+			dropped_++;
+		}
+		width_ = width;
+		height_ = height;
+		queue_.push_back(std::move(entry));
+	}
+
+	void RingVideoSource::end() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		ended_ = true;
+	}
+
+	uint64_t RingVideoSource::dropped() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return dropped_;
+	}
+
+	int RingVideoSource::width() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return width_;
+	}
+
+	int RingVideoSource::height() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return height_;
+	}
+
+	bool RingVideoSource::frameAt(std::chrono::microseconds mediaTime, VideoFrame& frame) {
+		Entry previous;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!queue_.empty()) {
+				previous = std::move(current_);
+				current_ = std::move(queue_.front());
+				queue_.pop_front();
+				sequence_++;
+			}
+		}
+		// previous goes back to its pool here, outside the lock.
+
+		if (!current_.data) {
+			return false;
+		}
+
+		frame.planes = I420ConstPlanes::packed(current_.data->data(), current_.width, current_.height);
+		frame.fullRange = current_.fullRange;
+		frame.sequence = sequence_;
+		return true;
+	}
+
+	bool RingVideoSource::finished() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return ended_ && queue_.empty();
+	}
+
+}  // namespace flutter_zoom_sdk
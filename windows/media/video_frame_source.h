@@ -0,0 +1,135 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_VIDEO_FRAME_SOURCE_H_
+#define FLUTTER_PLUGIN_MEDIA_VIDEO_FRAME_SOURCE_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "media/buffer_pool.h"
+#include "media/i420_image.h"
+#include "media/y4m_file.h"
+
+namespace flutter_zoom_sdk {
+
+	struct VideoFrame {
+		I420ConstPlanes planes;
+		bool fullRange = false;
+		// Increases by one per distinct source frame, so a sender can tell
+		// repeated and skipped frames apart.
+		uint64_t sequence = 0;
+	};
+
+	// I420 frames pulled by a sender thread.
+	class IVideoFrameSource {
+	public:
+		virtual ~IVideoFrameSource() {}
+
+		// Native size and rate; 0 while unknown.
+		virtual int width() const = 0;
+
+		virtual int height() const = 0;
+
+		virtual double frameRate() const = 0;
+
+		// The frame to show mediaTime after the stream started. False when
+		// there is nothing to show yet. The planes stay valid until the next
+		// call.
+		virtual bool frameAt(std::chrono::microseconds mediaTime, VideoFrame& frame) = 0;
+
+		// True once frameAt() will never return a new frame again.
+		virtual bool finished() const = 0;
+	};
+
+	// Plays a Y4M file once or in a loop at the file's frame rate. Frames
+	// the sender has fallen behind on are skipped without being read.
+	class Y4mVideoSource : public IVideoFrameSource {
+	public:
+		explicit Y4mVideoSource(bool loop);
+
+		// path is UTF-8.
+		bool open(const std::string& path);
+
+		int width() const override { return reader_.width(); }
+
+		int height() const override { return reader_.height(); }
+
+		double frameRate() const override { return frameRate_; }
+
+		bool frameAt(std::chrono::microseconds mediaTime, VideoFrame& frame) override;
+
+		bool finished() const override { return finished_.load(std::memory_order_acquire); }
+
+	private:
+		// Moves to the next file frame, rewinding when looping.
+		bool advance(bool decode);
+
+		const bool loop_;
+		Y4mReader reader_;
+		double frameRate_;
+		std::vector<uint8_t> frame_;
+		// Index of the next frame in the stream (not the file, which loops).
+		uint64_t next_;
+		std::atomic<bool> finished_;
+	};
+
+	// Frames pushed from the Dart channel. A short queue absorbs producer
+	// jitter; when it is full the oldest frame is dropped, and when it is
+	// empty the last frame is shown again.
+	class RingVideoSource : public IVideoFrameSource {
+	public:
+		RingVideoSource(int width, int height, double frameRate, size_t capacity = 3);
+
+		// Producer side. The frame is copied; a size change is allowed.
+		void push(const I420ConstPlanes& planes, bool fullRange);
+
+		// Producer side. Takes a packed I420 frame without copying it.
+		void push(PooledBuffer frame, int width, int height, bool fullRange);
+
+		// Producer side: no more frames will be pushed.
+		void end();
+
+		uint64_t dropped() const;
+
+		int width() const override;
+
+		int height() const override;
+
+		double frameRate() const override { return frameRate_; }
+
+		bool frameAt(std::chrono::microseconds mediaTime, VideoFrame& frame) override;
+
+		bool finished() const override;
+
+	private:
+		struct Entry {
+			PooledBuffer data;
+			int width = 0;
+			int height = 0;
+			bool fullRange = false;
+		};
+
+		const double frameRate_;
+		const size_t capacity_;
+
+		mutable std::mutex mutex_;
+		std::shared_ptr<BufferPool> pool_;
+		std::deque<Entry> queue_;
+		int width_;
+		int height_;
+		uint64_t dropped_;
+		bool ended_;
+
+		// Consumer owned.
+		Entry current_;
+		uint64_t sequence_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_VIDEO_FRAME_SOURCE_H_
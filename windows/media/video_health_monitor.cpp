@@ -0,0 +1,243 @@
+#include "media/video_health_monitor.h"
+
+#include <zoom_sdk_raw_data_def.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "media/tile_hash.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr auto kMinInterval = std::chrono::milliseconds(100);
+		constexpr auto kMaxInterval = std::chrono::milliseconds(10000);
+		// Every other row tells a repeated picture from a new one.
+		constexpr int kHashRowStep = 2;
+		constexpr size_t kPooledRecords = 16;
+		constexpr size_t kIdleReportBuffers = 4;
+
+		template <typename T>
+		void putLE(uint8_t* dst, T value) {
+			std::memcpy(dst, &value, sizeof(T));
+		}
+
+		template <typename T>
+		T saturate(uint64_t value) {
+			return static_cast<T>(std::min<uint64_t>(value, static_cast<T>(~T(0))));
+		}
+	}
+
+	VideoHealthMonitor::Tap::Tap(VideoStreamHealth::Clock::time_point start)
+		: health_(start),
+		rawDataOn_(false),
+		destroyed_(false) {}
+
+	void VideoHealthMonitor::Tap::onRendererBeDestroyed() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		destroyed_ = true;
+		rawDataOn_ = false;
+	}
+
+	void VideoHealthMonitor::Tap::onRawDataFrameReceived(YUVRawDataI420* data) {
+		if (!data) {
+			return;
+		}
+
+		const auto arrival = VideoStreamHealth::Clock::now();
+		const int width = static_cast<int>(data->GetStreamWidth());
+		const int height = static_cast<int>(data->GetStreamHeight());
+		const auto* y = reinterpret_cast<const uint8_t*>(data->GetYBuffer());
+		if (!y || width <= 0 || height <= 0) {
+			return;
+		}
+
+		// Hashed outside the lock; the reporter never waits on a frame.
+		const uint64_t hash = HashPlane(y, width, width, height, kHashRowStep);
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		rawDataOn_ = true;
+		health_.onFrame(data->GetTimeStamp(), width, height, hash, arrival);
+	}
+
+	void VideoHealthMonitor::Tap::onRawDataStatusChanged(RawDataStatus status) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		rawDataOn_ = status == RawData_On;
+	}
+
+	VideoHealthStats VideoHealthMonitor::Tap::stats(VideoStreamHealth::Clock::time_point now) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return health_.stats(now);
+	}
+
+	VideoHealthStats VideoHealthMonitor::Tap::report(VideoStreamHealth::Clock::time_point now) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return health_.report(now);
+	}
+
+	void VideoHealthMonitor::Tap::suspend(VideoStreamHealth::Clock::time_point now) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		rawDataOn_ = false;
+		health_.restart(now);
+	}
+
+	bool VideoHealthMonitor::Tap::rawDataOn() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return rawDataOn_;
+	}
+
+	bool VideoHealthMonitor::Tap::destroyed() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return destroyed_;
+	}
+
+	VideoHealthMonitor::VideoHealthMonitor(ReportSink sink, size_t reservedPrefix, std::chrono::milliseconds interval)
+		: sink_(std::move(sink)),
+		reservedPrefix_(reservedPrefix),
+		pool_(BufferPool::create(reservedPrefix + kVideoHealthHeaderSize + kPooledRecords * kVideoHealthRecordSize, kIdleReportBuffers)),
+		stopping_(false),
+		interval_(std::clamp(interval, kMinInterval, kMaxInterval)) {
+		worker_ = std::thread(&VideoHealthMonitor::run, this);
+	}
+
+	VideoHealthMonitor::~VideoHealthMonitor() {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stopping_ = true;
+		}
+		wake_.notify_all();
+		if (worker_.joinable()) {
+			worker_.join();
+		}
+	}
+
+	ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate* VideoHealthMonitor::add(uint32_t id) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto& tap = taps_[id];
+		if (tap) {
+			return nullptr;
+		}
+
+		tap = std::make_unique<Tap>(VideoStreamHealth::Clock::now());
+		return tap.get();
+	}
+
+	bool VideoHealthMonitor::remove(uint32_t id) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return taps_.erase(id) > 0;
+	}
+
+	bool VideoHealthMonitor::rendererDestroyed(uint32_t id) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto it = taps_.find(id);
+		return it != taps_.end() && it->second->destroyed();
+	}
+
+	bool VideoHealthMonitor::suspend(uint32_t id) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto it = taps_.find(id);
+		if (it == taps_.end()) {
+			return false;
+		}
+
+		it->second->suspend(VideoStreamHealth::Clock::now());
+		return true;
+	}
+
+	bool VideoHealthMonitor::stats(uint32_t id, VideoHealthStats& stats) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto it = taps_.find(id);
+		if (it == taps_.end()) {
+			return false;
+		}
+
+		stats = it->second->stats(VideoStreamHealth::Clock::now());
+		return true;
+	}
+
+	std::vector<uint32_t> VideoHealthMonitor::ids() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		std::vector<uint32_t> ids;
+		ids.reserve(taps_.size());
+		for (const auto& entry : taps_) {
+			ids.push_back(entry.first);
+		}
+		return ids;
+	}
+
+	void VideoHealthMonitor::setInterval(std::chrono::milliseconds interval) {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			interval_ = std::clamp(interval, kMinInterval, kMaxInterval);
+		}
+		wake_.notify_all();
+	}
+
+	void VideoHealthMonitor::run() {
+		std::unique_lock<std::mutex> lock(mutex_);
+		auto next = VideoStreamHealth::Clock::now() + interval_;
+		while (!stopping_) {
+			if (wake_.wait_until(lock, next, [this] { return stopping_; })) {
+				break;
+			}
+
+			const auto now = VideoStreamHealth::Clock::now();
+			next += interval_;
+			if (next <= now) {
+				// Fell behind or the interval changed; restart the schedule.
+				next = now + interval_;
+			}
+			if (taps_.empty()) {
+				continue;
+			}
+
+			const size_t count = std::min<size_t>(taps_.size(), UINT16_MAX);
+			PooledBuffer report = pool_->acquire();
+			report->resize(reservedPrefix_ + kVideoHealthHeaderSize + count * kVideoHealthRecordSize);
+			uint8_t* header = report->data() + reservedPrefix_;
+			header[0] = kVideoHealthVersion;
+			header[1] = static_cast<uint8_t>(kVideoHealthRecordSize);
+			putLE<uint16_t>(header + 2, static_cast<uint16_t>(count));
+			putLE<uint32_t>(header + 4, static_cast<uint32_t>(interval_.count()));
+
+			uint8_t* record = header + kVideoHealthHeaderSize;
+			size_t written = 0;
+			for (const auto& entry : taps_) {
+				if (written == count) {
+					break;
+				}
+
+				const VideoHealthStats stats = entry.second->report(now);
+				uint16_t flags = 0;
+				if (stats.frozen) {
+					flags |= kVideoHealthFrozen;
+				}
+				if (entry.second->rawDataOn()) {
+					flags |= kVideoHealthRawDataOn;
+				}
+				if (stats.intervalResolutionChanged) {
+					flags |= kVideoHealthResolutionChanged;
+				}
+
+				putLE<uint32_t>(record, entry.first);
+				putLE<uint16_t>(record + 4, saturate<uint16_t>(stats.width));
+				putLE<uint16_t>(record + 6, saturate<uint16_t>(stats.height));
+				putLE<uint16_t>(record + 8, saturate<uint16_t>(static_cast<uint64_t>(stats.fps * 100.0f + 0.5f)));
+				putLE<uint16_t>(record + 10, flags);
+				putLE<uint32_t>(record + 12, stats.jitterUs);
+				putLE<uint32_t>(record + 16, stats.maxGapMs);
+				putLE<uint32_t>(record + 20, stats.freezes);
+				putLE<uint32_t>(record + 24, saturate<uint32_t>(stats.frozenMs));
+				putLE<uint32_t>(record + 28, stats.intervalRepeated);
+				record += kVideoHealthRecordSize;
+				written++;
+			}
+
+			// The sink may block on the platform thread; taps keep running.
+			lock.unlock();
+			sink_(std::move(report));
+			lock.lock();
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,127 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_VIDEO_HEALTH_MONITOR_H_
+#define FLUTTER_PLUGIN_MEDIA_VIDEO_HEALTH_MONITOR_H_
+
+#include <rawdata/rawdata_renderer_interface.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "media/buffer_pool.h"
+#include "media/video_stream_health.h"
+
+namespace flutter_zoom_sdk {
+
+	// Layout of every health report, all little-endian:
+	//   0  u8   version (kVideoHealthVersion)
+	//   1  u8   record size (kVideoHealthRecordSize)
+	//   2  u16  record count
+	//   4  u32  reporting interval, milliseconds
+	//   8       one record per stream:
+	//     0  u32  subscribe id
+	//     4  u16  width
+	//     6  u16  height
+	//     8  u16  frames with new content per second, hundredths
+	//     10 u16  flags (kVideoHealth*)
+	//     12 u32  jitter, microseconds
+	//     16 u32  longest gap between new frames this interval, milliseconds
+	//     20 u32  freezes since subscribing
+	//     24 u32  frozen time since subscribing, milliseconds
+	//     28 u32  repeated frames this interval
+	constexpr uint8_t kVideoHealthVersion = 1;
+	constexpr size_t kVideoHealthHeaderSize = 8;
+	constexpr size_t kVideoHealthRecordSize = 32;
+
+	constexpr uint16_t kVideoHealthFrozen = 1 << 0;
+	constexpr uint16_t kVideoHealthRawDataOn = 1 << 1;
+	constexpr uint16_t kVideoHealthResolutionChanged = 1 << 2;
+
+	// Tracks VideoStreamHealth for each subscribed renderer and reports all
+	// of them in one compact frame per interval from its own thread. The SDK
+	// thread delivering a frame only hashes every other row of its Y plane
+	// and updates counters.
+	class VideoHealthMonitor {
+	public:
+		// Receives one report. The first reservedPrefix bytes of the buffer are
+		// left for the caller, the header follows. Called on the monitor's
+		// thread.
+		using ReportSink = std::function<void(PooledBuffer report)>;
+
+		VideoHealthMonitor(ReportSink sink, size_t reservedPrefix = 0,
+			std::chrono::milliseconds interval = std::chrono::milliseconds(1000));
+
+		~VideoHealthMonitor();
+
+		VideoHealthMonitor(const VideoHealthMonitor&) = delete;
+		VideoHealthMonitor& operator=(const VideoHealthMonitor&) = delete;
+
+		// Delegate to create the renderer for id with, owned by the monitor
+		// until remove(id). nullptr when id is already tracked.
+		ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate* add(uint32_t id);
+
+		// Destroy the renderer before removing its delegate.
+		bool remove(uint32_t id);
+
+		// Whether the SDK destroyed the renderer for id on its own.
+		bool rendererDestroyed(uint32_t id);
+
+		// Call when delivery for id is paused on purpose and again when it
+		// resumes; the gap is not counted as a freeze.
+		bool suspend(uint32_t id);
+
+		bool stats(uint32_t id, VideoHealthStats& stats);
+
+		std::vector<uint32_t> ids();
+
+		// Clamped to 100 ms - 10 s.
+		void setInterval(std::chrono::milliseconds interval);
+
+	private:
+		class Tap : public ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate {
+		public:
+			explicit Tap(VideoStreamHealth::Clock::time_point start);
+
+			void onRendererBeDestroyed() override;
+			void onRawDataFrameReceived(YUVRawDataI420* data) override;
+			void onRawDataStatusChanged(RawDataStatus status) override;
+
+			VideoHealthStats stats(VideoStreamHealth::Clock::time_point now);
+			VideoHealthStats report(VideoStreamHealth::Clock::time_point now);
+
+			void suspend(VideoStreamHealth::Clock::time_point now);
+
+			bool rawDataOn();
+			bool destroyed();
+
+		private:
+			std::mutex mutex_;
+			VideoStreamHealth health_;
+			bool rawDataOn_;
+			bool destroyed_;
+		};
+
+		void run();
+
+		const ReportSink sink_;
+		const size_t reservedPrefix_;
+		std::shared_ptr<BufferPool> pool_;
+
+		std::mutex mutex_;
+		std::condition_variable wake_;
+		bool stopping_;
+		std::chrono::milliseconds interval_;
+		std::unordered_map<uint32_t, std::unique_ptr<Tap>> taps_;
+
+		std::thread worker_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_VIDEO_HEALTH_MONITOR_H_
@@ -0,0 +1,147 @@
+#include "media/video_stream_health.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// Assumed until gaps have been measured: 30 fps.
+		constexpr double kInitialGapMs = 33.0;
+		constexpr double kGapGain = 1.0 / 16;
+		constexpr double kFreezeFactor = 3.0;
+		constexpr double kFreezeMarginMs = 150.0;
+		// RFC 3550 jitter smoothing.
+		constexpr int64_t kJitterGain = 16;
+
+		int64_t elapsedMs(VideoStreamHealth::Clock::time_point from, VideoStreamHealth::Clock::time_point to) {
+			return std::chrono::duration_cast<std::chrono::milliseconds>(to - from).count();
+		}
+	}
+
+	VideoStreamHealth::VideoStreamHealth(Clock::time_point start)
+		: haveFrame_(false),
+		width_(0),
+		height_(0),
+		lastHash_(0),
+		lastTimestampMs_(0),
+		meanGapMs_(kInitialGapMs),
+		jitterUs_(0),
+		intervalStart_(start),
+		intervalFrames_(0),
+		intervalDistinct_(0),
+		intervalRepeated_(0),
+		intervalMaxGapMs_(0),
+		intervalResolutionChanged_(false) {}
+
+	double VideoStreamHealth::freezeThresholdMs() const {
+		return std::max(meanGapMs_ * kFreezeFactor, meanGapMs_ + kFreezeMarginMs);
+	}
+
+	void VideoStreamHealth::checkStall(Clock::time_point now) {
+		if (haveFrame_ && !totals_.frozen && elapsedMs(lastDistinct_, now) >= freezeThresholdMs()) {
+			totals_.frozen = true;
+			totals_.freezes++;
+		}
+	}
+
+	void VideoStreamHealth::onFrame(uint64_t timestampMs, int width, int height, uint64_t hash, Clock::time_point arrival) {
+		totals_.frames++;
+		intervalFrames_++;
+
+		if (haveFrame_ && (width != width_ || height != height_)) {
+			totals_.resolutionChanges++;
+			intervalResolutionChanged_ = true;
+		}
+		width_ = width;
+		height_ = height;
+		totals_.width = static_cast<uint32_t>(width);
+		totals_.height = static_cast<uint32_t>(height);
+
+		if (haveFrame_ && timestampMs > lastTimestampMs_ && lastTimestampMs_ != 0) {
+			const int64_t arrivalUs = std::chrono::duration_cast<std::chrono::microseconds>(arrival - lastArrival_).count();
+			const int64_t mediaUs = static_cast<int64_t>(timestampMs - lastTimestampMs_) * 1000;
+			jitterUs_ += (std::abs(arrivalUs - mediaUs) - jitterUs_) / kJitterGain;
+		}
+		if (timestampMs != 0) {
+			lastTimestampMs_ = timestampMs;
+		}
+		lastArrival_ = arrival;
+
+		if (haveFrame_ && hash == lastHash_) {
+			totals_.repeatedFrames++;
+			intervalRepeated_++;
+			return;
+		}
+
+		if (haveFrame_) {
+			const int64_t gapMs = elapsedMs(lastDistinct_, arrival);
+			intervalMaxGapMs_ = std::max(intervalMaxGapMs_, static_cast<uint32_t>(gapMs));
+			checkStall(arrival);
+			if (totals_.frozen) {
+				// The whole gap since the last new picture was frozen.
+				totals_.frozenMs += static_cast<uint64_t>(gapMs);
+				totals_.frozen = false;
+			}
+			else {
+				meanGapMs_ += (static_cast<double>(gapMs) - meanGapMs_) * kGapGain;
+			}
+		}
+
+		haveFrame_ = true;
+		lastHash_ = hash;
+		lastDistinct_ = arrival;
+		intervalDistinct_++;
+	}
+
+	VideoHealthStats VideoStreamHealth::stats(Clock::time_point now) const {
+		VideoHealthStats stats = totals_;
+		const bool stalled = haveFrame_ && elapsedMs(lastDistinct_, now) >= freezeThresholdMs();
+		if (stalled && !stats.frozen) {
+			stats.frozen = true;
+			stats.freezes++;
+		}
+		if (stats.frozen) {
+			stats.frozenMs += static_cast<uint64_t>(elapsedMs(lastDistinct_, now));
+		}
+
+		const double seconds = std::chrono::duration<double>(now - intervalStart_).count();
+		if (seconds > 0.0) {
+			stats.fps = static_cast<float>(intervalDistinct_ / seconds);
+			stats.arrivalFps = static_cast<float>(intervalFrames_ / seconds);
+		}
+		stats.intervalRepeated = intervalRepeated_;
+		stats.intervalResolutionChanged = intervalResolutionChanged_;
+		stats.maxGapMs = intervalMaxGapMs_;
+		if (haveFrame_) {
+			// A gap still open counts too, so a stalled stream shows it.
+			stats.maxGapMs = std::max(stats.maxGapMs, static_cast<uint32_t>(elapsedMs(lastDistinct_, now)));
+		}
+		stats.jitterUs = static_cast<uint32_t>(jitterUs_);
+		return stats;
+	}
+
+	VideoHealthStats VideoStreamHealth::report(Clock::time_point now) {
+		checkStall(now);
+		const VideoHealthStats stats = this->stats(now);
+
+		intervalStart_ = now;
+		intervalFrames_ = 0;
+		intervalDistinct_ = 0;
+		intervalRepeated_ = 0;
+		intervalMaxGapMs_ = 0;
+		intervalResolutionChanged_ = false;
+		return stats;
+	}
+
+	void VideoStreamHealth::restart(Clock::time_point now) {
+		checkStall(now);
+		if (totals_.frozen) {
+			totals_.frozenMs += static_cast<uint64_t>(elapsedMs(lastDistinct_, now));
+			totals_.frozen = false;
+		}
+		haveFrame_ = false;
+		lastTimestampMs_ = 0;
+	}
+
+}  // namespace flutter_zoom_sdk
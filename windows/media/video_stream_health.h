@@ -0,0 +1,86 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_VIDEO_STREAM_HEALTH_H_
+#define FLUTTER_PLUGIN_MEDIA_VIDEO_STREAM_HEALTH_H_
+
+#include <chrono>
+#include <cstdint>
+
+namespace flutter_zoom_sdk {
+
+	struct VideoHealthStats {
+		uint32_t width = 0;
+		uint32_t height = 0;
+		// Totals since the stream was first seen.
+		uint64_t frames = 0;
+		// Frames whose Y plane matched the frame before.
+		uint64_t repeatedFrames = 0;
+		uint32_t resolutionChanges = 0;
+		uint32_t freezes = 0;
+		// Includes a freeze still in progress.
+		uint64_t frozenMs = 0;
+		bool frozen = false;
+		// Over the current reporting interval.
+		float fps = 0.0f;          // frames with new content per second
+		float arrivalFps = 0.0f;   // every frame, repeats included
+		uint32_t intervalRepeated = 0;
+		bool intervalResolutionChanged = false;
+		// Longest time between frames with new content.
+		uint32_t maxGapMs = 0;
+		// RFC 3550 style smoothed difference between the arrival interval and
+		// the GetTimeStamp() interval of consecutive frames.
+		uint32_t jitterUs = 0;
+	};
+
+	// Health of one received video stream from frame arrivals, their SDK
+	// timestamps and a hash of their Y plane. A freeze is a gap between
+	// frames with new content, whether none arrived or the same picture kept
+	// arriving, of at least three times the mean gap or the mean gap plus
+	// 150 ms, whichever is longer, as WebRTC counts them. Not thread-safe.
+	class VideoStreamHealth {
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		explicit VideoStreamHealth(Clock::time_point start);
+
+		// timestampMs of 0 or going backwards is ignored for jitter.
+		void onFrame(uint64_t timestampMs, int width, int height, uint64_t hash, Clock::time_point arrival);
+
+		// Counters as of now, including a freeze in progress.
+		VideoHealthStats stats(Clock::time_point now) const;
+
+		// stats(now), then starts a new reporting interval.
+		VideoHealthStats report(Clock::time_point now);
+
+		// Ends a freeze in progress and forgets the last frame, so frames
+		// deliberately not delivered until the next one do not count as a
+		// freeze. Totals are kept.
+		void restart(Clock::time_point now);
+
+	private:
+		double freezeThresholdMs() const;
+
+		// Starts a freeze when new content is overdue.
+		void checkStall(Clock::time_point now);
+
+		VideoHealthStats totals_;
+		bool haveFrame_;
+		int width_;
+		int height_;
+		uint64_t lastHash_;
+		uint64_t lastTimestampMs_;
+		Clock::time_point lastArrival_;
+		Clock::time_point lastDistinct_;
+		// Mean gap between frames with new content, freezes left out.
+		double meanGapMs_;
+		int64_t jitterUs_;
+
+		Clock::time_point intervalStart_;
+		uint32_t intervalFrames_;
+		uint32_t intervalDistinct_;
+		uint32_t intervalRepeated_;
+		uint32_t intervalMaxGapMs_;
+		bool intervalResolutionChanged_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_VIDEO_STREAM_HEALTH_H_
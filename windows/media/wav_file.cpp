@@ -0,0 +1,191 @@
+#include "media/wav_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr size_t kHeaderSize = 44;
+		constexpr uint64_t kMaxDataBytes = 0xFFFFFFFFull - (kHeaderSize - 8);
+
+		constexpr uint16_t kFormatPcm = 1;
+		constexpr uint16_t kFormatExtensible = 0xFFFE;
+
+		template <typename T>
+		void putLE(uint8_t* dst, T value) {
+			std::memcpy(dst, &value, sizeof(T));
+		}
+
+		template <typename T>
+		T getLE(const uint8_t* src) {
+			T value;
+			std::memcpy(&value, src, sizeof(T));
+			return value;
+		}
+	}
+
+	WavWriter::WavWriter() : sampleRate_(0), channels_(0), dataBytes_(0) {}
+
+	WavWriter::~WavWriter() {
+		close();
+	}
+
+	bool WavWriter::open(const std::string& path, uint32_t sampleRate, uint16_t channels) {
+		close();
+
+		file_.open(std::filesystem::u8path(path), std::ios::binary | std::ios::trunc);
+		if (!file_.is_open()) {
+			return false;
+		}
+
+		sampleRate_ = sampleRate;
+		channels_ = channels;
+		dataBytes_ = 0;
+		writeHeader();
+		return file_.good();
+	}
+
+	bool WavWriter::write(const int16_t* samples, size_t count) {
+		if (!file_.is_open()) {
+			return false;
+		}
+
+		// RIFF sizes are 32-bit; stop at 4 GB rather than write a corrupt file.
+		const uint64_t bytes = std::min<uint64_t>(count * sizeof(int16_t), kMaxDataBytes - dataBytes_);
+		file_.write(reinterpret_cast<const char*>(samples), static_cast<std::streamsize>(bytes));
+		dataBytes_ += bytes;
+		return file_.good() && bytes == count * sizeof(int16_t);
+	}
+
+	bool WavWriter::close() {
+		if (!file_.is_open()) {
+			return false;
+		}
+
+		file_.seekp(0);
+		writeHeader();
+		file_.close();
+		return !file_.fail();
+	}
+
+	void WavWriter::writeHeader() {
+		uint8_t header[kHeaderSize];
+		const uint16_t blockAlign = static_cast<uint16_t>(channels_ * sizeof(int16_t));
+
+		std::memcpy(header, "RIFF", 4);
+		putLE<uint32_t>(header + 4, static_cast<uint32_t>(kHeaderSize - 8 + dataBytes_));
+		std::memcpy(header + 8, "WAVEfmt ", 8);
+		putLE<uint32_t>(header + 16, 16);
+		putLE<uint16_t>(header + 20, 1);  // PCM
+		putLE<uint16_t>(header + 22, channels_);
+		putLE<uint32_t>(header + 24, sampleRate_);
+		putLE<uint32_t>(header + 28, sampleRate_ * blockAlign);
+		putLE<uint16_t>(header + 32, blockAlign);
+		putLE<uint16_t>(header + 34, 16);
+		std::memcpy(header + 36, "data", 4);
+		putLE<uint32_t>(header + 40, static_cast<uint32_t>(dataBytes_));
+
+		file_.write(reinterpret_cast<const char*>(header), kHeaderSize);
+	}
+
+	WavReader::WavReader() : sampleRate_(0), channels_(0), dataOffset_(0), frameCount_(0), position_(0) {}
+
+	bool WavReader::open(const std::string& path) {
+		close();
+
+		file_.open(std::filesystem::u8path(path), std::ios::binary);
+		if (!file_.is_open()) {
+			return false;
+		}
+
+		uint8_t riff[12];
+		if (!file_.read(reinterpret_cast<char*>(riff), sizeof(riff))
+			|| std::memcmp(riff, "RIFF", 4) != 0 || std::memcmp(riff + 8, "WAVE", 4) != 0) {
+			close();
+			return false;
+		}
+
+		bool haveFormat = false;
+		uint8_t chunk[8];
+		while (file_.read(reinterpret_cast<char*>(chunk), sizeof(chunk))) {
+			const uint32_t size = getLE<uint32_t>(chunk + 4);
+
+			if (std::memcmp(chunk, "fmt ", 4) == 0 && size >= 16) {
+				uint8_t format[40] = {};
+				const uint32_t wanted = std::min<uint32_t>(size, sizeof(format));
+				if (!file_.read(reinterpret_cast<char*>(format), wanted)) {
+					break;
+				}
+				file_.seekg(size - wanted + (size & 1), std::ios::cur);
+
+				uint16_t tag = getLE<uint16_t>(format);
+				if (tag == kFormatExtensible && wanted >= 26) {
+					// The sub-format GUID starts with the plain format tag.
+					tag = getLE<uint16_t>(format + 24);
+				}
+				channels_ = getLE<uint16_t>(format + 2);
+				sampleRate_ = getLE<uint32_t>(format + 4);
+				const uint16_t bits = getLE<uint16_t>(format + 14);
+				haveFormat = tag == kFormatPcm && bits == 16 && channels_ > 0 && sampleRate_ > 0;
+				if (!haveFormat) {
+					break;
+				}
+			}
+			else if (std::memcmp(chunk, "data", 4) == 0) {
+				if (!haveFormat) {
+					break;
+				}
+				dataOffset_ = static_cast<uint64_t>(file_.tellg());
+
+				// Streams cut short by a crash carry a size larger than the file.
+				file_.seekg(0, std::ios::end);
+				const uint64_t available = static_cast<uint64_t>(file_.tellg()) - dataOffset_;
+				frameCount_ = std::min<uint64_t>(size, available) / (channels_ * sizeof(int16_t));
+				return rewind();
+			}
+			else {
+				file_.seekg(size + (size & 1), std::ios::cur);
+			}
+		}
+
+		close();
+		return false;
+	}
+
+	size_t WavReader::read(int16_t* samples, size_t frames) {
+		if (!file_.is_open()) {
+			return 0;
+		}
+
+		frames = static_cast<size_t>(std::min<uint64_t>(frames, framesLeft()));
+		file_.read(reinterpret_cast<char*>(samples), static_cast<std::streamsize>(frames * channels_ * sizeof(int16_t)));
+		frames = static_cast<size_t>(file_.gcount()) / (channels_ * sizeof(int16_t));
+		position_ += frames;
+		return frames;
+	}
+
+	bool WavReader::rewind() {
+		if (!file_.is_open()) {
+			return false;
+		}
+
+		file_.clear();
+		file_.seekg(static_cast<std::streamoff>(dataOffset_));
+		position_ = 0;
+		return file_.good();
+	}
+
+	void WavReader::close() {
+		if (file_.is_open()) {
+			file_.close();
+		}
+		sampleRate_ = 0;
+		channels_ = 0;
+		dataOffset_ = 0;
+		frameCount_ = 0;
+		position_ = 0;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,89 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_WAV_FILE_H_
+#define FLUTTER_PLUGIN_MEDIA_WAV_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace flutter_zoom_sdk {
+
+	// Streams 16-bit PCM into a RIFF/WAVE file. The header is written with
+	// zero sizes up front and patched on close, so a file cut short by a crash
+	// is still readable by most tools up to the last write.
+	class WavWriter {
+	public:
+		WavWriter();
+
+		~WavWriter();
+
+		WavWriter(const WavWriter&) = delete;
+		WavWriter& operator=(const WavWriter&) = delete;
+
+		// path is UTF-8.
+		bool open(const std::string& path, uint32_t sampleRate, uint16_t channels);
+
+		bool write(const int16_t* samples, size_t count);
+
+		bool close();
+
+		bool isOpen() const { return file_.is_open(); }
+
+		uint32_t sampleRate() const { return sampleRate_; }
+
+		uint16_t channels() const { return channels_; }
+
+		uint64_t dataBytes() const { return dataBytes_; }
+
+	private:
+		void writeHeader();
+
+		std::ofstream file_;
+		uint32_t sampleRate_;
+		uint16_t channels_;
+		uint64_t dataBytes_;
+	};
+
+	// Reads 16-bit PCM RIFF/WAVE files (plain or WAVE_FORMAT_EXTENSIBLE),
+	// skipping chunks other than fmt and data.
+	class WavReader {
+	public:
+		WavReader();
+
+		WavReader(const WavReader&) = delete;
+		WavReader& operator=(const WavReader&) = delete;
+
+		// path is UTF-8. Fails for anything but 16-bit PCM.
+		bool open(const std::string& path);
+
+		// Reads up to frames interleaved frames; returns the number read, 0 at
+		// the end of the data.
+		size_t read(int16_t* samples, size_t frames);
+
+		// Back to the first frame.
+		bool rewind();
+
+		void close();
+
+		bool isOpen() const { return file_.is_open(); }
+
+		uint32_t sampleRate() const { return sampleRate_; }
+
+		uint16_t channels() const { return channels_; }
+
+		uint64_t frameCount() const { return frameCount_; }
+
+		uint64_t framesLeft() const { return frameCount_ - position_; }
+
+	private:
+		std::ifstream file_;
+		uint32_t sampleRate_;
+		uint16_t channels_;
+		uint64_t dataOffset_;
+		uint64_t frameCount_;
+		uint64_t position_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_WAV_FILE_H_
@@ -0,0 +1,57 @@
+#include "media/worker_pool.h"
+
+#include <algorithm>
+
+namespace flutter_zoom_sdk {
+
+	WorkerPool::WorkerPool(size_t threads) : stopping_(false) {
+		if (threads == 0) {
+			threads = std::clamp<size_t>(std::thread::hardware_concurrency() / 2, 1, 4);
+		}
+
+		threads_.reserve(threads);
+		for (size_t i = 0; i < threads; i++) {
+			threads_.emplace_back(&WorkerPool::run, this);
+		}
+	}
+
+	WorkerPool::~WorkerPool() {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stopping_ = true;
+		}
+		wake_.notify_all();
+
+		for (auto& thread : threads_) {
+			thread.join();
+		}
+	}
+
+	void WorkerPool::post(std::function<void()> task) {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			tasks_.push_back(std::move(task));
+		}
+		wake_.notify_one();
+	}
+
+	void WorkerPool::run() {
+		std::unique_lock<std::mutex> lock(mutex_);
+		for (;;) {
+			wake_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+			if (tasks_.empty()) {
+				// Only reached when stopping.
+				break;
+			}
+
+			std::function<void()> task = std::move(tasks_.front());
+			tasks_.pop_front();
+			lock.unlock();
+
+			task();
+
+			lock.lock();
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,45 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_WORKER_POOL_H_
+#define FLUTTER_PLUGIN_MEDIA_WORKER_POOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	// Fixed set of threads shared by the analysis stages, so the math never
+	// runs on SDK callback threads and each stage does not bring its own
+	// thread. Tasks must not block.
+	class WorkerPool {
+	public:
+		// 0 picks half the hardware threads, between 1 and 4.
+		explicit WorkerPool(size_t threads = 0);
+
+		// Runs the tasks already queued, then joins.
+		~WorkerPool();
+
+		WorkerPool(const WorkerPool&) = delete;
+		WorkerPool& operator=(const WorkerPool&) = delete;
+
+		// Safe to call from any thread.
+		void post(std::function<void()> task);
+
+		size_t size() const { return threads_.size(); }
+
+	private:
+		void run();
+
+		std::mutex mutex_;
+		std::condition_variable wake_;
+		std::deque<std::function<void()>> tasks_;
+		bool stopping_;
+		std::vector<std::thread> threads_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_WORKER_POOL_H_
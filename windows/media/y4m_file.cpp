@@ -0,0 +1,147 @@
+#include "media/y4m_file.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <sstream>
+
+#include "media/i420_image.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr char kMagic[] = "YUV4MPEG2";
+		constexpr char kFrameTag[] = "FRAME";
+		// Header lines are short; anything longer is not a Y4M file.
+		constexpr size_t kMaxLine = 1024;
+		constexpr int kMaxDimension = 8192;
+
+		bool readLine(std::ifstream& file, std::string& line) {
+			line.clear();
+			char c;
+			while (file.get(c)) {
+				if (c == '\n') {
+					return true;
+				}
+				if (line.size() >= kMaxLine) {
+					return false;
+				}
+				line.push_back(c);
+			}
+			return false;
+		}
+	}
+
+	Y4mReader::Y4mReader() : width_(0), height_(0), frameRate_(0.0), fullRange_(false), frameSize_(0), firstFrame_(0), fileSize_(0) {}
+
+	bool Y4mReader::open(const std::string& path) {
+		close();
+
+		file_.open(std::filesystem::u8path(path), std::ios::binary);
+		if (!file_.is_open()) {
+			return false;
+		}
+
+		std::string header;
+		if (!readLine(file_, header) || header.compare(0, sizeof(kMagic) - 1, kMagic) != 0) {
+			close();
+			return false;
+		}
+
+		bool chroma420 = true;
+		std::istringstream tokens(header.substr(sizeof(kMagic) - 1));
+		std::string token;
+		while (tokens >> token) {
+			const std::string value = token.substr(1);
+			switch (token[0]) {
+			case 'W':
+				width_ = std::atoi(value.c_str());
+				break;
+			case 'H':
+				height_ = std::atoi(value.c_str());
+				break;
+			case 'F': {
+				const size_t colon = value.find(':');
+				const double numerator = std::atof(value.substr(0, colon).c_str());
+				const double denominator = colon == std::string::npos ? 1.0 : std::atof(value.substr(colon + 1).c_str());
+				frameRate_ = denominator > 0.0 ? numerator / denominator : 0.0;
+				break;
+			}
+			case 'C':
+				chroma420 = value.compare(0, 3, "420") == 0;
+				break;
+			case 'X':
+				if (value == "COLORRANGE=FULL") {
+					fullRange_ = true;
+				}
+				break;
+			default:
+				// Interlacing, aspect ratio and unknown tags do not matter here.
+				break;
+			}
+		}
+
+		if (!chroma420 || width_ <= 0 || height_ <= 0 || width_ > kMaxDimension || height_ > kMaxDimension) {
+			close();
+			return false;
+		}
+
+		frameSize_ = I420BufferSize(width_, height_);
+		firstFrame_ = file_.tellg();
+		file_.seekg(0, std::ios::end);
+		fileSize_ = file_.tellg();
+		file_.seekg(firstFrame_);
+		return true;
+	}
+
+	bool Y4mReader::nextFrameHeader() {
+		std::string line;
+		return readLine(file_, line) && line.compare(0, sizeof(kFrameTag) - 1, kFrameTag) == 0;
+	}
+
+	bool Y4mReader::read(uint8_t* frame) {
+		if (!file_.is_open() || !nextFrameHeader()) {
+			return false;
+		}
+
+		file_.read(reinterpret_cast<char*>(frame), static_cast<std::streamsize>(frameSize_));
+		return static_cast<size_t>(file_.gcount()) == frameSize_;
+	}
+
+	bool Y4mReader::skip() {
+		if (!file_.is_open() || !nextFrameHeader()) {
+			return false;
+		}
+
+		// A truncated last frame counts as the end.
+		const std::streamoff end = file_.tellg() + static_cast<std::streamoff>(frameSize_);
+		if (end > fileSize_) {
+			return false;
+		}
+		file_.seekg(end);
+		return file_.good();
+	}
+
+	bool Y4mReader::rewind() {
+		if (!file_.is_open()) {
+			return false;
+		}
+
+		file_.clear();
+		file_.seekg(firstFrame_);
+		return file_.good();
+	}
+
+	void Y4mReader::close() {
+		if (file_.is_open()) {
+			file_.close();
+		}
+		width_ = 0;
+		height_ = 0;
+		frameRate_ = 0.0;
+		fullRange_ = false;
+		frameSize_ = 0;
+		firstFrame_ = 0;
+		fileSize_ = 0;
+	}
+
+}  // namespace flutter_zoom_sdk
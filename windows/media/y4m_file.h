@@ -0,0 +1,63 @@
+#ifndef FLUTTER_PLUGIN_MEDIA_Y4M_FILE_H_
+#define FLUTTER_PLUGIN_MEDIA_Y4M_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace flutter_zoom_sdk {
+
+	// Reads YUV4MPEG2 files with 4:2:0 chroma (C420, C420jpeg, C420paldv,
+	// C420mpeg2; the chroma siting is ignored). Frames come out packed I420.
+	// Range is limited unless the file carries XCOLORRANGE=FULL.
+	class Y4mReader {
+	public:
+		Y4mReader();
+
+		Y4mReader(const Y4mReader&) = delete;
+		Y4mReader& operator=(const Y4mReader&) = delete;
+
+		// path is UTF-8.
+		bool open(const std::string& path);
+
+		// Reads the next frame into frameSize() bytes. False at the end.
+		bool read(uint8_t* frame);
+
+		// Skips the next frame without reading its pixels.
+		bool skip();
+
+		// Back to the first frame.
+		bool rewind();
+
+		void close();
+
+		bool isOpen() const { return file_.is_open(); }
+
+		int width() const { return width_; }
+
+		int height() const { return height_; }
+
+		// Frames per second; 0 if the header has none.
+		double frameRate() const { return frameRate_; }
+
+		bool fullRange() const { return fullRange_; }
+
+		size_t frameSize() const { return frameSize_; }
+
+	private:
+		bool nextFrameHeader();
+
+		std::ifstream file_;
+		int width_;
+		int height_;
+		double frameRate_;
+		bool fullRange_;
+		size_t frameSize_;
+		std::streamoff firstFrame_;
+		std::streamoff fileSize_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEDIA_Y4M_FILE_H_
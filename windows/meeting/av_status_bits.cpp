@@ -0,0 +1,216 @@
+#include "meeting/av_status_bits.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr uint8_t kKindSnapshot = 0;
+		constexpr uint8_t kKindDelta = 1;
+
+		template <typename T>
+		void appendLE(std::vector<uint8_t>& out, T value) {
+			const size_t at = out.size();
+			out.resize(at + sizeof(T));
+			std::memcpy(out.data() + at, &value, sizeof(T));
+		}
+
+		template <typename T>
+		void putLE(uint8_t* dst, T value) {
+			std::memcpy(dst, &value, sizeof(T));
+		}
+
+		// std::popcount is C++20.
+		size_t popcount(uint64_t value) {
+			value = value - ((value >> 1) & 0x5555555555555555ull);
+			value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+			value = (value + (value >> 4)) & 0x0f0f0f0f0f0f0f0full;
+			return static_cast<size_t>((value * 0x0101010101010101ull) >> 56);
+		}
+
+		void beginUpdate(std::vector<uint8_t>& out, size_t reservedPrefix, uint8_t kind, uint64_t sequence) {
+			out.resize(reservedPrefix + kAvStatusHeaderSize);
+			uint8_t* header = out.data() + reservedPrefix;
+			std::memset(header, 0, kAvStatusHeaderSize);
+			header[0] = kAvStatusFormat;
+			header[1] = kind;
+			putLE<uint64_t>(header + 16, sequence);
+		}
+
+		void appendWord(std::vector<uint8_t>& out, size_t status, size_t word, uint64_t mask) {
+			out.push_back(static_cast<uint8_t>(status));
+			out.push_back(0);
+			out.push_back(0);
+			out.push_back(0);
+			appendLE<uint32_t>(out, static_cast<uint32_t>(word));
+			appendLE<uint64_t>(out, mask);
+		}
+	}
+
+	void AvStatusBits::grow(size_t slots) {
+		if (slots <= ids_.size()) {
+			return;
+		}
+
+		ids_.resize(slots, 0);
+		reportedIds_.resize(slots, 0);
+		const size_t words = (slots + 63) / 64;
+		for (size_t s = 0; s < kAvStatusCount; s++) {
+			bits_[s].resize(words, 0);
+			reported_[s].resize(words, 0);
+		}
+	}
+
+	uint32_t AvStatusBits::slot(uint32_t id) {
+		if (id == 0) {
+			return kNoSlot;
+		}
+
+		uint32_t slot = slots_.find(id);
+		if (slot != kNoSlot) {
+			return slot;
+		}
+
+		if (!freeSlots_.empty()) {
+			slot = freeSlots_.back();
+			freeSlots_.pop_back();
+		}
+		else {
+			slot = static_cast<uint32_t>(ids_.size());
+			grow(ids_.size() + 1);
+		}
+		ids_[slot] = id;
+		slots_.set(id, slot);
+		reassigned_.push_back(slot);
+		return slot;
+	}
+
+	bool AvStatusBits::remove(uint32_t id) {
+		const uint32_t slot = slots_.find(id);
+		if (slot == kNoSlot) {
+			return false;
+		}
+
+		const uint64_t bit = 1ull << (slot % 64);
+		for (auto& bits : bits_) {
+			bits[slot / 64] &= ~bit;
+		}
+		ids_[slot] = 0;
+		slots_.erase(id);
+		freeSlots_.push_back(slot);
+		reassigned_.push_back(slot);
+		return true;
+	}
+
+	bool AvStatusBits::set(uint32_t id, AvStatus status, bool on) {
+		const uint32_t at = slot(id);
+		if (at == kNoSlot) {
+			return false;
+		}
+
+		uint64_t& word = bits_[static_cast<size_t>(status)][at / 64];
+		const uint64_t bit = 1ull << (at % 64);
+		if (((word & bit) != 0) == on) {
+			return false;
+		}
+		word ^= bit;
+		return true;
+	}
+
+	bool AvStatusBits::get(uint32_t id, AvStatus status) const {
+		const uint32_t at = slots_.find(id);
+		if (at == kNoSlot) {
+			return false;
+		}
+		return (bits_[static_cast<size_t>(status)][at / 64] >> (at % 64)) & 1;
+	}
+
+	void AvStatusBits::clear(AvStatus status) {
+		auto& bits = bits_[static_cast<size_t>(status)];
+		std::fill(bits.begin(), bits.end(), 0);
+	}
+
+	void AvStatusBits::clear() {
+		for (uint32_t id : ids_) {
+			if (id != 0) {
+				remove(id);
+			}
+		}
+	}
+
+	size_t AvStatusBits::count(AvStatus status) const {
+		size_t count = 0;
+		for (uint64_t word : bits_[static_cast<size_t>(status)]) {
+			count += popcount(word);
+		}
+		return count;
+	}
+
+	bool AvStatusBits::flush(std::vector<uint8_t>& out, size_t reservedPrefix) {
+		const size_t start = out.size();
+		beginUpdate(out, reservedPrefix, kKindDelta, sequence_ + 1);
+
+		std::sort(reassigned_.begin(), reassigned_.end());
+		reassigned_.erase(std::unique(reassigned_.begin(), reassigned_.end()), reassigned_.end());
+		uint32_t assignments = 0;
+		for (uint32_t slot : reassigned_) {
+			if (ids_[slot] != reportedIds_[slot]) {
+				appendLE<uint32_t>(out, slot);
+				appendLE<uint32_t>(out, ids_[slot]);
+				reportedIds_[slot] = ids_[slot];
+				assignments++;
+			}
+		}
+		reassigned_.clear();
+
+		uint32_t words = 0;
+		for (size_t s = 0; s < kAvStatusCount; s++) {
+			for (size_t w = 0; w < bits_[s].size(); w++) {
+				const uint64_t changed = bits_[s][w] ^ reported_[s][w];
+				if (changed != 0) {
+					appendWord(out, s, w, changed);
+					reported_[s][w] = bits_[s][w];
+					words++;
+				}
+			}
+		}
+
+		if (assignments == 0 && words == 0) {
+			out.resize(start);
+			return false;
+		}
+
+		sequence_++;
+		putLE<uint32_t>(out.data() + reservedPrefix + 4, assignments);
+		putLE<uint32_t>(out.data() + reservedPrefix + 8, words);
+		return true;
+	}
+
+	void AvStatusBits::snapshot(std::vector<uint8_t>& out, size_t reservedPrefix) const {
+		beginUpdate(out, reservedPrefix, kKindSnapshot, sequence_);
+
+		uint32_t assignments = 0;
+		for (size_t slot = 0; slot < reportedIds_.size(); slot++) {
+			if (reportedIds_[slot] != 0) {
+				appendLE<uint32_t>(out, static_cast<uint32_t>(slot));
+				appendLE<uint32_t>(out, reportedIds_[slot]);
+				assignments++;
+			}
+		}
+
+		uint32_t words = 0;
+		for (size_t s = 0; s < kAvStatusCount; s++) {
+			for (size_t w = 0; w < reported_[s].size(); w++) {
+				if (reported_[s][w] != 0) {
+					appendWord(out, s, w, reported_[s][w]);
+					words++;
+				}
+			}
+		}
+
+		putLE<uint32_t>(out.data() + reservedPrefix + 4, assignments);
+		putLE<uint32_t>(out.data() + reservedPrefix + 8, words);
+	}
+
+}  // namespace flutter_zoom_sdk
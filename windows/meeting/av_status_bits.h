@@ -0,0 +1,114 @@
+#ifndef FLUTTER_PLUGIN_MEETING_AV_STATUS_BITS_H_
+#define FLUTTER_PLUGIN_MEETING_AV_STATUS_BITS_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "meeting/flat_id_map.h"
+
+namespace flutter_zoom_sdk {
+
+	enum class AvStatus : uint8_t {
+		Muted = 0,
+		VideoOn = 1,
+		Talking = 2,
+		// In the SDK's latest active audio list.
+		ActiveAudio = 3,
+	};
+
+	constexpr size_t kAvStatusCount = 4;
+
+	// Layout of every status update, all little-endian:
+	//   0  u8   format (kAvStatusFormat)
+	//   1  u8   kind: 0 snapshot, 1 delta
+	//   2  u16  reserved, 0
+	//   4  u32  slot assignment count
+	//   8  u32  word count
+	//   12 u32  reserved, 0
+	//   16 u64  sequence; a delta applies to the update before it only
+	//   24      slot assignments, 8 bytes each:
+	//     0  u32  slot
+	//     4  u32  user id, 0 when the slot was freed
+	//           then words, 16 bytes each:
+	//     0  u8   status (AvStatus)
+	//     1  u8[3] reserved, 0
+	//     4  u32  word index: slots 64 * index to 64 * index + 63
+	//     8  u64  mask, bit n for slot 64 * index + n
+	// In a snapshot the masks are the status bits; in a delta they are XORed
+	// into the bits the client has. A snapshot clears all bits first.
+	constexpr uint8_t kAvStatusFormat = 1;
+	constexpr size_t kAvStatusHeaderSize = 24;
+	constexpr size_t kAvStatusAssignmentSize = 8;
+	constexpr size_t kAvStatusWordSize = 16;
+
+	// Audio and video status of every user as one bitset per status over
+	// dense slots. Slots are stable while a user stays and are reused after
+	// they leave. flush() diffs the bits against the last update with XOR and
+	// writes only the words that changed, so muting a thousand users costs a
+	// few dozen words. Not thread-safe; used on the platform thread.
+	class AvStatusBits {
+	public:
+		static constexpr uint32_t kNoSlot = FlatIdMap::kMissing;
+
+		AvStatusBits() = default;
+
+		AvStatusBits(const AvStatusBits&) = delete;
+		AvStatusBits& operator=(const AvStatusBits&) = delete;
+
+		// The user's slot, assigned on first use. kNoSlot for id 0.
+		uint32_t slot(uint32_t id);
+
+		uint32_t find(uint32_t id) const { return slots_.find(id); }
+
+		// Frees the user's slot and clears their bits.
+		bool remove(uint32_t id);
+
+		// Returns whether the bit changed.
+		bool set(uint32_t id, AvStatus status, bool on);
+
+		bool get(uint32_t id, AvStatus status) const;
+
+		// Clears status for everyone.
+		void clear(AvStatus status);
+
+		// Forgets every user.
+		void clear();
+
+		size_t count(AvStatus status) const;
+
+		size_t users() const { return slots_.size(); }
+
+		uint64_t sequence() const { return sequence_; }
+
+		// Writes the changes since the last update as a delta after
+		// reservedPrefix bytes of out. Returns false, leaving out alone, when
+		// nothing changed.
+		bool flush(std::vector<uint8_t>& out, size_t reservedPrefix = 0);
+
+		// Writes every slot and bit, tagged with the sequence of the last update.
+		void snapshot(std::vector<uint8_t>& out, size_t reservedPrefix = 0) const;
+
+	private:
+		using Bits = std::vector<uint64_t>;
+
+		void grow(size_t slots);
+
+		FlatIdMap slots_;
+		std::vector<uint32_t> ids_;
+		std::vector<uint32_t> freeSlots_;
+		std::array<Bits, kAvStatusCount> bits_;
+
+		// The bits and slot owners as of the last update.
+		std::array<Bits, kAvStatusCount> reported_;
+		std::vector<uint32_t> reportedIds_;
+
+		// Slots whose owner changed since the last update.
+		std::vector<uint32_t> reassigned_;
+		uint64_t sequence_ = 0;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_AV_STATUS_BITS_H_
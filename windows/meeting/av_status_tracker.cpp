@@ -0,0 +1,138 @@
+#include "meeting/av_status_tracker.h"
+
+#include <algorithm>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr uint16_t kMirroredFields = rosterFlagField(RosterFlag::Muted)
+			| rosterFlagField(RosterFlag::VideoOn)
+			| rosterFlagField(RosterFlag::Talking);
+	}
+
+	AvStatusTracker::AvStatusTracker(AvStatusBits& bits, RosterStore& roster, Changed changed)
+		: bits_(bits),
+		roster_(roster),
+		changed_(std::move(changed)) {}
+
+	void AvStatusTracker::set(uint32_t id, AvStatus status, bool on) {
+		if (bits_.set(id, status, on) && changed_) {
+			changed_();
+		}
+	}
+
+	void AvStatusTracker::mirror(uint32_t id) {
+		const uint32_t index = roster_.indexOf(id);
+		if (index == RosterStore::kNotFound) {
+			return;
+		}
+
+		// A new slot is news even when all its bits are clear.
+		if (bits_.find(id) == AvStatusBits::kNoSlot) {
+			bits_.slot(id);
+			if (changed_) {
+				changed_();
+			}
+		}
+		set(id, AvStatus::Muted, roster_.flag(index, RosterFlag::Muted));
+		set(id, AvStatus::VideoOn, roster_.flag(index, RosterFlag::VideoOn));
+		set(id, AvStatus::Talking, roster_.flag(index, RosterFlag::Talking));
+	}
+
+	void AvStatusTracker::onUserAudioStatusChange(ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::IUserAudioStatus*>* lstAudioStatusChange, const zchar_t* strAudioStatusList) {
+		if (!lstAudioStatusChange) {
+			return;
+		}
+
+		const int count = lstAudioStatusChange->GetCount();
+		for (int i = 0; i < count; i++) {
+			ZOOM_SDK_NAMESPACE::IUserAudioStatus* status = lstAudioStatusChange->GetItem(i);
+			if (!status) {
+				continue;
+			}
+
+			bool muted;
+			switch (status->GetStatus()) {
+			case ZOOM_SDK_NAMESPACE::Audio_Muted:
+			case ZOOM_SDK_NAMESPACE::Audio_Muted_ByHost:
+			case ZOOM_SDK_NAMESPACE::Audio_MutedAll_ByHost:
+				muted = true;
+				break;
+			case ZOOM_SDK_NAMESPACE::Audio_UnMuted:
+			case ZOOM_SDK_NAMESPACE::Audio_UnMuted_ByHost:
+			case ZOOM_SDK_NAMESPACE::Audio_UnMutedAll_ByHost:
+				muted = false;
+				break;
+			default:
+				continue;
+			}
+
+			const uint32_t userId = status->GetUserId();
+			roster_.setFlag(userId, RosterFlag::Muted, muted);
+			if (muted) {
+				roster_.setFlag(userId, RosterFlag::Talking, false);
+			}
+		}
+	}
+
+	void AvStatusTracker::onUserActiveAudioChange(ZOOM_SDK_NAMESPACE::IList<unsigned int>* plstActiveAudio) {
+		// Only users with a slot: clearing the bit of anyone else later would
+		// give them a slot that no roster leave ever frees.
+		std::vector<uint32_t> active;
+		const int count = plstActiveAudio ? plstActiveAudio->GetCount() : 0;
+		for (int i = 0; i < count; i++) {
+			const uint32_t userId = plstActiveAudio->GetItem(i);
+			if (bits_.find(userId) != AvStatusBits::kNoSlot) {
+				active.push_back(userId);
+			}
+		}
+
+		// The lists hold a few speakers at most.
+		for (uint32_t userId : active_) {
+			if (std::find(active.begin(), active.end(), userId) == active.end()) {
+				set(userId, AvStatus::ActiveAudio, false);
+				roster_.setFlag(userId, RosterFlag::Talking, false);
+			}
+		}
+		for (uint32_t userId : active) {
+			set(userId, AvStatus::ActiveAudio, true);
+			const uint32_t index = roster_.indexOf(userId);
+			if (index != RosterStore::kNotFound && !roster_.flag(index, RosterFlag::Muted)) {
+				roster_.setFlag(userId, RosterFlag::Talking, true);
+			}
+		}
+		active_ = std::move(active);
+	}
+
+	void AvStatusTracker::onUserVideoStatusChange(unsigned int userId, ZOOM_SDK_NAMESPACE::VideoStatus status) {
+		roster_.setFlag(userId, RosterFlag::VideoOn, status == ZOOM_SDK_NAMESPACE::Video_ON);
+	}
+
+	void AvStatusTracker::onRosterJoined(uint32_t id) {
+		mirror(id);
+	}
+
+	void AvStatusTracker::onRosterLeft(uint32_t id) {
+		if (bits_.remove(id) && changed_) {
+			changed_();
+		}
+		active_.erase(std::remove(active_.begin(), active_.end(), id), active_.end());
+	}
+
+	void AvStatusTracker::onRosterChanged(uint32_t id, uint16_t fields) {
+		if (fields & kMirroredFields) {
+			mirror(id);
+		}
+	}
+
+	void AvStatusTracker::onRosterCleared() {
+		if (bits_.users() != 0) {
+			bits_.clear();
+			if (changed_) {
+				changed_();
+			}
+		}
+		active_.clear();
+	}
+
+}  // namespace flutter_zoom_sdk
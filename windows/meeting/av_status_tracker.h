@@ -0,0 +1,74 @@
+#ifndef FLUTTER_PLUGIN_MEETING_AV_STATUS_TRACKER_H_
+#define FLUTTER_PLUGIN_MEETING_AV_STATUS_TRACKER_H_
+
+#include <meeting_service_components/meeting_audio_interface.h>
+#include <meeting_service_components/meeting_video_interface.h>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "meeting/av_status_bits.h"
+#include "meeting/roster_store.h"
+
+namespace flutter_zoom_sdk {
+
+	// Follows the audio and video status events into the roster's flags and
+	// mirrors those flags, plus the active audio list, into AvStatusBits. As a
+	// roster observer it gives each participant a slot on joining and frees it
+	// on leaving. The SDK has no per-user talking event, so talking follows
+	// the active audio list and ends on mute.
+	class AvStatusTracker : public ZOOM_SDK_NAMESPACE::IMeetingAudioCtrlEvent,
+		public ZOOM_SDK_NAMESPACE::IMeetingVideoCtrlEvent,
+		public RosterObserver {
+	public:
+		// Called after an event that changed a bit, to schedule an update.
+		using Changed = std::function<void()>;
+
+		AvStatusTracker(AvStatusBits& bits, RosterStore& roster, Changed changed);
+
+		AvStatusTracker(const AvStatusTracker&) = delete;
+		AvStatusTracker& operator=(const AvStatusTracker&) = delete;
+
+		void onUserAudioStatusChange(ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::IUserAudioStatus*>* lstAudioStatusChange, const zchar_t* strAudioStatusList = nullptr) override;
+		void onUserActiveAudioChange(ZOOM_SDK_NAMESPACE::IList<unsigned int>* plstActiveAudio) override;
+		void onHostRequestStartAudio(ZOOM_SDK_NAMESPACE::IRequestStartAudioHandler* handler_) override {}
+		void onJoin3rdPartyTelephonyAudio(const zchar_t* audioInfo) override {}
+		void onMuteOnEntryStatusChange(bool bEnabled) override {}
+
+		void onUserVideoStatusChange(unsigned int userId, ZOOM_SDK_NAMESPACE::VideoStatus status) override;
+		void onSpotlightedUserListChangeNotification(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstSpotlightedUserID) override {}
+		void onHostRequestStartVideo(ZOOM_SDK_NAMESPACE::IRequestStartVideoHandler* handler_) override {}
+		void onActiveSpeakerVideoUserChanged(unsigned int userid) override {}
+		void onActiveVideoUserChanged(unsigned int userid) override {}
+		void onHostVideoOrderUpdated(ZOOM_SDK_NAMESPACE::IList<unsigned int>* orderList) override {}
+		void onLocalVideoOrderUpdated(ZOOM_SDK_NAMESPACE::IList<unsigned int>* localOrderList) override {}
+		void onFollowHostVideoOrderChanged(bool bFollow) override {}
+		void onUserVideoQualityChanged(ZOOM_SDK_NAMESPACE::VideoConnectionQuality quality, unsigned int userid) override {}
+		void onVideoAlphaChannelStatusChanged(bool isAlphaModeOn) override {}
+		void onCameraControlRequestReceived(unsigned int userId, ZOOM_SDK_NAMESPACE::CameraControlRequestType requestType,
+			ZOOM_SDK_NAMESPACE::ICameraControlRequestHandler* pHandler) override {}
+		void onCameraControlRequestResult(unsigned int userId, ZOOM_SDK_NAMESPACE::CameraControlRequestResult result) override {}
+
+		void onRosterJoined(uint32_t id) override;
+		void onRosterLeft(uint32_t id) override;
+		void onRosterChanged(uint32_t id, uint16_t fields) override;
+		void onRosterCleared() override;
+
+	private:
+		// Copies the roster's flags for id into the bits.
+		void mirror(uint32_t id);
+
+		void set(uint32_t id, AvStatus status, bool on);
+
+		AvStatusBits& bits_;
+		RosterStore& roster_;
+		const Changed changed_;
+
+		// The last active audio list.
+		std::vector<uint32_t> active_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_AV_STATUS_TRACKER_H_
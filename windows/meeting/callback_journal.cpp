@@ -0,0 +1,259 @@
+#include "meeting/callback_journal.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr auto kMinFlushInterval = std::chrono::milliseconds(50);
+		constexpr auto kMaxFlushInterval = std::chrono::milliseconds(10000);
+		constexpr size_t kMinQueuedBytes = 64 << 10;
+		constexpr size_t kMaxQueuedBytes = 256 << 20;
+
+		template <typename T>
+		void putLE(uint8_t* out, T value) {
+			std::memcpy(out, &value, sizeof(T));
+		}
+
+		uint64_t unixMs() {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+				std::chrono::system_clock::now().time_since_epoch()).count());
+		}
+
+		size_t varintSize(uint64_t value) {
+			size_t size = 1;
+			while (value >= 0x80) {
+				value >>= 7;
+				size++;
+			}
+			return size;
+		}
+	}
+
+	CallbackJournalConfig CallbackJournalConfig::normalized() const {
+		CallbackJournalConfig config = *this;
+		config.flushInterval = std::clamp(flushInterval, kMinFlushInterval, kMaxFlushInterval);
+		config.maxQueuedBytes = std::clamp(maxQueuedBytes, kMinQueuedBytes, kMaxQueuedBytes);
+		return config;
+	}
+
+	CallbackJournal::CallbackJournal()
+		: recording_(false),
+		generation_(0),
+		recordingGeneration_(0),
+		kind_(CallbackKind::String),
+		nextString_(0),
+		lastUs_(0) {}
+
+	CallbackJournal::~CallbackJournal() {
+		stop();
+	}
+
+	bool CallbackJournal::start(const std::string& path, const CallbackJournalConfig& config) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (recording_.load() || writer_.joinable()) {
+			return false;
+		}
+		if (!file_.open(path)) {
+			return false;
+		}
+
+		uint8_t header[kCallbackJournalHeaderSize] = {};
+		std::memcpy(header, kCallbackJournalMagic, 4);
+		putLE<uint16_t>(header + 4, kCallbackJournalVersion);
+		putLE<uint16_t>(header + 6, static_cast<uint16_t>(kCallbackJournalHeaderSize));
+		putLE<uint64_t>(header + 8, unixMs());
+		if (!file_.write(header, sizeof(header))) {
+			file_.close();
+			return false;
+		}
+
+		// The recording thread may be mid-record; it resets on its next begin().
+		started_ = std::chrono::steady_clock::now();
+		generation_.store(generation_.load() + 1, std::memory_order_release);
+
+		config_ = config.normalized();
+		queue_.clear();
+		stats_ = CallbackJournalStats();
+		stats_.recording = true;
+		stats_.path = path;
+		stats_.bytesWritten = file_.size();
+		recording_.store(true, std::memory_order_release);
+		writer_ = std::thread(&CallbackJournal::run, this);
+		return true;
+	}
+
+	CallbackJournalStats CallbackJournal::stop() {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (!writer_.joinable()) {
+				return stats_;
+			}
+			recording_.store(false, std::memory_order_release);
+		}
+
+		wake_.notify_all();
+		writer_.join();
+
+		std::lock_guard<std::mutex> lock(mutex_);
+		stats_.recording = false;
+		return stats_;
+	}
+
+	CallbackJournalStats CallbackJournal::stats() {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return stats_;
+	}
+
+	void CallbackJournal::begin(CallbackKind kind) {
+		const uint32_t generation = generation_.load(std::memory_order_acquire);
+		if (generation != recordingGeneration_) {
+			// A new file: nothing interned or timed so far is in it.
+			std::lock_guard<std::mutex> lock(mutex_);
+			recordingGeneration_ = generation_.load();
+			start_ = started_;
+			lastUs_ = 0;
+			definitions_.clear();
+			strings_.clear();
+			nextString_ = 0;
+		}
+		// A record abandoned before its commit may have interned strings that
+		// never reach the file.
+		else if (!definitions_.empty()) {
+			definitions_.clear();
+			strings_.clear();
+			nextString_ = 0;
+		}
+		kind_ = kind;
+		payload_.clear();
+	}
+
+	void CallbackJournal::field(uint64_t value) {
+		CallbackJournalPutVarint(payload_, value);
+	}
+
+	void CallbackJournal::signedField(int64_t value) {
+		CallbackJournalPutVarint(payload_, CallbackJournalZigzag(value));
+	}
+
+	void CallbackJournal::string(const std::string& value) {
+		CallbackJournalPutVarint(payload_, intern(value));
+	}
+
+	void CallbackJournal::ids(const uint32_t* ids, size_t count) {
+		CallbackJournalPutVarint(payload_, count);
+		for (size_t i = 0; i < count; i++) {
+			CallbackJournalPutVarint(payload_, ids[i]);
+		}
+	}
+
+	uint32_t CallbackJournal::intern(const std::string& value) {
+		auto it = strings_.find(value);
+		if (it != strings_.end()) {
+			return it->second;
+		}
+
+		if (nextString_ == kCallbackJournalMaxStrings) {
+			strings_.clear();
+			nextString_ = 0;
+		}
+		const uint32_t id = nextString_++;
+		strings_.emplace(value, id);
+
+		// Stamped with the previous record's time; only its place matters.
+		definitions_.push_back(static_cast<uint8_t>(CallbackKind::String));
+		CallbackJournalPutVarint(definitions_, 0);
+		CallbackJournalPutVarint(definitions_, varintSize(id) + value.size());
+		CallbackJournalPutVarint(definitions_, id);
+		definitions_.insert(definitions_.end(), value.begin(), value.end());
+		return id;
+	}
+
+	bool CallbackJournal::commit() {
+		if (!recording_.load(std::memory_order_acquire)) {
+			return false;
+		}
+
+		const uint64_t nowUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now() - start_).count());
+		record_.clear();
+		record_.push_back(static_cast<uint8_t>(kind_));
+		CallbackJournalPutVarint(record_, nowUs >= lastUs_ ? nowUs - lastUs_ : 0);
+		CallbackJournalPutVarint(record_, payload_.size());
+		record_.insert(record_.end(), payload_.begin(), payload_.end());
+
+		bool wake = false;
+		bool dropped = false;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			const size_t bytes = definitions_.size() + record_.size();
+			if (generation_.load() != recordingGeneration_) {
+				// Begun before a restart; its strings are not in the new file.
+				dropped = true;
+			}
+			else if (queue_.size() + bytes > config_.maxQueuedBytes) {
+				stats_.droppedRecords++;
+				dropped = true;
+			}
+			else {
+				// Past half full, the writer goes early rather than drop.
+				const size_t half = config_.maxQueuedBytes / 2;
+				wake = queue_.size() < half && queue_.size() + bytes >= half;
+				queue_.insert(queue_.end(), definitions_.begin(), definitions_.end());
+				queue_.insert(queue_.end(), record_.begin(), record_.end());
+				stats_.records++;
+				stats_.strings = static_cast<uint32_t>(strings_.size());
+				stats_.queuedBytes = queue_.size();
+				lastUs_ = nowUs;
+			}
+		}
+		if (wake) {
+			wake_.notify_all();
+		}
+
+		if (dropped && !definitions_.empty()) {
+			// The dropped definitions never reach the file, so every string
+			// is defined again from id 0.
+			strings_.clear();
+			nextString_ = 0;
+		}
+		definitions_.clear();
+		return !dropped;
+	}
+
+	void CallbackJournal::run() {
+		std::unique_lock<std::mutex> lock(mutex_);
+		const CallbackJournalConfig config = config_;
+		auto nextFlush = std::chrono::steady_clock::now() + config.flushInterval;
+		std::vector<uint8_t> writing;
+
+		while (true) {
+			wake_.wait_until(lock, nextFlush, [this, &config] {
+				return !recording_.load() || queue_.size() >= config.maxQueuedBytes / 2;
+			});
+			const bool stopping = !recording_.load();
+			writing.swap(queue_);
+			stats_.queuedBytes = 0;
+			lock.unlock();
+
+			uint32_t errors = 0;
+			if (!writing.empty() && (!file_.write(writing.data(), writing.size()) || !file_.sync())) {
+				errors++;
+			}
+			writing.clear();
+			nextFlush = std::chrono::steady_clock::now() + config.flushInterval;
+
+			lock.lock();
+			stats_.writeErrors += errors;
+			stats_.bytesWritten = file_.size();
+			if (stopping) {
+				break;
+			}
+		}
+		lock.unlock();
+
+		file_.close();
+	}
+
+}  // namespace flutter_zoom_sdk
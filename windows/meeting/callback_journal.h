@@ -0,0 +1,121 @@
+#ifndef FLUTTER_PLUGIN_MEETING_CALLBACK_JOURNAL_H_
+#define FLUTTER_PLUGIN_MEETING_CALLBACK_JOURNAL_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "media/durable_file.h"
+#include "meeting/callback_journal_format.h"
+
+namespace flutter_zoom_sdk {
+
+	struct CallbackJournalConfig {
+		// Queued records are written out and synced to disk this often.
+		std::chrono::milliseconds flushInterval{ 1000 };
+		// Records are dropped while this much is waiting for the writer.
+		size_t maxQueuedBytes = 4 << 20;
+
+		// Clamps every field into its supported range.
+		CallbackJournalConfig normalized() const;
+	};
+
+	struct CallbackJournalStats {
+		bool recording = false;
+		uint64_t records = 0;
+		uint64_t bytesWritten = 0;
+		uint64_t droppedRecords = 0;
+		uint32_t strings = 0;
+		uint32_t writeErrors = 0;
+		size_t queuedBytes = 0;
+		std::string path;
+	};
+
+	// Writes SDK callbacks to a journal file (see callback_journal_format.h).
+	// The callback's thread encodes each record, interning its strings, and
+	// queues it; a writer thread writes the queue out and syncs it every
+	// flushInterval, so a callback never waits on the disk. A record is built
+	// with begin(), the field calls and commit(), all on one thread, the
+	// SDK's; start(), stop() and stats() may come from any. A start() bumps
+	// the generation, and the recording thread resets its intern table on
+	// its next begin(); a record spanning a restart is dropped.
+	class CallbackJournal {
+	public:
+		CallbackJournal();
+
+		~CallbackJournal();
+
+		CallbackJournal(const CallbackJournal&) = delete;
+		CallbackJournal& operator=(const CallbackJournal&) = delete;
+
+		// path is UTF-8; the file is created or truncated. Fails if already
+		// recording.
+		bool start(const std::string& path, const CallbackJournalConfig& config);
+
+		// Writes out what is queued and closes the file.
+		CallbackJournalStats stop();
+
+		bool isRecording() const { return recording_.load(std::memory_order_acquire); }
+
+		CallbackJournalStats stats();
+
+		void begin(CallbackKind kind);
+
+		void field(uint64_t value);
+
+		void signedField(int64_t value);
+
+		// UTF-8; interned, so a repeated string costs its id.
+		void string(const std::string& value);
+
+		void ids(const uint32_t* ids, size_t count);
+
+		// Timestamps and queues the record. False when it was dropped for a
+		// full queue or the journal is not recording.
+		bool commit();
+
+	private:
+		uint32_t intern(const std::string& value);
+
+		void run();
+
+		std::atomic<bool> recording_;
+		// Bumped by every start(); changed under mutex_.
+		std::atomic<uint32_t> generation_;
+
+		// Recording thread owned.
+		uint32_t recordingGeneration_;
+		CallbackKind kind_;
+		std::vector<uint8_t> payload_;
+		// String records for strings first seen in the current record.
+		std::vector<uint8_t> definitions_;
+		std::unordered_map<std::string, uint32_t> strings_;
+		uint32_t nextString_;
+		std::chrono::steady_clock::time_point start_;
+		uint64_t lastUs_;
+		std::vector<uint8_t> record_;
+
+		std::mutex mutex_;
+		std::condition_variable wake_;
+		// When the current generation started.
+		std::chrono::steady_clock::time_point started_;
+		std::vector<uint8_t> queue_;
+		CallbackJournalConfig config_;
+		CallbackJournalStats stats_;
+
+		// Writer-thread owned.
+		DurableFile file_;
+
+		std::thread writer_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_CALLBACK_JOURNAL_H_
@@ -0,0 +1,191 @@
+#ifndef FLUTTER_PLUGIN_MEETING_CALLBACK_JOURNAL_FORMAT_H_
+#define FLUTTER_PLUGIN_MEETING_CALLBACK_JOURNAL_FORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	// SDK callback journal (.zcj), all little-endian.
+	//
+	// Header, kCallbackJournalHeaderSize bytes:
+	//   0  "ZCBJ"
+	//   4  u16  version (kCallbackJournalVersion)
+	//   6  u16  header size
+	//   8  u64  start time, Unix milliseconds
+	//
+	// Records follow back to back, until the end of the file; a record cut
+	// short by a crash ends the journal:
+	//   u8      CallbackKind
+	//   varint  microseconds on a monotonic clock since the previous record,
+	//           or since the start for the first
+	//   varint  payload bytes
+	//   payload
+	//
+	// Varints are LEB128, signed fields zigzag encoded. Payloads are the
+	// fields listed with each kind, as varints. A string field is the id of
+	// a String record earlier in the journal; a later String record with the
+	// same id replaces the text. An id list is a count, then the ids. Readers
+	// skip kinds they do not know by the payload size.
+	enum class CallbackKind : uint8_t {
+		// id, then UTF-8 bytes to the end of the payload.
+		String = 0,
+
+		// AuthResult.
+		AuthResult = 1,
+		Logout = 2,
+		IdentityExpired = 3,
+
+		// MeetingStatus, signed result.
+		MeetingStatus = 4,
+		// StatisticsWarningType.
+		StatisticsWarning = 5,
+		// MeetingType, kCallbackParameter* bits, meeting number, topic, host.
+		MeetingParameter = 6,
+		// topic.
+		MeetingTopic = 7,
+
+		// id, name, UserRole, kCallbackUser* bits: what the SDK said about
+		// the user, ahead of the participants record that had it asked.
+		User = 8,
+		// ids of the participants list, read when the roster is loaded.
+		RosterLoaded = 9,
+		// ids.
+		UserJoin = 10,
+		// ids.
+		UserLeft = 11,
+		// id.
+		HostChange = 12,
+		// id, co-host 0 or 1.
+		CoHostChange = 13,
+		// id, lowered 0 or 1.
+		HandStatus = 14,
+		AllHandsLowered = 15,
+		// ids.
+		UserNamesChanged = 16,
+
+		// count, then id, AudioStatus and AudioType per user.
+		AudioStatus = 17,
+		// ids.
+		ActiveAudio = 18,
+		// id, VideoStatus.
+		VideoStatus = 19,
+		// id.
+		ActiveSpeakerVideo = 20,
+		// id.
+		ActiveVideo = 21,
+		// ids.
+		SpotlightedUsers = 22,
+		// id, VideoConnectionQuality.
+		VideoQuality = 23,
+
+		// user id, share source id, SharingStatus, ShareType.
+		SharingStatus = 24,
+		// locked 0 or 1.
+		ShareLocked = 25,
+
+		// RecordingStatus.
+		RecordingStatus = 26,
+		// RecordingStatus.
+		CloudRecordingStatus = 27,
+		// can record 0 or 1.
+		RecordPrivilege = 28,
+
+		// message id, sender id, sender name, receiver id, receiver name,
+		// content, signed Unix seconds, SDKChatMessageType, kCallbackChat*
+		// bits.
+		ChatMessage = 29,
+		// kCallbackChatStatus* bits.
+		ChatStatus = 30,
+		// message id, SDKChatMessageDeleteType.
+		ChatMessageDeleted = 31,
+
+		// sender id, text, signed Unix seconds.
+		CaptionMessage = 32,
+		// SDKLiveTranscriptionStatus.
+		LiveTranscriptionStatus = 33,
+		// message id, speaker id, speaker name, content, signed Unix seconds,
+		// SDKLiveTranscriptionOperationType.
+		LiveTranscriptionMessage = 34,
+		// enabled 0 or 1.
+		CaptionStatus = 35,
+		// enabled 0 or 1.
+		ManualCaptionStatus = 36,
+	};
+
+	constexpr uint16_t kCallbackJournalVersion = 1;
+	constexpr size_t kCallbackJournalHeaderSize = 16;
+	constexpr char kCallbackJournalMagic[4] = { 'Z', 'C', 'B', 'J' };
+	constexpr char kCallbackJournalExtension[] = ".zcj";
+
+	// Ids wrap to 0 past this many strings.
+	constexpr uint32_t kCallbackJournalMaxStrings = 4096;
+
+	constexpr uint32_t kCallbackParameterViewOnly = 1 << 0;
+	constexpr uint32_t kCallbackParameterAutoRecordingLocal = 1 << 1;
+	constexpr uint32_t kCallbackParameterAutoRecordingCloud = 1 << 2;
+
+	constexpr uint32_t kCallbackUserHost = 1 << 0;
+	constexpr uint32_t kCallbackUserMyself = 1 << 1;
+	constexpr uint32_t kCallbackUserVideoOn = 1 << 2;
+	constexpr uint32_t kCallbackUserMuted = 1 << 3;
+	constexpr uint32_t kCallbackUserTalking = 1 << 4;
+	constexpr uint32_t kCallbackUserHandRaised = 1 << 5;
+	constexpr uint32_t kCallbackUserWaitingRoom = 1 << 6;
+	constexpr uint32_t kCallbackUserPurePhone = 1 << 7;
+	constexpr uint32_t kCallbackUserBot = 1 << 8;
+	constexpr uint32_t kCallbackUserH323 = 1 << 9;
+	constexpr uint32_t kCallbackUserInterpreter = 1 << 10;
+
+	constexpr uint32_t kCallbackChatToAll = 1 << 0;
+	constexpr uint32_t kCallbackChatToAllPanelists = 1 << 1;
+	constexpr uint32_t kCallbackChatToWaitingRoom = 1 << 2;
+	constexpr uint32_t kCallbackChatComment = 1 << 3;
+
+	// The first four are the members of the status union in declaration
+	// order, whichever of them is in use.
+	constexpr uint32_t kCallbackChatStatusRole0 = 1 << 0;
+	constexpr uint32_t kCallbackChatStatusRole1 = 1 << 1;
+	constexpr uint32_t kCallbackChatStatusRole2 = 1 << 2;
+	constexpr uint32_t kCallbackChatStatusRole3 = 1 << 3;
+	constexpr uint32_t kCallbackChatStatusOff = 1 << 4;
+	constexpr uint32_t kCallbackChatStatusWebinarAttendee = 1 << 5;
+	constexpr uint32_t kCallbackChatStatusWebinar = 1 << 6;
+
+	inline void CallbackJournalPutVarint(std::vector<uint8_t>& out, uint64_t value) {
+		while (value >= 0x80) {
+			out.push_back(static_cast<uint8_t>(value | 0x80));
+			value >>= 7;
+		}
+		out.push_back(static_cast<uint8_t>(value));
+	}
+
+	inline uint64_t CallbackJournalZigzag(int64_t value) {
+		return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+	}
+
+	inline int64_t CallbackJournalUnzigzag(uint64_t value) {
+		return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+	}
+
+	// Reads a varint from [*cursor, end) and advances past it. False when it
+	// runs past end or over 64 bits.
+	inline bool CallbackJournalGetVarint(const uint8_t** cursor, const uint8_t* end, uint64_t& value) {
+		value = 0;
+		for (int shift = 0; shift < 64; shift += 7) {
+			if (*cursor >= end) {
+				return false;
+			}
+			const uint8_t byte = *(*cursor)++;
+			value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+			if ((byte & 0x80) == 0) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_CALLBACK_JOURNAL_FORMAT_H_
@@ -0,0 +1,114 @@
+#include "meeting/callback_journal_reader.h"
+
+#include <cstring>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		template <typename T>
+		T getLE(const uint8_t* in) {
+			T value;
+			std::memcpy(&value, in, sizeof(T));
+			return value;
+		}
+
+		const std::string kNoString;
+	}
+
+	CallbackJournalReader::CallbackJournalReader()
+		: startUnixMs_(0),
+		offset_(0),
+		timeUs_(0),
+		truncated_(false) {}
+
+	bool CallbackJournalReader::open(const std::string& path) {
+		close();
+		if (!file_.open(path)) {
+			return false;
+		}
+
+		const uint8_t* header = file_.data();
+		if (file_.size() < kCallbackJournalHeaderSize || std::memcmp(header, kCallbackJournalMagic, 4) != 0
+			|| getLE<uint16_t>(header + 4) != kCallbackJournalVersion
+			|| getLE<uint16_t>(header + 6) < kCallbackJournalHeaderSize
+			|| getLE<uint16_t>(header + 6) > file_.size()) {
+			close();
+			return false;
+		}
+
+		startUnixMs_ = getLE<uint64_t>(header + 8);
+		rewind();
+		return true;
+	}
+
+	void CallbackJournalReader::close() {
+		file_.close();
+		startUnixMs_ = 0;
+		offset_ = 0;
+		timeUs_ = 0;
+		truncated_ = false;
+		strings_.clear();
+	}
+
+	void CallbackJournalReader::rewind() {
+		offset_ = file_.isOpen() ? getLE<uint16_t>(file_.data() + 6) : 0;
+		timeUs_ = 0;
+		truncated_ = false;
+		strings_.clear();
+	}
+
+	bool CallbackJournalReader::next(CallbackRecord& record) {
+		if (!file_.isOpen()) {
+			return false;
+		}
+
+		const uint8_t* end = file_.data() + file_.size();
+		while (offset_ < file_.size()) {
+			const uint8_t* cursor = file_.data() + offset_;
+			const auto kind = static_cast<CallbackKind>(*cursor++);
+			uint64_t deltaUs = 0;
+			uint64_t payloadBytes = 0;
+			if (!CallbackJournalGetVarint(&cursor, end, deltaUs) || !CallbackJournalGetVarint(&cursor, end, payloadBytes)
+				|| payloadBytes > static_cast<uint64_t>(end - cursor)) {
+				truncated_ = true;
+				return false;
+			}
+
+			const uint8_t* payloadEnd = cursor + payloadBytes;
+			offset_ = static_cast<size_t>(payloadEnd - file_.data());
+			timeUs_ += deltaUs;
+
+			if (kind == CallbackKind::String) {
+				uint64_t id = 0;
+				if (!CallbackJournalGetVarint(&cursor, payloadEnd, id) || id >= kCallbackJournalMaxStrings) {
+					truncated_ = true;
+					return false;
+				}
+				if (id >= strings_.size()) {
+					strings_.resize(static_cast<size_t>(id) + 1);
+				}
+				strings_[static_cast<size_t>(id)].assign(reinterpret_cast<const char*>(cursor), payloadEnd - cursor);
+				continue;
+			}
+
+			record.kind = kind;
+			record.timeUs = timeUs_;
+			record.fields.clear();
+			while (cursor < payloadEnd) {
+				uint64_t value = 0;
+				if (!CallbackJournalGetVarint(&cursor, payloadEnd, value)) {
+					truncated_ = true;
+					return false;
+				}
+				record.fields.push_back(value);
+			}
+			return true;
+		}
+		return false;
+	}
+
+	const std::string& CallbackJournalReader::string(uint64_t id) const {
+		return id < strings_.size() ? strings_[static_cast<size_t>(id)] : kNoString;
+	}
+
+}  // namespace flutter_zoom_sdk
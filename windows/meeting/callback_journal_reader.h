@@ -0,0 +1,66 @@
+#ifndef FLUTTER_PLUGIN_MEETING_CALLBACK_JOURNAL_READER_H_
+#define FLUTTER_PLUGIN_MEETING_CALLBACK_JOURNAL_READER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "media/mapped_file.h"
+#include "meeting/callback_journal_format.h"
+
+namespace flutter_zoom_sdk {
+
+	struct CallbackRecord {
+		CallbackKind kind = CallbackKind::String;
+		// Since the journal started.
+		uint64_t timeUs = 0;
+		// The payload's varints, still zigzag encoded where signed.
+		std::vector<uint64_t> fields;
+	};
+
+	// Reads a callback journal through a memory mapping, one record at a
+	// time, keeping the string table as the String records go by.
+	class CallbackJournalReader {
+	public:
+		CallbackJournalReader();
+
+		CallbackJournalReader(const CallbackJournalReader&) = delete;
+		CallbackJournalReader& operator=(const CallbackJournalReader&) = delete;
+
+		// path is UTF-8.
+		bool open(const std::string& path);
+
+		void close();
+
+		bool isOpen() const { return file_.isOpen(); }
+
+		uint64_t startUnixMs() const { return startUnixMs_; }
+
+		// Fills record with the next record that is not a String record.
+		// False at the end of the journal, including a record cut short or
+		// one whose payload does not parse.
+		bool next(CallbackRecord& record);
+
+		// Back to the first record, forgetting the strings.
+		void rewind();
+
+		// The text of string id as of the last record read; empty when
+		// undefined.
+		const std::string& string(uint64_t id) const;
+
+		// Whether the journal ended with bytes that are not a whole record.
+		bool truncated() const { return truncated_; }
+
+	private:
+		MappedFile file_;
+		uint64_t startUnixMs_;
+		size_t offset_;
+		uint64_t timeUs_;
+		bool truncated_;
+		std::vector<std::string> strings_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_CALLBACK_JOURNAL_READER_H_
@@ -0,0 +1,351 @@
+#include "meeting/callback_recorder.h"
+
+#include "util/zchar_util.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		std::string text(const zchar_t* value) {
+			return value ? ToUtf8(value) : std::string();
+		}
+
+		uint32_t userBits(ZOOM_SDK_NAMESPACE::IUserInfo& user) {
+			uint32_t bits = 0;
+			bits |= user.IsHost() ? kCallbackUserHost : 0;
+			bits |= user.IsMySelf() ? kCallbackUserMyself : 0;
+			bits |= user.IsVideoOn() ? kCallbackUserVideoOn : 0;
+			bits |= user.IsAudioMuted() ? kCallbackUserMuted : 0;
+			bits |= user.IsTalking() ? kCallbackUserTalking : 0;
+			bits |= user.IsRaiseHand() ? kCallbackUserHandRaised : 0;
+			bits |= user.IsInWaitingRoom() ? kCallbackUserWaitingRoom : 0;
+			bits |= user.IsPurePhoneUser() ? kCallbackUserPurePhone : 0;
+			bits |= user.IsBotUser() ? kCallbackUserBot : 0;
+			bits |= user.IsH323User() ? kCallbackUserH323 : 0;
+#if defined(WIN32)
+			bits |= user.IsInterpreter() ? kCallbackUserInterpreter : 0;
+#endif
+			return bits;
+		}
+
+		uint32_t chatStatusBits(const ZOOM_SDK_NAMESPACE::ChatStatus& status) {
+			bool role[4] = {};
+			if (!status.is_webinar_meeting) {
+				const ZOOM_SDK_NAMESPACE::NormalMeetingChatStatus& normal = status.ut.normal_meeting_status;
+				role[0] = normal.can_chat;
+				role[1] = normal.can_chat_to_all;
+				role[2] = normal.can_chat_to_individual;
+				role[3] = normal.is_only_can_chat_to_host;
+			}
+			else if (status.is_webinar_attendee) {
+				const ZOOM_SDK_NAMESPACE::WebinarAttendeeChatStatus& attendee = status.ut.webinar_attendee_status;
+				role[0] = attendee.can_chat;
+				role[1] = attendee.can_chat_to_all_panellist_and_attendee;
+				role[2] = attendee.can_chat_to_all_panellist;
+			}
+			else {
+				const ZOOM_SDK_NAMESPACE::WebinarOtherUserRoleChatStatus& other = status.ut.webinar_other_status;
+				role[0] = other.can_chat_to_all_panellist;
+				role[1] = other.can_chat_to_all_panellist_and_attendee;
+				role[2] = other.can_chat_to_individual;
+			}
+
+			uint32_t bits = 0;
+			bits |= role[0] ? kCallbackChatStatusRole0 : 0;
+			bits |= role[1] ? kCallbackChatStatusRole1 : 0;
+			bits |= role[2] ? kCallbackChatStatusRole2 : 0;
+			bits |= role[3] ? kCallbackChatStatusRole3 : 0;
+			bits |= status.is_chat_off ? kCallbackChatStatusOff : 0;
+			bits |= status.is_webinar_attendee ? kCallbackChatStatusWebinarAttendee : 0;
+			bits |= status.is_webinar_meeting ? kCallbackChatStatusWebinar : 0;
+			return bits;
+		}
+	}
+
+	CallbackRecorder::CallbackRecorder(CallbackJournal& journal, UserLookup lookup)
+		: journal_(journal),
+		lookup_(std::move(lookup)) {}
+
+	void CallbackRecorder::record(CallbackKind kind, std::initializer_list<uint64_t> values) {
+		if (!journal_.isRecording()) {
+			return;
+		}
+
+		journal_.begin(kind);
+		for (uint64_t value : values) {
+			journal_.field(value);
+		}
+		journal_.commit();
+	}
+
+	void CallbackRecorder::recordUsers(CallbackKind kind, ZOOM_SDK_NAMESPACE::IList<unsigned int>* users, bool described) {
+		if (!journal_.isRecording()) {
+			return;
+		}
+
+		ids_.clear();
+		const int count = users ? users->GetCount() : 0;
+		for (int i = 0; i < count; i++) {
+			ids_.push_back(users->GetItem(i));
+		}
+		if (described) {
+			for (uint32_t id : ids_) {
+				describe(id);
+			}
+		}
+
+		journal_.begin(kind);
+		journal_.ids(ids_.data(), ids_.size());
+		journal_.commit();
+	}
+
+	void CallbackRecorder::describe(uint32_t userId) {
+		ZOOM_SDK_NAMESPACE::IUserInfo* user = lookup_ ? lookup_(userId) : nullptr;
+		if (!user) {
+			return;
+		}
+
+		journal_.begin(CallbackKind::User);
+		journal_.field(userId);
+		journal_.string(text(user->GetUserName()));
+		journal_.field(static_cast<uint64_t>(user->GetUserRole()));
+		journal_.field(userBits(*user));
+		journal_.commit();
+	}
+
+	void CallbackRecorder::onAuthResult(ZOOM_SDK_NAMESPACE::AuthResult result) {
+		record(CallbackKind::AuthResult, { static_cast<uint64_t>(result) });
+	}
+
+	void CallbackRecorder::onLogout() {
+		record(CallbackKind::Logout, {});
+	}
+
+	void CallbackRecorder::onIdentityExpired() {
+		record(CallbackKind::IdentityExpired, {});
+	}
+
+	void CallbackRecorder::onMeetingStatus(ZOOM_SDK_NAMESPACE::MeetingStatus status, int result) {
+		record(CallbackKind::MeetingStatus, { static_cast<uint64_t>(status), CallbackJournalZigzag(result) });
+	}
+
+	void CallbackRecorder::onStatisticsWarning(ZOOM_SDK_NAMESPACE::StatisticsWarningType type) {
+		record(CallbackKind::StatisticsWarning, { static_cast<uint64_t>(type) });
+	}
+
+	void CallbackRecorder::onMeetingParameter(const ZOOM_SDK_NAMESPACE::MeetingParameter& parameter) {
+		if (!journal_.isRecording()) {
+			return;
+		}
+
+		uint32_t bits = 0;
+		bits |= parameter.is_view_only ? kCallbackParameterViewOnly : 0;
+		bits |= parameter.is_auto_recording_local ? kCallbackParameterAutoRecordingLocal : 0;
+		bits |= parameter.is_auto_recording_cloud ? kCallbackParameterAutoRecordingCloud : 0;
+		journal_.begin(CallbackKind::MeetingParameter);
+		journal_.field(static_cast<uint64_t>(parameter.meeting_type));
+		journal_.field(bits);
+		journal_.field(parameter.meeting_number);
+		journal_.string(text(parameter.meeting_topic));
+		journal_.string(text(parameter.meeting_host));
+		journal_.commit();
+	}
+
+	void CallbackRecorder::onMeetingTopic(const zchar_t* topic) {
+		if (!journal_.isRecording()) {
+			return;
+		}
+
+		journal_.begin(CallbackKind::MeetingTopic);
+		journal_.string(text(topic));
+		journal_.commit();
+	}
+
+	void CallbackRecorder::onRosterLoaded(ZOOM_SDK_NAMESPACE::IList<unsigned int>* users) {
+		recordUsers(CallbackKind::RosterLoaded, users, true);
+	}
+
+	void CallbackRecorder::onUserAudioStatusChange(ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::IUserAudioStatus*>* lstAudioStatusChange, const zchar_t* strAudioStatusList) {
+		if (!journal_.isRecording()) {
+			return;
+		}
+
+		const int count = lstAudioStatusChange ? lstAudioStatusChange->GetCount() : 0;
+		journal_.begin(CallbackKind::AudioStatus);
+		ids_.clear();
+		for (int i = 0; i < count; i++) {
+			ZOOM_SDK_NAMESPACE::IUserAudioStatus* status = lstAudioStatusChange->GetItem(i);
+			if (status) {
+				ids_.push_back(status->GetUserId());
+				ids_.push_back(static_cast<uint32_t>(status->GetStatus()));
+				ids_.push_back(static_cast<uint32_t>(status->GetAudioType()));
+			}
+		}
+		journal_.field(ids_.size() / 3);
+		for (uint32_t value : ids_) {
+			journal_.field(value);
+		}
+		journal_.commit();
+	}
+
+	void CallbackRecorder::onUserActiveAudioChange(ZOOM_SDK_NAMESPACE::IList<unsigned int>* plstActiveAudio) {
+		recordUsers(CallbackKind::ActiveAudio, plstActiveAudio, false);
+	}
+
+	void CallbackRecorder::onUserVideoStatusChange(unsigned int userId, ZOOM_SDK_NAMESPACE::VideoStatus status) {
+		record(CallbackKind::VideoStatus, { userId, static_cast<uint64_t>(status) });
+	}
+
+	void CallbackRecorder::onSpotlightedUserListChangeNotification(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstSpotlightedUserID) {
+		recordUsers(CallbackKind::SpotlightedUsers, lstSpotlightedUserID, false);
+	}
+
+	void CallbackRecorder::onActiveSpeakerVideoUserChanged(unsigned int userid) {
+		record(CallbackKind::ActiveSpeakerVideo, { userid });
+	}
+
+	void CallbackRecorder::onActiveVideoUserChanged(unsigned int userid) {
+		record(CallbackKind::ActiveVideo, { userid });
+	}
+
+	void CallbackRecorder::onUserVideoQualityChanged(ZOOM_SDK_NAMESPACE::VideoConnectionQuality quality, unsigned int userid) {
+		record(CallbackKind::VideoQuality, { userid, static_cast<uint64_t>(quality) });
+	}
+
+	void CallbackRecorder::onSharingStatus(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) {
+		record(CallbackKind::SharingStatus, { shareInfo.userid, shareInfo.shareSourceID,
+			static_cast<uint64_t>(shareInfo.status), static_cast<uint64_t>(shareInfo.contentType) });
+	}
+
+	void CallbackRecorder::onLockShareStatus(bool bLocked) {
+		record(CallbackKind::ShareLocked, { bLocked ? 1u : 0u });
+	}
+
+	void CallbackRecorder::onRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) {
+		record(CallbackKind::RecordingStatus, { static_cast<uint64_t>(status) });
+	}
+
+	void CallbackRecorder::onCloudRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) {
+		record(CallbackKind::CloudRecordingStatus, { static_cast<uint64_t>(status) });
+	}
+
+	void CallbackRecorder::onRecordPrivilegeChanged(bool bCanRec) {
+		record(CallbackKind::RecordPrivilege, { bCanRec ? 1u : 0u });
+	}
+
+	void CallbackRecorder::onChatMsgNotification(ZOOM_SDK_NAMESPACE::IChatMsgInfo* chatMsg, const zchar_t* content) {
+		if (!chatMsg || !journal_.isRecording()) {
+			return;
+		}
+
+		uint32_t bits = 0;
+		bits |= chatMsg->IsChatToAll() ? kCallbackChatToAll : 0;
+		bits |= chatMsg->IsChatToAllPanelist() ? kCallbackChatToAllPanelists : 0;
+		bits |= chatMsg->IsChatToWaitingroom() ? kCallbackChatToWaitingRoom : 0;
+		bits |= chatMsg->IsComment() ? kCallbackChatComment : 0;
+		journal_.begin(CallbackKind::ChatMessage);
+		journal_.string(text(chatMsg->GetMessageID()));
+		journal_.field(chatMsg->GetSenderUserId());
+		journal_.string(text(chatMsg->GetSenderDisplayName()));
+		journal_.field(chatMsg->GetReceiverUserId());
+		journal_.string(text(chatMsg->GetReceiverDisplayName()));
+		journal_.string(text(content ? content : chatMsg->GetContent()));
+		journal_.signedField(static_cast<int64_t>(chatMsg->GetTimeStamp()));
+		journal_.field(static_cast<uint64_t>(chatMsg->GetChatMessageType()));
+		journal_.field(bits);
+		journal_.commit();
+	}
+
+	void CallbackRecorder::onChatStatusChangedNotification(ZOOM_SDK_NAMESPACE::ChatStatus* status_) {
+		if (status_) {
+			record(CallbackKind::ChatStatus, { chatStatusBits(*status_) });
+		}
+	}
+
+	void CallbackRecorder::onChatMsgDeleteNotification(const zchar_t* msgID, ZOOM_SDK_NAMESPACE::SDKChatMessageDeleteType deleteBy) {
+		if (!journal_.isRecording()) {
+			return;
+		}
+
+		journal_.begin(CallbackKind::ChatMessageDeleted);
+		journal_.string(text(msgID));
+		journal_.field(static_cast<uint64_t>(deleteBy));
+		journal_.commit();
+	}
+
+	void CallbackRecorder::onClosedCaptionMsgReceived(const zchar_t* ccMsg, unsigned int sender_id, time_t time) {
+		if (!journal_.isRecording()) {
+			return;
+		}
+
+		journal_.begin(CallbackKind::CaptionMessage);
+		journal_.field(sender_id);
+		journal_.string(text(ccMsg));
+		journal_.signedField(static_cast<int64_t>(time));
+		journal_.commit();
+	}
+
+	void CallbackRecorder::onLiveTranscriptionStatus(ZOOM_SDK_NAMESPACE::SDKLiveTranscriptionStatus status) {
+		record(CallbackKind::LiveTranscriptionStatus, { static_cast<uint64_t>(status) });
+	}
+
+	void CallbackRecorder::onLiveTranscriptionMsgInfoReceived(ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo* messageInfo) {
+		if (!messageInfo || !journal_.isRecording()) {
+			return;
+		}
+
+		journal_.begin(CallbackKind::LiveTranscriptionMessage);
+		journal_.string(text(messageInfo->GetMessageID()));
+		journal_.field(messageInfo->GetSpeakerID());
+		journal_.string(text(messageInfo->GetSpeakerName()));
+		journal_.string(text(messageInfo->GetMessageContent()));
+		journal_.signedField(static_cast<int64_t>(messageInfo->GetTimeStamp()));
+		journal_.field(static_cast<uint64_t>(messageInfo->GetMessageOperationType()));
+		journal_.commit();
+	}
+
+	void CallbackRecorder::onCaptionStatusChanged(bool bEnabled) {
+		record(CallbackKind::CaptionStatus, { bEnabled ? 1u : 0u });
+	}
+
+	void CallbackRecorder::onManualCaptionStatusChanged(bool bEnabled) {
+		record(CallbackKind::ManualCaptionStatus, { bEnabled ? 1u : 0u });
+	}
+
+	void CallbackRecorder::onUserJoin(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID, const zchar_t* strUserList) {
+		recordUsers(CallbackKind::UserJoin, lstUserID, true);
+	}
+
+	void CallbackRecorder::onUserLeft(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID, const zchar_t* strUserList) {
+		recordUsers(CallbackKind::UserLeft, lstUserID, false);
+	}
+
+	void CallbackRecorder::onHostChangeNotification(unsigned int userId) {
+		if (journal_.isRecording()) {
+			describe(userId);
+		}
+		record(CallbackKind::HostChange, { userId });
+	}
+
+	void CallbackRecorder::onLowOrRaiseHandStatusChanged(bool bLow, unsigned int userid) {
+		if (journal_.isRecording()) {
+			describe(userid);
+		}
+		record(CallbackKind::HandStatus, { userid, bLow ? 1u : 0u });
+	}
+
+	void CallbackRecorder::onUserNamesChanged(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID) {
+		recordUsers(CallbackKind::UserNamesChanged, lstUserID, true);
+	}
+
+	void CallbackRecorder::onCoHostChangeNotification(unsigned int userId, bool isCoHost) {
+		if (journal_.isRecording()) {
+			describe(userId);
+		}
+		record(CallbackKind::CoHostChange, { userId, isCoHost ? 1u : 0u });
+	}
+
+	void CallbackRecorder::onAllHandsLowered() {
+		record(CallbackKind::AllHandsLowered, {});
+	}
+
+}  // namespace flutter_zoom_sdk
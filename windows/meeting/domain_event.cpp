@@ -0,0 +1,45 @@
+#include "meeting/domain_event.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		template <typename T>
+		void putLE(uint8_t* dst, T value) {
+			std::memcpy(dst, &value, sizeof(T));
+		}
+	}
+
+	void writeDomainEvent(const DomainEvent& event, uint64_t sequence, std::vector<uint8_t>& out, size_t reservedPrefix) {
+		const size_t strings = std::min(event.strings.size(), kMaxDomainEventStrings);
+		size_t size = reservedPrefix + kDomainEventHeaderSize;
+		for (size_t i = 0; i < strings; i++) {
+			size += sizeof(uint32_t) + event.strings[i].size();
+		}
+		out.resize(size);
+
+		uint8_t* header = out.data() + reservedPrefix;
+		header[0] = kDomainEventFormat;
+		header[1] = event.kind;
+		header[2] = static_cast<uint8_t>(strings);
+		header[3] = 0;
+		putLE<uint32_t>(header + 4, event.userId);
+		putLE<uint32_t>(header + 8, event.otherId);
+		putLE<int32_t>(header + 12, event.value);
+		putLE<int64_t>(header + 16, event.timeMs);
+		putLE<uint64_t>(header + 24, sequence);
+
+		uint8_t* at = header + kDomainEventHeaderSize;
+		for (size_t i = 0; i < strings; i++) {
+			const std::string& text = event.strings[i];
+			putLE<uint32_t>(at, static_cast<uint32_t>(text.size()));
+			if (!text.empty()) {
+				std::memcpy(at + sizeof(uint32_t), text.data(), text.size());
+			}
+			at += sizeof(uint32_t) + text.size();
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
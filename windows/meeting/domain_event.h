@@ -0,0 +1,88 @@
+#ifndef FLUTTER_PLUGIN_MEETING_DOMAIN_EVENT_H_
+#define FLUTTER_PLUGIN_MEETING_DOMAIN_EVENT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	enum class ChatEventKind : uint8_t {
+		// Strings: message id, content, sender name, receiver name. Value is
+		// the SDKChatMessageType; the other id is the receiver, 0 for everyone.
+		Message = 0,
+		// As Message.
+		Edited = 1,
+		// Strings: message id. Value is the SDKChatMessageDeleteType.
+		Deleted = 2,
+	};
+
+	enum class CaptionEventKind : uint8_t {
+		// Strings: an empty message id, text.
+		ClosedCaption = 0,
+		// Strings: message id, content, speaker name. Value is the
+		// SDKLiveTranscriptionOperationType.
+		Transcription = 1,
+		// As Transcription, in the speaker's own language.
+		OriginalLanguage = 2,
+	};
+
+	enum class SharingEventKind : uint8_t {
+		// Value is the SharingStatus; the other id is the share source.
+		Status = 0,
+		// Value is the ShareType; the other id is the share source.
+		Content = 1,
+		// Value is 0 or 1.
+		Locked = 2,
+		FailedToStart = 3,
+	};
+
+	enum class RecordingEventKind : uint8_t {
+		// Value is the RecordingStatus.
+		Local = 0,
+		Cloud = 1,
+		// Value is 0 or 1.
+		Privilege = 2,
+		// Value is the RequestLocalRecordingStatus.
+		LocalPrivilegeRequest = 3,
+		// Value is the RequestStartCloudRecordingStatus.
+		CloudRequest = 4,
+		// Time is the end of the grace period.
+		StorageFull = 5,
+	};
+
+	// Layout of every chat, caption, sharing and recording event, all
+	// little-endian:
+	//   0  u8   format (kDomainEventFormat)
+	//   1  u8   kind, of the channel's domain
+	//   2  u8   string count
+	//   3  u8   reserved, 0
+	//   4  u32  user id: the sender, speaker or sharer; 0 for none
+	//   8  u32  other id, as the kind says; 0 for none
+	//   12 i32  value, as the kind says
+	//   16 i64  time, Unix milliseconds; 0 when the SDK gives none
+	//   24 u64  sequence, counting the channel's events; a gap means some
+	//           were dropped
+	//   32      strings, each a u32 byte count and that many UTF-8 bytes
+	constexpr uint8_t kDomainEventFormat = 1;
+	constexpr size_t kDomainEventHeaderSize = 32;
+	constexpr size_t kMaxDomainEventStrings = 4;
+
+	struct DomainEvent {
+		uint8_t kind = 0;
+		uint32_t userId = 0;
+		uint32_t otherId = 0;
+		int32_t value = 0;
+		int64_t timeMs = 0;
+		// Up to kMaxDomainEventStrings; the rest are not written.
+		std::vector<std::string> strings;
+	};
+
+	// Writes event after reservedPrefix bytes of out, resizing it to fit.
+	void writeDomainEvent(const DomainEvent& event, uint64_t sequence, std::vector<uint8_t>& out,
+		size_t reservedPrefix = 0);
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_DOMAIN_EVENT_H_
@@ -0,0 +1,130 @@
+#ifndef FLUTTER_PLUGIN_MEETING_EVENT_JOURNAL_H_
+#define FLUTTER_PLUGIN_MEETING_EVENT_JOURNAL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	enum class JournalOverflow : uint8_t {
+		// A full journal forgets its oldest event for the new one.
+		DropOldest = 0,
+		// A full journal keeps what it has and refuses the new event.
+		DropNewest = 1,
+	};
+
+	// Bounded ring of the latest events, so a listener that arrives late, or
+	// again after a hot restart, can be replayed what it missed. Holds at
+	// most capacity events and replays only those younger than maxAgeMs, 0
+	// meaning any age. Times are in milliseconds on any monotonic clock. Not
+	// thread-safe.
+	template <typename Event>
+	class EventJournal {
+	public:
+		explicit EventJournal(size_t capacity, uint64_t maxAgeMs = 0, JournalOverflow overflow = JournalOverflow::DropOldest)
+			: capacity_(capacity),
+			maxAgeMs_(maxAgeMs),
+			overflow_(overflow),
+			head_(0),
+			size_(0),
+			dropped_(0) {
+			entries_.resize(capacity);
+		}
+
+		// Keeps the newest events that still fit.
+		void configure(size_t capacity, uint64_t maxAgeMs, JournalOverflow overflow) {
+			std::vector<Entry> entries;
+			entries.reserve(capacity);
+			const size_t keep = size_ < capacity ? size_ : capacity;
+			for (size_t i = size_ - keep; i < size_; i++) {
+				entries.push_back(std::move(at(i)));
+			}
+			dropped_ += size_ - keep;
+			entries.resize(capacity);
+
+			entries_ = std::move(entries);
+			capacity_ = capacity;
+			maxAgeMs_ = maxAgeMs;
+			overflow_ = overflow;
+			head_ = 0;
+			size_ = keep;
+		}
+
+		// Returns false when the event was dropped instead.
+		bool push(uint64_t now, Event event) {
+			if (capacity_ == 0) {
+				dropped_++;
+				return false;
+			}
+			if (size_ == capacity_) {
+				dropped_++;
+				if (overflow_ == JournalOverflow::DropNewest) {
+					return false;
+				}
+				head_ = (head_ + 1) % capacity_;
+				size_--;
+			}
+
+			Entry& entry = entries_[(head_ + size_) % capacity_];
+			entry.time = now;
+			entry.event = std::move(event);
+			size_++;
+			return true;
+		}
+
+		// Calls visit(event) for each event young enough at now, oldest first.
+		template <typename Visit>
+		void replay(uint64_t now, Visit&& visit) const {
+			for (size_t i = 0; i < size_; i++) {
+				const Entry& entry = at(i);
+				if (maxAgeMs_ != 0 && now >= entry.time && now - entry.time > maxAgeMs_) {
+					continue;
+				}
+				visit(entry.event);
+			}
+		}
+
+		void clear() {
+			for (Entry& entry : entries_) {
+				entry.event = Event();
+			}
+			head_ = 0;
+			size_ = 0;
+		}
+
+		size_t size() const { return size_; }
+
+		size_t capacity() const { return capacity_; }
+
+		uint64_t maxAgeMs() const { return maxAgeMs_; }
+
+		JournalOverflow overflow() const { return overflow_; }
+
+		// Events lost to a full journal or a smaller capacity.
+		uint64_t dropped() const { return dropped_; }
+
+	private:
+		struct Entry {
+			uint64_t time = 0;
+			Event event = Event();
+		};
+
+		Entry& at(size_t i) { return entries_[(head_ + i) % capacity_]; }
+
+		const Entry& at(size_t i) const { return entries_[(head_ + i) % capacity_]; }
+
+		std::vector<Entry> entries_;
+		size_t capacity_;
+		uint64_t maxAgeMs_;
+		JournalOverflow overflow_;
+		// Index of the oldest event.
+		size_t head_;
+		size_t size_;
+		uint64_t dropped_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_EVENT_JOURNAL_H_
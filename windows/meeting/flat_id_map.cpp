@@ -0,0 +1,132 @@
+#include "meeting/flat_id_map.h"
+
+#include <algorithm>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr size_t kMinCapacity = 16;
+
+		size_t capacityFor(size_t expected) {
+			size_t capacity = kMinCapacity;
+			while (capacity < expected * 2) {
+				capacity *= 2;
+			}
+			return capacity;
+		}
+
+		int log2(size_t value) {
+			int bits = 0;
+			while (value > 1) {
+				value >>= 1;
+				bits++;
+			}
+			return bits;
+		}
+	}
+
+	FlatIdMap::FlatIdMap(size_t expected)
+		: mask_(0),
+		shift_(0),
+		size_(0) {
+		rehash(capacityFor(expected));
+	}
+
+	size_t FlatIdMap::home(uint32_t key) const {
+		// Fibonacci hashing: user ids are often sequential, which the
+		// multiply spreads over the whole table.
+		return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> shift_);
+	}
+
+	uint32_t FlatIdMap::find(uint32_t key) const {
+		if (key == 0) {
+			return kMissing;
+		}
+
+		for (size_t i = home(key);; i = (i + 1) & mask_) {
+			const Slot& slot = slots_[i];
+			if (slot.key == key) {
+				return slot.value;
+			}
+			if (slot.key == 0) {
+				return kMissing;
+			}
+		}
+	}
+
+	void FlatIdMap::set(uint32_t key, uint32_t value) {
+		if (key == 0) {
+			return;
+		}
+		if ((size_ + 1) * 2 > slots_.size()) {
+			rehash(slots_.size() * 2);
+		}
+
+		for (size_t i = home(key);; i = (i + 1) & mask_) {
+			Slot& slot = slots_[i];
+			if (slot.key == key) {
+				slot.value = value;
+				return;
+			}
+			if (slot.key == 0) {
+				slot = { key, value };
+				size_++;
+				return;
+			}
+		}
+	}
+
+	bool FlatIdMap::erase(uint32_t key) {
+		if (key == 0) {
+			return false;
+		}
+
+		size_t hole = home(key);
+		while (slots_[hole].key != key) {
+			if (slots_[hole].key == 0) {
+				return false;
+			}
+			hole = (hole + 1) & mask_;
+		}
+
+		// Pull back every later entry of the run whose home is not between
+		// the hole and its slot, so lookups never hit a gap early.
+		for (size_t i = (hole + 1) & mask_; slots_[i].key != 0; i = (i + 1) & mask_) {
+			const size_t want = home(slots_[i].key);
+			if (((i - want) & mask_) >= ((i - hole) & mask_)) {
+				slots_[hole] = slots_[i];
+				hole = i;
+			}
+		}
+		slots_[hole] = { 0, 0 };
+		size_--;
+		return true;
+	}
+
+	void FlatIdMap::reserve(size_t expected) {
+		const size_t capacity = capacityFor(expected);
+		if (capacity > slots_.size()) {
+			rehash(capacity);
+		}
+	}
+
+	void FlatIdMap::clear() {
+		std::fill(slots_.begin(), slots_.end(), Slot{ 0, 0 });
+		size_ = 0;
+	}
+
+	void FlatIdMap::rehash(size_t capacity) {
+		std::vector<Slot> old;
+		old.swap(slots_);
+		slots_.assign(capacity, Slot{ 0, 0 });
+		mask_ = capacity - 1;
+		shift_ = 64 - log2(capacity);
+		size_ = 0;
+		for (const Slot& slot : old) {
+			if (slot.key != 0) {
+				set(slot.key, slot.value);
+			}
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,53 @@
+#ifndef FLUTTER_PLUGIN_MEETING_FLAT_ID_MAP_H_
+#define FLUTTER_PLUGIN_MEETING_FLAT_ID_MAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	// Open-addressing map from non-zero user ids to 32-bit values, in one
+	// flat array of key/value slots. Linear probing keeps a lookup to a cache
+	// line or two; deletion shifts the following run back instead of leaving
+	// tombstones, so join/leave churn never degrades probes. The table is at
+	// most half full. Not thread-safe.
+	class FlatIdMap {
+	public:
+		static constexpr uint32_t kMissing = UINT32_MAX;
+
+		explicit FlatIdMap(size_t expected = 0);
+
+		// kMissing when key is absent.
+		uint32_t find(uint32_t key) const;
+
+		// Inserts or overwrites. key 0 is reserved for empty slots and ignored.
+		void set(uint32_t key, uint32_t value);
+
+		bool erase(uint32_t key);
+
+		void reserve(size_t expected);
+
+		void clear();
+
+		size_t size() const { return size_; }
+
+	private:
+		struct Slot {
+			uint32_t key;
+			uint32_t value;
+		};
+
+		size_t home(uint32_t key) const;
+
+		void rehash(size_t capacity);
+
+		std::vector<Slot> slots_;
+		size_t mask_;
+		int shift_;
+		size_t size_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_FLAT_ID_MAP_H_
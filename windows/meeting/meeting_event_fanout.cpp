@@ -0,0 +1,363 @@
+#include "meeting/meeting_event_fanout.h"
+
+namespace flutter_zoom_sdk {
+	using ZOOM_SDK_NAMESPACE::IClosedCaptionControllerEvent;
+	using ZOOM_SDK_NAMESPACE::IMeetingAudioCtrlEvent;
+	using ZOOM_SDK_NAMESPACE::IMeetingChatCtrlEvent;
+	using ZOOM_SDK_NAMESPACE::IMeetingParticipantsCtrlEvent;
+	using ZOOM_SDK_NAMESPACE::IMeetingRecordingCtrlEvent;
+	using ZOOM_SDK_NAMESPACE::IMeetingShareCtrlEvent;
+	using ZOOM_SDK_NAMESPACE::IMeetingVideoCtrlEvent;
+
+	void VideoEventFanout::onUserVideoStatusChange(unsigned int userId, ZOOM_SDK_NAMESPACE::VideoStatus status) {
+		forward(&IMeetingVideoCtrlEvent::onUserVideoStatusChange, userId, status);
+	}
+
+	void VideoEventFanout::onSpotlightedUserListChangeNotification(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstSpotlightedUserID) {
+		forward(&IMeetingVideoCtrlEvent::onSpotlightedUserListChangeNotification, lstSpotlightedUserID);
+	}
+
+	void VideoEventFanout::onHostRequestStartVideo(ZOOM_SDK_NAMESPACE::IRequestStartVideoHandler* handler_) {
+		forward(&IMeetingVideoCtrlEvent::onHostRequestStartVideo, handler_);
+	}
+
+	void VideoEventFanout::onActiveSpeakerVideoUserChanged(unsigned int userid) {
+		forward(&IMeetingVideoCtrlEvent::onActiveSpeakerVideoUserChanged, userid);
+	}
+
+	void VideoEventFanout::onActiveVideoUserChanged(unsigned int userid) {
+		forward(&IMeetingVideoCtrlEvent::onActiveVideoUserChanged, userid);
+	}
+
+	void VideoEventFanout::onHostVideoOrderUpdated(ZOOM_SDK_NAMESPACE::IList<unsigned int>* orderList) {
+		forward(&IMeetingVideoCtrlEvent::onHostVideoOrderUpdated, orderList);
+	}
+
+	void VideoEventFanout::onLocalVideoOrderUpdated(ZOOM_SDK_NAMESPACE::IList<unsigned int>* localOrderList) {
+		forward(&IMeetingVideoCtrlEvent::onLocalVideoOrderUpdated, localOrderList);
+	}
+
+	void VideoEventFanout::onFollowHostVideoOrderChanged(bool bFollow) {
+		forward(&IMeetingVideoCtrlEvent::onFollowHostVideoOrderChanged, bFollow);
+	}
+
+	void VideoEventFanout::onUserVideoQualityChanged(ZOOM_SDK_NAMESPACE::VideoConnectionQuality quality, unsigned int userid) {
+		forward(&IMeetingVideoCtrlEvent::onUserVideoQualityChanged, quality, userid);
+	}
+
+	void VideoEventFanout::onVideoAlphaChannelStatusChanged(bool isAlphaModeOn) {
+		forward(&IMeetingVideoCtrlEvent::onVideoAlphaChannelStatusChanged, isAlphaModeOn);
+	}
+
+	void VideoEventFanout::onCameraControlRequestReceived(unsigned int userId, ZOOM_SDK_NAMESPACE::CameraControlRequestType requestType,
+		ZOOM_SDK_NAMESPACE::ICameraControlRequestHandler* pHandler) {
+		forward(&IMeetingVideoCtrlEvent::onCameraControlRequestReceived, userId, requestType, pHandler);
+	}
+
+	void VideoEventFanout::onCameraControlRequestResult(unsigned int userId, ZOOM_SDK_NAMESPACE::CameraControlRequestResult result) {
+		forward(&IMeetingVideoCtrlEvent::onCameraControlRequestResult, userId, result);
+	}
+
+	void AudioEventFanout::onUserAudioStatusChange(ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::IUserAudioStatus*>* lstAudioStatusChange, const zchar_t* strAudioStatusList) {
+		forward(&IMeetingAudioCtrlEvent::onUserAudioStatusChange, lstAudioStatusChange, strAudioStatusList);
+	}
+
+	void AudioEventFanout::onUserActiveAudioChange(ZOOM_SDK_NAMESPACE::IList<unsigned int>* plstActiveAudio) {
+		forward(&IMeetingAudioCtrlEvent::onUserActiveAudioChange, plstActiveAudio);
+	}
+
+	void AudioEventFanout::onHostRequestStartAudio(ZOOM_SDK_NAMESPACE::IRequestStartAudioHandler* handler_) {
+		forward(&IMeetingAudioCtrlEvent::onHostRequestStartAudio, handler_);
+	}
+
+	void AudioEventFanout::onJoin3rdPartyTelephonyAudio(const zchar_t* audioInfo) {
+		forward(&IMeetingAudioCtrlEvent::onJoin3rdPartyTelephonyAudio, audioInfo);
+	}
+
+	void AudioEventFanout::onMuteOnEntryStatusChange(bool bEnabled) {
+		forward(&IMeetingAudioCtrlEvent::onMuteOnEntryStatusChange, bEnabled);
+	}
+
+	void ShareEventFanout::onSharingStatus(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) {
+		forward(&IMeetingShareCtrlEvent::onSharingStatus, shareInfo);
+	}
+
+	void ShareEventFanout::onFailedToStartShare() {
+		forward(&IMeetingShareCtrlEvent::onFailedToStartShare);
+	}
+
+	void ShareEventFanout::onLockShareStatus(bool bLocked) {
+		forward(&IMeetingShareCtrlEvent::onLockShareStatus, bLocked);
+	}
+
+	void ShareEventFanout::onShareContentNotification(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) {
+		forward(&IMeetingShareCtrlEvent::onShareContentNotification, shareInfo);
+	}
+
+	void ShareEventFanout::onMultiShareSwitchToSingleShareNeedConfirm(ZOOM_SDK_NAMESPACE::IShareSwitchMultiToSingleConfirmHandler* handler_) {
+		forward(&IMeetingShareCtrlEvent::onMultiShareSwitchToSingleShareNeedConfirm, handler_);
+	}
+
+	void ShareEventFanout::onShareSettingTypeChangedNotification(ZOOM_SDK_NAMESPACE::ShareSettingType type) {
+		forward(&IMeetingShareCtrlEvent::onShareSettingTypeChangedNotification, type);
+	}
+
+	void ShareEventFanout::onSharedVideoEnded() {
+		forward(&IMeetingShareCtrlEvent::onSharedVideoEnded);
+	}
+
+	void ShareEventFanout::onVideoFileSharePlayError(ZOOM_SDK_NAMESPACE::ZoomSDKVideoFileSharePlayError error) {
+		forward(&IMeetingShareCtrlEvent::onVideoFileSharePlayError, error);
+	}
+
+	void ShareEventFanout::onOptimizingShareForVideoClipStatusChanged(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) {
+		forward(&IMeetingShareCtrlEvent::onOptimizingShareForVideoClipStatusChanged, shareInfo);
+	}
+
+	void RecordingEventFanout::onRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) {
+		forward(&IMeetingRecordingCtrlEvent::onRecordingStatus, status);
+	}
+
+	void RecordingEventFanout::onCloudRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) {
+		forward(&IMeetingRecordingCtrlEvent::onCloudRecordingStatus, status);
+	}
+
+	void RecordingEventFanout::onRecordPrivilegeChanged(bool bCanRec) {
+		forward(&IMeetingRecordingCtrlEvent::onRecordPrivilegeChanged, bCanRec);
+	}
+
+	void RecordingEventFanout::onLocalRecordingPrivilegeRequestStatus(ZOOM_SDK_NAMESPACE::RequestLocalRecordingStatus status) {
+		forward(&IMeetingRecordingCtrlEvent::onLocalRecordingPrivilegeRequestStatus, status);
+	}
+
+	void RecordingEventFanout::onRequestCloudRecordingResponse(ZOOM_SDK_NAMESPACE::RequestStartCloudRecordingStatus status) {
+		forward(&IMeetingRecordingCtrlEvent::onRequestCloudRecordingResponse, status);
+	}
+
+	void RecordingEventFanout::onLocalRecordingPrivilegeRequested(ZOOM_SDK_NAMESPACE::IRequestLocalRecordingPrivilegeHandler* handler) {
+		forward(&IMeetingRecordingCtrlEvent::onLocalRecordingPrivilegeRequested, handler);
+	}
+
+	void RecordingEventFanout::onStartCloudRecordingRequested(ZOOM_SDK_NAMESPACE::IRequestStartCloudRecordingHandler* handler) {
+		forward(&IMeetingRecordingCtrlEvent::onStartCloudRecordingRequested, handler);
+	}
+
+#if defined(WIN32)
+	void RecordingEventFanout::onRecording2MP4Done(bool bsuccess, int iResult, const zchar_t* szPath) {
+		forward(&IMeetingRecordingCtrlEvent::onRecording2MP4Done, bsuccess, iResult, szPath);
+	}
+
+	void RecordingEventFanout::onRecording2MP4Processing(int iPercentage) {
+		forward(&IMeetingRecordingCtrlEvent::onRecording2MP4Processing, iPercentage);
+	}
+
+	void RecordingEventFanout::onCustomizedLocalRecordingSourceNotification(ZOOM_SDK_NAMESPACE::ICustomizedLocalRecordingLayoutHelper* layout_helper) {
+		forward(&IMeetingRecordingCtrlEvent::onCustomizedLocalRecordingSourceNotification, layout_helper);
+	}
+#endif
+
+	void RecordingEventFanout::onCloudRecordingStorageFull(time_t gracePeriodDate) {
+		forward(&IMeetingRecordingCtrlEvent::onCloudRecordingStorageFull, gracePeriodDate);
+	}
+
+	void RecordingEventFanout::onEnableAndStartSmartRecordingRequested(ZOOM_SDK_NAMESPACE::IRequestEnableAndStartSmartRecordingHandler* handler) {
+		forward(&IMeetingRecordingCtrlEvent::onEnableAndStartSmartRecordingRequested, handler);
+	}
+
+	void RecordingEventFanout::onSmartRecordingEnableActionCallback(ZOOM_SDK_NAMESPACE::ISmartRecordingEnableActionHandler* handler) {
+		forward(&IMeetingRecordingCtrlEvent::onSmartRecordingEnableActionCallback, handler);
+	}
+
+#if defined(__linux__)
+	void RecordingEventFanout::onTranscodingStatusChanged(ZOOM_SDK_NAMESPACE::TranscodingStatus status, const zchar_t* path) {
+		forward(&IMeetingRecordingCtrlEvent::onTranscodingStatusChanged, status, path);
+	}
+#endif
+
+	void ChatEventFanout::onChatMsgNotification(ZOOM_SDK_NAMESPACE::IChatMsgInfo* chatMsg, const zchar_t* content) {
+		forward(&IMeetingChatCtrlEvent::onChatMsgNotification, chatMsg, content);
+	}
+
+	void ChatEventFanout::onChatStatusChangedNotification(ZOOM_SDK_NAMESPACE::ChatStatus* status_) {
+		forward(&IMeetingChatCtrlEvent::onChatStatusChangedNotification, status_);
+	}
+
+	void ChatEventFanout::onChatMsgDeleteNotification(const zchar_t* msgID, ZOOM_SDK_NAMESPACE::SDKChatMessageDeleteType deleteBy) {
+		forward(&IMeetingChatCtrlEvent::onChatMsgDeleteNotification, msgID, deleteBy);
+	}
+
+	void ChatEventFanout::onChatMessageEditNotification(ZOOM_SDK_NAMESPACE::IChatMsgInfo* chatMsg) {
+		forward(&IMeetingChatCtrlEvent::onChatMessageEditNotification, chatMsg);
+	}
+
+	void ChatEventFanout::onShareMeetingChatStatusChanged(bool isStart) {
+		forward(&IMeetingChatCtrlEvent::onShareMeetingChatStatusChanged, isStart);
+	}
+
+	void ChatEventFanout::onFileSendStart(ZOOM_SDK_NAMESPACE::ISDKFileSender* sender) {
+		forward(&IMeetingChatCtrlEvent::onFileSendStart, sender);
+	}
+
+	void ChatEventFanout::onFileReceived(ZOOM_SDK_NAMESPACE::ISDKFileReceiver* receiver) {
+		forward(&IMeetingChatCtrlEvent::onFileReceived, receiver);
+	}
+
+	void ChatEventFanout::onFileTransferProgress(ZOOM_SDK_NAMESPACE::SDKFileTransferInfo* info) {
+		forward(&IMeetingChatCtrlEvent::onFileTransferProgress, info);
+	}
+
+	void CaptionEventFanout::onAssignedToSendCC(bool bAssigned) {
+		forward(&IClosedCaptionControllerEvent::onAssignedToSendCC, bAssigned);
+	}
+
+	void CaptionEventFanout::onClosedCaptionMsgReceived(const zchar_t* ccMsg, unsigned int sender_id, time_t time) {
+		forward(&IClosedCaptionControllerEvent::onClosedCaptionMsgReceived, ccMsg, sender_id, time);
+	}
+
+	void CaptionEventFanout::onLiveTranscriptionStatus(ZOOM_SDK_NAMESPACE::SDKLiveTranscriptionStatus status) {
+		forward(&IClosedCaptionControllerEvent::onLiveTranscriptionStatus, status);
+	}
+
+	void CaptionEventFanout::onOriginalLanguageMsgReceived(ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo* messageInfo) {
+		forward(&IClosedCaptionControllerEvent::onOriginalLanguageMsgReceived, messageInfo);
+	}
+
+	void CaptionEventFanout::onLiveTranscriptionMsgInfoReceived(ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo* messageInfo) {
+		forward(&IClosedCaptionControllerEvent::onLiveTranscriptionMsgInfoReceived, messageInfo);
+	}
+
+	void CaptionEventFanout::onLiveTranscriptionMsgError(ZOOM_SDK_NAMESPACE::ILiveTranscriptionLanguage* spokenLanguage, ZOOM_SDK_NAMESPACE::ILiveTranscriptionLanguage* transcriptLanguage) {
+		forward(&IClosedCaptionControllerEvent::onLiveTranscriptionMsgError, spokenLanguage, transcriptLanguage);
+	}
+
+	void CaptionEventFanout::onRequestForLiveTranscriptReceived(unsigned int requester_id, bool bAnonymous) {
+		forward(&IClosedCaptionControllerEvent::onRequestForLiveTranscriptReceived, requester_id, bAnonymous);
+	}
+
+	void CaptionEventFanout::onRequestLiveTranscriptionStatusChange(bool bEnabled) {
+		forward(&IClosedCaptionControllerEvent::onRequestLiveTranscriptionStatusChange, bEnabled);
+	}
+
+	void CaptionEventFanout::onCaptionStatusChanged(bool bEnabled) {
+		forward(&IClosedCaptionControllerEvent::onCaptionStatusChanged, bEnabled);
+	}
+
+	void CaptionEventFanout::onStartCaptionsRequestReceived(ZOOM_SDK_NAMESPACE::ICCRequestHandler* handler) {
+		forward(&IClosedCaptionControllerEvent::onStartCaptionsRequestReceived, handler);
+	}
+
+	void CaptionEventFanout::onStartCaptionsRequestApproved() {
+		forward(&IClosedCaptionControllerEvent::onStartCaptionsRequestApproved);
+	}
+
+	void CaptionEventFanout::onManualCaptionStatusChanged(bool bEnabled) {
+		forward(&IClosedCaptionControllerEvent::onManualCaptionStatusChanged, bEnabled);
+	}
+
+	void CaptionEventFanout::onSpokenLanguageChanged(ZOOM_SDK_NAMESPACE::ILiveTranscriptionLanguage* spokenLanguage) {
+		forward(&IClosedCaptionControllerEvent::onSpokenLanguageChanged, spokenLanguage);
+	}
+
+	void ParticipantsEventFanout::onUserJoin(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID, const zchar_t* strUserList) {
+		forward(&IMeetingParticipantsCtrlEvent::onUserJoin, lstUserID, strUserList);
+	}
+
+	void ParticipantsEventFanout::onUserLeft(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID, const zchar_t* strUserList) {
+		forward(&IMeetingParticipantsCtrlEvent::onUserLeft, lstUserID, strUserList);
+	}
+
+	void ParticipantsEventFanout::onHostChangeNotification(unsigned int userId) {
+		forward(&IMeetingParticipantsCtrlEvent::onHostChangeNotification, userId);
+	}
+
+	void ParticipantsEventFanout::onLowOrRaiseHandStatusChanged(bool bLow, unsigned int userid) {
+		forward(&IMeetingParticipantsCtrlEvent::onLowOrRaiseHandStatusChanged, bLow, userid);
+	}
+
+	void ParticipantsEventFanout::onUserNamesChanged(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID) {
+		forward(&IMeetingParticipantsCtrlEvent::onUserNamesChanged, lstUserID);
+	}
+
+	void ParticipantsEventFanout::onCoHostChangeNotification(unsigned int userId, bool isCoHost) {
+		forward(&IMeetingParticipantsCtrlEvent::onCoHostChangeNotification, userId, isCoHost);
+	}
+
+	void ParticipantsEventFanout::onInvalidReclaimHostkey() {
+		forward(&IMeetingParticipantsCtrlEvent::onInvalidReclaimHostkey);
+	}
+
+	void ParticipantsEventFanout::onAllHandsLowered() {
+		forward(&IMeetingParticipantsCtrlEvent::onAllHandsLowered);
+	}
+
+	void ParticipantsEventFanout::onLocalRecordingStatusChanged(unsigned int user_id, ZOOM_SDK_NAMESPACE::RecordingStatus status) {
+		forward(&IMeetingParticipantsCtrlEvent::onLocalRecordingStatusChanged, user_id, status);
+	}
+
+	void ParticipantsEventFanout::onAllowParticipantsRenameNotification(bool bAllow) {
+		forward(&IMeetingParticipantsCtrlEvent::onAllowParticipantsRenameNotification, bAllow);
+	}
+
+	void ParticipantsEventFanout::onAllowParticipantsUnmuteSelfNotification(bool bAllow) {
+		forward(&IMeetingParticipantsCtrlEvent::onAllowParticipantsUnmuteSelfNotification, bAllow);
+	}
+
+	void ParticipantsEventFanout::onAllowParticipantsStartVideoNotification(bool bAllow) {
+		forward(&IMeetingParticipantsCtrlEvent::onAllowParticipantsStartVideoNotification, bAllow);
+	}
+
+	void ParticipantsEventFanout::onAllowParticipantsShareWhiteBoardNotification(bool bAllow) {
+		forward(&IMeetingParticipantsCtrlEvent::onAllowParticipantsShareWhiteBoardNotification, bAllow);
+	}
+
+	void ParticipantsEventFanout::onRequestLocalRecordingPrivilegeChanged(ZOOM_SDK_NAMESPACE::LocalRecordingRequestPrivilegeStatus status) {
+		forward(&IMeetingParticipantsCtrlEvent::onRequestLocalRecordingPrivilegeChanged, status);
+	}
+
+	void ParticipantsEventFanout::onAllowParticipantsRequestCloudRecording(bool bAllow) {
+		forward(&IMeetingParticipantsCtrlEvent::onAllowParticipantsRequestCloudRecording, bAllow);
+	}
+
+	void ParticipantsEventFanout::onInMeetingUserAvatarPathUpdated(unsigned int userID) {
+		forward(&IMeetingParticipantsCtrlEvent::onInMeetingUserAvatarPathUpdated, userID);
+	}
+
+	void ParticipantsEventFanout::onParticipantProfilePictureStatusChange(bool bHidden) {
+		forward(&IMeetingParticipantsCtrlEvent::onParticipantProfilePictureStatusChange, bHidden);
+	}
+
+	void ParticipantsEventFanout::onFocusModeStateChanged(bool bEnabled) {
+		forward(&IMeetingParticipantsCtrlEvent::onFocusModeStateChanged, bEnabled);
+	}
+
+	void ParticipantsEventFanout::onFocusModeShareTypeChanged(ZOOM_SDK_NAMESPACE::FocusModeShareType type) {
+		forward(&IMeetingParticipantsCtrlEvent::onFocusModeShareTypeChanged, type);
+	}
+
+	void ParticipantsEventFanout::onBotAuthorizerRelationChanged(unsigned int authorizeUserID) {
+		forward(&IMeetingParticipantsCtrlEvent::onBotAuthorizerRelationChanged, authorizeUserID);
+	}
+
+	void ParticipantsEventFanout::onVirtualNameTagStatusChanged(bool bOn, unsigned int userID) {
+		forward(&IMeetingParticipantsCtrlEvent::onVirtualNameTagStatusChanged, bOn, userID);
+	}
+
+	void ParticipantsEventFanout::onVirtualNameTagRosterInfoUpdated(unsigned int userID) {
+		forward(&IMeetingParticipantsCtrlEvent::onVirtualNameTagRosterInfoUpdated, userID);
+	}
+
+#if defined(WIN32)
+	void ParticipantsEventFanout::onCreateCompanionRelation(unsigned int parentUserID, unsigned int childUserID) {
+		forward(&IMeetingParticipantsCtrlEvent::onCreateCompanionRelation, parentUserID, childUserID);
+	}
+
+	void ParticipantsEventFanout::onRemoveCompanionRelation(unsigned int childUserID) {
+		forward(&IMeetingParticipantsCtrlEvent::onRemoveCompanionRelation, childUserID);
+	}
+#endif
+
+	void ParticipantsEventFanout::onGrantCoOwnerPrivilegeChanged(bool canGrantOther) {
+		forward(&IMeetingParticipantsCtrlEvent::onGrantCoOwnerPrivilegeChanged, canGrantOther);
+	}
+
+}  // namespace flutter_zoom_sdk
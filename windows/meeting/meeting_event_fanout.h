@@ -0,0 +1,214 @@
+#ifndef FLUTTER_PLUGIN_MEETING_MEETING_EVENT_FANOUT_H_
+#define FLUTTER_PLUGIN_MEETING_MEETING_EVENT_FANOUT_H_
+
+// The chat and caption interfaces use time_t without including it.
+#include <ctime>
+
+#include <meeting_service_interface.h>
+#include <meeting_service_components/meeting_audio_interface.h>
+#include <meeting_service_components/meeting_chat_interface.h>
+#include <meeting_service_components/meeting_closedcaption_interface.h>
+#include <meeting_service_components/meeting_participants_ctrl_interface.h>
+#include <meeting_service_components/meeting_recording_interface.h>
+#include <meeting_service_components/meeting_sharing_interface.h>
+#include <meeting_service_components/meeting_video_interface.h>
+
+#include <functional>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	// The SDK controllers take a single event listener each. A fanout is set
+	// once as that listener and forwards every callback to the listeners
+	// added to it, in the order they were added, so several features can
+	// follow the same events. Listeners may add or remove listeners from a
+	// callback; the change applies from the next one. A fanout without
+	// listeners need not be set on its controller at all; demandChanged tells
+	// the owner when that flips. A tap sees every callback first, without
+	// being a listener, to record what arrives. Platform thread only.
+	template <typename Event>
+	class EventFanout {
+	public:
+		// Called when the first listener is added or the last one removed.
+		using DemandChanged = std::function<void()>;
+
+		void setDemandChanged(DemandChanged demandChanged) { demandChanged_ = std::move(demandChanged); }
+
+		bool wanted() const { return !listeners_.empty(); }
+
+		// nullptr removes the tap.
+		void setTap(Event* tap) { tap_ = tap; }
+
+		void add(Event* listener) {
+			for (Event* existing : listeners_) {
+				if (existing == listener) {
+					return;
+				}
+			}
+			listeners_.push_back(listener);
+			if (listeners_.size() == 1 && demandChanged_) {
+				demandChanged_();
+			}
+		}
+
+		void remove(Event* listener) {
+			for (auto it = listeners_.begin(); it != listeners_.end(); ++it) {
+				if (*it == listener) {
+					listeners_.erase(it);
+					if (listeners_.empty() && demandChanged_) {
+						demandChanged_();
+					}
+					return;
+				}
+			}
+		}
+
+	protected:
+		template <typename Method, typename... Args>
+		void forward(Method method, Args... args) {
+			if (tap_) {
+				(tap_->*method)(args...);
+			}
+			const std::vector<Event*> listeners = listeners_;
+			for (Event* listener : listeners) {
+				(listener->*method)(args...);
+			}
+		}
+
+	private:
+		std::vector<Event*> listeners_;
+		DemandChanged demandChanged_;
+		Event* tap_ = nullptr;
+	};
+
+	class VideoEventFanout : public ZOOM_SDK_NAMESPACE::IMeetingVideoCtrlEvent,
+		public EventFanout<ZOOM_SDK_NAMESPACE::IMeetingVideoCtrlEvent> {
+	public:
+		void onUserVideoStatusChange(unsigned int userId, ZOOM_SDK_NAMESPACE::VideoStatus status) override;
+		void onSpotlightedUserListChangeNotification(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstSpotlightedUserID) override;
+		void onHostRequestStartVideo(ZOOM_SDK_NAMESPACE::IRequestStartVideoHandler* handler_) override;
+		void onActiveSpeakerVideoUserChanged(unsigned int userid) override;
+		void onActiveVideoUserChanged(unsigned int userid) override;
+		void onHostVideoOrderUpdated(ZOOM_SDK_NAMESPACE::IList<unsigned int>* orderList) override;
+		void onLocalVideoOrderUpdated(ZOOM_SDK_NAMESPACE::IList<unsigned int>* localOrderList) override;
+		void onFollowHostVideoOrderChanged(bool bFollow) override;
+		void onUserVideoQualityChanged(ZOOM_SDK_NAMESPACE::VideoConnectionQuality quality, unsigned int userid) override;
+		void onVideoAlphaChannelStatusChanged(bool isAlphaModeOn) override;
+		void onCameraControlRequestReceived(unsigned int userId, ZOOM_SDK_NAMESPACE::CameraControlRequestType requestType,
+			ZOOM_SDK_NAMESPACE::ICameraControlRequestHandler* pHandler) override;
+		void onCameraControlRequestResult(unsigned int userId, ZOOM_SDK_NAMESPACE::CameraControlRequestResult result) override;
+	};
+
+	class AudioEventFanout : public ZOOM_SDK_NAMESPACE::IMeetingAudioCtrlEvent,
+		public EventFanout<ZOOM_SDK_NAMESPACE::IMeetingAudioCtrlEvent> {
+	public:
+		void onUserAudioStatusChange(ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::IUserAudioStatus*>* lstAudioStatusChange, const zchar_t* strAudioStatusList = nullptr) override;
+		void onUserActiveAudioChange(ZOOM_SDK_NAMESPACE::IList<unsigned int>* plstActiveAudio) override;
+		void onHostRequestStartAudio(ZOOM_SDK_NAMESPACE::IRequestStartAudioHandler* handler_) override;
+		void onJoin3rdPartyTelephonyAudio(const zchar_t* audioInfo) override;
+		void onMuteOnEntryStatusChange(bool bEnabled) override;
+	};
+
+	class ShareEventFanout : public ZOOM_SDK_NAMESPACE::IMeetingShareCtrlEvent,
+		public EventFanout<ZOOM_SDK_NAMESPACE::IMeetingShareCtrlEvent> {
+	public:
+		void onSharingStatus(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) override;
+		void onFailedToStartShare() override;
+		void onLockShareStatus(bool bLocked) override;
+		void onShareContentNotification(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) override;
+		void onMultiShareSwitchToSingleShareNeedConfirm(ZOOM_SDK_NAMESPACE::IShareSwitchMultiToSingleConfirmHandler* handler_) override;
+		void onShareSettingTypeChangedNotification(ZOOM_SDK_NAMESPACE::ShareSettingType type) override;
+		void onSharedVideoEnded() override;
+		void onVideoFileSharePlayError(ZOOM_SDK_NAMESPACE::ZoomSDKVideoFileSharePlayError error) override;
+		void onOptimizingShareForVideoClipStatusChanged(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) override;
+	};
+
+	class RecordingEventFanout : public ZOOM_SDK_NAMESPACE::IMeetingRecordingCtrlEvent,
+		public EventFanout<ZOOM_SDK_NAMESPACE::IMeetingRecordingCtrlEvent> {
+	public:
+		void onRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) override;
+		void onCloudRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) override;
+		void onRecordPrivilegeChanged(bool bCanRec) override;
+		void onLocalRecordingPrivilegeRequestStatus(ZOOM_SDK_NAMESPACE::RequestLocalRecordingStatus status) override;
+		void onRequestCloudRecordingResponse(ZOOM_SDK_NAMESPACE::RequestStartCloudRecordingStatus status) override;
+		void onLocalRecordingPrivilegeRequested(ZOOM_SDK_NAMESPACE::IRequestLocalRecordingPrivilegeHandler* handler) override;
+		void onStartCloudRecordingRequested(ZOOM_SDK_NAMESPACE::IRequestStartCloudRecordingHandler* handler) override;
+#if defined(WIN32)
+		void onRecording2MP4Done(bool bsuccess, int iResult, const zchar_t* szPath) override;
+		void onRecording2MP4Processing(int iPercentage) override;
+		void onCustomizedLocalRecordingSourceNotification(ZOOM_SDK_NAMESPACE::ICustomizedLocalRecordingLayoutHelper* layout_helper) override;
+#endif
+		void onCloudRecordingStorageFull(time_t gracePeriodDate) override;
+		void onEnableAndStartSmartRecordingRequested(ZOOM_SDK_NAMESPACE::IRequestEnableAndStartSmartRecordingHandler* handler) override;
+		void onSmartRecordingEnableActionCallback(ZOOM_SDK_NAMESPACE::ISmartRecordingEnableActionHandler* handler) override;
+#if defined(__linux__)
+		void onTranscodingStatusChanged(ZOOM_SDK_NAMESPACE::TranscodingStatus status, const zchar_t* path) override;
+#endif
+	};
+
+	class ChatEventFanout : public ZOOM_SDK_NAMESPACE::IMeetingChatCtrlEvent,
+		public EventFanout<ZOOM_SDK_NAMESPACE::IMeetingChatCtrlEvent> {
+	public:
+		void onChatMsgNotification(ZOOM_SDK_NAMESPACE::IChatMsgInfo* chatMsg, const zchar_t* content = nullptr) override;
+		void onChatStatusChangedNotification(ZOOM_SDK_NAMESPACE::ChatStatus* status_) override;
+		void onChatMsgDeleteNotification(const zchar_t* msgID, ZOOM_SDK_NAMESPACE::SDKChatMessageDeleteType deleteBy) override;
+		void onChatMessageEditNotification(ZOOM_SDK_NAMESPACE::IChatMsgInfo* chatMsg) override;
+		void onShareMeetingChatStatusChanged(bool isStart) override;
+		void onFileSendStart(ZOOM_SDK_NAMESPACE::ISDKFileSender* sender) override;
+		void onFileReceived(ZOOM_SDK_NAMESPACE::ISDKFileReceiver* receiver) override;
+		void onFileTransferProgress(ZOOM_SDK_NAMESPACE::SDKFileTransferInfo* info) override;
+	};
+
+	class CaptionEventFanout : public ZOOM_SDK_NAMESPACE::IClosedCaptionControllerEvent,
+		public EventFanout<ZOOM_SDK_NAMESPACE::IClosedCaptionControllerEvent> {
+	public:
+		void onAssignedToSendCC(bool bAssigned) override;
+		void onClosedCaptionMsgReceived(const zchar_t* ccMsg, unsigned int sender_id, time_t time) override;
+		void onLiveTranscriptionStatus(ZOOM_SDK_NAMESPACE::SDKLiveTranscriptionStatus status) override;
+		void onOriginalLanguageMsgReceived(ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo* messageInfo) override;
+		void onLiveTranscriptionMsgInfoReceived(ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo* messageInfo) override;
+		void onLiveTranscriptionMsgError(ZOOM_SDK_NAMESPACE::ILiveTranscriptionLanguage* spokenLanguage, ZOOM_SDK_NAMESPACE::ILiveTranscriptionLanguage* transcriptLanguage) override;
+		void onRequestForLiveTranscriptReceived(unsigned int requester_id, bool bAnonymous) override;
+		void onRequestLiveTranscriptionStatusChange(bool bEnabled) override;
+		void onCaptionStatusChanged(bool bEnabled) override;
+		void onStartCaptionsRequestReceived(ZOOM_SDK_NAMESPACE::ICCRequestHandler* handler) override;
+		void onStartCaptionsRequestApproved() override;
+		void onManualCaptionStatusChanged(bool bEnabled) override;
+		void onSpokenLanguageChanged(ZOOM_SDK_NAMESPACE::ILiveTranscriptionLanguage* spokenLanguage) override;
+	};
+
+	class ParticipantsEventFanout : public ZOOM_SDK_NAMESPACE::IMeetingParticipantsCtrlEvent,
+		public EventFanout<ZOOM_SDK_NAMESPACE::IMeetingParticipantsCtrlEvent> {
+	public:
+		void onUserJoin(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID, const zchar_t* strUserList = nullptr) override;
+		void onUserLeft(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID, const zchar_t* strUserList = nullptr) override;
+		void onHostChangeNotification(unsigned int userId) override;
+		void onLowOrRaiseHandStatusChanged(bool bLow, unsigned int userid) override;
+		void onUserNamesChanged(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID) override;
+		void onCoHostChangeNotification(unsigned int userId, bool isCoHost) override;
+		void onInvalidReclaimHostkey() override;
+		void onAllHandsLowered() override;
+		void onLocalRecordingStatusChanged(unsigned int user_id, ZOOM_SDK_NAMESPACE::RecordingStatus status) override;
+		void onAllowParticipantsRenameNotification(bool bAllow) override;
+		void onAllowParticipantsUnmuteSelfNotification(bool bAllow) override;
+		void onAllowParticipantsStartVideoNotification(bool bAllow) override;
+		void onAllowParticipantsShareWhiteBoardNotification(bool bAllow) override;
+		void onRequestLocalRecordingPrivilegeChanged(ZOOM_SDK_NAMESPACE::LocalRecordingRequestPrivilegeStatus status) override;
+		void onAllowParticipantsRequestCloudRecording(bool bAllow) override;
+		void onInMeetingUserAvatarPathUpdated(unsigned int userID) override;
+		void onParticipantProfilePictureStatusChange(bool bHidden) override;
+		void onFocusModeStateChanged(bool bEnabled) override;
+		void onFocusModeShareTypeChanged(ZOOM_SDK_NAMESPACE::FocusModeShareType type) override;
+		void onBotAuthorizerRelationChanged(unsigned int authorizeUserID) override;
+		void onVirtualNameTagStatusChanged(bool bOn, unsigned int userID) override;
+		void onVirtualNameTagRosterInfoUpdated(unsigned int userID) override;
+#if defined(WIN32)
+		void onCreateCompanionRelation(unsigned int parentUserID, unsigned int childUserID) override;
+		void onRemoveCompanionRelation(unsigned int childUserID) override;
+#endif
+		void onGrantCoOwnerPrivilegeChanged(bool canGrantOther) override;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_MEETING_EVENT_FANOUT_H_
@@ -0,0 +1,61 @@
+#include "meeting/meeting_event_filter.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// Indexed by event; the status and warning tags follow the SDK enums.
+		constexpr const char* kMeetingEventTags[kMeetingEventCount] = {
+			"MEETING_STATUS_IDLE",
+			"MEETING_STATUS_CONNECTING",
+			"MEETING_STATUS_WAITINGFORHOST",
+			"MEETING_STATUS_INMEETING",
+			"MEETING_STATUS_DISCONNECTING",
+			"MEETING_STATUS_RECONNECTING",
+			"MEETING_STATUS_FAILED",
+			"MEETING_STATUS_ENDED",
+			"MEETING_STATUS_UNKNOWN",
+			"MEETING_STATUS_LOCKED",
+			"MEETING_STATUS_UNLOCKED",
+			"MEETING_STATUS_IN_WAITING_ROOM",
+			"MEETING_STATUS_WEBINAR_PROMOTE",
+			"MEETING_STATUS_WEBINAR_DEPROMOTE",
+			"MEETING_STATUS_JOIN_BREAKOUT_ROOM",
+			"MEETING_STATUS_LEAVE_BREAKOUT_ROOM",
+			"MEETING_STATISTICS_WARNING_NONE",
+			"MEETING_STATISTICS_WARNING_NETWORK_QUALITY_BAD",
+			"MEETING_STATISTICS_WARNING_BUSY_SYSTEM",
+			"MEETING_PARAMETER",
+			"MEETING_TOPIC_CHANGED",
+		};
+
+		static_assert(ZOOM_SDK_NAMESPACE::MEETING_STATUS_LEAVE_BREAKOUT_ROOM == kMeetingStatusEventCount - 1,
+			"kMeetingEventTags is out of step with MeetingStatus");
+		static_assert(ZOOM_SDK_NAMESPACE::Statistics_Warning_Busy_System == kStatisticsWarningEventCount - 1,
+			"kMeetingEventTags is out of step with StatisticsWarningType");
+	}
+
+	int meetingStatusEvent(ZOOM_SDK_NAMESPACE::MeetingStatus status) {
+		const int index = static_cast<int>(status);
+		return index >= 0 && index < kMeetingStatusEventCount ? kMeetingStatusEventFirst + index : kNoMeetingEvent;
+	}
+
+	int statisticsWarningEvent(ZOOM_SDK_NAMESPACE::StatisticsWarningType type) {
+		const int index = static_cast<int>(type);
+		return index >= 0 && index < kStatisticsWarningEventCount ? kStatisticsWarningEventFirst + index : kNoMeetingEvent;
+	}
+
+	const char* meetingEventTag(int event) {
+		return event >= 0 && event < kMeetingEventCount ? kMeetingEventTags[event] : nullptr;
+	}
+
+	int meetingEventFromTag(const std::string& tag) {
+		// Only called when Dart subscribes, so a scan is fine.
+		for (int event = 0; event < kMeetingEventCount; event++) {
+			if (tag.compare(kMeetingEventTags[event]) == 0) {
+				return event;
+			}
+		}
+		return kNoMeetingEvent;
+	}
+
+}  // namespace flutter_zoom_sdk
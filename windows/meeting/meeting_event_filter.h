@@ -0,0 +1,60 @@
+#ifndef FLUTTER_PLUGIN_MEETING_MEETING_EVENT_FILTER_H_
+#define FLUTTER_PLUGIN_MEETING_MEETING_EVENT_FILTER_H_
+
+#include <meeting_service_interface.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace flutter_zoom_sdk {
+
+	// Every event the meeting event stream carries, as an index into one tag
+	// table: the meeting statuses in SDK order, then the statistics warnings
+	// in SDK order, then the rest. Dart sees the tags.
+	constexpr int kMeetingStatusEventFirst = 0;
+	constexpr int kMeetingStatusEventCount = 16;
+	constexpr int kStatisticsWarningEventFirst = kMeetingStatusEventFirst + kMeetingStatusEventCount;
+	constexpr int kStatisticsWarningEventCount = 3;
+	constexpr int kMeetingParameterEvent = kStatisticsWarningEventFirst + kStatisticsWarningEventCount;
+	constexpr int kMeetingTopicEvent = kMeetingParameterEvent + 1;
+	constexpr int kMeetingEventCount = kMeetingTopicEvent + 1;
+
+	constexpr int kNoMeetingEvent = -1;
+
+	constexpr uint64_t kAllMeetingEvents = (uint64_t(1) << kMeetingEventCount) - 1;
+
+	// kNoMeetingEvent for a status newer than this table.
+	int meetingStatusEvent(ZOOM_SDK_NAMESPACE::MeetingStatus status);
+
+	// kNoMeetingEvent for a warning newer than this table.
+	int statisticsWarningEvent(ZOOM_SDK_NAMESPACE::StatisticsWarningType type);
+
+	// nullptr for kNoMeetingEvent or anything out of range.
+	const char* meetingEventTag(int event);
+
+	// kNoMeetingEvent for an unknown tag.
+	int meetingEventFromTag(const std::string& tag);
+
+	// Which events Dart subscribed to, checked before an event is encoded.
+	// Everything until set otherwise. Not thread-safe.
+	class MeetingEventFilter {
+	public:
+		MeetingEventFilter() : mask_(kAllMeetingEvents) {}
+
+		bool wants(int event) const {
+			return event >= 0 && event < kMeetingEventCount && (mask_ & (uint64_t(1) << event)) != 0;
+		}
+
+		// Bits beyond kMeetingEventCount are dropped.
+		void setMask(uint64_t mask) { mask_ = mask & kAllMeetingEvents; }
+
+		uint64_t mask() const { return mask_; }
+
+	private:
+		uint64_t mask_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_MEETING_EVENT_FILTER_H_
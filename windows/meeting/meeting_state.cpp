@@ -0,0 +1,116 @@
+#include "meeting/meeting_state.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr uint8_t kKindSnapshot = 0;
+		constexpr uint8_t kKindDelta = 1;
+
+		template <typename T>
+		void putLE(uint8_t* dst, T value) {
+			std::memcpy(dst, &value, sizeof(T));
+		}
+	}
+
+	MeetingState::MeetingState(Changed changed)
+		: changed_(std::move(changed)),
+		version_(0) {
+		values_.fill(kMeetingStateUnknown);
+		versions_.fill(0);
+	}
+
+	void MeetingState::stamp(size_t field) {
+		versions_[field] = ++version_;
+		if (changed_) {
+			changed_();
+		}
+	}
+
+	bool MeetingState::set(MeetingStateField field, int64_t value) {
+		const size_t at = static_cast<size_t>(field);
+		if (at >= kMeetingStateFieldCount || field == MeetingStateField::CoHosts || values_[at] == value) {
+			return false;
+		}
+		values_[at] = value;
+		stamp(at);
+		return true;
+	}
+
+	bool MeetingState::setCoHost(uint32_t id, bool coHost) {
+		auto it = std::lower_bound(coHosts_.begin(), coHosts_.end(), id);
+		const bool present = it != coHosts_.end() && *it == id;
+		if (present == coHost) {
+			// The first report makes the list known, even when empty.
+			if (values_[static_cast<size_t>(MeetingStateField::CoHosts)] != kMeetingStateUnknown) {
+				return false;
+			}
+		}
+		else if (coHost) {
+			coHosts_.insert(it, id);
+		}
+		else {
+			coHosts_.erase(it);
+		}
+		values_[static_cast<size_t>(MeetingStateField::CoHosts)] = static_cast<int64_t>(coHosts_.size());
+		stamp(static_cast<size_t>(MeetingStateField::CoHosts));
+		return true;
+	}
+
+	bool MeetingState::clearCoHosts() {
+		if (coHosts_.empty()) {
+			return false;
+		}
+		coHosts_.clear();
+		values_[static_cast<size_t>(MeetingStateField::CoHosts)] = 0;
+		stamp(static_cast<size_t>(MeetingStateField::CoHosts));
+		return true;
+	}
+
+	void MeetingState::reset() {
+		coHosts_.clear();
+		for (size_t field = 0; field < kMeetingStateFieldCount; field++) {
+			if (field != static_cast<size_t>(MeetingStateField::Status) && values_[field] != kMeetingStateUnknown) {
+				values_[field] = kMeetingStateUnknown;
+				stamp(field);
+			}
+		}
+	}
+
+	void MeetingState::since(uint64_t base, std::vector<uint8_t>& out, size_t reservedPrefix) const {
+		const bool snapshot = base == 0 || base > version_;
+		out.resize(reservedPrefix + kMeetingStateHeaderSize);
+
+		uint16_t count = 0;
+		for (size_t field = 0; field < kMeetingStateFieldCount; field++) {
+			if (!snapshot && versions_[field] <= base) {
+				continue;
+			}
+
+			const bool coHosts = field == static_cast<size_t>(MeetingStateField::CoHosts);
+			const size_t ids = coHosts ? coHosts_.size() : 0;
+			const size_t at = out.size();
+			out.resize(at + kMeetingStateFieldSize + ids * sizeof(uint32_t));
+			uint8_t* record = out.data() + at;
+			std::memset(record, 0, kMeetingStateFieldSize);
+			record[0] = static_cast<uint8_t>(field);
+			putLE<uint16_t>(record + 2, static_cast<uint16_t>(ids));
+			putLE<int64_t>(record + 8, values_[field]);
+			for (size_t i = 0; i < ids; i++) {
+				putLE<uint32_t>(record + kMeetingStateFieldSize + i * sizeof(uint32_t), coHosts_[i]);
+			}
+			count++;
+		}
+
+		uint8_t* header = out.data() + reservedPrefix;
+		std::memset(header, 0, kMeetingStateHeaderSize);
+		header[0] = kMeetingStateFormat;
+		header[1] = snapshot ? kKindSnapshot : kKindDelta;
+		putLE<uint16_t>(header + 2, count);
+		putLE<uint64_t>(header + 8, snapshot ? 0 : base);
+		putLE<uint64_t>(header + 16, version_);
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,117 @@
+#ifndef FLUTTER_PLUGIN_MEETING_MEETING_STATE_H_
+#define FLUTTER_PLUGIN_MEETING_MEETING_STATE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	// Values are the SDK's enums as integers unless noted.
+	enum class MeetingStateField : uint8_t {
+		Status = 0,
+		// User ids; 0 for nobody.
+		Host = 1,
+		// Value is the count; the ids follow the record.
+		CoHosts = 2,
+		// 0 or 1.
+		Locked = 3,
+		ShareStatus = 4,
+		SharingUser = 5,
+		ShareLocked = 6,
+		LocalRecording = 7,
+		CloudRecording = 8,
+		// kChat* bits.
+		Chat = 9,
+		Captions = 10,
+		ManualCaptions = 11,
+		LiveTranscription = 12,
+		AudioSendQuality = 13,
+		AudioReceiveQuality = 14,
+		VideoSendQuality = 15,
+		VideoReceiveQuality = 16,
+		ShareSendQuality = 17,
+		ShareReceiveQuality = 18,
+		StatisticsWarning = 19,
+	};
+
+	constexpr size_t kMeetingStateFieldCount = 20;
+
+	constexpr int64_t kChatOff = 1 << 0;
+	constexpr int64_t kChatAllowed = 1 << 1;
+	constexpr int64_t kChatToEveryone = 1 << 2;
+	constexpr int64_t kChatToIndividuals = 1 << 3;
+	constexpr int64_t kChatToHostOnly = 1 << 4;
+	constexpr int64_t kChatToPanelists = 1 << 5;
+
+	// Layout of every state update, all little-endian:
+	//   0  u8   format (kMeetingStateFormat)
+	//   1  u8   kind: 0 snapshot, 1 delta
+	//   2  u16  field count
+	//   4  u32  reserved, 0
+	//   8  u64  base version: the delta holds every field changed after it;
+	//           0 for a snapshot
+	//   16 u64  version
+	//   24      fields, 16 bytes each:
+	//     0  u8   field (MeetingStateField)
+	//     1  u8   reserved, 0
+	//     2  u16  ids following the field, for CoHosts
+	//     4  u32  reserved, 0
+	//     8  i64  value, kMeetingStateUnknown until known
+	//     16      u32 ids
+	constexpr uint8_t kMeetingStateFormat = 1;
+	constexpr size_t kMeetingStateHeaderSize = 24;
+	constexpr size_t kMeetingStateFieldSize = 16;
+	constexpr int64_t kMeetingStateUnknown = -1;
+
+	// Meeting-wide state as versioned fields. Every change bumps the version
+	// and stamps the field with it, so the fields changed after any version
+	// are known without keeping history. Not thread-safe.
+	class MeetingState {
+	public:
+		// Called after a change, to schedule an update.
+		using Changed = std::function<void()>;
+
+		explicit MeetingState(Changed changed = nullptr);
+
+		MeetingState(const MeetingState&) = delete;
+		MeetingState& operator=(const MeetingState&) = delete;
+
+		// Returns whether the value changed.
+		bool set(MeetingStateField field, int64_t value);
+
+		bool setCoHost(uint32_t id, bool coHost);
+
+		// Empties a known co-host list. Returns whether it had anyone.
+		bool clearCoHosts();
+
+		int64_t get(MeetingStateField field) const { return values_[static_cast<size_t>(field)]; }
+
+		// Sorted.
+		const std::vector<uint32_t>& coHosts() const { return coHosts_; }
+
+		// Forgets everything but the status, for the end of a meeting.
+		void reset();
+
+		uint64_t version() const { return version_; }
+
+		// Writes the fields changed after base as a delta after
+		// reservedPrefix bytes of out, or every field as a snapshot when base
+		// is 0 or not a version this state has reached.
+		void since(uint64_t base, std::vector<uint8_t>& out, size_t reservedPrefix = 0) const;
+
+	private:
+		void stamp(size_t field);
+
+		const Changed changed_;
+		std::array<int64_t, kMeetingStateFieldCount> values_;
+		std::array<uint64_t, kMeetingStateFieldCount> versions_;
+		std::vector<uint32_t> coHosts_;
+		uint64_t version_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_MEETING_STATE_H_
@@ -0,0 +1,205 @@
+#include "meeting/meeting_state_tracker.h"
+
+namespace flutter_zoom_sdk {
+
+	MeetingStateTracker::MeetingStateTracker(MeetingState& state, const RosterStore& roster)
+		: state_(state),
+		roster_(roster) {}
+
+	void MeetingStateTracker::onMeetingStatus(ZOOM_SDK_NAMESPACE::MeetingStatus status) {
+		state_.set(MeetingStateField::Status, status);
+		switch (status) {
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_ENDED:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_FAILED:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_IDLE:
+			state_.reset();
+			break;
+		default:
+			break;
+		}
+	}
+
+	void MeetingStateTracker::onStatisticsWarning(ZOOM_SDK_NAMESPACE::StatisticsWarningType type) {
+		state_.set(MeetingStateField::StatisticsWarning, type);
+	}
+
+	void MeetingStateTracker::load(ZOOM_SDK_NAMESPACE::IMeetingService* meetingService, bool everything) {
+		if (!meetingService) {
+			return;
+		}
+
+		state_.set(MeetingStateField::Locked, meetingService->IsMeetingLocked() ? 1 : 0);
+		state_.set(MeetingStateField::AudioSendQuality, meetingService->GetAudioConnQuality(true));
+		state_.set(MeetingStateField::AudioReceiveQuality, meetingService->GetAudioConnQuality(false));
+		state_.set(MeetingStateField::VideoSendQuality, meetingService->GetVideoConnQuality(true));
+		state_.set(MeetingStateField::VideoReceiveQuality, meetingService->GetVideoConnQuality(false));
+		state_.set(MeetingStateField::ShareSendQuality, meetingService->GetSharingConnQuality(true));
+		state_.set(MeetingStateField::ShareReceiveQuality, meetingService->GetSharingConnQuality(false));
+		if (!everything) {
+			return;
+		}
+
+		ZOOM_SDK_NAMESPACE::IMeetingShareController* share = meetingService->GetMeetingShareController();
+		bool shareLocked = false;
+		if (share && share->IsShareLocked(shareLocked) == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+			state_.set(MeetingStateField::ShareLocked, shareLocked ? 1 : 0);
+		}
+		if (share) {
+			loadSharing(*share);
+		}
+
+		ZOOM_SDK_NAMESPACE::IMeetingRecordingController* recording = meetingService->GetMeetingRecordingController();
+		if (recording) {
+			state_.set(MeetingStateField::CloudRecording, recording->GetCloudRecordingStatus());
+		}
+		// The SDK cannot be asked for the local recording status; one from
+		// before the events were missed may be stale.
+		state_.set(MeetingStateField::LocalRecording, kMeetingStateUnknown);
+
+		ZOOM_SDK_NAMESPACE::IMeetingChatController* chat = meetingService->GetMeetingChatController();
+		const ZOOM_SDK_NAMESPACE::ChatStatus* chatStatus = chat ? chat->GetChatStatus() : nullptr;
+		if (chatStatus) {
+			setChat(*chatStatus);
+		}
+
+#if defined(WIN32)
+		ZOOM_SDK_NAMESPACE::IClosedCaptionController* captions = meetingService->GetMeetingClosedCaptionController();
+		if (captions) {
+			state_.set(MeetingStateField::Captions, captions->IsCaptionsEnabled() ? 1 : 0);
+			state_.set(MeetingStateField::LiveTranscription, captions->GetLiveTranscriptionStatus());
+			state_.set(MeetingStateField::ManualCaptions, captions->IsMeetingManualCaptionEnabled() ? 1 : 0);
+		}
+#endif
+	}
+
+	void MeetingStateTracker::loadSharing(ZOOM_SDK_NAMESPACE::IMeetingShareController& share) {
+		// The first share that can be viewed stands for the meeting's, as the
+		// latest onSharingStatus would.
+		ZOOM_SDK_NAMESPACE::IList<unsigned int>* users = share.GetViewableSharingUserList();
+		const uint32_t userId = users && users->GetCount() > 0 ? users->GetItem(0) : 0;
+		ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo>* sources =
+			userId != 0 ? share.GetSharingSourceInfoList(userId) : nullptr;
+		if (!sources || sources->GetCount() <= 0) {
+			state_.set(MeetingStateField::SharingUser, 0);
+			state_.set(MeetingStateField::ShareStatus, kMeetingStateUnknown);
+			return;
+		}
+
+		state_.set(MeetingStateField::SharingUser, userId);
+		state_.set(MeetingStateField::ShareStatus, sources->GetItem(0).status);
+	}
+
+	void MeetingStateTracker::onSharingStatus(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) {
+		state_.set(MeetingStateField::ShareStatus, shareInfo.status);
+		switch (shareInfo.status) {
+		case ZOOM_SDK_NAMESPACE::Sharing_Self_Send_Begin:
+		case ZOOM_SDK_NAMESPACE::Sharing_Self_Send_Pure_Audio_Begin:
+		case ZOOM_SDK_NAMESPACE::Sharing_Other_Share_Begin:
+		case ZOOM_SDK_NAMESPACE::Sharing_Other_Share_Pure_Audio_Begin:
+		case ZOOM_SDK_NAMESPACE::Sharing_View_Other_Sharing:
+		case ZOOM_SDK_NAMESPACE::Sharing_Resume:
+			state_.set(MeetingStateField::SharingUser, shareInfo.userid);
+			break;
+		case ZOOM_SDK_NAMESPACE::Sharing_Self_Send_End:
+		case ZOOM_SDK_NAMESPACE::Sharing_Self_Send_Pure_Audio_End:
+		case ZOOM_SDK_NAMESPACE::Sharing_Other_Share_End:
+		case ZOOM_SDK_NAMESPACE::Sharing_Other_Share_Pure_Audio_End:
+			state_.set(MeetingStateField::SharingUser, 0);
+			break;
+		default:
+			break;
+		}
+	}
+
+	void MeetingStateTracker::onLockShareStatus(bool bLocked) {
+		state_.set(MeetingStateField::ShareLocked, bLocked ? 1 : 0);
+	}
+
+	void MeetingStateTracker::onRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) {
+		state_.set(MeetingStateField::LocalRecording, status);
+	}
+
+	void MeetingStateTracker::onCloudRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) {
+		state_.set(MeetingStateField::CloudRecording, status);
+	}
+
+	void MeetingStateTracker::setChat(const ZOOM_SDK_NAMESPACE::ChatStatus& status) {
+		int64_t chat = status.is_chat_off ? kChatOff : 0;
+		if (!status.is_webinar_meeting) {
+			const ZOOM_SDK_NAMESPACE::NormalMeetingChatStatus& normal = status.ut.normal_meeting_status;
+			chat |= (normal.can_chat ? kChatAllowed : 0)
+				| (normal.can_chat_to_all ? kChatToEveryone : 0)
+				| (normal.can_chat_to_individual ? kChatToIndividuals : 0)
+				| (normal.is_only_can_chat_to_host ? kChatToHostOnly : 0);
+		}
+		else if (status.is_webinar_attendee) {
+			const ZOOM_SDK_NAMESPACE::WebinarAttendeeChatStatus& attendee = status.ut.webinar_attendee_status;
+			chat |= (attendee.can_chat ? kChatAllowed : 0)
+				| (attendee.can_chat_to_all_panellist_and_attendee ? kChatToEveryone : 0)
+				| (attendee.can_chat_to_all_panellist ? kChatToPanelists : 0);
+		}
+		else {
+			const ZOOM_SDK_NAMESPACE::WebinarOtherUserRoleChatStatus& other = status.ut.webinar_other_status;
+			chat |= kChatAllowed
+				| (other.can_chat_to_all_panellist_and_attendee ? kChatToEveryone : 0)
+				| (other.can_chat_to_individual ? kChatToIndividuals : 0)
+				| (other.can_chat_to_all_panellist ? kChatToPanelists : 0);
+		}
+		state_.set(MeetingStateField::Chat, chat);
+	}
+
+	void MeetingStateTracker::onChatStatusChangedNotification(ZOOM_SDK_NAMESPACE::ChatStatus* status_) {
+		if (status_) {
+			setChat(*status_);
+		}
+	}
+
+	void MeetingStateTracker::onLiveTranscriptionStatus(ZOOM_SDK_NAMESPACE::SDKLiveTranscriptionStatus status) {
+		state_.set(MeetingStateField::LiveTranscription, status);
+	}
+
+	void MeetingStateTracker::onCaptionStatusChanged(bool bEnabled) {
+		state_.set(MeetingStateField::Captions, bEnabled ? 1 : 0);
+	}
+
+	void MeetingStateTracker::onManualCaptionStatusChanged(bool bEnabled) {
+		state_.set(MeetingStateField::ManualCaptions, bEnabled ? 1 : 0);
+	}
+
+	void MeetingStateTracker::updateRoles(uint32_t id) {
+		const uint32_t index = roster_.indexOf(id);
+		const uint16_t attributes = index == RosterStore::kNotFound ? 0 : roster_.attributes(index);
+		if (attributes & kRosterHost) {
+			state_.set(MeetingStateField::Host, id);
+		}
+		else if (state_.get(MeetingStateField::Host) == id) {
+			state_.set(MeetingStateField::Host, 0);
+		}
+		state_.setCoHost(id, (attributes & kRosterCoHost) != 0);
+	}
+
+	void MeetingStateTracker::onRosterJoined(uint32_t id) {
+		updateRoles(id);
+	}
+
+	void MeetingStateTracker::onRosterLeft(uint32_t id) {
+		updateRoles(id);
+	}
+
+	void MeetingStateTracker::onRosterCleared() {
+		// The roster is no longer followed, or the meeting is over; whoever
+		// held a role may leave unseen, and a reload reports them again.
+		const int64_t host = state_.get(MeetingStateField::Host);
+		if (host != kMeetingStateUnknown && host != 0) {
+			state_.set(MeetingStateField::Host, 0);
+		}
+		state_.clearCoHosts();
+	}
+
+	void MeetingStateTracker::onRosterChanged(uint32_t id, uint16_t fields) {
+		if (fields & kRosterFieldAttributes) {
+			updateRoles(id);
+		}
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,115 @@
+#ifndef FLUTTER_PLUGIN_MEETING_MEETING_STATE_TRACKER_H_
+#define FLUTTER_PLUGIN_MEETING_MEETING_STATE_TRACKER_H_
+
+#include <ctime>
+
+#include <meeting_service_interface.h>
+#include <meeting_service_components/meeting_chat_interface.h>
+#include <meeting_service_components/meeting_closedcaption_interface.h>
+#include <meeting_service_components/meeting_recording_interface.h>
+#include <meeting_service_components/meeting_sharing_interface.h>
+
+#include <cstdint>
+
+#include "meeting/meeting_state.h"
+#include "meeting/roster_store.h"
+
+namespace flutter_zoom_sdk {
+
+	// Keeps MeetingState current: the share, recording, chat and caption
+	// events set their fields as they come, the host and co-hosts follow the
+	// roster's attributes, and load() reads what has no event, the lock and
+	// the connection qualities. Platform thread only.
+	class MeetingStateTracker : public ZOOM_SDK_NAMESPACE::IMeetingShareCtrlEvent,
+		public ZOOM_SDK_NAMESPACE::IMeetingRecordingCtrlEvent,
+		public ZOOM_SDK_NAMESPACE::IMeetingChatCtrlEvent,
+		public ZOOM_SDK_NAMESPACE::IClosedCaptionControllerEvent,
+		public RosterObserver {
+	public:
+		MeetingStateTracker(MeetingState& state, const RosterStore& roster);
+
+		MeetingStateTracker(const MeetingStateTracker&) = delete;
+		MeetingStateTracker& operator=(const MeetingStateTracker&) = delete;
+
+		// Forgets the meeting's fields when it ends.
+		void onMeetingStatus(ZOOM_SDK_NAMESPACE::MeetingStatus status);
+
+		void onStatisticsWarning(ZOOM_SDK_NAMESPACE::StatisticsWarningType type);
+
+		// Reads the lock and the connection qualities. With everything, also
+		// the fields that have events, for joining mid-way.
+		void load(ZOOM_SDK_NAMESPACE::IMeetingService* meetingService, bool everything);
+
+		void onSharingStatus(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) override;
+		void onFailedToStartShare() override {}
+		void onLockShareStatus(bool bLocked) override;
+		void onShareContentNotification(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) override {}
+		void onMultiShareSwitchToSingleShareNeedConfirm(ZOOM_SDK_NAMESPACE::IShareSwitchMultiToSingleConfirmHandler* handler_) override {}
+		void onShareSettingTypeChangedNotification(ZOOM_SDK_NAMESPACE::ShareSettingType type) override {}
+		void onSharedVideoEnded() override {}
+		void onVideoFileSharePlayError(ZOOM_SDK_NAMESPACE::ZoomSDKVideoFileSharePlayError error) override {}
+		void onOptimizingShareForVideoClipStatusChanged(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) override {}
+
+		void onRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) override;
+		void onCloudRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) override;
+		void onRecordPrivilegeChanged(bool bCanRec) override {}
+		void onLocalRecordingPrivilegeRequestStatus(ZOOM_SDK_NAMESPACE::RequestLocalRecordingStatus status) override {}
+		void onRequestCloudRecordingResponse(ZOOM_SDK_NAMESPACE::RequestStartCloudRecordingStatus status) override {}
+		void onLocalRecordingPrivilegeRequested(ZOOM_SDK_NAMESPACE::IRequestLocalRecordingPrivilegeHandler* handler) override {}
+		void onStartCloudRecordingRequested(ZOOM_SDK_NAMESPACE::IRequestStartCloudRecordingHandler* handler) override {}
+#if defined(WIN32)
+		void onRecording2MP4Done(bool bsuccess, int iResult, const zchar_t* szPath) override {}
+		void onRecording2MP4Processing(int iPercentage) override {}
+		void onCustomizedLocalRecordingSourceNotification(ZOOM_SDK_NAMESPACE::ICustomizedLocalRecordingLayoutHelper* layout_helper) override {}
+#endif
+		void onCloudRecordingStorageFull(time_t gracePeriodDate) override {}
+		void onEnableAndStartSmartRecordingRequested(ZOOM_SDK_NAMESPACE::IRequestEnableAndStartSmartRecordingHandler* handler) override {}
+		void onSmartRecordingEnableActionCallback(ZOOM_SDK_NAMESPACE::ISmartRecordingEnableActionHandler* handler) override {}
+#if defined(__linux__)
+		void onTranscodingStatusChanged(ZOOM_SDK_NAMESPACE::TranscodingStatus status, const zchar_t* path) override {}
+#endif
+
+		void onChatMsgNotification(ZOOM_SDK_NAMESPACE::IChatMsgInfo* chatMsg, const zchar_t* content = nullptr) override {}
+		void onChatStatusChangedNotification(ZOOM_SDK_NAMESPACE::ChatStatus* status_) override;
+		void onChatMsgDeleteNotification(const zchar_t* msgID, ZOOM_SDK_NAMESPACE::SDKChatMessageDeleteType deleteBy) override {}
+		void onChatMessageEditNotification(ZOOM_SDK_NAMESPACE::IChatMsgInfo* chatMsg) override {}
+		void onShareMeetingChatStatusChanged(bool isStart) override {}
+		void onFileSendStart(ZOOM_SDK_NAMESPACE::ISDKFileSender* sender) override {}
+		void onFileReceived(ZOOM_SDK_NAMESPACE::ISDKFileReceiver* receiver) override {}
+		void onFileTransferProgress(ZOOM_SDK_NAMESPACE::SDKFileTransferInfo* info) override {}
+
+		void onAssignedToSendCC(bool bAssigned) override {}
+		void onClosedCaptionMsgReceived(const zchar_t* ccMsg, unsigned int sender_id, time_t time) override {}
+		void onLiveTranscriptionStatus(ZOOM_SDK_NAMESPACE::SDKLiveTranscriptionStatus status) override;
+		void onOriginalLanguageMsgReceived(ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo* messageInfo) override {}
+		void onLiveTranscriptionMsgInfoReceived(ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo* messageInfo) override {}
+		void onLiveTranscriptionMsgError(ZOOM_SDK_NAMESPACE::ILiveTranscriptionLanguage* spokenLanguage, ZOOM_SDK_NAMESPACE::ILiveTranscriptionLanguage* transcriptLanguage) override {}
+		void onRequestForLiveTranscriptReceived(unsigned int requester_id, bool bAnonymous) override {}
+		void onRequestLiveTranscriptionStatusChange(bool bEnabled) override {}
+		void onCaptionStatusChanged(bool bEnabled) override;
+		void onStartCaptionsRequestReceived(ZOOM_SDK_NAMESPACE::ICCRequestHandler* handler) override {}
+		void onStartCaptionsRequestApproved() override {}
+		void onManualCaptionStatusChanged(bool bEnabled) override;
+		void onSpokenLanguageChanged(ZOOM_SDK_NAMESPACE::ILiveTranscriptionLanguage* spokenLanguage) override {}
+
+		void onRosterJoined(uint32_t id) override;
+		void onRosterLeft(uint32_t id) override;
+		void onRosterChanged(uint32_t id, uint16_t fields) override;
+		void onRosterCleared() override;
+
+	private:
+		void setChat(const ZOOM_SDK_NAMESPACE::ChatStatus& status);
+
+		// The sharing user and status, from who can be viewed sharing now.
+		void loadSharing(ZOOM_SDK_NAMESPACE::IMeetingShareController& share);
+
+		// Host and co-host from id's roster attributes.
+		void updateRoles(uint32_t id);
+
+		MeetingState& state_;
+		const RosterStore& roster_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_MEETING_STATE_TRACKER_H_
@@ -0,0 +1,237 @@
+#include "meeting/roster_index.h"
+
+#include <algorithm>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		bool isSpace(char c) {
+			return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+		}
+
+		// Name changes can move a member between indices, as can these fields.
+		constexpr uint16_t kFilterFields = kRosterFieldAttributes | rosterFlagField(RosterFlag::HandRaised);
+	}
+
+	RosterIndex::RosterIndex(const RosterStore& store) : store_(store) {}
+
+	std::string RosterIndex::normalize(const std::string& name, bool trimEnd) {
+		std::string key;
+		key.reserve(name.size());
+		bool space = false;
+		for (char c : name) {
+			if (isSpace(c)) {
+				space = !key.empty();
+				continue;
+			}
+			if (space) {
+				key.push_back(' ');
+				space = false;
+			}
+			key.push_back(c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c);
+		}
+		if (space && !trimEnd) {
+			key.push_back(' ');
+		}
+		return key;
+	}
+
+	uint16_t RosterIndex::filtersOf(uint32_t id) const {
+		const uint32_t index = store_.indexOf(id);
+		if (index == RosterStore::kNotFound) {
+			return 0;
+		}
+
+		const uint16_t attributes = store_.attributes(index);
+		uint16_t filters = 0;
+		if (store_.flag(index, RosterFlag::HandRaised)) {
+			filters |= kRosterFilterHandRaised;
+		}
+		if (attributes & kRosterWaitingRoom) {
+			filters |= kRosterFilterWaitingRoom;
+		}
+		if (attributes & (kRosterHost | kRosterCoHost)) {
+			filters |= kRosterFilterHostOrCoHost;
+		}
+		if (attributes & kRosterPurePhone) {
+			filters |= kRosterFilterPurePhone;
+		}
+		if (attributes & kRosterBot) {
+			filters |= kRosterFilterBot;
+		}
+		return filters;
+	}
+
+	bool RosterIndex::less(uint32_t a, uint32_t b) const {
+		const int order = entries_[a].key.compare(entries_[b].key);
+		return order != 0 ? order < 0 : entries_[a].id < entries_[b].id;
+	}
+
+	void RosterIndex::insert(Order& order, uint32_t slot) {
+		auto it = std::lower_bound(order.begin(), order.end(), slot,
+			[this](uint32_t a, uint32_t b) { return less(a, b); });
+		order.insert(it, slot);
+	}
+
+	void RosterIndex::erase(Order& order, uint32_t slot) {
+		auto it = std::lower_bound(order.begin(), order.end(), slot,
+			[this](uint32_t a, uint32_t b) { return less(a, b); });
+		if (it != order.end() && *it == slot) {
+			order.erase(it);
+		}
+	}
+
+	void RosterIndex::onRosterJoined(uint32_t id) {
+		const uint32_t index = store_.indexOf(id);
+		if (index == RosterStore::kNotFound || slots_.find(id) != FlatIdMap::kMissing) {
+			return;
+		}
+
+		uint32_t slot;
+		if (!freeSlots_.empty()) {
+			slot = freeSlots_.back();
+			freeSlots_.pop_back();
+		}
+		else {
+			slot = static_cast<uint32_t>(entries_.size());
+			entries_.emplace_back();
+		}
+		Entry& entry = entries_[slot];
+		entry.key = normalize(store_.name(index));
+		entry.id = id;
+		entry.filters = filtersOf(id);
+		slots_.set(id, slot);
+
+		insert(all_, slot);
+		for (size_t f = 0; f < kRosterFilterCount; f++) {
+			if (entry.filters & (1 << f)) {
+				insert(filtered_[f], slot);
+			}
+		}
+	}
+
+	void RosterIndex::onRosterLeft(uint32_t id) {
+		const uint32_t slot = slots_.find(id);
+		if (slot == FlatIdMap::kMissing) {
+			return;
+		}
+
+		erase(all_, slot);
+		for (size_t f = 0; f < kRosterFilterCount; f++) {
+			if (entries_[slot].filters & (1 << f)) {
+				erase(filtered_[f], slot);
+			}
+		}
+		slots_.erase(id);
+		entries_[slot].key.clear();
+		freeSlots_.push_back(slot);
+	}
+
+	void RosterIndex::onRosterChanged(uint32_t id, uint16_t fields) {
+		const uint32_t slot = slots_.find(id);
+		if (slot == FlatIdMap::kMissing) {
+			return;
+		}
+		Entry& entry = entries_[slot];
+
+		if (fields & kRosterFieldName) {
+			const uint32_t index = store_.indexOf(id);
+			std::string key = index == RosterStore::kNotFound ? entry.key : normalize(store_.name(index));
+			if (key != entry.key) {
+				// Out of every index under the old key, back in under the new.
+				erase(all_, slot);
+				for (size_t f = 0; f < kRosterFilterCount; f++) {
+					if (entry.filters & (1 << f)) {
+						erase(filtered_[f], slot);
+					}
+				}
+				entry.key = std::move(key);
+				insert(all_, slot);
+				for (size_t f = 0; f < kRosterFilterCount; f++) {
+					if (entry.filters & (1 << f)) {
+						insert(filtered_[f], slot);
+					}
+				}
+			}
+		}
+
+		if (fields & kFilterFields) {
+			const uint16_t filters = filtersOf(id);
+			const uint16_t changed = filters ^ entry.filters;
+			for (size_t f = 0; f < kRosterFilterCount; f++) {
+				if (!(changed & (1 << f))) {
+					continue;
+				}
+				if (filters & (1 << f)) {
+					insert(filtered_[f], slot);
+				}
+				else {
+					erase(filtered_[f], slot);
+				}
+			}
+			entry.filters = filters;
+		}
+	}
+
+	void RosterIndex::onRosterCleared() {
+		slots_.clear();
+		entries_.clear();
+		freeSlots_.clear();
+		all_.clear();
+		for (auto& order : filtered_) {
+			order.clear();
+		}
+	}
+
+	RosterPage RosterIndex::query(const RosterQuery& query) const {
+		// Walk the smallest index among the filters asked for.
+		const Order* order = &all_;
+		uint16_t walked = 0;
+		for (size_t f = 0; f < kRosterFilterCount; f++) {
+			if ((query.filters & (1 << f)) && (walked == 0 || filtered_[f].size() < order->size())) {
+				order = &filtered_[f];
+				walked = static_cast<uint16_t>(1 << f);
+			}
+		}
+		const uint16_t remaining = query.filters & ~walked;
+
+		auto begin = order->begin();
+		auto end = order->end();
+		const std::string prefix = normalize(query.prefix, false);
+		if (!prefix.empty()) {
+			begin = std::lower_bound(order->begin(), order->end(), prefix,
+				[this](uint32_t slot, const std::string& prefix) { return entries_[slot].key.compare(0, prefix.size(), prefix) < 0; });
+			end = std::upper_bound(begin, order->end(), prefix,
+				[this](const std::string& prefix, uint32_t slot) { return entries_[slot].key.compare(0, prefix.size(), prefix) > 0; });
+		}
+
+		RosterPage page;
+		const size_t range = static_cast<size_t>(end - begin);
+		if (remaining == 0) {
+			page.total = range;
+			if (query.offset >= range) {
+				return page;
+			}
+			const size_t count = std::min(query.limit, range - query.offset);
+			page.ids.reserve(count);
+			for (size_t i = 0; i < count; i++) {
+				const size_t at = query.descending ? range - 1 - query.offset - i : query.offset + i;
+				page.ids.push_back(entries_[begin[at]].id);
+			}
+			return page;
+		}
+
+		for (size_t i = 0; i < range; i++) {
+			const Entry& entry = entries_[begin[query.descending ? range - 1 - i : i]];
+			if ((entry.filters & remaining) != remaining) {
+				continue;
+			}
+			if (page.total >= query.offset && page.ids.size() < query.limit) {
+				page.ids.push_back(entry.id);
+			}
+			page.total++;
+		}
+		return page;
+	}
+
+}  // namespace flutter_zoom_sdk
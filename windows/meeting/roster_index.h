@@ -0,0 +1,93 @@
+#ifndef FLUTTER_PLUGIN_MEETING_ROSTER_INDEX_H_
+#define FLUTTER_PLUGIN_MEETING_ROSTER_INDEX_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "meeting/flat_id_map.h"
+#include "meeting/roster_store.h"
+
+namespace flutter_zoom_sdk {
+
+	// Filters of a roster query; a member must match every one that is set.
+	constexpr uint16_t kRosterFilterHandRaised = 1 << 0;
+	constexpr uint16_t kRosterFilterWaitingRoom = 1 << 1;
+	constexpr uint16_t kRosterFilterHostOrCoHost = 1 << 2;
+	constexpr uint16_t kRosterFilterPurePhone = 1 << 3;
+	constexpr uint16_t kRosterFilterBot = 1 << 4;
+	constexpr size_t kRosterFilterCount = 5;
+
+	struct RosterQuery {
+		uint16_t filters = 0;
+
+		// Matches the start of the name, ignoring ASCII case and runs of
+		// whitespace.
+		std::string prefix;
+		bool descending = false;
+		size_t offset = 0;
+		size_t limit = 50;
+	};
+
+	struct RosterPage {
+		// Members matching the query, over all pages.
+		size_t total = 0;
+
+		// The requested page, in name order.
+		std::vector<uint32_t> ids;
+	};
+
+	// Name-ordered indices over a RosterStore, one of everybody and one per
+	// filter, kept current from the store's change notifications. A prefix is
+	// a binary-searched range of an index, so a query with at most one filter
+	// costs O(log n + page); each further filter is checked only within the
+	// range of the smallest index. Not thread-safe; used with the store.
+	class RosterIndex : public RosterObserver {
+	public:
+		explicit RosterIndex(const RosterStore& store);
+
+		RosterIndex(const RosterIndex&) = delete;
+		RosterIndex& operator=(const RosterIndex&) = delete;
+
+		RosterPage query(const RosterQuery& query) const;
+
+		// Lowercases ASCII and folds runs of whitespace into one space; with
+		// trimEnd, trailing whitespace is dropped too.
+		static std::string normalize(const std::string& name, bool trimEnd = true);
+
+		void onRosterJoined(uint32_t id) override;
+		void onRosterLeft(uint32_t id) override;
+		void onRosterChanged(uint32_t id, uint16_t fields) override;
+		void onRosterCleared() override;
+
+	private:
+		struct Entry {
+			std::string key;
+			uint32_t id;
+			uint16_t filters;
+		};
+
+		// Indices hold slots of entries_, ordered by key, then id.
+		using Order = std::vector<uint32_t>;
+
+		uint16_t filtersOf(uint32_t id) const;
+
+		bool less(uint32_t a, uint32_t b) const;
+
+		void insert(Order& order, uint32_t slot);
+
+		void erase(Order& order, uint32_t slot);
+
+		const RosterStore& store_;
+		FlatIdMap slots_;
+		std::vector<Entry> entries_;
+		std::vector<uint32_t> freeSlots_;
+		Order all_;
+		std::array<Order, kRosterFilterCount> filtered_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_ROSTER_INDEX_H_
@@ -0,0 +1,208 @@
+#include "meeting/roster_store.h"
+
+#include <algorithm>
+
+namespace flutter_zoom_sdk {
+
+	void RosterStore::addObserver(RosterObserver* observer) {
+		if (std::find(observers_.begin(), observers_.end(), observer) == observers_.end()) {
+			observers_.push_back(observer);
+		}
+	}
+
+	void RosterStore::removeObserver(RosterObserver* observer) {
+		observers_.erase(std::remove(observers_.begin(), observers_.end(), observer), observers_.end());
+	}
+
+	void RosterStore::reserve(size_t members) {
+		index_.reserve(members);
+		ids_.reserve(members);
+		names_.reserve(members);
+		attributes_.reserve(members);
+		for (auto& column : flags_) {
+			column.reserve(members);
+		}
+	}
+
+	uint32_t RosterStore::upsert(const RosterMember& member) {
+		if (member.id == 0) {
+			return kNotFound;
+		}
+
+		uint32_t index = index_.find(member.id);
+		if (index == kNotFound) {
+			index = static_cast<uint32_t>(ids_.size());
+			index_.set(member.id, index);
+			ids_.push_back(member.id);
+			names_.push_back(member.name);
+			attributes_.push_back(member.attributes);
+			for (size_t f = 0; f < kRosterFlagCount; f++) {
+				flags_[f].push_back(member.flags[f] ? 1 : 0);
+			}
+			for (RosterObserver* observer : observers_) {
+				observer->onRosterJoined(member.id);
+			}
+			return index;
+		}
+
+		uint16_t fields = 0;
+		if (names_[index] != member.name) {
+			names_[index] = member.name;
+			fields |= kRosterFieldName;
+		}
+		if (attributes_[index] != member.attributes) {
+			attributes_[index] = member.attributes;
+			fields |= kRosterFieldAttributes;
+		}
+		for (size_t f = 0; f < kRosterFlagCount; f++) {
+			const uint8_t value = member.flags[f] ? 1 : 0;
+			if (flags_[f][index] != value) {
+				flags_[f][index] = value;
+				fields |= rosterFlagField(static_cast<RosterFlag>(f));
+			}
+		}
+		if (fields != 0) {
+			for (RosterObserver* observer : observers_) {
+				observer->onRosterChanged(member.id, fields);
+			}
+		}
+		return index;
+	}
+
+	bool RosterStore::remove(uint32_t id) {
+		const uint32_t index = index_.find(id);
+		if (index == kNotFound) {
+			return false;
+		}
+
+		const uint32_t last = static_cast<uint32_t>(ids_.size() - 1);
+		if (index != last) {
+			ids_[index] = ids_[last];
+			names_[index] = std::move(names_[last]);
+			attributes_[index] = attributes_[last];
+			for (auto& column : flags_) {
+				column[index] = column[last];
+			}
+			index_.set(ids_[index], index);
+		}
+		ids_.pop_back();
+		names_.pop_back();
+		attributes_.pop_back();
+		for (auto& column : flags_) {
+			column.pop_back();
+		}
+		index_.erase(id);
+		for (RosterObserver* observer : observers_) {
+			observer->onRosterLeft(id);
+		}
+		return true;
+	}
+
+	void RosterStore::clear() {
+		index_.clear();
+		ids_.clear();
+		names_.clear();
+		attributes_.clear();
+		for (auto& column : flags_) {
+			column.clear();
+		}
+		for (RosterObserver* observer : observers_) {
+			observer->onRosterCleared();
+		}
+	}
+
+	bool RosterStore::member(uint32_t id, RosterMember& member) const {
+		const uint32_t index = index_.find(id);
+		if (index == kNotFound) {
+			return false;
+		}
+
+		member.id = id;
+		member.name = names_[index];
+		member.attributes = attributes_[index];
+		for (size_t f = 0; f < kRosterFlagCount; f++) {
+			member.flags[f] = flags_[f][index] != 0;
+		}
+		return true;
+	}
+
+	bool RosterStore::setName(uint32_t id, const std::string& name) {
+		const uint32_t index = index_.find(id);
+		if (index == kNotFound || names_[index] == name) {
+			return false;
+		}
+
+		names_[index] = name;
+		for (RosterObserver* observer : observers_) {
+			observer->onRosterChanged(id, kRosterFieldName);
+		}
+		return true;
+	}
+
+	bool RosterStore::setAttribute(uint32_t id, uint16_t attribute, bool on) {
+		const uint32_t index = index_.find(id);
+		if (index == kNotFound) {
+			return false;
+		}
+
+		const uint16_t updated = on ? attributes_[index] | attribute : attributes_[index] & ~attribute;
+		if (updated == attributes_[index]) {
+			return false;
+		}
+		attributes_[index] = updated;
+		for (RosterObserver* observer : observers_) {
+			observer->onRosterChanged(id, kRosterFieldAttributes);
+		}
+		return true;
+	}
+
+	bool RosterStore::setFlag(uint32_t id, RosterFlag which, bool on) {
+		const uint32_t index = index_.find(id);
+		if (index == kNotFound) {
+			return false;
+		}
+
+		uint8_t& value = flags_[static_cast<size_t>(which)][index];
+		if ((value != 0) == on) {
+			return false;
+		}
+		value = on ? 1 : 0;
+		for (RosterObserver* observer : observers_) {
+			observer->onRosterChanged(id, rosterFlagField(which));
+		}
+		return true;
+	}
+
+	size_t RosterStore::count(RosterFlag which) const {
+		const auto& column = flags_[static_cast<size_t>(which)];
+		size_t count = 0;
+		for (uint8_t value : column) {
+			count += value;
+		}
+		return count;
+	}
+
+	std::vector<uint32_t> RosterStore::clearFlag(RosterFlag which) {
+		auto& column = flags_[static_cast<size_t>(which)];
+		std::vector<uint32_t> changed;
+		for (size_t i = 0; i < column.size(); i++) {
+			if (column[i]) {
+				column[i] = 0;
+				changed.push_back(ids_[i]);
+			}
+		}
+		for (uint32_t id : changed) {
+			for (RosterObserver* observer : observers_) {
+				observer->onRosterChanged(id, rosterFlagField(which));
+			}
+		}
+		return changed;
+	}
+
+	uint32_t RosterStore::hostId() const {
+		const auto it = std::find_if(attributes_.begin(), attributes_.end(),
+			[](uint16_t attributes) { return (attributes & kRosterHost) != 0; });
+		return it == attributes_.end() ? 0 : ids_[static_cast<size_t>(it - attributes_.begin())];
+	}
+
+}  // namespace flutter_zoom_sdk
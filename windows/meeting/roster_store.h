@@ -0,0 +1,144 @@
+#ifndef FLUTTER_PLUGIN_MEETING_ROSTER_STORE_H_
+#define FLUTTER_PLUGIN_MEETING_ROSTER_STORE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "meeting/flat_id_map.h"
+
+namespace flutter_zoom_sdk {
+
+	// Flags read on nearly every roster update and count, kept one array
+	// each so a scan touches only the flag it needs.
+	enum class RosterFlag : uint8_t {
+		VideoOn = 0,
+		Muted = 1,
+		Talking = 2,
+		HandRaised = 3,
+	};
+
+	constexpr size_t kRosterFlagCount = 4;
+
+	// Rarely changing traits of a participant.
+	constexpr uint16_t kRosterHost = 1 << 0;
+	constexpr uint16_t kRosterCoHost = 1 << 1;
+	constexpr uint16_t kRosterMyself = 1 << 2;
+	constexpr uint16_t kRosterWaitingRoom = 1 << 3;
+	constexpr uint16_t kRosterPurePhone = 1 << 4;
+	constexpr uint16_t kRosterBot = 1 << 5;
+	constexpr uint16_t kRosterH323 = 1 << 6;
+	constexpr uint16_t kRosterInterpreter = 1 << 7;
+	constexpr uint16_t kRosterPanelist = 1 << 8;
+	constexpr uint16_t kRosterAttendee = 1 << 9;
+
+	// Fields a roster change touched: the name, the attributes, then one bit
+	// per RosterFlag.
+	constexpr uint16_t kRosterFieldName = 1 << 0;
+	constexpr uint16_t kRosterFieldAttributes = 1 << 1;
+	constexpr uint16_t kRosterFieldFirstFlag = 1 << 2;
+	constexpr uint16_t kRosterFieldFlags = ((1 << kRosterFlagCount) - 1) * kRosterFieldFirstFlag;
+	constexpr uint16_t kRosterFieldAll = kRosterFieldName | kRosterFieldAttributes | kRosterFieldFlags;
+
+	constexpr uint16_t rosterFlagField(RosterFlag which) {
+		return static_cast<uint16_t>(kRosterFieldFirstFlag << static_cast<uint16_t>(which));
+	}
+
+	struct RosterMember {
+		uint32_t id = 0;
+		std::string name;
+		uint16_t attributes = 0;
+		std::array<bool, kRosterFlagCount> flags{};
+
+		bool flag(RosterFlag which) const { return flags[static_cast<size_t>(which)]; }
+	};
+
+	// Told about every change to a RosterStore, right after it is made.
+	class RosterObserver {
+	public:
+		virtual ~RosterObserver() = default;
+
+		virtual void onRosterJoined(uint32_t id) = 0;
+
+		virtual void onRosterLeft(uint32_t id) = 0;
+
+		// fields is a set of kRosterField* bits, never empty.
+		virtual void onRosterChanged(uint32_t id, uint16_t fields) = 0;
+
+		// Everyone was removed at once, ahead of a reload or after the meeting.
+		virtual void onRosterCleared() = 0;
+	};
+
+	// The meeting's participants, indexed by user id through a FlatIdMap into
+	// dense columns. Removal moves the last member into the hole, so indices
+	// are only stable until the next remove. Not thread-safe; the plugin uses
+	// it on the platform thread, where the SDK delivers its events.
+	class RosterStore {
+	public:
+		static constexpr uint32_t kNotFound = FlatIdMap::kMissing;
+
+		RosterStore() = default;
+
+		RosterStore(const RosterStore&) = delete;
+		RosterStore& operator=(const RosterStore&) = delete;
+
+		// Observers are told in the order they were added. Not owned.
+		void addObserver(RosterObserver* observer);
+
+		void removeObserver(RosterObserver* observer);
+
+		void reserve(size_t members);
+
+		// Adds member or replaces the one with its id. Returns its index.
+		uint32_t upsert(const RosterMember& member);
+
+		bool remove(uint32_t id);
+
+		void clear();
+
+		size_t size() const { return ids_.size(); }
+
+		uint32_t indexOf(uint32_t id) const { return index_.find(id); }
+
+		bool contains(uint32_t id) const { return index_.find(id) != kNotFound; }
+
+		bool member(uint32_t id, RosterMember& member) const;
+
+		uint32_t id(uint32_t index) const { return ids_[index]; }
+
+		const std::string& name(uint32_t index) const { return names_[index]; }
+
+		uint16_t attributes(uint32_t index) const { return attributes_[index]; }
+
+		bool flag(uint32_t index, RosterFlag which) const { return flags_[static_cast<size_t>(which)][index] != 0; }
+
+		// Setters return whether the value changed; unknown ids change nothing.
+		bool setName(uint32_t id, const std::string& name);
+
+		bool setAttribute(uint32_t id, uint16_t attribute, bool on);
+
+		bool setFlag(uint32_t id, RosterFlag which, bool on);
+
+		// Members with the flag set.
+		size_t count(RosterFlag which) const;
+
+		// Clears the flag on everyone. Returns the ids that had it.
+		std::vector<uint32_t> clearFlag(RosterFlag which);
+
+		// 0 when the host is unknown.
+		uint32_t hostId() const;
+
+	private:
+		FlatIdMap index_;
+		std::vector<uint32_t> ids_;
+		std::vector<std::string> names_;
+		std::vector<uint16_t> attributes_;
+		std::array<std::vector<uint8_t>, kRosterFlagCount> flags_;
+		std::vector<RosterObserver*> observers_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_ROSTER_STORE_H_
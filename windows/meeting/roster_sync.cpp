@@ -0,0 +1,230 @@
+#include "meeting/roster_sync.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		template <typename T>
+		void appendLE(std::vector<uint8_t>& out, T value) {
+			const size_t at = out.size();
+			out.resize(at + sizeof(T));
+			std::memcpy(out.data() + at, &value, sizeof(T));
+		}
+
+		template <typename T>
+		void putLE(uint8_t* dst, T value) {
+			std::memcpy(dst, &value, sizeof(T));
+		}
+
+		void beginUpdate(std::vector<uint8_t>& out, size_t reservedPrefix, RosterSyncKind kind, uint64_t base, uint64_t version) {
+			out.resize(reservedPrefix + kRosterSyncHeaderSize);
+			uint8_t* header = out.data() + reservedPrefix;
+			header[0] = kRosterSyncFormat;
+			header[1] = static_cast<uint8_t>(kind);
+			putLE<uint16_t>(header + 2, 0);
+			putLE<uint32_t>(header + 4, 0);
+			putLE<uint64_t>(header + 8, base);
+			putLE<uint64_t>(header + 16, version);
+		}
+
+		void endUpdate(std::vector<uint8_t>& out, size_t reservedPrefix, uint32_t records) {
+			putLE<uint32_t>(out.data() + reservedPrefix + 4, records);
+		}
+
+		void appendRecord(std::vector<uint8_t>& out, const RosterStore& store, uint32_t index, RosterSyncOp op, uint16_t fields) {
+			uint8_t flags = 0;
+			for (size_t f = 0; f < kRosterFlagCount; f++) {
+				if (store.flag(index, static_cast<RosterFlag>(f))) {
+					flags |= static_cast<uint8_t>(1 << f);
+				}
+			}
+
+			appendLE<uint32_t>(out, store.id(index));
+			out.push_back(static_cast<uint8_t>(op));
+			out.push_back(flags);
+			appendLE<uint16_t>(out, fields);
+			if (fields & kRosterFieldName) {
+				const std::string& name = store.name(index);
+				const size_t length = std::min<size_t>(name.size(), UINT16_MAX);
+				appendLE<uint16_t>(out, static_cast<uint16_t>(length));
+				out.insert(out.end(), name.begin(), name.begin() + length);
+			}
+			if (fields & kRosterFieldAttributes) {
+				appendLE<uint16_t>(out, store.attributes(index));
+			}
+		}
+
+		void appendLeft(std::vector<uint8_t>& out, uint32_t id) {
+			appendLE<uint32_t>(out, id);
+			out.push_back(static_cast<uint8_t>(RosterSyncOp::Left));
+			out.push_back(0);
+			appendLE<uint16_t>(out, 0);
+		}
+	}
+
+	RosterSync::RosterSync(const RosterStore& store, WakeUp wakeUp, size_t historyChanges)
+		: store_(store),
+		wakeUp_(std::move(wakeUp)),
+		historyChanges_(historyChanges),
+		version_(0),
+		cleared_(false),
+		woken_(false),
+		historyBase_(0),
+		historySize_(0) {}
+
+	void RosterSync::wake() {
+		if (!woken_) {
+			woken_ = true;
+			if (wakeUp_) {
+				wakeUp_();
+			}
+		}
+	}
+
+	void RosterSync::note(uint32_t id, bool before, bool after, uint16_t fields) {
+		wake();
+		if (cleared_) {
+			// The snapshot will carry it.
+			return;
+		}
+
+		uint32_t index = pendingIndex_.find(id);
+		if (index == FlatIdMap::kMissing) {
+			index = static_cast<uint32_t>(pending_.size());
+			pendingIndex_.set(id, index);
+			pending_.push_back({ id, before, after, 0 });
+		}
+		Change& change = pending_[index];
+		change.after = after;
+		change.fields |= fields;
+	}
+
+	void RosterSync::onRosterJoined(uint32_t id) {
+		note(id, false, true, kRosterFieldAll);
+	}
+
+	void RosterSync::onRosterLeft(uint32_t id) {
+		note(id, true, false, 0);
+	}
+
+	void RosterSync::onRosterChanged(uint32_t id, uint16_t fields) {
+		note(id, true, true, fields);
+	}
+
+	void RosterSync::onRosterCleared() {
+		wake();
+		cleared_ = true;
+		pendingIndex_.clear();
+		pending_.clear();
+	}
+
+	bool RosterSync::flush(std::vector<uint8_t>& out, size_t reservedPrefix) {
+		woken_ = false;
+
+		if (cleared_) {
+			cleared_ = false;
+			version_++;
+			history_.clear();
+			historySize_ = 0;
+			historyBase_ = version_;
+			snapshot(out, reservedPrefix);
+			return true;
+		}
+
+		// Users who joined and left within the window, or changed nothing in
+		// the end, are dropped.
+		Batch batch;
+		for (const Change& change : pending_) {
+			if (change.before != change.after || (change.after && change.fields != 0)) {
+				batch.changes.push_back(change);
+			}
+		}
+		pendingIndex_.clear();
+		pending_.clear();
+		if (batch.changes.empty()) {
+			return false;
+		}
+
+		version_++;
+		batch.version = version_;
+		writeDelta(batch.changes, version_ - 1, out, reservedPrefix);
+
+		historySize_ += batch.changes.size();
+		history_.push_back(std::move(batch));
+		while (historySize_ > historyChanges_ && !history_.empty()) {
+			historySize_ -= history_.front().changes.size();
+			historyBase_ = history_.front().version;
+			history_.pop_front();
+		}
+		return true;
+	}
+
+	void RosterSync::since(uint64_t version, std::vector<uint8_t>& out, size_t reservedPrefix) const {
+		if (version < historyBase_ || version > version_) {
+			snapshot(out, reservedPrefix);
+			return;
+		}
+
+		// Merge the kept deltas after version the same way a window is merged.
+		FlatIdMap index;
+		std::vector<Change> merged;
+		for (const Batch& batch : history_) {
+			if (batch.version <= version) {
+				continue;
+			}
+			for (const Change& change : batch.changes) {
+				const uint32_t at = index.find(change.id);
+				if (at == FlatIdMap::kMissing) {
+					index.set(change.id, static_cast<uint32_t>(merged.size()));
+					merged.push_back(change);
+					continue;
+				}
+				merged[at].after = change.after;
+				merged[at].fields |= change.fields;
+			}
+		}
+
+		merged.erase(std::remove_if(merged.begin(), merged.end(), [](const Change& change) {
+			return change.before == change.after && (!change.after || change.fields == 0);
+		}), merged.end());
+		writeDelta(merged, version, out, reservedPrefix);
+	}
+
+	void RosterSync::snapshot(std::vector<uint8_t>& out, size_t reservedPrefix) const {
+		beginUpdate(out, reservedPrefix, RosterSyncKind::Snapshot, 0, version_);
+		const uint32_t count = static_cast<uint32_t>(store_.size());
+		for (uint32_t index = 0; index < count; index++) {
+			appendRecord(out, store_, index, RosterSyncOp::Joined, kRosterFieldAll);
+		}
+		endUpdate(out, reservedPrefix, count);
+	}
+
+	void RosterSync::writeDelta(const std::vector<Change>& changes, uint64_t base, std::vector<uint8_t>& out, size_t reservedPrefix) const {
+		beginUpdate(out, reservedPrefix, RosterSyncKind::Delta, base, version_);
+		uint32_t records = 0;
+		for (const Change& change : changes) {
+			if (!change.after) {
+				appendLeft(out, change.id);
+				records++;
+				continue;
+			}
+
+			// A user who has since left gets their Left in a later delta.
+			const uint32_t index = store_.indexOf(change.id);
+			if (index == RosterStore::kNotFound) {
+				continue;
+			}
+			if (!change.before) {
+				appendRecord(out, store_, index, RosterSyncOp::Joined, kRosterFieldAll);
+			}
+			else {
+				appendRecord(out, store_, index, RosterSyncOp::Changed, change.fields);
+			}
+			records++;
+		}
+		endUpdate(out, reservedPrefix, records);
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,124 @@
+#ifndef FLUTTER_PLUGIN_MEETING_ROSTER_SYNC_H_
+#define FLUTTER_PLUGIN_MEETING_ROSTER_SYNC_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include "meeting/flat_id_map.h"
+#include "meeting/roster_store.h"
+
+namespace flutter_zoom_sdk {
+
+	// Layout of every roster update, all little-endian:
+	//   0  u8   format (kRosterSyncFormat)
+	//   1  u8   kind (RosterSyncKind)
+	//   2  u16  reserved, 0
+	//   4  u32  record count
+	//   8  u64  base version: the version a delta applies to, 0 for a snapshot
+	//   16 u64  version after applying the update
+	//   24      records, back to back:
+	//     0  u32  user id
+	//     4  u8   op (RosterSyncOp)
+	//     5  u8   flag values, bit n for RosterFlag n
+	//     6  u16  fields present (kRosterField*); all for Joined, none for Left
+	//     8       if name: u16 byte length, then UTF-8
+	//             if attributes: u16 (kRoster* attribute bits)
+	// Applying a record is idempotent, so a client may apply a delta on top of
+	// a state that already has some of its changes.
+	constexpr uint8_t kRosterSyncFormat = 1;
+	constexpr size_t kRosterSyncHeaderSize = 24;
+
+	enum class RosterSyncKind : uint8_t {
+		Snapshot = 0,
+		Delta = 1,
+	};
+
+	enum class RosterSyncOp : uint8_t {
+		Joined = 0,
+		Left = 1,
+		Changed = 2,
+	};
+
+	// Turns the changes of a RosterStore into versioned updates for Dart: one
+	// snapshot, then deltas that carry only who joined, who left and which
+	// fields changed. Changes are collected until flush(), so a window of
+	// events for one user, such as five mute toggles, becomes one record. The
+	// last deltas are kept so a client that missed some can catch up without a
+	// snapshot. Not thread-safe; used on the platform thread with the store.
+	class RosterSync : public RosterObserver {
+	public:
+		// Called when the first change after a flush arrives, to schedule the
+		// next flush.
+		using WakeUp = std::function<void()>;
+
+		// Deltas are kept for catch-up until they hold more than historyChanges
+		// records between them.
+		RosterSync(const RosterStore& store, WakeUp wakeUp, size_t historyChanges = 4096);
+
+		RosterSync(const RosterSync&) = delete;
+		RosterSync& operator=(const RosterSync&) = delete;
+
+		uint64_t version() const { return version_; }
+
+		// Writes the changes since the last flush as one delta, or a snapshot
+		// after the store was cleared, following reservedPrefix bytes of out.
+		// Returns false, leaving out alone, when nothing changed.
+		bool flush(std::vector<uint8_t>& out, size_t reservedPrefix = 0);
+
+		// Writes what a client at version needs to reach version(): a delta
+		// from the kept history, or a snapshot when version is older than that
+		// or unknown. Changes not yet flushed are not included.
+		void since(uint64_t version, std::vector<uint8_t>& out, size_t reservedPrefix = 0) const;
+
+		void snapshot(std::vector<uint8_t>& out, size_t reservedPrefix = 0) const;
+
+		void onRosterJoined(uint32_t id) override;
+		void onRosterLeft(uint32_t id) override;
+		void onRosterChanged(uint32_t id, uint16_t fields) override;
+		void onRosterCleared() override;
+
+	private:
+		// A user's net change over a window: whether they were in the roster
+		// before and after it, and which fields changed in between.
+		struct Change {
+			uint32_t id;
+			bool before;
+			bool after;
+			uint16_t fields;
+		};
+
+		struct Batch {
+			uint64_t version;
+			std::vector<Change> changes;
+		};
+
+		void note(uint32_t id, bool before, bool after, uint16_t fields);
+
+		void wake();
+
+		// Appends the records of changes and patches the header's count.
+		void writeDelta(const std::vector<Change>& changes, uint64_t base, std::vector<uint8_t>& out, size_t reservedPrefix) const;
+
+		const RosterStore& store_;
+		const WakeUp wakeUp_;
+		const size_t historyChanges_;
+		uint64_t version_;
+
+		// The next flush sends a snapshot.
+		bool cleared_;
+		bool woken_;
+		FlatIdMap pendingIndex_;
+		std::vector<Change> pending_;
+
+		// Oldest version a delta can be built from.
+		uint64_t historyBase_;
+		std::deque<Batch> history_;
+		size_t historySize_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_ROSTER_SYNC_H_
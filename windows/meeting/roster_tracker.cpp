@@ -0,0 +1,152 @@
+#include "meeting/roster_tracker.h"
+
+#include "util/zchar_util.h"
+
+namespace flutter_zoom_sdk {
+
+	RosterTracker::RosterTracker(RosterStore& store, UserLookup lookup)
+		: store_(store),
+		lookup_(std::move(lookup)),
+		hostId_(0) {}
+
+	RosterMember RosterTracker::describe(ZOOM_SDK_NAMESPACE::IUserInfo& user) {
+		RosterMember member;
+		member.id = user.GetUserID();
+		member.name = ToUtf8(user.GetUserName());
+
+		uint16_t attributes = 0;
+		const ZOOM_SDK_NAMESPACE::UserRole role = user.GetUserRole();
+		if (user.IsHost() || role == ZOOM_SDK_NAMESPACE::USERROLE_HOST) {
+			attributes |= kRosterHost;
+		}
+		if (role == ZOOM_SDK_NAMESPACE::USERROLE_COHOST) {
+			attributes |= kRosterCoHost;
+		}
+		if (role == ZOOM_SDK_NAMESPACE::USERROLE_PANELIST) {
+			attributes |= kRosterPanelist;
+		}
+		if (role == ZOOM_SDK_NAMESPACE::USERROLE_ATTENDEE) {
+			attributes |= kRosterAttendee;
+		}
+		if (user.IsMySelf()) {
+			attributes |= kRosterMyself;
+		}
+		if (user.IsInWaitingRoom()) {
+			attributes |= kRosterWaitingRoom;
+		}
+		if (user.IsPurePhoneUser()) {
+			attributes |= kRosterPurePhone;
+		}
+		if (user.IsBotUser()) {
+			attributes |= kRosterBot;
+		}
+		if (user.IsH323User()) {
+			attributes |= kRosterH323;
+		}
+#if defined(WIN32)
+		if (user.IsInterpreter()) {
+			attributes |= kRosterInterpreter;
+		}
+#endif
+		member.attributes = attributes;
+
+		member.flags[static_cast<size_t>(RosterFlag::VideoOn)] = user.IsVideoOn();
+		member.flags[static_cast<size_t>(RosterFlag::Muted)] = user.IsAudioMuted();
+		member.flags[static_cast<size_t>(RosterFlag::Talking)] = user.IsTalking();
+		member.flags[static_cast<size_t>(RosterFlag::HandRaised)] = user.IsRaiseHand();
+		return member;
+	}
+
+	bool RosterTracker::refresh(uint32_t userId) {
+		ZOOM_SDK_NAMESPACE::IUserInfo* user = lookup_ ? lookup_(userId) : nullptr;
+		if (!user) {
+			return false;
+		}
+
+		RosterMember member = describe(*user);
+		member.id = userId;
+		store_.upsert(member);
+		if (member.attributes & kRosterHost) {
+			hostId_ = userId;
+		}
+		return true;
+	}
+
+	void RosterTracker::load(ZOOM_SDK_NAMESPACE::IList<unsigned int>* users) {
+		store_.clear();
+		hostId_ = 0;
+		if (!users) {
+			return;
+		}
+
+		const int count = users->GetCount();
+		store_.reserve(static_cast<size_t>(count));
+		for (int i = 0; i < count; i++) {
+			refresh(users->GetItem(i));
+		}
+	}
+
+	void RosterTracker::onUserJoin(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID, const zchar_t* strUserList) {
+		if (!lstUserID) {
+			return;
+		}
+
+		const int count = lstUserID->GetCount();
+		for (int i = 0; i < count; i++) {
+			refresh(lstUserID->GetItem(i));
+		}
+	}
+
+	void RosterTracker::onUserLeft(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID, const zchar_t* strUserList) {
+		if (!lstUserID) {
+			return;
+		}
+
+		const int count = lstUserID->GetCount();
+		for (int i = 0; i < count; i++) {
+			const uint32_t userId = lstUserID->GetItem(i);
+			store_.remove(userId);
+			if (userId == hostId_) {
+				hostId_ = 0;
+			}
+		}
+	}
+
+	void RosterTracker::onHostChangeNotification(unsigned int userId) {
+		if (hostId_ != 0 && hostId_ != userId) {
+			store_.setAttribute(hostId_, kRosterHost, false);
+		}
+		hostId_ = userId;
+		store_.setAttribute(userId, kRosterHost, true);
+		// The new host stops being a co-host.
+		store_.setAttribute(userId, kRosterCoHost, false);
+	}
+
+	void RosterTracker::onLowOrRaiseHandStatusChanged(bool bLow, unsigned int userid) {
+		store_.setFlag(userid, RosterFlag::HandRaised, !bLow);
+	}
+
+	void RosterTracker::onUserNamesChanged(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID) {
+		if (!lstUserID) {
+			return;
+		}
+
+		const int count = lstUserID->GetCount();
+		for (int i = 0; i < count; i++) {
+			const uint32_t userId = lstUserID->GetItem(i);
+			ZOOM_SDK_NAMESPACE::IUserInfo* user = lookup_ ? lookup_(userId) : nullptr;
+			if (user) {
+				store_.setName(userId, ToUtf8(user->GetUserName()));
+			}
+		}
+	}
+
+	void RosterTracker::onCoHostChangeNotification(unsigned int userId, bool isCoHost) {
+		store_.setAttribute(userId, kRosterCoHost, isCoHost);
+	}
+
+	void RosterTracker::onAllHandsLowered() {
+		store_.clearFlag(RosterFlag::HandRaised);
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,74 @@
+#ifndef FLUTTER_PLUGIN_MEETING_ROSTER_TRACKER_H_
+#define FLUTTER_PLUGIN_MEETING_ROSTER_TRACKER_H_
+
+#include <meeting_service_components/meeting_audio_interface.h>
+#include <meeting_service_components/meeting_participants_ctrl_interface.h>
+
+#include <cstdint>
+#include <functional>
+
+#include "meeting/roster_store.h"
+
+namespace flutter_zoom_sdk {
+
+	// Keeps a RosterStore in step with the participants events. The SDK is
+	// asked about a user only when that user joins or changes, never for the
+	// whole list, so a webinar with thousands of attendees stays O(1) per
+	// event instead of O(n).
+	class RosterTracker : public ZOOM_SDK_NAMESPACE::IMeetingParticipantsCtrlEvent {
+	public:
+		// IMeetingParticipantsController::GetUserByUserID, or a stub.
+		using UserLookup = std::function<ZOOM_SDK_NAMESPACE::IUserInfo*(uint32_t userId)>;
+
+		RosterTracker(RosterStore& store, UserLookup lookup);
+
+		RosterTracker(const RosterTracker&) = delete;
+		RosterTracker& operator=(const RosterTracker&) = delete;
+
+		// Replaces the roster with users, from GetParticipantsList, once per
+		// meeting.
+		void load(ZOOM_SDK_NAMESPACE::IList<unsigned int>* users);
+
+		static RosterMember describe(ZOOM_SDK_NAMESPACE::IUserInfo& user);
+
+		void onUserJoin(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID, const zchar_t* strUserList = nullptr) override;
+		void onUserLeft(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID, const zchar_t* strUserList = nullptr) override;
+		void onHostChangeNotification(unsigned int userId) override;
+		void onLowOrRaiseHandStatusChanged(bool bLow, unsigned int userid) override;
+		void onUserNamesChanged(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID) override;
+		void onCoHostChangeNotification(unsigned int userId, bool isCoHost) override;
+		void onAllHandsLowered() override;
+
+		void onInvalidReclaimHostkey() override {}
+		void onLocalRecordingStatusChanged(unsigned int user_id, ZOOM_SDK_NAMESPACE::RecordingStatus status) override {}
+		void onAllowParticipantsRenameNotification(bool bAllow) override {}
+		void onAllowParticipantsUnmuteSelfNotification(bool bAllow) override {}
+		void onAllowParticipantsStartVideoNotification(bool bAllow) override {}
+		void onAllowParticipantsShareWhiteBoardNotification(bool bAllow) override {}
+		void onRequestLocalRecordingPrivilegeChanged(ZOOM_SDK_NAMESPACE::LocalRecordingRequestPrivilegeStatus status) override {}
+		void onAllowParticipantsRequestCloudRecording(bool bAllow) override {}
+		void onInMeetingUserAvatarPathUpdated(unsigned int userID) override {}
+		void onParticipantProfilePictureStatusChange(bool bHidden) override {}
+		void onFocusModeStateChanged(bool bEnabled) override {}
+		void onFocusModeShareTypeChanged(ZOOM_SDK_NAMESPACE::FocusModeShareType type) override {}
+		void onBotAuthorizerRelationChanged(unsigned int authorizeUserID) override {}
+		void onVirtualNameTagStatusChanged(bool bOn, unsigned int userID) override {}
+		void onVirtualNameTagRosterInfoUpdated(unsigned int userID) override {}
+#if defined(WIN32)
+		void onCreateCompanionRelation(unsigned int parentUserID, unsigned int childUserID) override {}
+		void onRemoveCompanionRelation(unsigned int childUserID) override {}
+#endif
+		void onGrantCoOwnerPrivilegeChanged(bool canGrantOther) override {}
+
+	private:
+		// Reads userId from the SDK into the store.
+		bool refresh(uint32_t userId);
+
+		RosterStore& store_;
+		UserLookup lookup_;
+		uint32_t hostId_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_ROSTER_TRACKER_H_
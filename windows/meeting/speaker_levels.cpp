@@ -0,0 +1,49 @@
+#include "meeting/speaker_levels.h"
+
+#include <cmath>
+#include <limits>
+
+namespace flutter_zoom_sdk {
+
+	float SpeakerLevels::level(const int16_t* samples, size_t count) {
+		if (count == 0) {
+			return -std::numeric_limits<float>::infinity();
+		}
+
+		int64_t sum = 0;
+		for (size_t i = 0; i < count; i++) {
+			sum += static_cast<int32_t>(samples[i]) * samples[i];
+		}
+		if (sum == 0) {
+			return -std::numeric_limits<float>::infinity();
+		}
+		const double meanSquare = static_cast<double>(sum) / count / (32768.0 * 32768.0);
+		return static_cast<float>(10.0 * std::log10(meanSquare));
+	}
+
+	void SpeakerLevels::onAudioFrame(const AudioStreamKey& key, const AudioFrame& frame) {
+		if (key.kind != AudioStreamKind::OneWay || key.id == 0 || !frame.samples) {
+			return;
+		}
+
+		const float value = level(frame.samples, frame.sampleCount);
+		std::lock_guard<std::mutex> lock(mutex_);
+		// Only the few users talking since the last drain are here.
+		for (Level& pending : pending_) {
+			if (pending.first == key.id) {
+				if (value > pending.second) {
+					pending.second = value;
+				}
+				return;
+			}
+		}
+		pending_.emplace_back(key.id, value);
+	}
+
+	void SpeakerLevels::drain(std::vector<Level>& levels) {
+		levels.clear();
+		std::lock_guard<std::mutex> lock(mutex_);
+		levels.swap(pending_);
+	}
+
+}  // namespace flutter_zoom_sdk
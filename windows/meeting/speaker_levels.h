@@ -0,0 +1,36 @@
+#ifndef FLUTTER_PLUGIN_MEETING_SPEAKER_LEVELS_H_
+#define FLUTTER_PLUGIN_MEETING_SPEAKER_LEVELS_H_
+
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "media/audio_stream.h"
+
+namespace flutter_zoom_sdk {
+
+	// Measures one-way audio for SpeakerTracker: the RMS level of every frame,
+	// in dBFS, keeping the loudest per user until the platform thread drains
+	// them. onAudioFrame runs on SDK audio threads and only holds the lock to
+	// update one entry.
+	class SpeakerLevels : public IAudioStreamConsumer {
+	public:
+		using Level = std::pair<uint32_t, float>;
+
+		void onAudioFrame(const AudioStreamKey& key, const AudioFrame& frame) override;
+
+		// Moves the loudest level of each user since the last drain into levels.
+		void drain(std::vector<Level>& levels);
+
+		// RMS of samples in dBFS; -infinity for silence.
+		static float level(const int16_t* samples, size_t count);
+
+	private:
+		std::mutex mutex_;
+		std::vector<Level> pending_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_SPEAKER_LEVELS_H_
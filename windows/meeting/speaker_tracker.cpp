@@ -0,0 +1,272 @@
+#include "meeting/speaker_tracker.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		// The SDK's own speaker pick counts most; being on the active video
+		// or in the active audio list backs it up.
+		constexpr float kSpeakerWeight = 1.0f;
+		constexpr float kVideoWeight = 0.5f;
+		constexpr float kAudioWeight = 0.5f;
+
+		// Levels map linearly from silence at kLevelFloor to full weight at
+		// kLevelCeiling.
+		constexpr float kLevelWeight = 1.0f;
+		constexpr float kLevelFloor = -50.0f;
+		constexpr float kLevelCeiling = -20.0f;
+
+		// Evidence decayed below this is forgotten.
+		constexpr float kForgetScore = 0.01f;
+	}
+
+	SpeakerTracker::SpeakerTracker(SpeakerTrackerConfig config)
+		: config_(config),
+		speaker_(0),
+		video_(0),
+		current_(0),
+		currentSince_(0),
+		challenger_(0),
+		challengerSince_(0),
+		changed_(false),
+		signalChanges_(0),
+		switches_(0) {}
+
+	void SpeakerTracker::configure(const SpeakerTrackerConfig& config) {
+		config_ = config;
+		if (recent_.size() > config_.recentCount) {
+			recent_.resize(config_.recentCount);
+			changed_ = true;
+		}
+	}
+
+	SpeakerTracker::Evidence& SpeakerTracker::evidence(uint32_t id) {
+		uint32_t slot = ids_.find(id);
+		if (slot == FlatIdMap::kMissing) {
+			slot = static_cast<uint32_t>(evidence_.size());
+			evidence_.emplace_back();
+			evidence_.back().id = id;
+			ids_.set(id, slot);
+		}
+		return evidence_[slot];
+	}
+
+	void SpeakerTracker::start(uint32_t id, Signal signal, float weight, uint64_t now) {
+		Evidence& entry = evidence(id);
+		entry.live |= 1 << signal;
+		entry.weight[signal] = weight;
+		entry.since[signal] = now;
+	}
+
+	void SpeakerTracker::end(uint32_t id, Signal signal, uint64_t now) {
+		const uint32_t slot = ids_.find(id);
+		if (slot == FlatIdMap::kMissing || !(evidence_[slot].live & (1 << signal))) {
+			return;
+		}
+		evidence_[slot].live &= ~(1 << signal);
+		evidence_[slot].since[signal] = now;
+	}
+
+	void SpeakerTracker::activeSpeaker(uint32_t id, uint64_t now) {
+		if (id == speaker_) {
+			return;
+		}
+		end(speaker_, kSpeaker, now);
+		speaker_ = id;
+		if (id != 0) {
+			start(id, kSpeaker, kSpeakerWeight, now);
+			signalChanges_++;
+		}
+	}
+
+	void SpeakerTracker::activeVideo(uint32_t id, uint64_t now) {
+		if (id == video_) {
+			return;
+		}
+		end(video_, kVideo, now);
+		video_ = id;
+		if (id != 0) {
+			start(id, kVideo, kVideoWeight, now);
+		}
+	}
+
+	void SpeakerTracker::activeAudio(const uint32_t* ids, size_t count, uint64_t now) {
+		for (uint32_t id : audio_) {
+			if (std::find(ids, ids + count, id) == ids + count) {
+				end(id, kAudio, now);
+			}
+		}
+		for (size_t i = 0; i < count; i++) {
+			if (ids[i] != 0 && std::find(audio_.begin(), audio_.end(), ids[i]) == audio_.end()) {
+				start(ids[i], kAudio, kAudioWeight, now);
+			}
+		}
+		audio_.assign(ids, ids + count);
+	}
+
+	void SpeakerTracker::audioLevel(uint32_t id, float dbfs, uint64_t now) {
+		const float level = std::min(1.0f, (dbfs - kLevelFloor) / (kLevelCeiling - kLevelFloor));
+		if (id == 0 || !(level > 0.0f)) {
+			return;
+		}
+
+		// A louder reading replaces what is left of the last one.
+		Evidence& entry = evidence(id);
+		const float weight = level * kLevelWeight;
+		if (weight >= entry.weight[kLevel] * decay(entry.since[kLevel], now)) {
+			entry.weight[kLevel] = weight;
+			entry.since[kLevel] = now;
+		}
+	}
+
+	void SpeakerTracker::remove(uint32_t id) {
+		const uint32_t slot = ids_.find(id);
+		if (slot != FlatIdMap::kMissing) {
+			ids_.erase(id);
+			if (slot + 1 != evidence_.size()) {
+				evidence_[slot] = evidence_.back();
+				ids_.set(evidence_[slot].id, slot);
+			}
+			evidence_.pop_back();
+		}
+
+		if (speaker_ == id) {
+			speaker_ = 0;
+		}
+		if (video_ == id) {
+			video_ = 0;
+		}
+		audio_.erase(std::remove(audio_.begin(), audio_.end(), id), audio_.end());
+		if (challenger_ == id) {
+			challenger_ = 0;
+		}
+
+		auto it = std::find(recent_.begin(), recent_.end(), id);
+		if (it != recent_.end()) {
+			recent_.erase(it);
+			changed_ = true;
+		}
+		if (current_ == id) {
+			current_ = 0;
+			changed_ = true;
+		}
+	}
+
+	void SpeakerTracker::reset() {
+		evidence_.clear();
+		ids_.clear();
+		speaker_ = 0;
+		video_ = 0;
+		audio_.clear();
+		current_ = 0;
+		currentSince_ = 0;
+		challenger_ = 0;
+		challengerSince_ = 0;
+		recent_.clear();
+		changed_ = false;
+	}
+
+	float SpeakerTracker::decay(uint64_t since, uint64_t now) const {
+		if (now < since) {
+			return 1.0f;
+		}
+		if (config_.halfLifeMs == 0) {
+			return now == since ? 1.0f : 0.0f;
+		}
+		return std::exp2(-static_cast<float>(now - since) / static_cast<float>(config_.halfLifeMs));
+	}
+
+	float SpeakerTracker::score(const Evidence& entry, uint64_t now) const {
+		float total = 0.0f;
+		for (int signal = 0; signal < kSignalCount; signal++) {
+			if (entry.weight[signal] <= 0.0f) {
+				continue;
+			}
+			if (entry.live & (1 << signal)) {
+				total += entry.weight[signal];
+			}
+			else {
+				total += entry.weight[signal] * decay(entry.since[signal], now);
+			}
+		}
+		return total;
+	}
+
+	float SpeakerTracker::score(uint32_t id, uint64_t now) const {
+		const uint32_t slot = ids_.find(id);
+		return slot == FlatIdMap::kMissing ? 0.0f : score(evidence_[slot], now);
+	}
+
+	void SpeakerTracker::switchTo(uint32_t id, uint64_t now) {
+		recent_.erase(std::remove(recent_.begin(), recent_.end(), id), recent_.end());
+		if (current_ != 0) {
+			recent_.insert(recent_.begin(), current_);
+		}
+		if (recent_.size() > config_.recentCount) {
+			recent_.resize(config_.recentCount);
+		}
+		current_ = id;
+		currentSince_ = now;
+		challenger_ = 0;
+		switches_++;
+	}
+
+	bool SpeakerTracker::update(uint64_t now) {
+		const bool changed = changed_;
+		changed_ = false;
+
+		// Forget spent evidence while looking for the leader; ties go to the
+		// current speaker.
+		uint32_t leader = 0;
+		float best = 0.0f;
+		float currentScore = 0.0f;
+		for (size_t i = 0; i < evidence_.size();) {
+			const Evidence& entry = evidence_[i];
+			const float value = score(entry, now);
+			if (entry.live == 0 && value < kForgetScore) {
+				ids_.erase(entry.id);
+				if (i + 1 != evidence_.size()) {
+					evidence_[i] = evidence_.back();
+					ids_.set(evidence_[i].id, static_cast<uint32_t>(i));
+				}
+				evidence_.pop_back();
+				continue;
+			}
+
+			if (entry.id == current_) {
+				currentScore = value;
+			}
+			if (value >= config_.minScore && (value > best || (value == best && entry.id == current_))) {
+				leader = entry.id;
+				best = value;
+			}
+			i++;
+		}
+
+		if (leader == 0 || leader == current_) {
+			challenger_ = 0;
+			return changed;
+		}
+		if (current_ == 0) {
+			switchTo(leader, now);
+			return true;
+		}
+		if (best < currentScore + config_.hysteresis) {
+			challenger_ = 0;
+			return changed;
+		}
+
+		if (challenger_ != leader) {
+			challenger_ = leader;
+			challengerSince_ = now;
+		}
+		if (now - challengerSince_ >= config_.debounceMs && now - currentSince_ >= config_.holdMs) {
+			switchTo(leader, now);
+			return true;
+		}
+		return changed;
+	}
+
+}  // namespace flutter_zoom_sdk
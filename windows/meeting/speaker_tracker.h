@@ -0,0 +1,146 @@
+#ifndef FLUTTER_PLUGIN_MEETING_SPEAKER_TRACKER_H_
+#define FLUTTER_PLUGIN_MEETING_SPEAKER_TRACKER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "meeting/flat_id_map.h"
+
+namespace flutter_zoom_sdk {
+
+	struct SpeakerTrackerConfig {
+		// The current speaker keeps the floor at least this long.
+		uint32_t holdMs = 2000;
+
+		// A challenger must lead by the hysteresis margin this long to take
+		// the floor.
+		uint32_t debounceMs = 500;
+
+		// How far a challenger's score must be above the current speaker's.
+		float hysteresis = 0.5f;
+
+		// Evidence halves every halfLifeMs once its signal ends.
+		uint32_t halfLifeMs = 1500;
+
+		// Below this score a user is not speaking.
+		float minScore = 0.25f;
+
+		// Length of recent(), not counting the current speaker.
+		size_t recentCount = 8;
+	};
+
+	// Fuses the SDK's active speaker, active video and active audio signals,
+	// plus optional audio levels, into one stable current speaker. Every
+	// signal gives its users evidence that decays once the signal moves on;
+	// a user's score is the sum. The current speaker changes only when a
+	// challenger has out-scored them by the hysteresis margin for the debounce
+	// time and they have held the floor for the hold time, so crosstalk does
+	// not flip the speaker back and forth. Silence keeps the last speaker.
+	// Times are in milliseconds on any monotonic clock. Not thread-safe.
+	class SpeakerTracker {
+	public:
+		explicit SpeakerTracker(SpeakerTrackerConfig config = SpeakerTrackerConfig());
+
+		SpeakerTracker(const SpeakerTracker&) = delete;
+		SpeakerTracker& operator=(const SpeakerTracker&) = delete;
+
+		void configure(const SpeakerTrackerConfig& config);
+
+		const SpeakerTrackerConfig& config() const { return config_; }
+
+		// onActiveSpeakerVideoUserChanged; 0 ends the signal.
+		void activeSpeaker(uint32_t id, uint64_t now);
+
+		// onActiveVideoUserChanged; 0 ends the signal.
+		void activeVideo(uint32_t id, uint64_t now);
+
+		// onUserActiveAudioChange: the users now in the list.
+		void activeAudio(const uint32_t* ids, size_t count, uint64_t now);
+
+		// The loudness of one user's audio, in dBFS.
+		void audioLevel(uint32_t id, float dbfs, uint64_t now);
+
+		// The user left; they lose the floor on the next update.
+		void remove(uint32_t id);
+
+		void reset();
+
+		// Re-decides the current speaker. Returns true when current() or
+		// recent() changed.
+		bool update(uint64_t now);
+
+		// 0 before anyone has spoken.
+		uint32_t current() const { return current_; }
+
+		// Earlier speakers, the one who held the floor last first.
+		const std::vector<uint32_t>& recent() const { return recent_; }
+
+		float score(uint32_t id, uint64_t now) const;
+
+		// Whether any evidence is left to decay, so update() may still change
+		// something without new signals.
+		bool active() const { return !evidence_.empty(); }
+
+		// Times the raw active speaker signal named someone new, and times
+		// the current speaker changed; their ratio is the churn saved.
+		uint64_t signalChanges() const { return signalChanges_; }
+
+		uint64_t switches() const { return switches_; }
+
+	private:
+		enum Signal {
+			kSpeaker = 0,
+			kVideo = 1,
+			kAudio = 2,
+			kLevel = 3,
+			kSignalCount = 4,
+		};
+
+		struct Evidence {
+			uint32_t id = 0;
+			// Bit per Signal that is still on; those do not decay.
+			uint8_t live = 0;
+			float weight[kSignalCount] = {};
+			// When each signal ended, or last refreshed for levels.
+			uint64_t since[kSignalCount] = {};
+		};
+
+		Evidence& evidence(uint32_t id);
+
+		void start(uint32_t id, Signal signal, float weight, uint64_t now);
+
+		void end(uint32_t id, Signal signal, uint64_t now);
+
+		// How much of an ended signal is left at now.
+		float decay(uint64_t since, uint64_t now) const;
+
+		float score(const Evidence& evidence, uint64_t now) const;
+
+		void switchTo(uint32_t id, uint64_t now);
+
+		SpeakerTrackerConfig config_;
+
+		// Users with evidence left, in slots found through ids_.
+		std::vector<Evidence> evidence_;
+		FlatIdMap ids_;
+
+		uint32_t speaker_;
+		uint32_t video_;
+		std::vector<uint32_t> audio_;
+
+		uint32_t current_;
+		uint64_t currentSince_;
+		uint32_t challenger_;
+		uint64_t challengerSince_;
+		std::vector<uint32_t> recent_;
+		// Set when remove() changed current_ or recent_ between updates.
+		bool changed_;
+
+		uint64_t signalChanges_;
+		uint64_t switches_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_SPEAKER_TRACKER_H_
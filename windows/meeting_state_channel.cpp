@@ -0,0 +1,216 @@
+#include "meeting_state_channel.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	namespace {
+		constexpr char kChannelName[] = "flutter_zoom_sdk/meeting_state";
+
+		// Deltas say which version they start from, so Dart recovers from a
+		// dropped one by asking for the fields changed since its version.
+		constexpr size_t kMaxPendingUpdates = 8;
+		constexpr size_t kUpdateBufferSize = 1024;
+		constexpr size_t kIdleUpdateBuffers = 2;
+
+		// Changes closer together than this go out as one delta.
+		constexpr auto kUpdateWindow = std::chrono::milliseconds(100);
+
+		// The lock and connection qualities have no events.
+		constexpr auto kPollInterval = std::chrono::seconds(2);
+	}
+
+	MeetingStateChannel::MeetingStateChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher,
+		ShareEventFanout& shareEvents, RecordingEventFanout& recordingEvents, ChatEventFanout& chatEvents,
+		CaptionEventFanout& captionEvents, RosterStore& roster, RosterWanted rosterWanted,
+		MeetingServiceGetter meetingService)
+		: dispatcher_(dispatcher),
+		shareEvents_(shareEvents),
+		recordingEvents_(recordingEvents),
+		chatEvents_(chatEvents),
+		captionEvents_(captionEvents),
+		roster_(roster),
+		rosterWanted_(std::move(rosterWanted)),
+		meetingService_(std::move(meetingService)),
+		events_(messenger, dispatcher, kChannelName, kMaxPendingUpdates,
+			[this](bool listening) {
+				listening_ = listening;
+				update();
+			}),
+		pool_(BufferPool::create(kUpdateBufferSize, kIdleUpdateBuffers)),
+		state_([this]() {
+			if (flushTimer_ != 0) {
+				return;
+			}
+			flushTimer_ = dispatcher_.postDelayed(kUpdateWindow, [this]() {
+				flushTimer_ = 0;
+				flush();
+			});
+			if (flushTimer_ == 0) {
+				dispatcher_.post([this]() { flush(); });
+			}
+		}),
+		tracker_(state_, roster),
+		flushTimer_(0),
+		pollTimer_(0),
+		reported_(0),
+		inMeeting_(false),
+		listening_(false),
+		queried_(false),
+		active_(false) {
+		roster_.addObserver(&tracker_);
+	}
+
+	MeetingStateChannel::~MeetingStateChannel() {
+		roster_.removeObserver(&tracker_);
+		captionEvents_.remove(&tracker_);
+		chatEvents_.remove(&tracker_);
+		recordingEvents_.remove(&tracker_);
+		shareEvents_.remove(&tracker_);
+		if (flushTimer_ != 0) {
+			dispatcher_.cancelDelayed(flushTimer_);
+		}
+		if (pollTimer_ != 0) {
+			dispatcher_.cancelDelayed(pollTimer_);
+		}
+	}
+
+	void MeetingStateChannel::onMeetingStatus(ZOOM_SDK_NAMESPACE::MeetingStatus status) {
+		tracker_.onMeetingStatus(status);
+		switch (status) {
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_INMEETING:
+			inMeeting_ = true;
+			break;
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_DISCONNECTING:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_RECONNECTING:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_FAILED:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_ENDED:
+		case ZOOM_SDK_NAMESPACE::MEETING_STATUS_IDLE:
+			inMeeting_ = false;
+			queried_ = false;
+			break;
+		default:
+			// Locking, webinar roles and the like happen within the meeting.
+			break;
+		}
+		update();
+	}
+
+	void MeetingStateChannel::onStatisticsWarning(ZOOM_SDK_NAMESPACE::StatisticsWarningType type) {
+		tracker_.onStatisticsWarning(type);
+		if (active_) {
+			tracker_.load(meetingService_(), false);
+		}
+	}
+
+	void MeetingStateChannel::update() {
+		const bool active = inMeeting_ && (listening_ || queried_);
+		if (active == active_) {
+			return;
+		}
+		active_ = active;
+
+		if (active) {
+			shareEvents_.add(&tracker_);
+			recordingEvents_.add(&tracker_);
+			chatEvents_.add(&tracker_);
+			captionEvents_.add(&tracker_);
+			if (rosterWanted_) {
+				rosterWanted_(true);
+			}
+			// Events missed while inactive are read back in one go; the local
+			// recording status, which cannot be read, becomes unknown.
+			tracker_.load(meetingService_(), true);
+			if (pollTimer_ == 0) {
+				pollTimer_ = dispatcher_.postDelayed(kPollInterval, [this]() {
+					pollTimer_ = 0;
+					poll();
+				});
+			}
+			return;
+		}
+
+		captionEvents_.remove(&tracker_);
+		chatEvents_.remove(&tracker_);
+		recordingEvents_.remove(&tracker_);
+		shareEvents_.remove(&tracker_);
+		if (rosterWanted_) {
+			rosterWanted_(false);
+		}
+		if (pollTimer_ != 0) {
+			dispatcher_.cancelDelayed(pollTimer_);
+			pollTimer_ = 0;
+		}
+	}
+
+	void MeetingStateChannel::poll() {
+		if (!active_) {
+			return;
+		}
+
+		tracker_.load(meetingService_(), false);
+		pollTimer_ = dispatcher_.postDelayed(kPollInterval, [this]() {
+			pollTimer_ = 0;
+			poll();
+		});
+	}
+
+	void MeetingStateChannel::flush() {
+		if (flushTimer_ != 0) {
+			dispatcher_.cancelDelayed(flushTimer_);
+			flushTimer_ = 0;
+		}
+		if (state_.version() == reported_) {
+			return;
+		}
+
+		PooledBuffer update = pool_->acquire();
+		state_.since(reported_, *update, BinaryEventChannel::kEnvelopePrefix);
+		reported_ = state_.version();
+		events_.send(std::move(update));
+	}
+
+	bool MeetingStateChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		// Asking starts following everything for the rest of the meeting.
+		if (method.compare(0, 14, "meeting_state_") == 0 && inMeeting_ && !queried_) {
+			queried_ = true;
+			update();
+		}
+
+		if (method.compare("meeting_state_get") == 0) {
+			// Pending changes go out first so the stream continues from here.
+			flush();
+			std::vector<uint8_t> update;
+			state_.since(0, update);
+			result->Success(EncodableValue(update));
+			return true;
+		}
+		else if (method.compare("meeting_state_since") == 0) {
+			int64_t version = 0;
+			if (!arguments || !IntArgument(*arguments, "version", version) || version < 0) {
+				result->Error("INVALID_ARGUMENTS", "Expected a version");
+				return true;
+			}
+
+			flush();
+			std::vector<uint8_t> update;
+			state_.since(static_cast<uint64_t>(version), update);
+			result->Success(EncodableValue(update));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
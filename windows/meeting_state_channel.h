@@ -0,0 +1,95 @@
+#ifndef FLUTTER_PLUGIN_MEETING_STATE_CHANNEL_H_
+#define FLUTTER_PLUGIN_MEETING_STATE_CHANNEL_H_
+
+#include <flutter/binary_messenger.h>
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <meeting_service_interface.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "binary_event_channel.h"
+#include "media/buffer_pool.h"
+#include "meeting/meeting_event_fanout.h"
+#include "meeting/meeting_state.h"
+#include "meeting/meeting_state_tracker.h"
+#include "meeting/roster_store.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Dart side of MeetingState. Changes within a short window go out on the
+	// "flutter_zoom_sdk/meeting_state" event channel as one Uint8List delta
+	// of the fields that changed. Dart reads the whole state in one call with
+	// meeting_state_get, or catches up with meeting_state_since. Only the
+	// status is followed until Dart listens or asks; from then on, for the
+	// rest of the meeting, everything is.
+	class MeetingStateChannel {
+	public:
+		using MeetingServiceGetter = std::function<ZOOM_SDK_NAMESPACE::IMeetingService*()>;
+
+		// Called with true while the channel needs the roster followed.
+		using RosterWanted = std::function<void(bool wanted)>;
+
+		// Listens on the fanouts, which the caller sets on the controllers,
+		// and takes the host and co-hosts from roster.
+		MeetingStateChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher,
+			ShareEventFanout& shareEvents, RecordingEventFanout& recordingEvents, ChatEventFanout& chatEvents,
+			CaptionEventFanout& captionEvents, RosterStore& roster, RosterWanted rosterWanted,
+			MeetingServiceGetter meetingService);
+
+		~MeetingStateChannel();
+
+		MeetingStateChannel(const MeetingStateChannel&) = delete;
+		MeetingStateChannel& operator=(const MeetingStateChannel&) = delete;
+
+		// From IMeetingServiceEvent.
+		void onMeetingStatus(ZOOM_SDK_NAMESPACE::MeetingStatus status);
+
+		void onStatisticsWarning(ZOOM_SDK_NAMESPACE::StatisticsWarningType type);
+
+		// Handles the meeting_state_* methods. Returns false, leaving result
+		// untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+	private:
+		// Starts or stops following the controllers as the demand changes.
+		void update();
+
+		void flush();
+
+		// Re-reads the fields without events while in the meeting.
+		void poll();
+
+		PlatformDispatcher& dispatcher_;
+		ShareEventFanout& shareEvents_;
+		RecordingEventFanout& recordingEvents_;
+		ChatEventFanout& chatEvents_;
+		CaptionEventFanout& captionEvents_;
+		RosterStore& roster_;
+		const RosterWanted rosterWanted_;
+		MeetingServiceGetter meetingService_;
+		BinaryEventChannel events_;
+		std::shared_ptr<BufferPool> pool_;
+
+		MeetingState state_;
+		MeetingStateTracker tracker_;
+		UINT_PTR flushTimer_;
+		UINT_PTR pollTimer_;
+		// The version of the last update sent.
+		uint64_t reported_;
+		bool inMeeting_;
+		bool listening_;
+		// Set by a meeting_state_* call in the meeting, until it ends.
+		bool queried_;
+		bool active_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_MEETING_STATE_CHANNEL_H_
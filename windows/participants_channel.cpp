@@ -0,0 +1,361 @@
+#include "participants_channel.h"
+
+#include <conio.h>
+#include <tchar.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableList;
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	namespace {
+		constexpr char kChannelName[] = "flutter_zoom_sdk/roster";
+		constexpr char kAvStatusChannelName[] = "flutter_zoom_sdk/av_status";
+
+		// Deltas are versioned, so Dart recovers from a dropped one by asking
+		// for the changes since its version.
+		constexpr size_t kMaxPendingUpdates = 16;
+		constexpr size_t kUpdateBufferSize = 4096;
+		constexpr size_t kIdleUpdateBuffers = 4;
+
+		constexpr size_t kMaxPageSize = 1000;
+
+		// Query filters, by argument name.
+		constexpr struct {
+			const char* name;
+			uint16_t filter;
+		} kQueryFilters[] = {
+			{ "handRaised", kRosterFilterHandRaised },
+			{ "inWaitingRoom", kRosterFilterWaitingRoom },
+			{ "hostOrCoHost", kRosterFilterHostOrCoHost },
+			{ "purePhone", kRosterFilterPurePhone },
+			{ "bot", kRosterFilterBot },
+		};
+
+		// Changes closer together than this go out as one delta.
+		constexpr auto kSyncWindow = std::chrono::milliseconds(100);
+
+		EncodableMap memberToMap(const RosterMember& member) {
+			EncodableMap map;
+			map[EncodableValue("userId")] = EncodableValue(static_cast<int64_t>(member.id));
+			map[EncodableValue("name")] = EncodableValue(member.name);
+			map[EncodableValue("host")] = EncodableValue((member.attributes & kRosterHost) != 0);
+			map[EncodableValue("coHost")] = EncodableValue((member.attributes & kRosterCoHost) != 0);
+			map[EncodableValue("myself")] = EncodableValue((member.attributes & kRosterMyself) != 0);
+			map[EncodableValue("inWaitingRoom")] = EncodableValue((member.attributes & kRosterWaitingRoom) != 0);
+			map[EncodableValue("purePhone")] = EncodableValue((member.attributes & kRosterPurePhone) != 0);
+			map[EncodableValue("bot")] = EncodableValue((member.attributes & kRosterBot) != 0);
+			map[EncodableValue("h323")] = EncodableValue((member.attributes & kRosterH323) != 0);
+			map[EncodableValue("interpreter")] = EncodableValue((member.attributes & kRosterInterpreter) != 0);
+			map[EncodableValue("panelist")] = EncodableValue((member.attributes & kRosterPanelist) != 0);
+			map[EncodableValue("attendee")] = EncodableValue((member.attributes & kRosterAttendee) != 0);
+			map[EncodableValue("videoOn")] = EncodableValue(member.flag(RosterFlag::VideoOn));
+			map[EncodableValue("muted")] = EncodableValue(member.flag(RosterFlag::Muted));
+			map[EncodableValue("talking")] = EncodableValue(member.flag(RosterFlag::Talking));
+			map[EncodableValue("handRaised")] = EncodableValue(member.flag(RosterFlag::HandRaised));
+			return map;
+		}
+	}
+
+	ParticipantsChannel::ParticipantsChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher,
+		AudioEventFanout& audioEvents, VideoEventFanout& videoEvents, MeetingServiceGetter meetingService)
+		: dispatcher_(dispatcher),
+		audioEvents_(audioEvents),
+		videoEvents_(videoEvents),
+		meetingService_(std::move(meetingService)),
+		events_(messenger, dispatcher, kChannelName, kMaxPendingUpdates,
+			[this](bool listening) { setDemand(kDemandRoster, listening); }),
+		avEvents_(messenger, dispatcher, kAvStatusChannelName, kMaxPendingUpdates,
+			[this](bool listening) { setDemand(kDemandAvStatus, listening); }),
+		pool_(BufferPool::create(kUpdateBufferSize, kIdleUpdateBuffers)),
+		index_(store_),
+		sync_(store_, [this]() {
+			flushTimer_ = dispatcher_.postDelayed(kSyncWindow, [this]() {
+				flushTimer_ = 0;
+				flushSync();
+			});
+			if (flushTimer_ == 0) {
+				dispatcher_.post([this]() { flushSync(); });
+			}
+		}),
+		tracker_(store_, [this](uint32_t userId) -> ZOOM_SDK_NAMESPACE::IUserInfo* {
+			ZOOM_SDK_NAMESPACE::IMeetingParticipantsController* controller = participantsController();
+			return controller ? controller->GetUserByUserID(userId) : nullptr;
+		}),
+		recorder_(nullptr),
+		avStatus_(avBits_, store_, [this]() {
+			if (avFlushTimer_ != 0) {
+				return;
+			}
+			avFlushTimer_ = dispatcher_.postDelayed(kSyncWindow, [this]() {
+				avFlushTimer_ = 0;
+				flushAvStatus();
+			});
+			if (avFlushTimer_ == 0) {
+				dispatcher_.post([this]() { flushAvStatus(); });
+			}
+		}),
+		flushTimer_(0),
+		avFlushTimer_(0),
+		inMeeting_(false),
+		demand_(0),
+		retained_(0),
+		attached_(false) {
+		store_.addObserver(&index_);
+		store_.addObserver(&sync_);
+		store_.addObserver(&avStatus_);
+		participantsEvents_.add(&tracker_);
+	}
+
+	ParticipantsChannel::~ParticipantsChannel() {
+		detach();
+		store_.removeObserver(&avStatus_);
+		store_.removeObserver(&sync_);
+		store_.removeObserver(&index_);
+		if (flushTimer_ != 0) {
+			dispatcher_.cancelDelayed(flushTimer_);
+		}
+		if (avFlushTimer_ != 0) {
+			dispatcher_.cancelDelayed(avFlushTimer_);
+		}
+	}
+
+	void ParticipantsChannel::flushSync() {
+		if (flushTimer_ != 0) {
+			dispatcher_.cancelDelayed(flushTimer_);
+			flushTimer_ = 0;
+		}
+
+		PooledBuffer update = pool_->acquire();
+		if (sync_.flush(*update, BinaryEventChannel::kEnvelopePrefix)) {
+			events_.send(std::move(update));
+		}
+	}
+
+	void ParticipantsChannel::flushAvStatus() {
+		if (avFlushTimer_ != 0) {
+			dispatcher_.cancelDelayed(avFlushTimer_);
+			avFlushTimer_ = 0;
+		}
+
+		PooledBuffer update = pool_->acquire();
+		if (avBits_.flush(*update, BinaryEventChannel::kEnvelopePrefix)) {
+			avEvents_.send(std::move(update));
+		}
+	}
+
+	ZOOM_SDK_NAMESPACE::IMeetingParticipantsController* ParticipantsChannel::participantsController() {
+		ZOOM_SDK_NAMESPACE::IMeetingService* meetingService = meetingService_();
+		return meetingService ? meetingService->GetMeetingParticipantsController() : nullptr;
+	}
+
+	void ParticipantsChannel::setInMeeting(bool inMeeting) {
+		inMeeting_ = inMeeting;
+		if (!inMeeting) {
+			demand_ &= ~kDemandQueried;
+		}
+		update();
+	}
+
+	void ParticipantsChannel::setRecorder(CallbackRecorder* recorder) {
+		recorder_ = recorder;
+		participantsEvents_.setTap(recorder);
+		if (recorder && attached_) {
+			// The journal starts from who is here now.
+			ZOOM_SDK_NAMESPACE::IMeetingParticipantsController* controller = participantsController();
+			if (controller) {
+				recorder->onRosterLoaded(controller->GetParticipantsList());
+			}
+		}
+	}
+
+	void ParticipantsChannel::retain() {
+		retained_++;
+		update();
+	}
+
+	void ParticipantsChannel::release() {
+		if (retained_ > 0) {
+			retained_--;
+		}
+		update();
+	}
+
+	void ParticipantsChannel::setDemand(uint8_t demand, bool on) {
+		demand_ = on ? (demand_ | demand) : (demand_ & ~demand);
+		update();
+	}
+
+	void ParticipantsChannel::update() {
+		if (inMeeting_ && (demand_ != 0 || retained_ > 0)) {
+			attach();
+		}
+		else {
+			detach();
+		}
+	}
+
+	bool ParticipantsChannel::attach() {
+		if (attached_) {
+			return true;
+		}
+
+		ZOOM_SDK_NAMESPACE::IMeetingParticipantsController* controller = participantsController();
+		if (!controller) {
+			return false;
+		}
+
+		// Events first, so nobody joining during the load is missed; a join
+		// seen twice just refreshes the user.
+		if (controller->SetEvent(&participantsEvents_) != ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+			_cputts(L"Participants: SetEvent failed\n");
+			return false;
+		}
+		audioEvents_.add(&avStatus_);
+		videoEvents_.add(&avStatus_);
+		ZOOM_SDK_NAMESPACE::IList<unsigned int>* users = controller->GetParticipantsList();
+		if (recorder_) {
+			recorder_->onRosterLoaded(users);
+		}
+		tracker_.load(users);
+		attached_ = true;
+		return true;
+	}
+
+	void ParticipantsChannel::detach() {
+		if (!attached_) {
+			return;
+		}
+
+		ZOOM_SDK_NAMESPACE::IMeetingParticipantsController* controller = participantsController();
+		if (controller) {
+			controller->SetEvent(nullptr);
+		}
+		audioEvents_.remove(&avStatus_);
+		videoEvents_.remove(&avStatus_);
+		store_.clear();
+		attached_ = false;
+	}
+
+	bool ParticipantsChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		// Asking about the participants starts following them for the rest
+		// of the meeting.
+		if (method.compare(0, 13, "participants_") == 0 && inMeeting_ && !attached_) {
+			setDemand(kDemandQueried, true);
+		}
+
+		if (method.compare("participants_count") == 0) {
+			result->Success(EncodableValue(static_cast<int64_t>(store_.size())));
+			return true;
+		}
+		else if (method.compare("participants_get") == 0) {
+			int64_t userId = 0;
+			if (!arguments || !IntArgument(*arguments, "userId", userId)) {
+				result->Error("INVALID_ARGUMENTS", "Expected a userId");
+				return true;
+			}
+
+			RosterMember member;
+			if (userId <= 0 || userId > UINT32_MAX || !store_.member(static_cast<uint32_t>(userId), member)) {
+				result->Success();
+				return true;
+			}
+			result->Success(EncodableValue(memberToMap(member)));
+			return true;
+		}
+		else if (method.compare("participants_ids") == 0) {
+			EncodableList ids;
+			ids.reserve(store_.size());
+			for (uint32_t index = 0; index < store_.size(); index++) {
+				ids.push_back(EncodableValue(static_cast<int64_t>(store_.id(index))));
+			}
+			result->Success(EncodableValue(ids));
+			return true;
+		}
+		else if (method.compare("participants_query") == 0) {
+			RosterQuery query;
+			if (arguments) {
+				for (const auto& filter : kQueryFilters) {
+					bool on = false;
+					if (BoolArgument(*arguments, filter.name, on) && on) {
+						query.filters |= filter.filter;
+					}
+				}
+				StringArgument(*arguments, "prefix", query.prefix);
+				BoolArgument(*arguments, "descending", query.descending);
+
+				int64_t offset = 0;
+				int64_t limit = static_cast<int64_t>(query.limit);
+				IntArgument(*arguments, "offset", offset);
+				IntArgument(*arguments, "limit", limit);
+				if (offset < 0 || limit < 0 || limit > static_cast<int64_t>(kMaxPageSize)) {
+					result->Error("INVALID_ARGUMENTS", "Expected a non-negative offset and a limit up to 1000");
+					return true;
+				}
+				query.offset = static_cast<size_t>(offset);
+				query.limit = static_cast<size_t>(limit);
+			}
+
+			const RosterPage page = index_.query(query);
+			EncodableList participants;
+			participants.reserve(page.ids.size());
+			RosterMember member;
+			for (uint32_t id : page.ids) {
+				if (store_.member(id, member)) {
+					participants.push_back(EncodableValue(memberToMap(member)));
+				}
+			}
+
+			EncodableMap map;
+			map[EncodableValue("total")] = EncodableValue(static_cast<int64_t>(page.total));
+			map[EncodableValue("participants")] = EncodableValue(participants);
+			result->Success(EncodableValue(map));
+			return true;
+		}
+		else if (method.compare("participants_roster_since") == 0) {
+			int64_t version = 0;
+			if (!arguments || !IntArgument(*arguments, "version", version) || version < 0) {
+				result->Error("INVALID_ARGUMENTS", "Expected a version");
+				return true;
+			}
+
+			// Pending changes go out first so the answer is as new as the stream.
+			flushSync();
+			std::vector<uint8_t> update;
+			sync_.since(static_cast<uint64_t>(version), update);
+			result->Success(EncodableValue(update));
+			return true;
+		}
+		else if (method.compare("participants_av_snapshot") == 0) {
+			flushAvStatus();
+			std::vector<uint8_t> update;
+			avBits_.snapshot(update);
+			result->Success(EncodableValue(update));
+			return true;
+		}
+		else if (method.compare("participants_av_counts") == 0) {
+			EncodableMap map;
+			map[EncodableValue("users")] = EncodableValue(static_cast<int64_t>(avBits_.users()));
+			map[EncodableValue("muted")] = EncodableValue(static_cast<int64_t>(avBits_.count(AvStatus::Muted)));
+			map[EncodableValue("videoOn")] = EncodableValue(static_cast<int64_t>(avBits_.count(AvStatus::VideoOn)));
+			map[EncodableValue("talking")] = EncodableValue(static_cast<int64_t>(avBits_.count(AvStatus::Talking)));
+			map[EncodableValue("activeAudio")] = EncodableValue(static_cast<int64_t>(avBits_.count(AvStatus::ActiveAudio)));
+			result->Success(EncodableValue(map));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
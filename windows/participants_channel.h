@@ -0,0 +1,126 @@
+#ifndef FLUTTER_PLUGIN_PARTICIPANTS_CHANNEL_H_
+#define FLUTTER_PLUGIN_PARTICIPANTS_CHANNEL_H_
+
+#include <flutter/binary_messenger.h>
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <meeting_service_interface.h>
+
+#include <functional>
+#include <memory>
+
+#include "binary_event_channel.h"
+#include "media/buffer_pool.h"
+#include "meeting/av_status_bits.h"
+#include "meeting/av_status_tracker.h"
+#include "meeting/callback_recorder.h"
+#include "meeting/meeting_event_fanout.h"
+#include "meeting/roster_index.h"
+#include "meeting/roster_store.h"
+#include "meeting/roster_sync.h"
+#include "meeting/roster_tracker.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Serves the meeting's participants from a native roster kept up to date
+	// by the participants events, instead of asking the SDK for every user.
+	// Roster updates go out on the "flutter_zoom_sdk/roster" event channel as
+	// Uint8List events: a snapshot, then versioned deltas of the changes over
+	// each short window. Audio and video status also goes out on its own as
+	// packed bitset deltas on "flutter_zoom_sdk/av_status".
+	//
+	// The roster is followed only while something wants it: Dart listening on
+	// either channel, a participants_* call, or a retain() from a native
+	// feature. Until then the participants, audio and video events are not
+	// even registered with the SDK.
+	class ParticipantsChannel {
+	public:
+		using MeetingServiceGetter = std::function<ZOOM_SDK_NAMESPACE::IMeetingService*()>;
+
+		// Follows audio and video status through the fanouts, which the caller
+		// sets on the controllers.
+		ParticipantsChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher,
+			AudioEventFanout& audioEvents, VideoEventFanout& videoEvents, MeetingServiceGetter meetingService);
+
+		~ParticipantsChannel();
+
+		ParticipantsChannel(const ParticipantsChannel&) = delete;
+		ParticipantsChannel& operator=(const ParticipantsChannel&) = delete;
+
+		// Called as the meeting starts and ends; the roster is cleared at the
+		// end.
+		void setInMeeting(bool inMeeting);
+
+		// A native feature wants the roster followed until release().
+		void retain();
+
+		void release();
+
+		// The roster, for features that follow who is in the meeting.
+		RosterStore& roster() { return store_; }
+
+		// Records the participants events, and the list each roster load
+		// starts from, into recorder until set to nullptr.
+		void setRecorder(CallbackRecorder* recorder);
+
+		// Handles the participants_* methods. Returns false, leaving result
+		// untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+	private:
+		// Why the roster is followed, besides retain().
+		enum Demand : uint8_t {
+			kDemandRoster = 1 << 0,
+			kDemandAvStatus = 1 << 1,
+			// Cleared when the meeting ends.
+			kDemandQueried = 1 << 2,
+		};
+
+		ZOOM_SDK_NAMESPACE::IMeetingParticipantsController* participantsController();
+
+		void setDemand(uint8_t demand, bool on);
+
+		// Attaches or detaches to match the meeting and the demand.
+		void update();
+
+		// Loads the roster and starts following it.
+		bool attach();
+
+		void detach();
+
+		// Send the changes of the window that just ended.
+		void flushSync();
+
+		void flushAvStatus();
+
+		PlatformDispatcher& dispatcher_;
+		AudioEventFanout& audioEvents_;
+		VideoEventFanout& videoEvents_;
+		MeetingServiceGetter meetingService_;
+		BinaryEventChannel events_;
+		BinaryEventChannel avEvents_;
+		std::shared_ptr<BufferPool> pool_;
+		RosterStore store_;
+		RosterIndex index_;
+		RosterSync sync_;
+		RosterTracker tracker_;
+		// Set on the controller; forwards to tracker_.
+		ParticipantsEventFanout participantsEvents_;
+		CallbackRecorder* recorder_;
+		AvStatusBits avBits_;
+		AvStatusTracker avStatus_;
+		UINT_PTR flushTimer_;
+		UINT_PTR avFlushTimer_;
+		bool inMeeting_;
+		uint8_t demand_;
+		size_t retained_;
+		bool attached_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_PARTICIPANTS_CHANNEL_H_
@@ -0,0 +1,71 @@
+#include "pcm_stream_channel.h"
+
+#include <string>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	namespace {
+		constexpr char kChannelName[] = "flutter_zoom_sdk/pcm_stream";
+
+		constexpr size_t kMaxPendingChunks = 64;
+	}
+
+	PcmStreamChannel::PcmStreamChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, AudioRawDataHub& hub)
+		: hub_(hub),
+		events_(messenger, dispatcher, kChannelName, kMaxPendingChunks),
+		streamer_(hub, [this](PooledBuffer chunk) { events_.send(std::move(chunk)); }, BinaryEventChannel::kEnvelopePrefix) {}
+
+	PcmStreamChannel::~PcmStreamChannel() {
+		streamer_.unsubscribeAll();
+	}
+
+	bool PcmStreamChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		if (method.compare("pcm_stream_subscribe") == 0 || method.compare("pcm_stream_unsubscribe") == 0) {
+			AudioStreamKey key;
+			if (!arguments || !AudioStreamKeyFromArguments(*arguments, hub_.languages(), key)) {
+				result->Error("INVALID_ARGUMENTS", "Expected an audio stream selector");
+				return true;
+			}
+
+			const bool subscribe = method.compare("pcm_stream_subscribe") == 0;
+			bool res = subscribe ? streamer_.subscribe(key) : streamer_.unsubscribe(key);
+
+			result->Success(EncodableValue(res));
+			return true;
+		}
+		else if (method.compare("pcm_stream_set_batch_duration") == 0) {
+			int64_t milliseconds = 0;
+			if (!arguments || !IntArgument(*arguments, "milliseconds", milliseconds)) {
+				result->Error("INVALID_ARGUMENTS", "Expected milliseconds");
+				return true;
+			}
+
+			streamer_.setBatchDuration(std::chrono::milliseconds(milliseconds));
+
+			result->Success(EncodableValue(static_cast<int64_t>(streamer_.batchDuration().count())));
+			return true;
+		}
+		else if (method.compare("interpreter_languages") == 0) {
+			// Maps the stream ids of interpreter chunks back to language names.
+			EncodableMap languages;
+			for (const auto& language : hub_.languages().languages()) {
+				languages[EncodableValue(static_cast<int64_t>(language.first))] = EncodableValue(language.second);
+			}
+
+			result->Success(EncodableValue(languages));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
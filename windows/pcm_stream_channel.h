@@ -0,0 +1,44 @@
+#ifndef FLUTTER_PLUGIN_PCM_STREAM_CHANNEL_H_
+#define FLUTTER_PLUGIN_PCM_STREAM_CHANNEL_H_
+
+#include <flutter/binary_messenger.h>
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <memory>
+
+#include "binary_event_channel.h"
+#include "media/audio_raw_data_hub.h"
+#include "media/pcm_streamer.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Dart side of PcmStreamer. Chunks go out on the
+	// "flutter_zoom_sdk/pcm_stream" event channel as Uint8List events.
+	class PcmStreamChannel {
+	public:
+		PcmStreamChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, AudioRawDataHub& hub);
+
+		~PcmStreamChannel();
+
+		PcmStreamChannel(const PcmStreamChannel&) = delete;
+		PcmStreamChannel& operator=(const PcmStreamChannel&) = delete;
+
+		// Handles the pcm_stream_* methods. Returns false, leaving result
+		// untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+	private:
+		AudioRawDataHub& hub_;
+		BinaryEventChannel events_;
+
+		// Declared last so its worker stops before the members above go away.
+		PcmStreamer streamer_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_PCM_STREAM_CHANNEL_H_
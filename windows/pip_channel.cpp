@@ -0,0 +1,220 @@
+#include "pip_channel.h"
+
+#include <rawdata/zoom_rawdata_api.h>
+#include <meeting_service_components/meeting_ui_ctrl_interface.h>
+
+#include <windows.h>
+#include <conio.h>
+#include <tchar.h>
+
+#include <string>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	namespace {
+		constexpr int64_t kNoTexture = -1;
+
+		void releasePixelBuffer(void* context) {
+			static_cast<PipRenderer*>(context)->releaseFrame();
+		}
+	}
+
+	PipChannel::View::View(flutter::TextureRegistrar* textures)
+		: renderer([this, textures]() {
+			const int64_t id = textureId.load();
+			if (id != kNoTexture) {
+				textures->MarkTextureFrameAvailable(id);
+			}
+		}),
+		pixelBuffer{},
+		textureId(kNoTexture) {
+		texture = std::make_unique<flutter::TextureVariant>(flutter::PixelBufferTexture(
+			[this](size_t width, size_t height) -> const FlutterDesktopPixelBuffer* {
+				uint32_t frameWidth = 0;
+				uint32_t frameHeight = 0;
+				const uint8_t* frame = renderer.acquireFrame(frameWidth, frameHeight);
+				if (!frame) {
+					renderer.releaseFrame();
+					return nullptr;
+				}
+
+				// Released by the engine once it has copied the pixels.
+				pixelBuffer.buffer = frame;
+				pixelBuffer.width = frameWidth;
+				pixelBuffer.height = frameHeight;
+				pixelBuffer.release_callback = releasePixelBuffer;
+				pixelBuffer.release_context = &renderer;
+				return &pixelBuffer;
+			}));
+	}
+
+	PipChannel::PipChannel(flutter::TextureRegistrar* textures, MeetingServiceGetter meetingService, CurrentSpeaker currentSpeaker, PauseOthers pauseOthers)
+		: textures_(textures),
+		meetingService_(std::move(meetingService)),
+		currentSpeaker_(std::move(currentSpeaker)),
+		pauseOthers_(std::move(pauseOthers)),
+		renderer_(nullptr),
+		userId_(0) {}
+
+	PipChannel::~PipChannel() {
+		stop();
+	}
+
+	ZOOM_SDK_NAMESPACE::IMeetingVideoController* PipChannel::videoController() {
+		ZOOM_SDK_NAMESPACE::IMeetingService* meetingService = meetingService_();
+		return meetingService ? meetingService->GetMeetingVideoController() : nullptr;
+	}
+
+	int64_t PipChannel::start(uint32_t userId, ZOOM_SDK_NAMESPACE::ZoomSDKResolution resolution) {
+		if (view_) {
+			if (userId != 0) {
+				follow(userId);
+			}
+			return view_->textureId.load();
+		}
+
+		ZOOM_SDK_NAMESPACE::IMeetingVideoController* controller = videoController();
+		if (!controller) {
+			return kNoTexture;
+		}
+
+		auto view = std::make_shared<View>(textures_);
+		ZOOM_SDK_NAMESPACE::IZoomSDKRenderer* renderer = nullptr;
+		if (ZOOM_SDK_NAMESPACE::createRenderer(&renderer, &view->renderer) != ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS || !renderer) {
+			_cputts(L"Picture-in-picture: createRenderer failed\n");
+			return kNoTexture;
+		}
+		renderer->setRawDataResolution(resolution);
+
+		const int64_t textureId = textures_->RegisterTexture(view->texture.get());
+		if (textureId < 0) {
+			ZOOM_SDK_NAMESPACE::destroyRenderer(renderer);
+			return kNoTexture;
+		}
+		view->textureId = textureId;
+
+		view_ = std::move(view);
+		renderer_ = renderer;
+		userId_ = 0;
+		if (pauseOthers_) {
+			pauseOthers_(true);
+		}
+		follow(userId != 0 || !currentSpeaker_ ? userId : currentSpeaker_());
+		minimizeMeeting();
+		return textureId;
+	}
+
+	void PipChannel::follow(uint32_t userId) {
+		if (!view_ || userId == 0 || userId == userId_ || view_->renderer.destroyed()) {
+			return;
+		}
+
+		// The last frame stays on screen until the new speaker's first one.
+		if (userId_ != 0) {
+			renderer_->unSubscribe();
+		}
+		userId_ = userId;
+		if (renderer_->subscribe(userId, ZOOM_SDK_NAMESPACE::RAW_DATA_TYPE_VIDEO) != ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+			_cputts(L"Picture-in-picture: subscribe failed\n");
+			userId_ = 0;
+		}
+	}
+
+	bool PipChannel::stop() {
+		if (!view_) {
+			return false;
+		}
+
+		// A renderer the SDK already destroyed must not be touched again.
+		if (!view_->renderer.destroyed()) {
+			renderer_->unSubscribe();
+			ZOOM_SDK_NAMESPACE::destroyRenderer(renderer_);
+		}
+		renderer_ = nullptr;
+		userId_ = 0;
+
+		// The engine may still be copying the last frame; the view goes away
+		// with its callback.
+		std::shared_ptr<View> view = std::move(view_);
+		const int64_t textureId = view->textureId.exchange(kNoTexture);
+		textures_->UnregisterTexture(textureId, [view]() {});
+
+		if (pauseOthers_) {
+			pauseOthers_(false);
+		}
+		return true;
+	}
+
+	void PipChannel::minimizeMeeting() {
+		ZOOM_SDK_NAMESPACE::IMeetingService* meetingService = meetingService_();
+		ZOOM_SDK_NAMESPACE::IMeetingUIController* controller = meetingService ? meetingService->GetUIController() : nullptr;
+		if (!controller) {
+			return;
+		}
+
+		HWND firstView = NULL;
+		HWND secondView = NULL;
+		controller->GetMeetingUIWnd(firstView, secondView);
+		if (firstView) {
+			// Unlike Win+Down, a plain minimize does not bring up Zoom's own
+			// mini window; the texture replaces it.
+			controller->ExitFullScreen(true, true);
+			ShowWindow(firstView, SW_MINIMIZE);
+		}
+	}
+
+	bool PipChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		if (method.compare("pip_start") == 0) {
+			int64_t userId = 0;
+			ZOOM_SDK_NAMESPACE::ZoomSDKResolution resolution = ZOOM_SDK_NAMESPACE::ZoomSDKResolution_180P;
+			if (arguments) {
+				IntArgument(*arguments, "userId", userId);
+				if (!ResolutionArgument(*arguments, "resolution", resolution)) {
+					result->Error("INVALID_ARGUMENTS", "Expected resolution 90, 180, 360, 720 or 1080");
+					return true;
+				}
+			}
+			if (userId < 0 || userId > UINT32_MAX) {
+				result->Error("INVALID_ARGUMENTS", "Expected a valid userId");
+				return true;
+			}
+
+			const int64_t textureId = start(static_cast<uint32_t>(userId), resolution);
+			if (textureId == kNoTexture) {
+				result->Success();
+				return true;
+			}
+			result->Success(EncodableValue(textureId));
+			return true;
+		}
+		else if (method.compare("pip_stop") == 0) {
+			result->Success(EncodableValue(stop()));
+			return true;
+		}
+		else if (method.compare("pip_state") == 0) {
+			if (!view_) {
+				result->Success();
+				return true;
+			}
+
+			EncodableMap map;
+			map[EncodableValue("textureId")] = EncodableValue(view_->textureId.load());
+			map[EncodableValue("userId")] = EncodableValue(static_cast<int64_t>(userId_));
+			map[EncodableValue("frames")] = EncodableValue(static_cast<int64_t>(view_->renderer.frames()));
+			result->Success(EncodableValue(map));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,93 @@
+#ifndef FLUTTER_PLUGIN_PIP_CHANNEL_H_
+#define FLUTTER_PLUGIN_PIP_CHANNEL_H_
+
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+#include <flutter/texture_registrar.h>
+
+#include <meeting_service_interface.h>
+#include <meeting_service_components/meeting_video_interface.h>
+#include <rawdata/rawdata_renderer_interface.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "media/pip_renderer.h"
+
+namespace flutter_zoom_sdk {
+
+	// Native picture-in-picture for a hidden meeting: minimizes the Zoom
+	// window and renders the active speaker from one low-resolution raw
+	// subscription into a Flutter texture, following followSpeaker().
+	class PipChannel {
+	public:
+		using MeetingServiceGetter = std::function<ZOOM_SDK_NAMESPACE::IMeetingService*()>;
+
+		// Called with true when picture-in-picture starts and false when it
+		// stops, to pause the other raw video subscriptions meanwhile: the
+		// video health renderers, which only watch views nobody sees. The raw
+		// media archiver keeps running; it is an explicit recording, not a
+		// view. So does the audio hub, whose one raw audio subscription feeds
+		// the PCM stream, recorder and archive, which must not gap, the mixer,
+		// the analyzer, and the speaker levels the picture follows.
+		using PauseOthers = std::function<void(bool paused)>;
+
+		// The speaker to show when pip_start names nobody, 0 for none.
+		using CurrentSpeaker = std::function<uint32_t()>;
+
+		PipChannel(flutter::TextureRegistrar* textures, MeetingServiceGetter meetingService, CurrentSpeaker currentSpeaker, PauseOthers pauseOthers);
+
+		~PipChannel();
+
+		PipChannel(const PipChannel&) = delete;
+		PipChannel& operator=(const PipChannel&) = delete;
+
+		// Handles the pip_* methods. Returns false, leaving result untouched,
+		// for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+		// Ends picture-in-picture, if on. Does not restore the meeting window.
+		bool stop();
+
+		// Moves the subscription to the new stable speaker while on.
+		void followSpeaker(uint32_t userId) { follow(userId); }
+
+	private:
+		// The texture and what it reads, kept alive until the engine lets go
+		// of the texture after unregistering it.
+		struct View {
+			explicit View(flutter::TextureRegistrar* textures);
+
+			PipRenderer renderer;
+			FlutterDesktopPixelBuffer pixelBuffer;
+			std::unique_ptr<flutter::TextureVariant> texture;
+			std::atomic<int64_t> textureId;
+		};
+
+		ZOOM_SDK_NAMESPACE::IMeetingVideoController* videoController();
+
+		int64_t start(uint32_t userId, ZOOM_SDK_NAMESPACE::ZoomSDKResolution resolution);
+
+		// Moves the subscription to userId; 0 leaves it off until the next
+		// active speaker.
+		void follow(uint32_t userId);
+
+		void minimizeMeeting();
+
+		flutter::TextureRegistrar* textures_;
+		MeetingServiceGetter meetingService_;
+		CurrentSpeaker currentSpeaker_;
+		PauseOthers pauseOthers_;
+
+		std::shared_ptr<View> view_;
+		ZOOM_SDK_NAMESPACE::IZoomSDKRenderer* renderer_;
+		uint32_t userId_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_PIP_CHANNEL_H_
@@ -0,0 +1,127 @@
+#include "platform_dispatcher.h"
+
+#include <conio.h>
+#include <tchar.h>
+
+#include <algorithm>
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr wchar_t kWindowClassName[] = L"FlutterZoomSdkPlatformDispatcher";
+		constexpr UINT kDrainMessage = WM_APP + 0x5A;
+
+		void registerWindowClass(WNDPROC proc) {
+			static bool registered = false;
+			if (registered) {
+				return;
+			}
+
+			WNDCLASSEX windowClass = {};
+			windowClass.cbSize = sizeof(WNDCLASSEX);
+			windowClass.lpfnWndProc = proc;
+			windowClass.hInstance = GetModuleHandle(nullptr);
+			windowClass.lpszClassName = kWindowClassName;
+			registered = RegisterClassEx(&windowClass) != 0;
+		}
+	}
+
+	PlatformDispatcher::PlatformDispatcher() : window_(nullptr), drainPosted_(false), nextDelayed_(0) {
+		registerWindowClass(&PlatformDispatcher::WindowProc);
+
+		window_ = CreateWindowEx(0, kWindowClassName, L"", 0, 0, 0, 0, 0,
+			HWND_MESSAGE, nullptr, GetModuleHandle(nullptr), nullptr);
+
+		if (window_) {
+			SetWindowLongPtr(window_, GWLP_USERDATA, reinterpret_cast<LONG_PTR>(this));
+		}
+		else {
+			_cputts(L"Create platform dispatcher window failed\n");
+		}
+	}
+
+	PlatformDispatcher::~PlatformDispatcher() {
+		if (window_) {
+			SetWindowLongPtr(window_, GWLP_USERDATA, 0);
+			DestroyWindow(window_);
+			window_ = nullptr;
+		}
+	}
+
+	void PlatformDispatcher::post(std::function<void()> task) {
+		std::lock_guard<std::mutex> lock(mutex_);
+
+		pending_.push_back(std::move(task));
+
+		// One wake-up per batch of tasks rather than one message per task.
+		if (!drainPosted_ && window_) {
+			drainPosted_ = PostMessage(window_, kDrainMessage, 0, 0) != 0;
+		}
+	}
+
+	UINT_PTR PlatformDispatcher::postDelayed(std::chrono::milliseconds delay, std::function<void()> task) {
+		if (!window_) {
+			return 0;
+		}
+
+		const UINT_PTR id = ++nextDelayed_;
+		const UINT elapse = static_cast<UINT>(std::max<long long>(delay.count(), USER_TIMER_MINIMUM));
+		if (SetTimer(window_, id, elapse, nullptr) == 0) {
+			return 0;
+		}
+		delayed_[id] = std::move(task);
+		return id;
+	}
+
+	void PlatformDispatcher::cancelDelayed(UINT_PTR id) {
+		if (delayed_.erase(id) != 0 && window_) {
+			KillTimer(window_, id);
+		}
+	}
+
+	void PlatformDispatcher::runDelayed(UINT_PTR id) {
+		// One-shot: WM_TIMER would repeat.
+		KillTimer(window_, id);
+		auto it = delayed_.find(id);
+		if (it == delayed_.end()) {
+			return;
+		}
+
+		std::function<void()> task = std::move(it->second);
+		delayed_.erase(it);
+		task();
+	}
+
+	void PlatformDispatcher::drain() {
+		std::vector<std::function<void()>> tasks;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			tasks.swap(pending_);
+			drainPosted_ = false;
+		}
+
+		for (auto& task : tasks) {
+			task();
+		}
+	}
+
+	LRESULT CALLBACK PlatformDispatcher::WindowProc(HWND hwnd, UINT message, WPARAM wparam, LPARAM lparam) {
+		if (message == kDrainMessage) {
+			auto* dispatcher = reinterpret_cast<PlatformDispatcher*>(GetWindowLongPtr(hwnd, GWLP_USERDATA));
+			if (dispatcher) {
+				dispatcher->drain();
+			}
+			return 0;
+		}
+		if (message == WM_TIMER) {
+			auto* dispatcher = reinterpret_cast<PlatformDispatcher*>(GetWindowLongPtr(hwnd, GWLP_USERDATA));
+			if (dispatcher) {
+				dispatcher->runDelayed(static_cast<UINT_PTR>(wparam));
+			}
+			return 0;
+		}
+
+		return DefWindowProc(hwnd, message, wparam, lparam);
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,56 @@
+#ifndef FLUTTER_PLUGIN_PLATFORM_DISPATCHER_H_
+#define FLUTTER_PLUGIN_PLATFORM_DISPATCHER_H_
+
+#include <windows.h>
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace flutter_zoom_sdk {
+
+	// Runs closures on the Flutter platform thread. Channel messages may only be
+	// sent from that thread, while raw data callbacks and plugin workers run
+	// elsewhere. Backed by a message-only window, so it must be created on the
+	// platform thread.
+	class PlatformDispatcher {
+	public:
+		PlatformDispatcher();
+
+		~PlatformDispatcher();
+
+		PlatformDispatcher(const PlatformDispatcher&) = delete;
+		PlatformDispatcher& operator=(const PlatformDispatcher&) = delete;
+
+		// Safe to call from any thread. Tasks run in posting order.
+		void post(std::function<void()> task);
+
+		// Runs task on the platform thread after delay. Platform thread only.
+		// Returns an id for cancelDelayed, 0 when the timer could not be set.
+		UINT_PTR postDelayed(std::chrono::milliseconds delay, std::function<void()> task);
+
+		// Drops a delayed task that has not run yet. Platform thread only.
+		void cancelDelayed(UINT_PTR id);
+
+	private:
+		static LRESULT CALLBACK WindowProc(HWND hwnd, UINT message, WPARAM wparam, LPARAM lparam);
+
+		void drain();
+
+		void runDelayed(UINT_PTR id);
+
+		HWND window_;
+		std::mutex mutex_;
+		std::vector<std::function<void()>> pending_;
+		bool drainPosted_;
+
+		// Platform thread only, like the timers themselves.
+		std::map<UINT_PTR, std::function<void()>> delayed_;
+		UINT_PTR nextDelayed_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_PLATFORM_DISPATCHER_H_
@@ -0,0 +1,227 @@
+#include "raw_archive_channel.h"
+
+#include <rawdata/zoom_rawdata_api.h>
+#include <meeting_service_components/meeting_raw_archiving_interface.h>
+
+#include <conio.h>
+#include <tchar.h>
+
+#include <string>
+#include <vector>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableList;
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	namespace {
+		bool RecordTypeArgument(const EncodableMap& arguments, RawArchiveRecordType& type) {
+			std::string name = "video";
+			StringArgument(arguments, "type", name);
+			if (name == "video") {
+				type = RawArchiveRecordType::Video;
+				return true;
+			}
+			if (name == "share") {
+				type = RawArchiveRecordType::Share;
+				return true;
+			}
+			return false;
+		}
+	}
+
+	RawArchiveChannel::RawArchiveChannel(AudioRawDataHub& hub, MeetingServiceGetter meetingService)
+		: hub_(hub),
+		meetingService_(std::move(meetingService)),
+		archiver_(hub) {}
+
+	RawArchiveChannel::~RawArchiveChannel() {
+		stop();
+	}
+
+	ZOOM_SDK_NAMESPACE::IMeetingRawArchivingController* RawArchiveChannel::archivingController() {
+		ZOOM_SDK_NAMESPACE::IMeetingService* meetingService = meetingService_();
+		return meetingService ? meetingService->GetMeetingRawArchivingController() : nullptr;
+	}
+
+	bool RawArchiveChannel::addVideo(uint32_t id, RawArchiveRecordType type, ZOOM_SDK_NAMESPACE::ZoomSDKResolution resolution) {
+		// A renderer the SDK destroyed, at the end of a meeting say, records
+		// nothing more; it is replaced rather than acknowledged.
+		if (renderers_.count(id) > 0 && archiver_.rendererDestroyed(id)) {
+			removeVideo(id);
+		}
+
+		ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate* delegate = archiver_.addVideo(id, type);
+		if (!delegate) {
+			return renderers_.count(id) > 0;
+		}
+
+		ZOOM_SDK_NAMESPACE::IZoomSDKRenderer* renderer = nullptr;
+		if (ZOOM_SDK_NAMESPACE::createRenderer(&renderer, delegate) != ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS || !renderer) {
+			_cputts(L"Raw archive: createRenderer failed\n");
+			archiver_.removeVideo(id);
+			return false;
+		}
+
+		renderer->setRawDataResolution(resolution);
+		const ZOOM_SDK_NAMESPACE::ZoomSDKRawDataType rawDataType = type == RawArchiveRecordType::Share
+			? ZOOM_SDK_NAMESPACE::RAW_DATA_TYPE_SHARE : ZOOM_SDK_NAMESPACE::RAW_DATA_TYPE_VIDEO;
+		if (renderer->subscribe(id, rawDataType) != ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+			_cputts(L"Raw archive: subscribe failed\n");
+			ZOOM_SDK_NAMESPACE::destroyRenderer(renderer);
+			archiver_.removeVideo(id);
+			return false;
+		}
+
+		renderers_[id] = renderer;
+		return true;
+	}
+
+	bool RawArchiveChannel::removeVideo(uint32_t id) {
+		auto it = renderers_.find(id);
+		if (it == renderers_.end()) {
+			return false;
+		}
+
+		// A renderer the SDK already destroyed must not be touched again.
+		if (!archiver_.rendererDestroyed(id)) {
+			it->second->unSubscribe();
+			ZOOM_SDK_NAMESPACE::destroyRenderer(it->second);
+		}
+		renderers_.erase(it);
+		archiver_.removeVideo(id);
+		return true;
+	}
+
+	std::vector<std::string> RawArchiveChannel::stop() {
+		if (!archiver_.isArchiving()) {
+			return {};
+		}
+
+		while (!renderers_.empty()) {
+			removeVideo(renderers_.begin()->first);
+		}
+		std::vector<std::string> paths = archiver_.stop();
+
+		ZOOM_SDK_NAMESPACE::IMeetingRawArchivingController* controller = archivingController();
+		if (controller) {
+			controller->StopRawArchiving();
+		}
+		return paths;
+	}
+
+	bool RawArchiveChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		if (method.compare("raw_archive_start") == 0) {
+			std::string directory;
+			if (!arguments || !StringArgument(*arguments, "directory", directory)) {
+				result->Error("INVALID_ARGUMENTS", "Expected directory");
+				return true;
+			}
+
+			RawArchiveConfig config;
+			int64_t value = 0;
+			if (IntArgument(*arguments, "segmentSeconds", value)) {
+				config.segmentDuration = std::chrono::seconds(value);
+			}
+			if (IntArgument(*arguments, "flushMs", value)) {
+				config.flushInterval = std::chrono::milliseconds(value);
+			}
+			if (IntArgument(*arguments, "maxBytes", value) && value > 0) {
+				config.maxBytes = static_cast<uint64_t>(value);
+			}
+			if (IntArgument(*arguments, "maxSegments", value) && value > 0) {
+				config.maxSegments = static_cast<uint32_t>(value);
+			}
+
+			std::vector<AudioStreamKey> streams;
+			auto itStreams = arguments->find(EncodableValue("streams"));
+			if (itStreams != arguments->end() && std::holds_alternative<EncodableList>(itStreams->second)) {
+				for (const auto& item : std::get<EncodableList>(itStreams->second)) {
+					AudioStreamKey key;
+					if (!std::holds_alternative<EncodableMap>(item) ||
+						!AudioStreamKeyFromArguments(std::get<EncodableMap>(item), hub_.languages(), key)) {
+						result->Error("INVALID_ARGUMENTS", "Expected audio stream selectors");
+						return true;
+					}
+					streams.push_back(key);
+				}
+			}
+
+			// Started first: only stop() turns raw archiving off again, and it
+			// does so only for a running archiver.
+			if (!archiver_.start(directory, config, streams)) {
+				result->Success(EncodableValue(false));
+				return true;
+			}
+
+			// Grants the raw data privilege; recording permission grants it too,
+			// so a refusal is not fatal.
+			ZOOM_SDK_NAMESPACE::IMeetingRawArchivingController* controller = archivingController();
+			if (!controller || controller->StartRawArchiving() != ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+				_cputts(L"Raw archive: StartRawArchiving failed\n");
+			}
+
+			result->Success(EncodableValue(true));
+			return true;
+		}
+		else if (method.compare("raw_archive_add_video") == 0) {
+			int64_t userId = 0;
+			RawArchiveRecordType type = RawArchiveRecordType::Video;
+			ZOOM_SDK_NAMESPACE::ZoomSDKResolution resolution = ZOOM_SDK_NAMESPACE::ZoomSDKResolution_360P;
+			if (!arguments || !IntArgument(*arguments, "userId", userId) || userId <= 0 || userId > UINT32_MAX
+				|| !RecordTypeArgument(*arguments, type) || !ResolutionArgument(*arguments, "resolution", resolution)) {
+				result->Error("INVALID_ARGUMENTS", "Expected a userId, type video or share and resolution 90, 180, 360, 720 or 1080");
+				return true;
+			}
+
+			result->Success(EncodableValue(addVideo(static_cast<uint32_t>(userId), type, resolution)));
+			return true;
+		}
+		else if (method.compare("raw_archive_remove_video") == 0) {
+			int64_t userId = 0;
+			if (!arguments || !IntArgument(*arguments, "userId", userId)) {
+				result->Error("INVALID_ARGUMENTS", "Expected a userId");
+				return true;
+			}
+
+			result->Success(EncodableValue(removeVideo(static_cast<uint32_t>(userId))));
+			return true;
+		}
+		else if (method.compare("raw_archive_stop") == 0) {
+			EncodableList files;
+			for (const auto& path : stop()) {
+				files.push_back(EncodableValue(path));
+			}
+
+			result->Success(EncodableValue(files));
+			return true;
+		}
+		else if (method.compare("raw_archive_stats") == 0) {
+			const RawArchiveStats stats = archiver_.stats();
+			EncodableMap map;
+			map[EncodableValue("archiving")] = EncodableValue(stats.archiving);
+			map[EncodableValue("segments")] = EncodableValue(static_cast<int64_t>(stats.segments));
+			map[EncodableValue("records")] = EncodableValue(static_cast<int64_t>(stats.records));
+			map[EncodableValue("bytesWritten")] = EncodableValue(static_cast<int64_t>(stats.bytesWritten));
+			map[EncodableValue("chunks")] = EncodableValue(static_cast<int64_t>(stats.chunks));
+			map[EncodableValue("droppedRecords")] = EncodableValue(static_cast<int64_t>(stats.droppedRecords));
+			map[EncodableValue("deletedSegments")] = EncodableValue(static_cast<int64_t>(stats.deletedSegments));
+			map[EncodableValue("writeErrors")] = EncodableValue(static_cast<int64_t>(stats.writeErrors));
+			map[EncodableValue("queuedBytes")] = EncodableValue(static_cast<int64_t>(stats.queuedBytes));
+			map[EncodableValue("segmentPath")] = EncodableValue(stats.segmentPath);
+
+			result->Success(EncodableValue(map));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,56 @@
+#ifndef FLUTTER_PLUGIN_RAW_ARCHIVE_CHANNEL_H_
+#define FLUTTER_PLUGIN_RAW_ARCHIVE_CHANNEL_H_
+
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <meeting_service_interface.h>
+#include <rawdata/rawdata_renderer_interface.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+#include "media/audio_raw_data_hub.h"
+#include "media/raw_archiver.h"
+
+namespace flutter_zoom_sdk {
+
+	// Archives raw meeting media to disk under the raw archiving privilege
+	// of IMeetingRawArchivingController.
+	class RawArchiveChannel {
+	public:
+		using MeetingServiceGetter = std::function<ZOOM_SDK_NAMESPACE::IMeetingService*()>;
+
+		RawArchiveChannel(AudioRawDataHub& hub, MeetingServiceGetter meetingService);
+
+		~RawArchiveChannel();
+
+		RawArchiveChannel(const RawArchiveChannel&) = delete;
+		RawArchiveChannel& operator=(const RawArchiveChannel&) = delete;
+
+		// Handles the raw_archive_* methods. Returns false, leaving result
+		// untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+	private:
+		ZOOM_SDK_NAMESPACE::IMeetingRawArchivingController* archivingController();
+
+		bool addVideo(uint32_t id, RawArchiveRecordType type, ZOOM_SDK_NAMESPACE::ZoomSDKResolution resolution);
+
+		bool removeVideo(uint32_t id);
+
+		std::vector<std::string> stop();
+
+		AudioRawDataHub& hub_;
+		MeetingServiceGetter meetingService_;
+		std::unordered_map<uint32_t, ZOOM_SDK_NAMESPACE::IZoomSDKRenderer*> renderers_;
+		RawArchiver archiver_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_RAW_ARCHIVE_CHANNEL_H_
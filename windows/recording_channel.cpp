@@ -0,0 +1,63 @@
+#include "recording_channel.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr char kChannelName[] = "flutter_zoom_sdk/recording";
+
+		constexpr size_t kMaxPendingEvents = 16;
+	}
+
+	RecordingChannel::Events::Events(DomainEventChannel& events)
+		: events_(events) {}
+
+	void RecordingChannel::Events::onRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) {
+		send(RecordingEventKind::Local, static_cast<int32_t>(status));
+	}
+
+	void RecordingChannel::Events::onCloudRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) {
+		send(RecordingEventKind::Cloud, static_cast<int32_t>(status));
+	}
+
+	void RecordingChannel::Events::onRecordPrivilegeChanged(bool bCanRec) {
+		send(RecordingEventKind::Privilege, bCanRec ? 1 : 0);
+	}
+
+	void RecordingChannel::Events::onLocalRecordingPrivilegeRequestStatus(ZOOM_SDK_NAMESPACE::RequestLocalRecordingStatus status) {
+		send(RecordingEventKind::LocalPrivilegeRequest, static_cast<int32_t>(status));
+	}
+
+	void RecordingChannel::Events::onRequestCloudRecordingResponse(ZOOM_SDK_NAMESPACE::RequestStartCloudRecordingStatus status) {
+		send(RecordingEventKind::CloudRequest, static_cast<int32_t>(status));
+	}
+
+	void RecordingChannel::Events::onCloudRecordingStorageFull(time_t gracePeriodDate) {
+		send(RecordingEventKind::StorageFull, 0, static_cast<int64_t>(gracePeriodDate) * 1000);
+	}
+
+	void RecordingChannel::Events::send(RecordingEventKind kind, int32_t value, int64_t timeMs) {
+		DomainEvent event;
+		event.kind = static_cast<uint8_t>(kind);
+		event.value = value;
+		event.timeMs = timeMs;
+		events_.send(event);
+	}
+
+	RecordingChannel::RecordingChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, RecordingEventFanout& recordingEvents)
+		: recordingEvents_(recordingEvents),
+		events_(messenger, dispatcher, kChannelName, kMaxPendingEvents,
+			[this](bool listening) {
+				if (listening) {
+					recordingEvents_.add(&listener_);
+				}
+				else {
+					recordingEvents_.remove(&listener_);
+				}
+			}),
+		listener_(events_) {}
+
+	RecordingChannel::~RecordingChannel() {
+		recordingEvents_.remove(&listener_);
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,62 @@
+#ifndef FLUTTER_PLUGIN_RECORDING_CHANNEL_H_
+#define FLUTTER_PLUGIN_RECORDING_CHANNEL_H_
+
+#include <flutter/binary_messenger.h>
+
+#include "domain_event_channel.h"
+#include "meeting/meeting_event_fanout.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Sends recording status, privilege and request outcomes on the
+	// "flutter_zoom_sdk/recording" event channel as DomainEvents of
+	// RecordingEventKind. Listens on recordingEvents, which the caller sets on
+	// the recording controller, only while Dart listens.
+	class RecordingChannel {
+	public:
+		RecordingChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, RecordingEventFanout& recordingEvents);
+
+		~RecordingChannel();
+
+		RecordingChannel(const RecordingChannel&) = delete;
+		RecordingChannel& operator=(const RecordingChannel&) = delete;
+
+	private:
+		class Events : public ZOOM_SDK_NAMESPACE::IMeetingRecordingCtrlEvent {
+		public:
+			explicit Events(DomainEventChannel& events);
+
+			void onRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) override;
+			void onCloudRecordingStatus(ZOOM_SDK_NAMESPACE::RecordingStatus status) override;
+			void onRecordPrivilegeChanged(bool bCanRec) override;
+			void onLocalRecordingPrivilegeRequestStatus(ZOOM_SDK_NAMESPACE::RequestLocalRecordingStatus status) override;
+			void onRequestCloudRecordingResponse(ZOOM_SDK_NAMESPACE::RequestStartCloudRecordingStatus status) override;
+			void onLocalRecordingPrivilegeRequested(ZOOM_SDK_NAMESPACE::IRequestLocalRecordingPrivilegeHandler* handler) override {}
+			void onStartCloudRecordingRequested(ZOOM_SDK_NAMESPACE::IRequestStartCloudRecordingHandler* handler) override {}
+#if defined(WIN32)
+			void onRecording2MP4Done(bool bsuccess, int iResult, const zchar_t* szPath) override {}
+			void onRecording2MP4Processing(int iPercentage) override {}
+			void onCustomizedLocalRecordingSourceNotification(ZOOM_SDK_NAMESPACE::ICustomizedLocalRecordingLayoutHelper* layout_helper) override {}
+#endif
+			void onCloudRecordingStorageFull(time_t gracePeriodDate) override;
+			void onEnableAndStartSmartRecordingRequested(ZOOM_SDK_NAMESPACE::IRequestEnableAndStartSmartRecordingHandler* handler) override {}
+			void onSmartRecordingEnableActionCallback(ZOOM_SDK_NAMESPACE::ISmartRecordingEnableActionHandler* handler) override {}
+#if defined(__linux__)
+			void onTranscodingStatusChanged(ZOOM_SDK_NAMESPACE::TranscodingStatus status, const zchar_t* path) override {}
+#endif
+
+		private:
+			void send(RecordingEventKind kind, int32_t value, int64_t timeMs = 0);
+
+			DomainEventChannel& events_;
+		};
+
+		RecordingEventFanout& recordingEvents_;
+		DomainEventChannel events_;
+		Events listener_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_RECORDING_CHANNEL_H_
@@ -0,0 +1,161 @@
+#include "share_audio_channel.h"
+
+#include <rawdata/zoom_rawdata_api.h>
+#include <meeting_service_components/meeting_sharing_interface.h>
+
+#include <conio.h>
+#include <tchar.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	namespace {
+		// Room for Dart to push in bursts without starving the pump.
+		constexpr uint32_t kStreamBufferSeconds = 2;
+	}
+
+	ShareAudioChannel::ShareAudioChannel(PlatformDispatcher& dispatcher, MeetingServiceGetter meetingService)
+		: dispatcher_(dispatcher), meetingService_(std::move(meetingService)) {
+		// A finished file ends the share, like the end of a shared video would.
+		pump_.setFinishedCallback([this]() {
+			dispatcher_.post([this]() { stopShare(); });
+		});
+	}
+
+	ShareAudioChannel::~ShareAudioChannel() {
+		if (pump_.stats().sending) {
+			stopShare();
+		}
+	}
+
+	bool ShareAudioChannel::stopShare() {
+		ZOOM_SDK_NAMESPACE::IMeetingService* meetingService = meetingService_();
+		ZOOM_SDK_NAMESPACE::IMeetingShareController* shareController =
+			meetingService ? meetingService->GetMeetingShareController() : nullptr;
+		if (!shareController) {
+			return false;
+		}
+
+		return shareController->StopShare() == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS;
+	}
+
+	bool ShareAudioChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		if (method.compare("share_audio_start") == 0) {
+			std::string path;
+			int64_t sampleRate = 0;
+			int64_t channels = 0;
+			std::shared_ptr<IPcmSource> source;
+			std::shared_ptr<RingPcmSource> ring;
+
+			if (arguments && StringArgument(*arguments, "path", path)) {
+				bool loop = false;
+				BoolArgument(*arguments, "loop", loop);
+
+				auto file = std::make_shared<WavFilePcmSource>(loop);
+				if (!file->open(path)) {
+					result->Error("INVALID_ARGUMENTS", "Expected a 16-bit PCM WAV file");
+					return true;
+				}
+				source = file;
+			}
+			else if (arguments && IntArgument(*arguments, "sampleRate", sampleRate) && IntArgument(*arguments, "channels", channels)
+				&& sampleRate >= 8000 && sampleRate <= 192000 && channels >= 1 && channels <= 2) {
+				ring = std::make_shared<RingPcmSource>(static_cast<uint32_t>(sampleRate), static_cast<uint32_t>(channels),
+					static_cast<size_t>(sampleRate * kStreamBufferSeconds));
+				source = ring;
+			}
+			else {
+				result->Error("INVALID_ARGUMENTS", "Expected a path, or sampleRate and channels (1 or 2)");
+				return true;
+			}
+
+			ZOOM_SDK_NAMESPACE::IZoomSDKShareSourceHelper* helper = ZOOM_SDK_NAMESPACE::GetRawdataShareSourceHelper();
+			if (!helper) {
+				result->Success(EncodableValue(false));
+				return true;
+			}
+
+			ring_ = ring;
+			pump_.setSource(source);
+			ZOOM_SDK_NAMESPACE::SDKError err = helper->setSharePureAudioSource(&pump_);
+			if (err != ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+				_cputts(L"Share audio: setSharePureAudioSource failed\n");
+			}
+
+			result->Success(EncodableValue(err == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS));
+			return true;
+		}
+		else if (method.compare("share_audio_push") == 0) {
+			const std::vector<uint8_t>* bytes = nullptr;
+			if (arguments) {
+				auto it = arguments->find(EncodableValue("samples"));
+				if (it != arguments->end()) {
+					bytes = std::get_if<std::vector<uint8_t>>(&it->second);
+				}
+			}
+			if (!bytes) {
+				result->Error("INVALID_ARGUMENTS", "Expected samples as Uint8List");
+				return true;
+			}
+
+			size_t accepted = 0;
+			if (ring_) {
+				const size_t frames = bytes->size() / (sizeof(int16_t) * ring_->channels());
+				std::vector<int16_t> samples(frames * ring_->channels());
+				std::memcpy(samples.data(), bytes->data(), samples.size() * sizeof(int16_t));
+				accepted = ring_->push(samples.data(), frames);
+			}
+
+			result->Success(EncodableValue(static_cast<int64_t>(accepted)));
+			return true;
+		}
+		else if (method.compare("share_audio_end") == 0) {
+			// Lets the buffered audio play out, then the share stops itself.
+			bool res = ring_ != nullptr;
+			if (res) {
+				ring_->end();
+			}
+
+			result->Success(EncodableValue(res));
+			return true;
+		}
+		else if (method.compare("share_audio_stop") == 0) {
+			bool res = stopShare();
+
+			result->Success(EncodableValue(res));
+			return true;
+		}
+		else if (method.compare("share_audio_stats") == 0) {
+			const ShareAudioPumpStats stats = pump_.stats();
+			EncodableMap map;
+			map[EncodableValue("sending")] = EncodableValue(stats.sending);
+			map[EncodableValue("finished")] = EncodableValue(stats.finished);
+			map[EncodableValue("chunksSent")] = EncodableValue(static_cast<int64_t>(stats.chunksSent));
+			map[EncodableValue("sendErrors")] = EncodableValue(static_cast<int64_t>(stats.sendErrors));
+			map[EncodableValue("underruns")] = EncodableValue(static_cast<int64_t>(stats.underruns));
+			map[EncodableValue("silentFrames")] = EncodableValue(static_cast<int64_t>(stats.silentFrames));
+			map[EncodableValue("bufferedMs")] = EncodableValue(static_cast<int64_t>(stats.bufferedMs));
+			map[EncodableValue("freeFrames")] = EncodableValue(static_cast<int64_t>(ring_ ? ring_->freeFrames() : 0));
+			map[EncodableValue("lateTicks")] = EncodableValue(static_cast<int64_t>(stats.lateTicks));
+			map[EncodableValue("maxLatenessUs")] = EncodableValue(static_cast<int64_t>(stats.maxLatenessUs));
+
+			result->Success(EncodableValue(map));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,49 @@
+#ifndef FLUTTER_PLUGIN_SHARE_AUDIO_CHANNEL_H_
+#define FLUTTER_PLUGIN_SHARE_AUDIO_CHANNEL_H_
+
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <meeting_service_interface.h>
+
+#include <functional>
+#include <memory>
+
+#include "media/pcm_source.h"
+#include "media/share_audio_pump.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Shares audio without a screen through setSharePureAudioSource, fed from
+	// a WAV file or from PCM pushed by Dart.
+	class ShareAudioChannel {
+	public:
+		using MeetingServiceGetter = std::function<ZOOM_SDK_NAMESPACE::IMeetingService*()>;
+
+		ShareAudioChannel(PlatformDispatcher& dispatcher, MeetingServiceGetter meetingService);
+
+		~ShareAudioChannel();
+
+		ShareAudioChannel(const ShareAudioChannel&) = delete;
+		ShareAudioChannel& operator=(const ShareAudioChannel&) = delete;
+
+		// Handles the share_audio_* methods. Returns false, leaving result
+		// untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+	private:
+		bool stopShare();
+
+		PlatformDispatcher& dispatcher_;
+		MeetingServiceGetter meetingService_;
+		// Set while Dart feeds the share; null for file sources.
+		std::shared_ptr<RingPcmSource> ring_;
+		ShareAudioPump pump_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_SHARE_AUDIO_CHANNEL_H_
@@ -0,0 +1,144 @@
+#include "share_source_channel.h"
+
+#include <rawdata/zoom_rawdata_api.h>
+#include <meeting_service_components/meeting_sharing_interface.h>
+
+#include <conio.h>
+#include <tchar.h>
+
+#include <string>
+#include <vector>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	namespace {
+		constexpr int64_t kMaxDimension = 4096;
+	}
+
+	ShareSourceChannel::ShareSourceChannel(MeetingServiceGetter meetingService)
+		: meetingService_(std::move(meetingService)) {}
+
+	ShareSourceChannel::~ShareSourceChannel() {
+		if (source_.stats().sending) {
+			stopShare();
+		}
+	}
+
+	bool ShareSourceChannel::stopShare() {
+		ZOOM_SDK_NAMESPACE::IMeetingService* meetingService = meetingService_();
+		ZOOM_SDK_NAMESPACE::IMeetingShareController* shareController =
+			meetingService ? meetingService->GetMeetingShareController() : nullptr;
+		if (!shareController) {
+			return false;
+		}
+
+		return shareController->StopShare() == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS;
+	}
+
+	bool ShareSourceChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		if (method.compare("share_source_start") == 0) {
+			ExternalShareSourceConfig config;
+			if (arguments) {
+				int64_t maxFps = config.maxFps;
+				int64_t keepAliveFps = config.keepAliveFps;
+				int64_t tileSize = config.tileSize;
+				IntArgument(*arguments, "maxFps", maxFps);
+				IntArgument(*arguments, "keepAliveFps", keepAliveFps);
+				IntArgument(*arguments, "tileSize", tileSize);
+				BoolArgument(*arguments, "fullRange", config.fullRange);
+				if (maxFps < 1 || maxFps > 30 || keepAliveFps < 1 || keepAliveFps > maxFps || tileSize < 8 || tileSize > 256) {
+					result->Error("INVALID_ARGUMENTS", "Expected 1 <= keepAliveFps <= maxFps <= 30 and tileSize between 8 and 256");
+					return true;
+				}
+				config.maxFps = static_cast<uint32_t>(maxFps);
+				config.keepAliveFps = static_cast<uint32_t>(keepAliveFps);
+				config.tileSize = static_cast<int>(tileSize);
+			}
+
+			ZOOM_SDK_NAMESPACE::IZoomSDKShareSourceHelper* helper = ZOOM_SDK_NAMESPACE::GetRawdataShareSourceHelper();
+			if (!helper) {
+				result->Success(EncodableValue(false));
+				return true;
+			}
+
+			source_.setConfig(config);
+			ZOOM_SDK_NAMESPACE::SDKError err = helper->setExternalShareSource(&source_);
+			if (err != ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+				_cputts(L"Share source: setExternalShareSource failed\n");
+			}
+
+			result->Success(EncodableValue(err == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS));
+			return true;
+		}
+		else if (method.compare("share_source_push") == 0) {
+			// format is "rgba" (the default) or "bgra"; rows may be padded to
+			// stride bytes.
+			int64_t width = 0;
+			int64_t height = 0;
+			int64_t stride = 0;
+			std::string format = "rgba";
+			const std::vector<uint8_t>* bytes = nullptr;
+			if (arguments && IntArgument(*arguments, "width", width) && IntArgument(*arguments, "height", height)
+				&& width > 0 && height > 0 && width <= kMaxDimension && height <= kMaxDimension) {
+				auto it = arguments->find(EncodableValue("data"));
+				if (it != arguments->end()) {
+					bytes = std::get_if<std::vector<uint8_t>>(&it->second);
+				}
+				StringArgument(*arguments, "format", format);
+				IntArgument(*arguments, "stride", stride);
+			}
+			if (stride == 0) {
+				stride = 4 * width;
+			}
+			if (!bytes || (format != "rgba" && format != "bgra") || stride < 4 * width
+				|| bytes->size() < static_cast<size_t>(stride) * (height - 1) + 4 * width) {
+				result->Error("INVALID_ARGUMENTS", "Expected width, height and data as Uint8List in rgba or bgra format");
+				return true;
+			}
+
+			bool changed = source_.push(bytes->data(), static_cast<int>(stride), static_cast<int>(width), static_cast<int>(height),
+				format == "rgba" ? PixelOrder::Rgba : PixelOrder::Bgra);
+
+			result->Success(EncodableValue(changed));
+			return true;
+		}
+		else if (method.compare("share_source_stop") == 0) {
+			bool res = stopShare();
+
+			result->Success(EncodableValue(res));
+			return true;
+		}
+		else if (method.compare("share_source_stats") == 0) {
+			const ExternalShareSourceStats stats = source_.stats();
+			EncodableMap map;
+			map[EncodableValue("sending")] = EncodableValue(stats.sending);
+			map[EncodableValue("width")] = EncodableValue(static_cast<int64_t>(stats.width));
+			map[EncodableValue("height")] = EncodableValue(static_cast<int64_t>(stats.height));
+			map[EncodableValue("framesPushed")] = EncodableValue(static_cast<int64_t>(stats.framesPushed));
+			map[EncodableValue("framesUnchanged")] = EncodableValue(static_cast<int64_t>(stats.framesUnchanged));
+			map[EncodableValue("framesSent")] = EncodableValue(static_cast<int64_t>(stats.framesSent));
+			map[EncodableValue("keepAliveFrames")] = EncodableValue(static_cast<int64_t>(stats.keepAliveFrames));
+			map[EncodableValue("framesSuperseded")] = EncodableValue(static_cast<int64_t>(stats.framesSuperseded));
+			map[EncodableValue("sendErrors")] = EncodableValue(static_cast<int64_t>(stats.sendErrors));
+			map[EncodableValue("lastChangedTiles")] = EncodableValue(static_cast<int64_t>(stats.lastChangedTiles));
+			map[EncodableValue("tileCount")] = EncodableValue(static_cast<int64_t>(stats.tileCount));
+			map[EncodableValue("meanHashUs")] = EncodableValue(static_cast<int64_t>(stats.meanHashUs));
+			map[EncodableValue("meanConvertUs")] = EncodableValue(static_cast<int64_t>(stats.meanConvertUs));
+
+			result->Success(EncodableValue(map));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
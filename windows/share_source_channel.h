@@ -0,0 +1,44 @@
+#ifndef FLUTTER_PLUGIN_SHARE_SOURCE_CHANNEL_H_
+#define FLUTTER_PLUGIN_SHARE_SOURCE_CHANNEL_H_
+
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <meeting_service_interface.h>
+
+#include <functional>
+#include <memory>
+
+#include "media/external_share_source.h"
+
+namespace flutter_zoom_sdk {
+
+	// Shares frames rendered by Flutter through setExternalShareSource,
+	// sending only when their content changes.
+	class ShareSourceChannel {
+	public:
+		using MeetingServiceGetter = std::function<ZOOM_SDK_NAMESPACE::IMeetingService*()>;
+
+		explicit ShareSourceChannel(MeetingServiceGetter meetingService);
+
+		~ShareSourceChannel();
+
+		ShareSourceChannel(const ShareSourceChannel&) = delete;
+		ShareSourceChannel& operator=(const ShareSourceChannel&) = delete;
+
+		// Handles the share_source_* methods. Returns false, leaving result
+		// untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+	private:
+		bool stopShare();
+
+		MeetingServiceGetter meetingService_;
+		ExternalShareSource source_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_SHARE_SOURCE_CHANNEL_H_
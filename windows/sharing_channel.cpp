@@ -0,0 +1,56 @@
+#include "sharing_channel.h"
+
+namespace flutter_zoom_sdk {
+
+	namespace {
+		constexpr char kChannelName[] = "flutter_zoom_sdk/sharing";
+
+		constexpr size_t kMaxPendingEvents = 16;
+	}
+
+	SharingChannel::Events::Events(DomainEventChannel& events)
+		: events_(events) {}
+
+	void SharingChannel::Events::onSharingStatus(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) {
+		send(SharingEventKind::Status, shareInfo.userid, shareInfo.shareSourceID, static_cast<int32_t>(shareInfo.status));
+	}
+
+	void SharingChannel::Events::onShareContentNotification(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) {
+		send(SharingEventKind::Content, shareInfo.userid, shareInfo.shareSourceID, static_cast<int32_t>(shareInfo.contentType));
+	}
+
+	void SharingChannel::Events::onLockShareStatus(bool bLocked) {
+		send(SharingEventKind::Locked, 0, 0, bLocked ? 1 : 0);
+	}
+
+	void SharingChannel::Events::onFailedToStartShare() {
+		send(SharingEventKind::FailedToStart, 0, 0, 0);
+	}
+
+	void SharingChannel::Events::send(SharingEventKind kind, uint32_t userId, uint32_t sourceId, int32_t value) {
+		DomainEvent event;
+		event.kind = static_cast<uint8_t>(kind);
+		event.userId = userId;
+		event.otherId = sourceId;
+		event.value = value;
+		events_.send(event);
+	}
+
+	SharingChannel::SharingChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, ShareEventFanout& shareEvents)
+		: shareEvents_(shareEvents),
+		events_(messenger, dispatcher, kChannelName, kMaxPendingEvents,
+			[this](bool listening) {
+				if (listening) {
+					shareEvents_.add(&listener_);
+				}
+				else {
+					shareEvents_.remove(&listener_);
+				}
+			}),
+		listener_(events_) {}
+
+	SharingChannel::~SharingChannel() {
+		shareEvents_.remove(&listener_);
+	}
+
+}  // namespace flutter_zoom_sdk
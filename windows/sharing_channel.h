@@ -0,0 +1,53 @@
+#ifndef FLUTTER_PLUGIN_SHARING_CHANNEL_H_
+#define FLUTTER_PLUGIN_SHARING_CHANNEL_H_
+
+#include <flutter/binary_messenger.h>
+
+#include "domain_event_channel.h"
+#include "meeting/meeting_event_fanout.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Sends every share start, stop and lock on the "flutter_zoom_sdk/sharing"
+	// event channel as DomainEvents of SharingEventKind; meeting_state keeps
+	// only the latest. Listens on shareEvents, which the caller sets on the
+	// share controller, only while Dart listens.
+	class SharingChannel {
+	public:
+		SharingChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, ShareEventFanout& shareEvents);
+
+		~SharingChannel();
+
+		SharingChannel(const SharingChannel&) = delete;
+		SharingChannel& operator=(const SharingChannel&) = delete;
+
+	private:
+		class Events : public ZOOM_SDK_NAMESPACE::IMeetingShareCtrlEvent {
+		public:
+			explicit Events(DomainEventChannel& events);
+
+			void onSharingStatus(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) override;
+			void onFailedToStartShare() override;
+			void onLockShareStatus(bool bLocked) override;
+			void onShareContentNotification(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) override;
+			void onMultiShareSwitchToSingleShareNeedConfirm(ZOOM_SDK_NAMESPACE::IShareSwitchMultiToSingleConfirmHandler* handler_) override {}
+			void onShareSettingTypeChangedNotification(ZOOM_SDK_NAMESPACE::ShareSettingType type) override {}
+			void onSharedVideoEnded() override {}
+			void onVideoFileSharePlayError(ZOOM_SDK_NAMESPACE::ZoomSDKVideoFileSharePlayError error) override {}
+			void onOptimizingShareForVideoClipStatusChanged(ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo shareInfo) override {}
+
+		private:
+			void send(SharingEventKind kind, uint32_t userId, uint32_t sourceId, int32_t value);
+
+			DomainEventChannel& events_;
+		};
+
+		ShareEventFanout& shareEvents_;
+		DomainEventChannel events_;
+		Events listener_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_SHARING_CHANNEL_H_
@@ -0,0 +1,281 @@
+#include "speaker_channel.h"
+
+#include <chrono>
+#include <cstring>
+#include <string>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	namespace {
+		constexpr char kChannelName[] = "flutter_zoom_sdk/speaker";
+
+		// Speaker changes are rare; a late update is superseded by the next.
+		constexpr size_t kMaxPendingUpdates = 4;
+		constexpr size_t kUpdateBufferSize = 256;
+		constexpr size_t kIdleUpdateBuffers = 2;
+
+		// Signals between ticks are decided together.
+		constexpr auto kTickInterval = std::chrono::milliseconds(100);
+
+		constexpr int64_t kMaxDurationMs = 60000;
+		constexpr int64_t kMaxRecentCount = 64;
+
+		template <typename T>
+		void putLE(uint8_t* dst, T value) {
+			std::memcpy(dst, &value, sizeof(T));
+		}
+
+		uint64_t nowMs() {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+	}
+
+	SpeakerChannel::Events::Events(SpeakerChannel& owner)
+		: owner_(owner) {}
+
+	void SpeakerChannel::Events::onUserActiveAudioChange(ZOOM_SDK_NAMESPACE::IList<unsigned int>* plstActiveAudio) {
+		std::vector<uint32_t> active;
+		const int count = plstActiveAudio ? plstActiveAudio->GetCount() : 0;
+		active.reserve(count > 0 ? count : 0);
+		for (int i = 0; i < count; i++) {
+			active.push_back(plstActiveAudio->GetItem(i));
+		}
+		owner_.tracker_.activeAudio(active.data(), active.size(), nowMs());
+		owner_.schedule();
+	}
+
+	void SpeakerChannel::Events::onActiveSpeakerVideoUserChanged(unsigned int userid) {
+		owner_.tracker_.activeSpeaker(userid, nowMs());
+		owner_.schedule();
+	}
+
+	void SpeakerChannel::Events::onActiveVideoUserChanged(unsigned int userid) {
+		owner_.tracker_.activeVideo(userid, nowMs());
+		owner_.schedule();
+	}
+
+	void SpeakerChannel::Events::onRosterLeft(uint32_t id) {
+		owner_.tracker_.remove(id);
+		owner_.schedule();
+	}
+
+	void SpeakerChannel::Events::onRosterCleared() {
+		// The meeting is over; Dart hears that nobody speaks.
+		const bool speaking = owner_.tracker_.current() != 0 || !owner_.tracker_.recent().empty();
+		owner_.tracker_.reset();
+		if (speaking) {
+			PooledBuffer update = owner_.pool_->acquire();
+			owner_.writeUpdate(*update, BinaryEventChannel::kEnvelopePrefix, ++owner_.sequence_);
+			owner_.events_.send(std::move(update));
+			if (owner_.speakerChanged_) {
+				owner_.speakerChanged_(0);
+			}
+		}
+	}
+
+	SpeakerChannel::SpeakerChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, AudioRawDataHub& hub,
+		AudioEventFanout& audioEvents, VideoEventFanout& videoEvents, RosterStore& roster, RosterWanted rosterWanted,
+		SpeakerChanged speakerChanged)
+		: dispatcher_(dispatcher),
+		hub_(hub),
+		audioEvents_(audioEvents),
+		videoEvents_(videoEvents),
+		roster_(roster),
+		rosterWanted_(std::move(rosterWanted)),
+		speakerChanged_(std::move(speakerChanged)),
+		events_(messenger, dispatcher, kChannelName, kMaxPendingUpdates,
+			[this](bool listening) {
+				listening_ = listening;
+				update();
+			}),
+		pool_(BufferPool::create(kUpdateBufferSize, kIdleUpdateBuffers)),
+		listener_(*this),
+		tickTimer_(0),
+		sequence_(0),
+		listening_(false),
+		followed_(false),
+		active_(false),
+		levelsWanted_(false) {
+		roster_.addObserver(&listener_);
+	}
+
+	SpeakerChannel::~SpeakerChannel() {
+		setLevels(false);
+		roster_.removeObserver(&listener_);
+		videoEvents_.remove(&listener_);
+		audioEvents_.remove(&listener_);
+		if (tickTimer_ != 0) {
+			dispatcher_.cancelDelayed(tickTimer_);
+		}
+	}
+
+	void SpeakerChannel::setFollowed(bool followed) {
+		followed_ = followed;
+		update();
+	}
+
+	void SpeakerChannel::update() {
+		const bool active = listening_ || followed_;
+		if (active == active_) {
+			return;
+		}
+		active_ = active;
+
+		if (active) {
+			audioEvents_.add(&listener_);
+			videoEvents_.add(&listener_);
+			if (rosterWanted_) {
+				rosterWanted_(true);
+			}
+			setLevels(levelsWanted_);
+			return;
+		}
+
+		setLevels(false);
+		videoEvents_.remove(&listener_);
+		audioEvents_.remove(&listener_);
+		if (rosterWanted_) {
+			rosterWanted_(false);
+		}
+		// Evidence from before the pause would decide the next speaker.
+		tracker_.reset();
+		if (tickTimer_ != 0) {
+			dispatcher_.cancelDelayed(tickTimer_);
+			tickTimer_ = 0;
+		}
+	}
+
+	void SpeakerChannel::schedule() {
+		if (tickTimer_ != 0) {
+			return;
+		}
+		tickTimer_ = dispatcher_.postDelayed(kTickInterval, [this]() {
+			tickTimer_ = 0;
+			tick();
+		});
+		if (tickTimer_ == 0) {
+			dispatcher_.post([this]() { tick(); });
+		}
+	}
+
+	void SpeakerChannel::tick() {
+		const uint64_t now = nowMs();
+		if (levels_) {
+			levels_->drain(drained_);
+			for (const SpeakerLevels::Level& level : drained_) {
+				tracker_.audioLevel(level.first, level.second, now);
+			}
+		}
+
+		const uint32_t previous = tracker_.current();
+		if (tracker_.update(now)) {
+			PooledBuffer update = pool_->acquire();
+			writeUpdate(*update, BinaryEventChannel::kEnvelopePrefix, ++sequence_);
+			events_.send(std::move(update));
+			if (tracker_.current() != previous && speakerChanged_) {
+				speakerChanged_(tracker_.current());
+			}
+		}
+
+		// Levels keep arriving without events, and decaying evidence can still
+		// hand over the floor.
+		if (levels_ || tracker_.active()) {
+			schedule();
+		}
+	}
+
+	void SpeakerChannel::setLevels(bool enabled) {
+		const AudioStreamKey key{ AudioStreamKind::OneWay, kAnyStreamId };
+		if (enabled && !levels_) {
+			levels_ = std::make_shared<SpeakerLevels>();
+			hub_.addConsumer(key, levels_);
+			schedule();
+		}
+		else if (!enabled && levels_) {
+			hub_.removeConsumer(key, levels_);
+			levels_.reset();
+		}
+	}
+
+	void SpeakerChannel::writeUpdate(std::vector<uint8_t>& out, size_t reservedPrefix, uint64_t sequence) const {
+		const std::vector<uint32_t>& recent = tracker_.recent();
+		out.resize(reservedPrefix + kSpeakerUpdateHeaderSize + recent.size() * sizeof(uint32_t));
+		uint8_t* header = out.data() + reservedPrefix;
+		header[0] = kSpeakerUpdateFormat;
+		header[1] = 0;
+		putLE<uint16_t>(header + 2, static_cast<uint16_t>(recent.size()));
+		putLE<uint32_t>(header + 4, tracker_.current());
+		putLE<uint64_t>(header + 8, sequence);
+		for (size_t i = 0; i < recent.size(); i++) {
+			putLE<uint32_t>(header + kSpeakerUpdateHeaderSize + i * sizeof(uint32_t), recent[i]);
+		}
+	}
+
+	bool SpeakerChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		if (method.compare("speaker_configure") == 0) {
+			SpeakerTrackerConfig config = tracker_.config();
+			bool levels = levelsWanted_;
+			if (arguments) {
+				int64_t holdMs = config.holdMs;
+				int64_t debounceMs = config.debounceMs;
+				int64_t halfLifeMs = config.halfLifeMs;
+				int64_t recentCount = static_cast<int64_t>(config.recentCount);
+				double hysteresis = config.hysteresis;
+				double minScore = config.minScore;
+				IntArgument(*arguments, "holdMs", holdMs);
+				IntArgument(*arguments, "debounceMs", debounceMs);
+				IntArgument(*arguments, "halfLifeMs", halfLifeMs);
+				IntArgument(*arguments, "recentCount", recentCount);
+				DoubleArgument(*arguments, "hysteresis", hysteresis);
+				DoubleArgument(*arguments, "minScore", minScore);
+				BoolArgument(*arguments, "audioLevels", levels);
+				if (holdMs < 0 || holdMs > kMaxDurationMs || debounceMs < 0 || debounceMs > kMaxDurationMs
+					|| halfLifeMs < 0 || halfLifeMs > kMaxDurationMs || recentCount < 0 || recentCount > kMaxRecentCount
+					|| !(hysteresis >= 0.0) || !(minScore >= 0.0)) {
+					result->Error("INVALID_ARGUMENTS", "Expected durations up to 60000 ms, up to 64 recent speakers and non-negative scores");
+					return true;
+				}
+				config.holdMs = static_cast<uint32_t>(holdMs);
+				config.debounceMs = static_cast<uint32_t>(debounceMs);
+				config.halfLifeMs = static_cast<uint32_t>(halfLifeMs);
+				config.recentCount = static_cast<size_t>(recentCount);
+				config.hysteresis = static_cast<float>(hysteresis);
+				config.minScore = static_cast<float>(minScore);
+			}
+			tracker_.configure(config);
+			levelsWanted_ = levels;
+			if (active_) {
+				setLevels(levels);
+				schedule();
+			}
+			result->Success(EncodableValue(true));
+			return true;
+		}
+		else if (method.compare("speaker_current") == 0) {
+			std::vector<uint8_t> update;
+			writeUpdate(update, 0, sequence_);
+			result->Success(EncodableValue(update));
+			return true;
+		}
+		else if (method.compare("speaker_stats") == 0) {
+			EncodableMap map;
+			map[EncodableValue("signalChanges")] = EncodableValue(static_cast<int64_t>(tracker_.signalChanges()));
+			map[EncodableValue("switches")] = EncodableValue(static_cast<int64_t>(tracker_.switches()));
+			result->Success(EncodableValue(map));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,146 @@
+#ifndef FLUTTER_PLUGIN_SPEAKER_CHANNEL_H_
+#define FLUTTER_PLUGIN_SPEAKER_CHANNEL_H_
+
+#include <flutter/binary_messenger.h>
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <meeting_service_components/meeting_audio_interface.h>
+#include <meeting_service_components/meeting_video_interface.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "binary_event_channel.h"
+#include "media/audio_raw_data_hub.h"
+#include "media/buffer_pool.h"
+#include "meeting/meeting_event_fanout.h"
+#include "meeting/roster_store.h"
+#include "meeting/speaker_levels.h"
+#include "meeting/speaker_tracker.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Layout of every speaker update, all little-endian:
+	//   0  u8   format (kSpeakerUpdateFormat)
+	//   1  u8   reserved, 0
+	//   2  u16  recent speaker count
+	//   4  u32  current speaker, 0 for none
+	//   8  u64  sequence, counting updates; speaker_current repeats the last
+	//   16 u32  recent speakers, the one who held the floor last first
+	constexpr uint8_t kSpeakerUpdateFormat = 1;
+	constexpr size_t kSpeakerUpdateHeaderSize = 16;
+
+	// Dart side of SpeakerTracker. Follows the active speaker, active video
+	// and active audio events, and one-way audio levels when asked, and sends
+	// the stable current speaker and recent speakers on the
+	// "flutter_zoom_sdk/speaker" event channel as Uint8List events, only when
+	// they change. Tracks only while Dart listens or setFollowed(true).
+	class SpeakerChannel {
+	public:
+		// Called on the platform thread with the new current speaker.
+		using SpeakerChanged = std::function<void(uint32_t userId)>;
+
+		// Called with true while the channel needs the roster followed.
+		using RosterWanted = std::function<void(bool wanted)>;
+
+		// Listens on audioEvents and videoEvents, which the caller sets on the
+		// controllers, and forgets users as they leave the roster.
+		SpeakerChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher, AudioRawDataHub& hub,
+			AudioEventFanout& audioEvents, VideoEventFanout& videoEvents, RosterStore& roster, RosterWanted rosterWanted,
+			SpeakerChanged speakerChanged);
+
+		~SpeakerChannel();
+
+		SpeakerChannel(const SpeakerChannel&) = delete;
+		SpeakerChannel& operator=(const SpeakerChannel&) = delete;
+
+		// Handles the speaker_* methods. Returns false, leaving result
+		// untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+		uint32_t current() const { return tracker_.current(); }
+
+		// A native feature follows the speaker through speakerChanged, so the
+		// tracker runs even while Dart does not listen.
+		void setFollowed(bool followed);
+
+	private:
+		class Events : public ZOOM_SDK_NAMESPACE::IMeetingAudioCtrlEvent,
+			public ZOOM_SDK_NAMESPACE::IMeetingVideoCtrlEvent,
+			public RosterObserver {
+		public:
+			explicit Events(SpeakerChannel& owner);
+
+			void onUserAudioStatusChange(ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::IUserAudioStatus*>* lstAudioStatusChange, const zchar_t* strAudioStatusList = nullptr) override {}
+			void onUserActiveAudioChange(ZOOM_SDK_NAMESPACE::IList<unsigned int>* plstActiveAudio) override;
+			void onHostRequestStartAudio(ZOOM_SDK_NAMESPACE::IRequestStartAudioHandler* handler_) override {}
+			void onJoin3rdPartyTelephonyAudio(const zchar_t* audioInfo) override {}
+			void onMuteOnEntryStatusChange(bool bEnabled) override {}
+
+			void onUserVideoStatusChange(unsigned int userId, ZOOM_SDK_NAMESPACE::VideoStatus status) override {}
+			void onSpotlightedUserListChangeNotification(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstSpotlightedUserID) override {}
+			void onHostRequestStartVideo(ZOOM_SDK_NAMESPACE::IRequestStartVideoHandler* handler_) override {}
+			void onActiveSpeakerVideoUserChanged(unsigned int userid) override;
+			void onActiveVideoUserChanged(unsigned int userid) override;
+			void onHostVideoOrderUpdated(ZOOM_SDK_NAMESPACE::IList<unsigned int>* orderList) override {}
+			void onLocalVideoOrderUpdated(ZOOM_SDK_NAMESPACE::IList<unsigned int>* localOrderList) override {}
+			void onFollowHostVideoOrderChanged(bool bFollow) override {}
+			void onUserVideoQualityChanged(ZOOM_SDK_NAMESPACE::VideoConnectionQuality quality, unsigned int userid) override {}
+			void onVideoAlphaChannelStatusChanged(bool isAlphaModeOn) override {}
+			void onCameraControlRequestReceived(unsigned int userId, ZOOM_SDK_NAMESPACE::CameraControlRequestType requestType,
+				ZOOM_SDK_NAMESPACE::ICameraControlRequestHandler* pHandler) override {}
+			void onCameraControlRequestResult(unsigned int userId, ZOOM_SDK_NAMESPACE::CameraControlRequestResult result) override {}
+
+			void onRosterJoined(uint32_t id) override {}
+			void onRosterLeft(uint32_t id) override;
+			void onRosterChanged(uint32_t id, uint16_t fields) override {}
+			void onRosterCleared() override;
+
+		private:
+			SpeakerChannel& owner_;
+		};
+
+		// Runs the tracker and keeps ticking while its evidence decays.
+		void tick();
+
+		void schedule();
+
+		// Starts or stops tracking as listening and following change.
+		void update();
+
+		void setLevels(bool enabled);
+
+		void writeUpdate(std::vector<uint8_t>& out, size_t reservedPrefix, uint64_t sequence) const;
+
+		PlatformDispatcher& dispatcher_;
+		AudioRawDataHub& hub_;
+		AudioEventFanout& audioEvents_;
+		VideoEventFanout& videoEvents_;
+		RosterStore& roster_;
+		const RosterWanted rosterWanted_;
+		const SpeakerChanged speakerChanged_;
+		BinaryEventChannel events_;
+		std::shared_ptr<BufferPool> pool_;
+
+		SpeakerTracker tracker_;
+		Events listener_;
+		std::shared_ptr<SpeakerLevels> levels_;
+		std::vector<SpeakerLevels::Level> drained_;
+		UINT_PTR tickTimer_;
+		uint64_t sequence_;
+		bool listening_;
+		bool followed_;
+		bool active_;
+		// What speaker_configure asked for; levels run only while active.
+		bool levelsWanted_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_SPEAKER_CHANNEL_H_
@@ -0,0 +1,577 @@
+// Replays a callback journal (.zcj, written by CallbackJournal) into the
+// plugin's listener classes against a stub SDK, for deterministic offline
+// reproduction and benchmarking of the native event path:
+//   - audio, video, share, recording, chat, caption and participants
+//     callbacks through their fanouts;
+//   - the roster tracker, answered from the participant snapshots in the
+//     journal, into the store, its index, RosterSync and the audio and video
+//     status bits;
+//   - the meeting state tracker and the active speaker tracker.
+// Updates are flushed every 100 ms of journal time, as the channels batch
+// them. Prints throughput, per-callback latency and a checksum of every
+// update produced; the checksum depends only on the journal, so two runs
+// must print the same one. --speed 0 (the default) replays as fast as
+// possible, 1 at the recorded pace.
+//
+//   callback_replay [--speed X] [--repeat N] JOURNAL
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "meeting/av_status_bits.h"
+#include "meeting/av_status_tracker.h"
+#include "meeting/callback_journal_reader.h"
+#include "meeting/meeting_event_fanout.h"
+#include "meeting/meeting_state.h"
+#include "meeting/meeting_state_tracker.h"
+#include "meeting/roster_index.h"
+#include "meeting/roster_store.h"
+#include "meeting/roster_sync.h"
+#include "meeting/roster_tracker.h"
+#include "meeting/speaker_tracker.h"
+#include "stub_meeting.h"
+
+using namespace flutter_zoom_sdk;
+
+namespace {
+	using Clock = std::chrono::steady_clock;
+
+	constexpr uint64_t kFlushIntervalUs = 100000;
+	constexpr uint64_t kFnvOffset = 14695981039346656037ull;
+	constexpr uint64_t kFnvPrime = 1099511628211ull;
+
+	struct Options {
+		double speed = 0.0;
+		int repeat = 1;
+		std::string path;
+	};
+
+	bool parseOptions(int argc, char** argv, Options& options) {
+		for (int i = 1; i < argc; i++) {
+			const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+			if (std::strcmp(argv[i], "--speed") == 0 && value) {
+				options.speed = std::strcmp(value, "max") == 0 ? 0.0 : std::atof(value);
+				i++;
+			}
+			else if (std::strcmp(argv[i], "--repeat") == 0 && value) {
+				options.repeat = std::atoi(value);
+				i++;
+			}
+			else if (argv[i][0] == '-' || !options.path.empty()) {
+				return false;
+			}
+			else {
+				options.path = argv[i];
+			}
+		}
+		return !options.path.empty() && options.speed >= 0.0 && options.repeat > 0;
+	}
+
+	// Samples in nanoseconds.
+	class Percentiles {
+	public:
+		void add(int64_t ns) { samples_.push_back(std::max<int64_t>(ns, 0)); }
+
+		void print(const char* name) {
+			if (samples_.empty()) {
+				std::printf("  %-16s no samples\n", name);
+				return;
+			}
+			std::sort(samples_.begin(), samples_.end());
+			const auto at = [this](double q) {
+				return samples_[std::min(samples_.size() - 1, static_cast<size_t>(q * samples_.size()))] / 1000.0;
+			};
+			std::printf("  %-16s p50=%9.2f us  p99=%9.2f us  max=%9.2f us  (n=%zu)\n", name,
+				at(0.50), at(0.99), samples_.back() / 1000.0, samples_.size());
+		}
+
+	private:
+		std::vector<int64_t> samples_;
+	};
+
+	uint64_t fnv(uint64_t hash, const uint8_t* data, size_t size) {
+		for (size_t i = 0; i < size; i++) {
+			hash = (hash ^ data[i]) * kFnvPrime;
+		}
+		return hash;
+	}
+
+	// The user ids of a list field: a count, then the ids.
+	size_t readIds(const CallbackRecord& record, size_t at, tools::StubList<unsigned int>& list) {
+		list.items.clear();
+		const size_t count = at < record.fields.size() ? static_cast<size_t>(record.fields[at]) : 0;
+		for (size_t i = 0; i < count && at + 1 + i < record.fields.size(); i++) {
+			list.items.push_back(static_cast<unsigned int>(record.fields[at + 1 + i]));
+		}
+		return at + 1 + count;
+	}
+
+	ZOOM_SDK_NAMESPACE::ChatStatus chatStatus(uint64_t bits) {
+		const bool role[4] = { (bits & kCallbackChatStatusRole0) != 0, (bits & kCallbackChatStatusRole1) != 0,
+			(bits & kCallbackChatStatusRole2) != 0, (bits & kCallbackChatStatusRole3) != 0 };
+		ZOOM_SDK_NAMESPACE::ChatStatus status;
+		status.is_chat_off = (bits & kCallbackChatStatusOff) != 0;
+		status.is_webinar_attendee = (bits & kCallbackChatStatusWebinarAttendee) != 0;
+		status.is_webinar_meeting = (bits & kCallbackChatStatusWebinar) != 0;
+		if (!status.is_webinar_meeting) {
+			status.ut.normal_meeting_status.can_chat = role[0];
+			status.ut.normal_meeting_status.can_chat_to_all = role[1];
+			status.ut.normal_meeting_status.can_chat_to_individual = role[2];
+			status.ut.normal_meeting_status.is_only_can_chat_to_host = role[3];
+		}
+		else if (status.is_webinar_attendee) {
+			status.ut.webinar_attendee_status.can_chat = role[0];
+			status.ut.webinar_attendee_status.can_chat_to_all_panellist_and_attendee = role[1];
+			status.ut.webinar_attendee_status.can_chat_to_all_panellist = role[2];
+		}
+		else {
+			status.ut.webinar_other_status.can_chat_to_all_panellist = role[0];
+			status.ut.webinar_other_status.can_chat_to_all_panellist_and_attendee = role[1];
+			status.ut.webinar_other_status.can_chat_to_individual = role[2];
+		}
+		return status;
+	}
+
+	// Feeds the speaker tracker as SpeakerChannel does, on the journal's
+	// clock so the outcome does not depend on the replay speed.
+	class SpeakerEvents : public ZOOM_SDK_NAMESPACE::IMeetingAudioCtrlEvent,
+		public ZOOM_SDK_NAMESPACE::IMeetingVideoCtrlEvent,
+		public RosterObserver {
+	public:
+		SpeakerEvents(SpeakerTracker& tracker, const uint64_t& nowMs) : tracker_(tracker), nowMs_(nowMs) {}
+
+		void onUserAudioStatusChange(ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::IUserAudioStatus*>* lstAudioStatusChange, const zchar_t* strAudioStatusList = nullptr) override {}
+		void onUserActiveAudioChange(ZOOM_SDK_NAMESPACE::IList<unsigned int>* plstActiveAudio) override {
+			active_.clear();
+			const int count = plstActiveAudio ? plstActiveAudio->GetCount() : 0;
+			for (int i = 0; i < count; i++) {
+				active_.push_back(plstActiveAudio->GetItem(i));
+			}
+			tracker_.activeAudio(active_.data(), active_.size(), nowMs_);
+		}
+		void onHostRequestStartAudio(ZOOM_SDK_NAMESPACE::IRequestStartAudioHandler* handler_) override {}
+		void onJoin3rdPartyTelephonyAudio(const zchar_t* audioInfo) override {}
+		void onMuteOnEntryStatusChange(bool bEnabled) override {}
+
+		void onUserVideoStatusChange(unsigned int userId, ZOOM_SDK_NAMESPACE::VideoStatus status) override {}
+		void onSpotlightedUserListChangeNotification(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstSpotlightedUserID) override {}
+		void onHostRequestStartVideo(ZOOM_SDK_NAMESPACE::IRequestStartVideoHandler* handler_) override {}
+		void onActiveSpeakerVideoUserChanged(unsigned int userid) override { tracker_.activeSpeaker(userid, nowMs_); }
+		void onActiveVideoUserChanged(unsigned int userid) override { tracker_.activeVideo(userid, nowMs_); }
+		void onHostVideoOrderUpdated(ZOOM_SDK_NAMESPACE::IList<unsigned int>* orderList) override {}
+		void onLocalVideoOrderUpdated(ZOOM_SDK_NAMESPACE::IList<unsigned int>* localOrderList) override {}
+		void onFollowHostVideoOrderChanged(bool bFollow) override {}
+		void onUserVideoQualityChanged(ZOOM_SDK_NAMESPACE::VideoConnectionQuality quality, unsigned int userid) override {}
+		void onVideoAlphaChannelStatusChanged(bool isAlphaModeOn) override {}
+		void onCameraControlRequestReceived(unsigned int userId, ZOOM_SDK_NAMESPACE::CameraControlRequestType requestType,
+			ZOOM_SDK_NAMESPACE::ICameraControlRequestHandler* pHandler) override {}
+		void onCameraControlRequestResult(unsigned int userId, ZOOM_SDK_NAMESPACE::CameraControlRequestResult result) override {}
+
+		void onRosterJoined(uint32_t id) override {}
+		void onRosterLeft(uint32_t id) override { tracker_.remove(id); }
+		void onRosterChanged(uint32_t id, uint16_t fields) override {}
+		void onRosterCleared() override { tracker_.reset(); }
+
+	private:
+		SpeakerTracker& tracker_;
+		const uint64_t& nowMs_;
+		std::vector<uint32_t> active_;
+	};
+
+	struct RunStats {
+		uint64_t callbacks = 0;
+		uint64_t countedOnly = 0;
+		uint64_t unknown = 0;
+		uint64_t updates = 0;
+		uint64_t updateBytes = 0;
+		uint64_t checksum = kFnvOffset;
+		uint64_t journalUs = 0;
+		double seconds = 0.0;
+		bool truncated = false;
+	};
+
+	// The stub SDK and the plugin's listeners for one pass over the journal.
+	class Replay {
+	public:
+		Replay()
+			: tracker_(store_, [this](uint32_t id) { return lookup(id); }),
+			index_(store_),
+			sync_(store_, nullptr),
+			avStatus_(avBits_, store_, nullptr),
+			stateTracker_(state_, store_),
+			speakerEvents_(speaker_, nowMs_) {
+			store_.addObserver(&index_);
+			store_.addObserver(&sync_);
+			store_.addObserver(&avStatus_);
+			store_.addObserver(&stateTracker_);
+			store_.addObserver(&speakerEvents_);
+			participantsEvents_.add(&tracker_);
+			audioEvents_.add(&avStatus_);
+			audioEvents_.add(&speakerEvents_);
+			videoEvents_.add(&avStatus_);
+			videoEvents_.add(&speakerEvents_);
+			shareEvents_.add(&stateTracker_);
+			recordingEvents_.add(&stateTracker_);
+			chatEvents_.add(&stateTracker_);
+			captionEvents_.add(&stateTracker_);
+		}
+
+		Replay(const Replay&) = delete;
+		Replay& operator=(const Replay&) = delete;
+
+		void run(CallbackJournalReader& reader, double speed, RunStats& stats, Percentiles& latency,
+			Percentiles& flushes, Percentiles& lag) {
+			CallbackRecord record;
+			uint64_t nextFlushUs = kFlushIntervalUs;
+			const Clock::time_point start = Clock::now();
+			while (reader.next(record)) {
+				if (speed > 0.0) {
+					const Clock::time_point due = start + std::chrono::microseconds(
+						static_cast<int64_t>(record.timeUs / speed));
+					std::this_thread::sleep_until(due);
+					lag.add(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - due).count());
+				}
+				while (record.timeUs >= nextFlushUs) {
+					timeFlush(nextFlushUs, stats, flushes);
+					nextFlushUs += kFlushIntervalUs;
+				}
+
+				nowMs_ = record.timeUs / 1000;
+				const Clock::time_point begin = Clock::now();
+				dispatch(record, reader, stats);
+				latency.add(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count());
+				stats.callbacks++;
+				stats.journalUs = record.timeUs;
+			}
+			timeFlush(stats.journalUs, stats, flushes);
+			stats.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+			stats.truncated = reader.truncated();
+		}
+
+	private:
+		ZOOM_SDK_NAMESPACE::IUserInfo* lookup(uint32_t id) {
+			auto it = users_.find(id);
+			return it == users_.end() ? nullptr : it->second.get();
+		}
+
+		void dispatch(const CallbackRecord& record, const CallbackJournalReader& reader, RunStats& stats) {
+			const std::vector<uint64_t>& f = record.fields;
+			const auto field = [&f](size_t i) { return i < f.size() ? f[i] : 0; };
+			const auto text = [&reader, &field](size_t i) { return FromUtf8(reader.string(field(i))); };
+
+			switch (record.kind) {
+			case CallbackKind::User: {
+				std::unique_ptr<tools::StubUserInfo>& user = users_[static_cast<uint32_t>(field(0))];
+				if (!user) {
+					user = std::make_unique<tools::StubUserInfo>(static_cast<unsigned int>(field(0)));
+				}
+				const uint64_t bits = field(3);
+				user->name = text(1);
+				user->role = static_cast<ZOOM_SDK_NAMESPACE::UserRole>(field(2));
+				user->myself = (bits & kCallbackUserMyself) != 0;
+				user->videoOn = (bits & kCallbackUserVideoOn) != 0;
+				user->muted = (bits & kCallbackUserMuted) != 0;
+				user->talking = (bits & kCallbackUserTalking) != 0;
+				user->handRaised = (bits & kCallbackUserHandRaised) != 0;
+				user->inWaitingRoom = (bits & kCallbackUserWaitingRoom) != 0;
+				user->phone = (bits & kCallbackUserPurePhone) != 0;
+				user->bot = (bits & kCallbackUserBot) != 0;
+				user->h323 = (bits & kCallbackUserH323) != 0;
+				user->interpreter = (bits & kCallbackUserInterpreter) != 0;
+				break;
+			}
+			case CallbackKind::MeetingStatus: {
+				const auto status = static_cast<ZOOM_SDK_NAMESPACE::MeetingStatus>(field(0));
+				stateTracker_.onMeetingStatus(status);
+				if (status == ZOOM_SDK_NAMESPACE::MEETING_STATUS_ENDED || status == ZOOM_SDK_NAMESPACE::MEETING_STATUS_FAILED
+					|| status == ZOOM_SDK_NAMESPACE::MEETING_STATUS_IDLE) {
+					// As ParticipantsChannel detaches.
+					store_.clear();
+				}
+				break;
+			}
+			case CallbackKind::StatisticsWarning:
+				stateTracker_.onStatisticsWarning(static_cast<ZOOM_SDK_NAMESPACE::StatisticsWarningType>(field(0)));
+				break;
+			case CallbackKind::RosterLoaded:
+				readIds(record, 0, ids_);
+				tracker_.load(&ids_);
+				break;
+			case CallbackKind::UserJoin:
+				readIds(record, 0, ids_);
+				participantsEvents_.onUserJoin(&ids_);
+				break;
+			case CallbackKind::UserLeft:
+				readIds(record, 0, ids_);
+				participantsEvents_.onUserLeft(&ids_);
+				break;
+			case CallbackKind::UserNamesChanged:
+				readIds(record, 0, ids_);
+				participantsEvents_.onUserNamesChanged(&ids_);
+				break;
+			case CallbackKind::HostChange:
+				participantsEvents_.onHostChangeNotification(static_cast<unsigned int>(field(0)));
+				break;
+			case CallbackKind::CoHostChange:
+				participantsEvents_.onCoHostChangeNotification(static_cast<unsigned int>(field(0)), field(1) != 0);
+				break;
+			case CallbackKind::HandStatus:
+				participantsEvents_.onLowOrRaiseHandStatusChanged(field(1) != 0, static_cast<unsigned int>(field(0)));
+				break;
+			case CallbackKind::AllHandsLowered:
+				participantsEvents_.onAllHandsLowered();
+				break;
+			case CallbackKind::AudioStatus: {
+				const size_t count = static_cast<size_t>(field(0));
+				audioStatuses_.resize(std::max(audioStatuses_.size(), count));
+				audioList_.items.clear();
+				for (size_t i = 0; i < count; i++) {
+					tools::StubAudioStatus& status = audioStatuses_[i];
+					status.id = static_cast<unsigned int>(field(1 + i * 3));
+					status.status = static_cast<ZOOM_SDK_NAMESPACE::AudioStatus>(field(2 + i * 3));
+					status.type = static_cast<ZOOM_SDK_NAMESPACE::AudioType>(field(3 + i * 3));
+					audioList_.items.push_back(&status);
+				}
+				audioEvents_.onUserAudioStatusChange(&audioList_);
+				break;
+			}
+			case CallbackKind::ActiveAudio:
+				readIds(record, 0, ids_);
+				audioEvents_.onUserActiveAudioChange(&ids_);
+				break;
+			case CallbackKind::VideoStatus:
+				videoEvents_.onUserVideoStatusChange(static_cast<unsigned int>(field(0)),
+					static_cast<ZOOM_SDK_NAMESPACE::VideoStatus>(field(1)));
+				break;
+			case CallbackKind::ActiveSpeakerVideo:
+				videoEvents_.onActiveSpeakerVideoUserChanged(static_cast<unsigned int>(field(0)));
+				break;
+			case CallbackKind::ActiveVideo:
+				videoEvents_.onActiveVideoUserChanged(static_cast<unsigned int>(field(0)));
+				break;
+			case CallbackKind::SpotlightedUsers:
+				readIds(record, 0, ids_);
+				videoEvents_.onSpotlightedUserListChangeNotification(&ids_);
+				break;
+			case CallbackKind::VideoQuality:
+				videoEvents_.onUserVideoQualityChanged(static_cast<ZOOM_SDK_NAMESPACE::VideoConnectionQuality>(field(1)),
+					static_cast<unsigned int>(field(0)));
+				break;
+			case CallbackKind::SharingStatus: {
+				ZOOM_SDK_NAMESPACE::ZoomSDKSharingSourceInfo info;
+				info.userid = static_cast<unsigned int>(field(0));
+				info.shareSourceID = static_cast<unsigned int>(field(1));
+				info.status = static_cast<ZOOM_SDK_NAMESPACE::SharingStatus>(field(2));
+				info.contentType = static_cast<ZOOM_SDK_NAMESPACE::ShareType>(field(3));
+				shareEvents_.onSharingStatus(info);
+				break;
+			}
+			case CallbackKind::ShareLocked:
+				shareEvents_.onLockShareStatus(field(0) != 0);
+				break;
+			case CallbackKind::RecordingStatus:
+				recordingEvents_.onRecordingStatus(static_cast<ZOOM_SDK_NAMESPACE::RecordingStatus>(field(0)));
+				break;
+			case CallbackKind::CloudRecordingStatus:
+				recordingEvents_.onCloudRecordingStatus(static_cast<ZOOM_SDK_NAMESPACE::RecordingStatus>(field(0)));
+				break;
+			case CallbackKind::RecordPrivilege:
+				recordingEvents_.onRecordPrivilegeChanged(field(0) != 0);
+				break;
+			case CallbackKind::ChatMessage: {
+				const uint64_t bits = field(8);
+				chatMessage_.messageId = text(0);
+				chatMessage_.senderId = static_cast<unsigned int>(field(1));
+				chatMessage_.senderName = text(2);
+				chatMessage_.receiverId = static_cast<unsigned int>(field(3));
+				chatMessage_.receiverName = text(4);
+				chatMessage_.content = text(5);
+				chatMessage_.time = static_cast<time_t>(CallbackJournalUnzigzag(field(6)));
+				chatMessage_.type = static_cast<ZOOM_SDK_NAMESPACE::SDKChatMessageType>(field(7));
+				chatMessage_.toAll = (bits & kCallbackChatToAll) != 0;
+				chatMessage_.toAllPanelists = (bits & kCallbackChatToAllPanelists) != 0;
+				chatMessage_.toWaitingRoom = (bits & kCallbackChatToWaitingRoom) != 0;
+				chatMessage_.comment = (bits & kCallbackChatComment) != 0;
+				chatEvents_.onChatMsgNotification(&chatMessage_, chatMessage_.content.c_str());
+				break;
+			}
+			case CallbackKind::ChatStatus: {
+				ZOOM_SDK_NAMESPACE::ChatStatus status = chatStatus(field(0));
+				chatEvents_.onChatStatusChangedNotification(&status);
+				break;
+			}
+			case CallbackKind::ChatMessageDeleted: {
+				const zstring messageId = text(0);
+				chatEvents_.onChatMsgDeleteNotification(messageId.c_str(),
+					static_cast<ZOOM_SDK_NAMESPACE::SDKChatMessageDeleteType>(field(1)));
+				break;
+			}
+			case CallbackKind::CaptionMessage: {
+				const zstring caption = text(1);
+				captionEvents_.onClosedCaptionMsgReceived(caption.c_str(), static_cast<unsigned int>(field(0)),
+					static_cast<time_t>(CallbackJournalUnzigzag(field(2))));
+				break;
+			}
+			case CallbackKind::LiveTranscriptionStatus:
+				captionEvents_.onLiveTranscriptionStatus(static_cast<ZOOM_SDK_NAMESPACE::SDKLiveTranscriptionStatus>(field(0)));
+				break;
+			case CallbackKind::LiveTranscriptionMessage:
+				transcription_.messageId = text(0);
+				transcription_.speakerId = static_cast<unsigned int>(field(1));
+				transcription_.speakerName = text(2);
+				transcription_.content = text(3);
+				transcription_.time = static_cast<time_t>(CallbackJournalUnzigzag(field(4)));
+				transcription_.operation = static_cast<ZOOM_SDK_NAMESPACE::SDKLiveTranscriptionOperationType>(field(5));
+				captionEvents_.onLiveTranscriptionMsgInfoReceived(&transcription_);
+				break;
+			case CallbackKind::CaptionStatus:
+				captionEvents_.onCaptionStatusChanged(field(0) != 0);
+				break;
+			case CallbackKind::ManualCaptionStatus:
+				captionEvents_.onManualCaptionStatusChanged(field(0) != 0);
+				break;
+			case CallbackKind::AuthResult:
+			case CallbackKind::Logout:
+			case CallbackKind::IdentityExpired:
+			case CallbackKind::MeetingParameter:
+			case CallbackKind::MeetingTopic:
+				// Only sent on to Dart, which the replay leaves out.
+				stats.countedOnly++;
+				break;
+			default:
+				stats.unknown++;
+				break;
+			}
+		}
+
+		void timeFlush(uint64_t timeUs, RunStats& stats, Percentiles& flushes) {
+			const Clock::time_point begin = Clock::now();
+			flush(timeUs, stats);
+			flushes.add(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin).count());
+		}
+
+		// What the channels send Dart once their update is due.
+		void flush(uint64_t timeUs, RunStats& stats) {
+			out_.clear();
+			if (sync_.flush(out_)) {
+				emit(stats);
+			}
+			out_.clear();
+			if (avBits_.flush(out_)) {
+				emit(stats);
+			}
+			if (state_.version() != stateVersion_) {
+				out_.clear();
+				state_.since(stateVersion_, out_);
+				stateVersion_ = state_.version();
+				emit(stats);
+			}
+			if (speaker_.update(timeUs / 1000)) {
+				out_.resize(sizeof(uint32_t));
+				const uint32_t current = speaker_.current();
+				std::memcpy(out_.data(), &current, sizeof(current));
+				emit(stats);
+			}
+		}
+
+		void emit(RunStats& stats) {
+			stats.updates++;
+			stats.updateBytes += out_.size();
+			stats.checksum = fnv(stats.checksum, out_.data(), out_.size());
+		}
+
+		std::unordered_map<uint32_t, std::unique_ptr<tools::StubUserInfo>> users_;
+		RosterStore store_;
+		RosterTracker tracker_;
+		RosterIndex index_;
+		RosterSync sync_;
+		AvStatusBits avBits_;
+		AvStatusTracker avStatus_;
+		MeetingState state_;
+		MeetingStateTracker stateTracker_;
+		SpeakerTracker speaker_;
+		uint64_t nowMs_ = 0;
+		SpeakerEvents speakerEvents_;
+		uint64_t stateVersion_ = 0;
+
+		ParticipantsEventFanout participantsEvents_;
+		AudioEventFanout audioEvents_;
+		VideoEventFanout videoEvents_;
+		ShareEventFanout shareEvents_;
+		RecordingEventFanout recordingEvents_;
+		ChatEventFanout chatEvents_;
+		CaptionEventFanout captionEvents_;
+
+		// Reused stub arguments.
+		tools::StubList<unsigned int> ids_;
+		std::vector<tools::StubAudioStatus> audioStatuses_;
+		tools::StubList<ZOOM_SDK_NAMESPACE::IUserAudioStatus*> audioList_;
+		tools::StubChatMsgInfo chatMessage_;
+		tools::StubTranscriptionMessage transcription_;
+		std::vector<uint8_t> out_;
+	};
+}
+
+int main(int argc, char** argv) {
+	Options options;
+	if (!parseOptions(argc, argv, options)) {
+		std::fprintf(stderr, "usage: callback_replay [--speed X] [--repeat N] JOURNAL\n");
+		return 2;
+	}
+
+	CallbackJournalReader reader;
+	if (!reader.open(options.path)) {
+		std::fprintf(stderr, "callback_replay: cannot read %s\n", options.path.c_str());
+		return 1;
+	}
+
+	Percentiles latency;
+	Percentiles flushes;
+	Percentiles lag;
+	RunStats first;
+	bool deterministic = true;
+	for (int pass = 0; pass < options.repeat; pass++) {
+		reader.rewind();
+		RunStats stats;
+		// Fresh listeners each pass, as for a new meeting.
+		auto replay = std::make_unique<Replay>();
+		replay->run(reader, options.speed, stats, latency, flushes, lag);
+
+		const double seconds = stats.seconds;
+		std::printf("pass %d: %llu callbacks over %.1f s of journal in %.3f s: %.0f callbacks/s, "
+			"%llu updates (%.1f KB), checksum %016llx%s\n",
+			pass + 1, static_cast<unsigned long long>(stats.callbacks), stats.journalUs / 1e6, seconds,
+			seconds > 0.0 ? stats.callbacks / seconds : 0.0, static_cast<unsigned long long>(stats.updates),
+			stats.updateBytes / 1024.0, static_cast<unsigned long long>(stats.checksum),
+			stats.truncated ? " (journal truncated)" : "");
+		if (pass == 0) {
+			first = stats;
+			if (stats.countedOnly > 0 || stats.unknown > 0) {
+				std::printf("  %llu auth and meeting info callbacks counted only, %llu unknown records skipped\n",
+					static_cast<unsigned long long>(stats.countedOnly), static_cast<unsigned long long>(stats.unknown));
+			}
+		}
+		else if (stats.checksum != first.checksum || stats.updates != first.updates) {
+			deterministic = false;
+		}
+	}
+
+	std::printf("latency\n");
+	latency.print("callback");
+	flushes.print("flush");
+	if (options.speed > 0.0) {
+		lag.print("schedule lag");
+	}
+	if (options.repeat > 1) {
+		std::printf("%s\n", deterministic ? "every pass produced the same updates" : "passes produced different updates");
+	}
+	return deterministic ? 0 : 1;
+}
@@ -0,0 +1,751 @@
+// Drives the plugin's native media paths with a simulated meeting, without
+// the SDK or Flutter, to size machines. A stub SDK runs:
+//   - N renderers, each emitting I420 at the chosen size and rate on its own
+//     thread into a renderer delegate that copies the frame into a pooled
+//     buffer, then scales it to a thumbnail and tile-hashes it on the worker
+//     pool;
+//   - M one-way audio streams, delivered every 10 ms on one audio thread
+//     through the AudioRawDataHub to the PCM streamer, the analyser and a
+//     mix of every stream;
+//   - roster churn: every few seconds a user leaves and another joins,
+//     through onUserJoin / onUserLeft, which subscribe and unsubscribe the
+//     user's streams.
+// Reports CPU per stream, dropped frames and latency percentiles.
+//
+//   load_generator [--video N] [--size WxH] [--fps F] [--audio M]
+//                  [--churn SECONDS] [--duration SECONDS] [--workers N]
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#include <time.h>
+#endif
+
+#include <rawdata/rawdata_renderer_interface.h>
+
+#include "media/audio_analyzer.h"
+#include "media/audio_mixer.h"
+#include "media/audio_raw_data_hub.h"
+#include "media/buffer_pool.h"
+#include "media/i420_image.h"
+#include "media/pcm_streamer.h"
+#include "media/tile_hash.h"
+#include "media/worker_pool.h"
+#include "stub_meeting.h"
+#include "stub_raw_data.h"
+
+using namespace flutter_zoom_sdk;
+
+namespace {
+	using Clock = std::chrono::steady_clock;
+
+	constexpr uint32_t kSampleRate = 32000;
+	constexpr size_t kAudioBlockFrames = kSampleRate / 100;  // 10 ms
+	constexpr auto kAudioInterval = std::chrono::milliseconds(10);
+	constexpr int kThumbnailWidth = 320;
+	constexpr int kThumbnailHeight = 180;
+	// Distinct frames each renderer cycles through, so tile hashes change.
+	constexpr size_t kRendererFrames = 8;
+	constexpr uint32_t kFirstUserId = 16778240;
+	constexpr uint32_t kMixId = 1;
+
+	struct Options {
+		int video = 9;
+		int width = 640;
+		int height = 360;
+		int fps = 15;
+		int audio = 9;
+		double churnSeconds = 2.0;
+		double durationSeconds = 20.0;
+		int workers = 0;
+	};
+
+	int64_t nowUs() {
+		return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch()).count();
+	}
+
+	// CPU time of the calling thread.
+	int64_t threadCpuNs() {
+#ifdef _WIN32
+		FILETIME creation, exit, kernel, user;
+		GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user);
+		const uint64_t ticks = (static_cast<uint64_t>(kernel.dwHighDateTime) << 32 | kernel.dwLowDateTime)
+			+ (static_cast<uint64_t>(user.dwHighDateTime) << 32 | user.dwLowDateTime);
+		return static_cast<int64_t>(ticks * 100);
+#else
+		timespec ts;
+		clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+		return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#endif
+	}
+
+	int64_t processCpuNs() {
+#ifdef _WIN32
+		FILETIME creation, exit, kernel, user;
+		GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+		const uint64_t ticks = (static_cast<uint64_t>(kernel.dwHighDateTime) << 32 | kernel.dwLowDateTime)
+			+ (static_cast<uint64_t>(user.dwHighDateTime) << 32 | user.dwLowDateTime);
+		return static_cast<int64_t>(ticks * 100);
+#else
+		rusage usage;
+		getrusage(RUSAGE_SELF, &usage);
+		return (static_cast<int64_t>(usage.ru_utime.tv_sec) + usage.ru_stime.tv_sec) * 1000000000
+			+ (static_cast<int64_t>(usage.ru_utime.tv_usec) + usage.ru_stime.tv_usec) * 1000;
+#endif
+	}
+
+	// Latency samples in microseconds, from any thread.
+	class Percentiles {
+	public:
+		void add(int64_t us) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			samples_.push_back(std::max<int64_t>(us, 0));
+		}
+
+		void print(const char* name) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (samples_.empty()) {
+				std::printf("  %-22s no samples\n", name);
+				return;
+			}
+			std::sort(samples_.begin(), samples_.end());
+			const auto at = [this](double q) {
+				return samples_[std::min(samples_.size() - 1, static_cast<size_t>(q * samples_.size()))];
+			};
+			std::printf("  %-22s p50=%7lld us  p95=%7lld us  p99=%7lld us  max=%7lld us  (n=%zu)\n", name,
+				static_cast<long long>(at(0.50)), static_cast<long long>(at(0.95)),
+				static_cast<long long>(at(0.99)), static_cast<long long>(samples_.back()), samples_.size());
+		}
+
+	private:
+		std::mutex mutex_;
+		std::vector<int64_t> samples_;
+	};
+
+	// Totals of one roster slot, across the users that held it.
+	struct SlotStats {
+		std::atomic<int64_t> cpuNs{ 0 };
+		std::atomic<uint64_t> frames{ 0 };
+		std::atomic<uint64_t> sdkDropped{ 0 };
+		std::atomic<uint64_t> queueDropped{ 0 };
+	};
+
+	struct Metrics {
+		std::vector<SlotStats> video;
+		std::vector<SlotStats> audio;
+		Percentiles videoLatency;
+		Percentiles videoCallback;
+		Percentiles audioCallback;
+		Percentiles joinHandling;
+		Percentiles leaveHandling;
+		std::atomic<uint64_t> audioLateTicks{ 0 };
+		std::atomic<uint64_t> pcmChunks{ 0 };
+		std::atomic<uint64_t> analysisFrames{ 0 };
+		std::atomic<uint64_t> joins{ 0 };
+		std::atomic<uint64_t> leaves{ 0 };
+
+		Metrics(size_t videoSlots, size_t audioSlots) : video(videoSlots), audio(audioSlots) {}
+	};
+
+	// Plugin side of one received video stream. The SDK thread only copies
+	// the frame into a pooled buffer; the thumbnail and tile hash run on the
+	// worker pool, one task per stream at a time, keeping only the newest
+	// frame when the pool falls behind.
+	class VideoPath : public ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate {
+	public:
+		VideoPath(WorkerPool& pool, SlotStats& slot, Metrics& metrics, int width, int height)
+			: state_(std::make_shared<State>(pool, slot, metrics, width, height)) {}
+
+		void onRendererBeDestroyed() override {}
+
+		void onRawDataStatusChanged(RawDataStatus status) override {}
+
+		void onRawDataFrameReceived(YUVRawDataI420* data) override {
+			const int64_t cpuStart = threadCpuNs();
+			const int64_t startUs = nowUs();
+			const int width = static_cast<int>(data->GetStreamWidth());
+			const int height = static_cast<int>(data->GetStreamHeight());
+
+			PooledBuffer buffer = state_->frames->acquire();
+			buffer->resize(I420BufferSize(width, height));
+			I420ConstPlanes source;
+			source.y = reinterpret_cast<const uint8_t*>(data->GetYBuffer());
+			source.u = reinterpret_cast<const uint8_t*>(data->GetUBuffer());
+			source.v = reinterpret_cast<const uint8_t*>(data->GetVBuffer());
+			source.strideY = width;
+			source.strideU = I420ChromaWidth(width);
+			source.strideV = source.strideU;
+			source.width = width;
+			source.height = height;
+			CopyI420(source, I420Planes::packed(buffer->data(), width, height));
+
+			bool post = false;
+			{
+				std::lock_guard<std::mutex> lock(state_->mutex);
+				if (state_->pending) {
+					state_->slot.queueDropped++;
+				}
+				state_->pending = std::move(buffer);
+				state_->pendingWidth = width;
+				state_->pendingHeight = height;
+				state_->pendingEmitUs = static_cast<int64_t>(data->GetTimeStamp());
+				post = !state_->scheduled;
+				state_->scheduled = true;
+			}
+			if (post) {
+				std::shared_ptr<State> state = state_;
+				state->pool.post([state]() { State::process(state); });
+			}
+
+			state_->metrics.videoCallback.add(nowUs() - startUs);
+			state_->slot.cpuNs += threadCpuNs() - cpuStart;
+		}
+
+	private:
+		struct State {
+			State(WorkerPool& pool, SlotStats& slot, Metrics& metrics, int width, int height)
+				: pool(pool), slot(slot), metrics(metrics),
+				frames(BufferPool::create(I420BufferSize(width, height), 3)),
+				thumbnail(I420BufferSize(kThumbnailWidth, kThumbnailHeight)) {}
+
+			static void process(const std::shared_ptr<State>& state) {
+				const int64_t cpuStart = threadCpuNs();
+				PooledBuffer frame;
+				int width = 0;
+				int height = 0;
+				int64_t emitUs = 0;
+				{
+					std::lock_guard<std::mutex> lock(state->mutex);
+					frame = std::move(state->pending);
+					width = state->pendingWidth;
+					height = state->pendingHeight;
+					emitUs = state->pendingEmitUs;
+				}
+
+				if (frame) {
+					ScaleI420(I420ConstPlanes::packed(frame->data(), width, height),
+						I420Planes::packed(state->thumbnail.data(), kThumbnailWidth, kThumbnailHeight));
+					state->hasher.update(frame->data(), width, width, height, 1);
+					state->slot.frames++;
+					state->metrics.videoLatency.add(nowUs() - emitUs);
+				}
+
+				bool again = false;
+				{
+					std::lock_guard<std::mutex> lock(state->mutex);
+					again = state->pending != nullptr;
+					state->scheduled = again;
+				}
+				state->slot.cpuNs += threadCpuNs() - cpuStart;
+				if (again) {
+					state->pool.post([state]() { State::process(state); });
+				}
+			}
+
+			WorkerPool& pool;
+			SlotStats& slot;
+			Metrics& metrics;
+			std::shared_ptr<BufferPool> frames;
+			std::mutex mutex;
+			PooledBuffer pending;
+			int pendingWidth = 0;
+			int pendingHeight = 0;
+			int64_t pendingEmitUs = 0;
+			bool scheduled = false;
+			// Worker owned; tasks of one stream never overlap.
+			std::vector<uint8_t> thumbnail;
+			TileHasher hasher;
+		};
+
+		std::shared_ptr<State> state_;
+	};
+
+	// SDK side of one subscribed renderer: emits frames on an absolute
+	// schedule and, like the SDK, drops the frames that fall due while the
+	// delegate is still busy.
+	class SimulatedRenderer {
+	public:
+		// content holds packed frames of width x height, shared by every
+		// renderer and cycled through.
+		SimulatedRenderer(ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate& delegate, SlotStats& slot,
+			uint32_t userId, int width, int height, int fps, const std::vector<std::vector<uint8_t>>& content)
+			: delegate_(delegate), slot_(slot), interval_(std::chrono::microseconds(1000000 / fps)),
+			content_(content), frame_(width, height, userId), stopping_(false) {
+			worker_ = std::thread(&SimulatedRenderer::run, this);
+		}
+
+		~SimulatedRenderer() {
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				stopping_ = true;
+			}
+			wake_.notify_all();
+			worker_.join();
+			delegate_.onRendererBeDestroyed();
+		}
+
+	private:
+		void run() {
+			Clock::time_point next = Clock::now();
+			uint64_t index = 0;
+			std::unique_lock<std::mutex> lock(mutex_);
+			while (!stopping_) {
+				lock.unlock();
+				// Stands in for the SDK decoding into its own buffer.
+				const std::vector<uint8_t>& image = content_[index++ % content_.size()];
+				std::copy(image.begin(), image.end(), frame_.buffer.begin());
+				frame_.timestamp = static_cast<unsigned long long>(nowUs());
+				delegate_.onRawDataFrameReceived(&frame_);
+				lock.lock();
+
+				next += interval_;
+				const Clock::time_point now = Clock::now();
+				if (now > next) {
+					const auto behind = (now - next) / interval_;
+					slot_.sdkDropped += static_cast<uint64_t>(behind);
+					next += interval_ * behind;
+				}
+				wake_.wait_until(lock, next, [this]() { return stopping_; });
+			}
+		}
+
+		ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate& delegate_;
+		SlotStats& slot_;
+		const Clock::duration interval_;
+		const std::vector<std::vector<uint8_t>>& content_;
+		tools::StubVideoRawData frame_;
+		std::mutex mutex_;
+		std::condition_variable wake_;
+		bool stopping_;
+		std::thread worker_;
+	};
+
+	// The stub SDK: which users are in the meeting, their renderers, and the
+	// audio thread that delivers mixed and one-way audio every 10 ms.
+	class SimulatedMeeting {
+	public:
+		SimulatedMeeting(const Options& options, AudioRawDataHub& hub, Metrics& metrics)
+			: options_(options), hub_(hub), metrics_(metrics), stopping_(false),
+			mixed_(kSampleRate, 1, kAudioBlockFrames) {
+			fillTone(mixed_, 440.0);
+
+			std::mt19937 rng(1);
+			std::uniform_int_distribution<int> noise(0, 15);
+			content_.resize(kRendererFrames, std::vector<uint8_t>(I420BufferSize(options.width, options.height)));
+			for (size_t i = 0; i < content_.size(); i++) {
+				for (size_t j = 0; j < content_[i].size(); j++) {
+					content_[i][j] = static_cast<uint8_t>(((j + i * 37) & 0x7F) + noise(rng));
+				}
+			}
+		}
+
+		~SimulatedMeeting() {
+			stop();
+		}
+
+		void setEvents(ZOOM_SDK_NAMESPACE::IMeetingParticipantsCtrlEvent* events) {
+			events_ = events;
+		}
+
+		// Everyone present from the start joins in one event, as when the app
+		// joins a running meeting.
+		void start() {
+			tools::StubList<unsigned int> joined;
+			for (int slot = 0; slot < slotCount(); slot++) {
+				const uint32_t userId = nextUserId_++;
+				addUser(slot, userId);
+				joined.AddItem(userId);
+			}
+			notify(joined, true);
+
+			audioThread_ = std::thread(&SimulatedMeeting::runAudio, this);
+			if (options_.churnSeconds > 0.0) {
+				churnThread_ = std::thread(&SimulatedMeeting::runChurn, this);
+			}
+		}
+
+		void stop() {
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				stopping_ = true;
+			}
+			wake_.notify_all();
+			if (audioThread_.joinable()) {
+				audioThread_.join();
+			}
+			if (churnThread_.joinable()) {
+				churnThread_.join();
+			}
+
+			tools::StubList<unsigned int> left;
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				for (const auto& user : users_) {
+					left.AddItem(user.first);
+				}
+			}
+			if (left.GetCount() > 0) {
+				notify(left, false);
+			}
+			std::lock_guard<std::mutex> lock(mutex_);
+			users_.clear();
+		}
+
+		// What the app calls from onUserJoin, like createRenderer plus
+		// subscribe.
+		void subscribeVideo(uint32_t userId, ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate& delegate) {
+			std::lock_guard<std::mutex> lock(rendererMutex_);
+			const int slot = slotOf(userId);
+			renderers_[userId] = std::make_unique<SimulatedRenderer>(delegate, metrics_.video[static_cast<size_t>(slot)],
+				userId, options_.width, options_.height, options_.fps, content_);
+		}
+
+		void unsubscribeVideo(uint32_t userId) {
+			std::unique_ptr<SimulatedRenderer> renderer;
+			{
+				std::lock_guard<std::mutex> lock(rendererMutex_);
+				auto it = renderers_.find(userId);
+				if (it == renderers_.end()) {
+					return;
+				}
+				renderer = std::move(it->second);
+				renderers_.erase(it);
+			}
+		}
+
+		int slotOf(uint32_t userId) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			auto it = users_.find(userId);
+			return it != users_.end() ? it->second.slot : -1;
+		}
+
+		int slotCount() const {
+			return std::max(options_.video, options_.audio);
+		}
+
+	private:
+		struct User {
+			int slot = 0;
+			std::unique_ptr<tools::StubAudioRawData> audio;
+		};
+
+		static void fillTone(tools::StubAudioRawData& data, double frequency) {
+			for (size_t i = 0; i < data.samples.size(); i++) {
+				data.samples[i] = static_cast<int16_t>(8000.0 * std::sin(2.0 * 3.14159265358979 * frequency * i / kSampleRate));
+			}
+		}
+
+		void addUser(int slot, uint32_t userId) {
+			User user;
+			user.slot = slot;
+			if (slot < options_.audio) {
+				user.audio = std::make_unique<tools::StubAudioRawData>(kSampleRate, 1, kAudioBlockFrames);
+				fillTone(*user.audio, 200.0 + 50.0 * slot);
+			}
+			std::lock_guard<std::mutex> lock(mutex_);
+			users_[userId] = std::move(user);
+		}
+
+		void notify(tools::StubList<unsigned int>& users, bool joined) {
+			const int64_t startUs = nowUs();
+			if (joined) {
+				events_->onUserJoin(&users);
+				metrics_.joinHandling.add(nowUs() - startUs);
+			}
+			else {
+				events_->onUserLeft(&users);
+				metrics_.leaveHandling.add(nowUs() - startUs);
+			}
+		}
+
+		void runChurn() {
+			std::mt19937 rng(7);
+			const auto interval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(options_.churnSeconds));
+			std::unique_lock<std::mutex> lock(mutex_);
+			while (!wake_.wait_for(lock, interval, [this]() { return stopping_; })) {
+				if (users_.empty()) {
+					continue;
+				}
+				auto it = users_.begin();
+				std::advance(it, std::uniform_int_distribution<size_t>(0, users_.size() - 1)(rng));
+				const uint32_t leaving = it->first;
+				const int slot = it->second.slot;
+				lock.unlock();
+
+				// The leaving user's audio stops before the event, as it would.
+				{
+					tools::StubList<unsigned int> left({ leaving });
+					notify(left, false);
+					std::lock_guard<std::mutex> usersLock(mutex_);
+					users_.erase(leaving);
+				}
+				const uint32_t joining = nextUserId_++;
+				addUser(slot, joining);
+				tools::StubList<unsigned int> joined({ joining });
+				notify(joined, true);
+				lock.lock();
+			}
+		}
+
+		void runAudio() {
+			Clock::time_point next = Clock::now();
+			uint64_t timestamp = 1000;
+			std::unique_lock<std::mutex> lock(mutex_);
+			while (!stopping_) {
+				mixed_.timestamp = timestamp;
+				hub_.onMixedAudioRawDataReceived(&mixed_);
+				for (auto& user : users_) {
+					if (!user.second.audio) {
+						continue;
+					}
+					SlotStats& slot = metrics_.audio[static_cast<size_t>(user.second.slot)];
+					const int64_t cpuStart = threadCpuNs();
+					const int64_t startUs = nowUs();
+					user.second.audio->timestamp = timestamp;
+					hub_.onOneWayAudioRawDataReceived(user.second.audio.get(), user.first);
+					metrics_.audioCallback.add(nowUs() - startUs);
+					slot.cpuNs += threadCpuNs() - cpuStart;
+					slot.frames++;
+				}
+				timestamp += 10;
+
+				next += kAudioInterval;
+				if (Clock::now() > next + kAudioInterval) {
+					metrics_.audioLateTicks++;
+				}
+				wake_.wait_until(lock, next, [this]() { return stopping_; });
+			}
+		}
+
+		const Options& options_;
+		AudioRawDataHub& hub_;
+		Metrics& metrics_;
+		ZOOM_SDK_NAMESPACE::IMeetingParticipantsCtrlEvent* events_ = nullptr;
+		std::atomic<uint32_t> nextUserId_{ kFirstUserId };
+
+		std::mutex mutex_;
+		std::condition_variable wake_;
+		bool stopping_;
+		std::map<uint32_t, User> users_;
+		tools::StubAudioRawData mixed_;
+
+		std::vector<std::vector<uint8_t>> content_;
+		std::mutex rendererMutex_;
+		std::map<uint32_t, std::unique_ptr<SimulatedRenderer>> renderers_;
+
+		std::thread audioThread_;
+		std::thread churnThread_;
+	};
+
+	// App side of the roster: subscribes each joining user's streams to the
+	// plugin paths and tears them down when the user leaves.
+	class RosterHandler : public tools::ParticipantsEventAdapter {
+	public:
+		RosterHandler(const Options& options, SimulatedMeeting& meeting, WorkerPool& pool, Metrics& metrics,
+			PcmStreamer& streamer, AudioAnalyzer& analyzer, AudioMixer& mixer)
+			: options_(options), meeting_(meeting), pool_(pool), metrics_(metrics),
+			streamer_(streamer), analyzer_(analyzer), mixer_(mixer) {}
+
+		void onUserJoin(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID, const zchar_t* strUserList) override {
+			for (int i = 0; lstUserID && i < lstUserID->GetCount(); i++) {
+				const uint32_t userId = lstUserID->GetItem(i);
+				const int slot = meeting_.slotOf(userId);
+				if (slot < 0) {
+					continue;
+				}
+				metrics_.joins++;
+				if (slot < options_.video) {
+					auto path = std::make_unique<VideoPath>(pool_, metrics_.video[static_cast<size_t>(slot)], metrics_,
+						options_.width, options_.height);
+					meeting_.subscribeVideo(userId, *path);
+					std::lock_guard<std::mutex> lock(mutex_);
+					videoPaths_[userId] = std::move(path);
+				}
+				if (slot < options_.audio) {
+					const AudioStreamKey key{ AudioStreamKind::OneWay, userId };
+					streamer_.subscribe(key);
+					analyzer_.subscribe(key, AudioAnalysisConfig());
+					std::lock_guard<std::mutex> lock(mutex_);
+					audioUsers_.push_back(userId);
+				}
+			}
+			updateMix();
+		}
+
+		void onUserLeft(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID, const zchar_t* strUserList) override {
+			for (int i = 0; lstUserID && i < lstUserID->GetCount(); i++) {
+				const uint32_t userId = lstUserID->GetItem(i);
+				metrics_.leaves++;
+				meeting_.unsubscribeVideo(userId);
+				const AudioStreamKey key{ AudioStreamKind::OneWay, userId };
+				streamer_.unsubscribe(key);
+				analyzer_.unsubscribe(key);
+
+				std::lock_guard<std::mutex> lock(mutex_);
+				videoPaths_.erase(userId);
+				audioUsers_.erase(std::remove(audioUsers_.begin(), audioUsers_.end(), userId), audioUsers_.end());
+			}
+			updateMix();
+		}
+
+	private:
+		void updateMix() {
+			std::vector<AudioMixInput> inputs;
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				for (uint32_t userId : audioUsers_) {
+					inputs.push_back(AudioMixInput{ AudioStreamKey{ AudioStreamKind::OneWay, userId }, 0.5f });
+				}
+			}
+			mixer_.setInputs(inputs);
+		}
+
+		const Options& options_;
+		SimulatedMeeting& meeting_;
+		WorkerPool& pool_;
+		Metrics& metrics_;
+		PcmStreamer& streamer_;
+		AudioAnalyzer& analyzer_;
+		AudioMixer& mixer_;
+
+		std::mutex mutex_;
+		std::map<uint32_t, std::unique_ptr<VideoPath>> videoPaths_;
+		std::vector<uint32_t> audioUsers_;
+	};
+
+	bool parseOptions(int argc, char** argv, Options& options) {
+		for (int i = 1; i < argc; i++) {
+			const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+			bool ok = value != nullptr;
+			if (std::strcmp(argv[i], "--video") == 0 && ok) {
+				options.video = std::atoi(value);
+			}
+			else if (std::strcmp(argv[i], "--size") == 0 && ok) {
+				ok = std::sscanf(value, "%dx%d", &options.width, &options.height) == 2;
+			}
+			else if (std::strcmp(argv[i], "--fps") == 0 && ok) {
+				options.fps = std::atoi(value);
+			}
+			else if (std::strcmp(argv[i], "--audio") == 0 && ok) {
+				options.audio = std::atoi(value);
+			}
+			else if (std::strcmp(argv[i], "--churn") == 0 && ok) {
+				options.churnSeconds = std::atof(value);
+			}
+			else if (std::strcmp(argv[i], "--duration") == 0 && ok) {
+				options.durationSeconds = std::atof(value);
+			}
+			else if (std::strcmp(argv[i], "--workers") == 0 && ok) {
+				options.workers = std::atoi(value);
+			}
+			else {
+				ok = false;
+			}
+			if (!ok) {
+				return false;
+			}
+			i++;
+		}
+		return options.video >= 0 && options.audio >= 0 && options.video + options.audio > 0
+			&& options.width >= 2 && options.height >= 2 && options.width <= 4096 && options.height <= 4096
+			&& options.fps >= 1 && options.fps <= 60 && options.durationSeconds > 0.0 && options.workers >= 0;
+	}
+
+	void printSlots(const char* name, std::vector<SlotStats>& slots, size_t count, double seconds, bool video) {
+		if (count == 0) {
+			return;
+		}
+		int64_t cpuNs = 0;
+		int64_t maxCpuNs = 0;
+		uint64_t frames = 0;
+		uint64_t sdkDropped = 0;
+		uint64_t queueDropped = 0;
+		for (size_t i = 0; i < count; i++) {
+			cpuNs += slots[i].cpuNs;
+			maxCpuNs = std::max<int64_t>(maxCpuNs, slots[i].cpuNs);
+			frames += slots[i].frames;
+			sdkDropped += slots[i].sdkDropped;
+			queueDropped += slots[i].queueDropped;
+		}
+		const double toPercent = 100.0 / (seconds * 1e9);
+		std::printf("  %-22s cpu/stream mean=%5.2f%% max=%5.2f%%  %s=%llu", name,
+			cpuNs * toPercent / count, maxCpuNs * toPercent, video ? "frames" : "blocks",
+			static_cast<unsigned long long>(frames));
+		if (video) {
+			std::printf("  dropped sdk=%llu queue=%llu",
+				static_cast<unsigned long long>(sdkDropped), static_cast<unsigned long long>(queueDropped));
+		}
+		std::printf("\n");
+	}
+}
+
+int main(int argc, char** argv) {
+	Options options;
+	if (!parseOptions(argc, argv, options)) {
+		std::fprintf(stderr, "usage: load_generator [--video N] [--size WxH] [--fps F] [--audio M]\n"
+			"                      [--churn SECONDS] [--duration SECONDS] [--workers N]\n");
+		return 2;
+	}
+
+	Metrics metrics(static_cast<size_t>(options.video), static_cast<size_t>(options.audio));
+	WorkerPool pool(static_cast<size_t>(options.workers));
+	AudioRawDataHub hub;
+	PcmStreamer streamer(hub, [&metrics](PooledBuffer chunk) { metrics.pcmChunks++; });
+	AudioAnalyzer analyzer(hub, pool, [&metrics](PooledBuffer frame) { metrics.analysisFrames++; });
+	AudioMixer mixer(hub, kMixId);
+	streamer.subscribe(mixer.outputKey());
+
+	std::printf("load: video %d x %dx%d@%d, audio %d, churn every %.1f s, %.0f s, %zu workers\n",
+		options.video, options.width, options.height, options.fps, options.audio,
+		options.churnSeconds, options.durationSeconds, pool.size());
+
+	const int64_t cpuStart = processCpuNs();
+	const Clock::time_point start = Clock::now();
+	{
+		SimulatedMeeting meeting(options, hub, metrics);
+		RosterHandler roster(options, meeting, pool, metrics, streamer, analyzer, mixer);
+		meeting.setEvents(&roster);
+		meeting.start();
+		std::this_thread::sleep_for(std::chrono::duration<double>(options.durationSeconds));
+		meeting.stop();
+	}
+	const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	const double processCpu = static_cast<double>(processCpuNs() - cpuStart) / (seconds * 1e9) * 100.0;
+	streamer.unsubscribeAll();
+	analyzer.unsubscribeAll();
+	const AudioMixerStats mix = mixer.stats();
+
+	std::printf("process cpu %.1f%% of one core over %.1f s\n", processCpu, seconds);
+	printSlots("video", metrics.video, static_cast<size_t>(options.video), seconds, true);
+	printSlots("audio (hub callback)", metrics.audio, static_cast<size_t>(options.audio), seconds, false);
+	std::printf("  %-22s late ticks=%llu  pcm chunks=%llu  analysis frames=%llu  mix blocks=%llu late=%llu dropped=%llu\n",
+		"audio pipeline",
+		static_cast<unsigned long long>(metrics.audioLateTicks), static_cast<unsigned long long>(metrics.pcmChunks),
+		static_cast<unsigned long long>(metrics.analysisFrames), static_cast<unsigned long long>(mix.blocks),
+		static_cast<unsigned long long>(mix.lateSamples), static_cast<unsigned long long>(mix.droppedSamples));
+	std::printf("  %-22s joins=%llu leaves=%llu\n", "roster",
+		static_cast<unsigned long long>(metrics.joins), static_cast<unsigned long long>(metrics.leaves));
+	std::printf("latency\n");
+	metrics.videoLatency.print("video emit to done");
+	metrics.videoCallback.print("video callback");
+	metrics.audioCallback.print("audio callback");
+	metrics.joinHandling.print("onUserJoin");
+	metrics.leaveHandling.print("onUserLeft");
+	return 0;
+}
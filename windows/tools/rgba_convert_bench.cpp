@@ -0,0 +1,55 @@
+// Measures RGBA to I420 conversion at 720p and 1080p, vectorized against
+// the scalar reference, in both ranges.
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "media/i420_image.h"
+#include "media/rgba_to_i420.h"
+
+using namespace flutter_zoom_sdk;
+
+namespace {
+	constexpr int kFrames = 200;
+
+	using Clock = std::chrono::steady_clock;
+
+	double msPerFrame(const std::vector<uint8_t>& rgba, int width, int height, bool fullRange, bool vectorized,
+		std::vector<uint8_t>& out) {
+		out.assign(I420BufferSize(width, height), 0);
+		const I420Planes planes = I420Planes::packed(out.data(), width, height);
+
+		const auto start = Clock::now();
+		for (int i = 0; i < kFrames; ++i) {
+			ConvertRgbaToI420(rgba.data(), 4 * width, PixelOrder::Rgba, fullRange, planes, vectorized);
+		}
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / kFrames;
+	}
+
+	void bench(int width, int height, bool fullRange) {
+		std::mt19937 rng(11);
+		std::vector<uint8_t> rgba(static_cast<size_t>(width) * height * 4);
+		for (auto& byte : rgba) {
+			byte = static_cast<uint8_t>(rng());
+		}
+
+		std::vector<uint8_t> scalarOut;
+		std::vector<uint8_t> simdOut;
+		const double scalarMs = msPerFrame(rgba, width, height, fullRange, false, scalarOut);
+		const double simdMs = msPerFrame(rgba, width, height, fullRange, true, simdOut);
+
+		std::printf("%4dx%-4d %-7s scalar=%6.3f ms/frame  simd=%6.3f ms/frame  speedup=%.2fx  match=%s\n",
+			width, height, fullRange ? "full" : "limited", scalarMs, simdMs, scalarMs / simdMs,
+			scalarOut == simdOut ? "yes" : "NO");
+	}
+}
+
+int main() {
+	for (bool fullRange : { false, true }) {
+		bench(1280, 720, fullRange);
+		bench(1920, 1080, fullRange);
+	}
+	return 0;
+}
@@ -0,0 +1,277 @@
+// Measures the participant roster against a stub SDK: users joining in
+// onUserJoin batches, hand and name churn, then everyone leaving, and the
+// naive alternative of re-reading every user on each join. Also compares
+// FlatIdMap lookups with std::unordered_map, and indexed page queries with
+// filtering and sorting the whole roster per query.
+//
+//   roster_bench [--users N] [--batch B]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "meeting/flat_id_map.h"
+#include "meeting/roster_index.h"
+#include "meeting/roster_store.h"
+#include "meeting/roster_tracker.h"
+#include "stub_meeting.h"
+
+using namespace flutter_zoom_sdk;
+
+namespace {
+	using Clock = std::chrono::steady_clock;
+
+	constexpr int kLookupRounds = 100;
+	constexpr int kQueryRounds = 200;
+
+	double elapsedMs(Clock::time_point start) {
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	struct Meeting {
+		std::vector<std::unique_ptr<tools::StubUserInfo>> users;
+		std::unordered_map<uint32_t, tools::StubUserInfo*> byId;
+
+		ZOOM_SDK_NAMESPACE::IUserInfo* lookup(uint32_t id) {
+			auto it = byId.find(id);
+			return it == byId.end() ? nullptr : it->second;
+		}
+	};
+
+	Meeting makeMeeting(size_t count) {
+		std::mt19937 rng(7);
+		Meeting meeting;
+		for (size_t i = 0; i < count; i++) {
+			// Sparse, like SDK user ids.
+			auto user = std::make_unique<tools::StubUserInfo>(16778240u + static_cast<uint32_t>(i) * 1024u + (rng() & 1023u));
+			const std::string name = "Attendee " + std::to_string(rng() % 100000);
+			user->name = FromUtf8(name);
+			user->videoOn = (rng() & 3) == 0;
+			user->phone = (rng() % 50) == 0;
+			meeting.byId[user->id] = user.get();
+			meeting.users.push_back(std::move(user));
+		}
+		return meeting;
+	}
+
+	std::vector<std::vector<unsigned int>> batches(const Meeting& meeting, size_t batch) {
+		std::vector<std::vector<unsigned int>> out;
+		for (size_t i = 0; i < meeting.users.size(); i += batch) {
+			std::vector<unsigned int> ids;
+			for (size_t j = i; j < std::min(i + batch, meeting.users.size()); j++) {
+				ids.push_back(meeting.users[j]->id);
+			}
+			out.push_back(std::move(ids));
+		}
+		return out;
+	}
+
+	void benchTracker(Meeting& meeting, size_t batch) {
+		RosterStore store;
+		RosterTracker tracker(store, [&meeting](uint32_t id) { return meeting.lookup(id); });
+		const auto joins = batches(meeting, batch);
+		const double users = static_cast<double>(meeting.users.size());
+
+		auto start = Clock::now();
+		for (const auto& ids : joins) {
+			tools::StubList<unsigned int> list(ids);
+			tracker.onUserJoin(&list);
+		}
+		const double joinMs = elapsedMs(start);
+
+		start = Clock::now();
+		for (const auto& user : meeting.users) {
+			tracker.onLowOrRaiseHandStatusChanged(false, user->id);
+		}
+		const size_t raised = store.count(RosterFlag::HandRaised);
+		tracker.onAllHandsLowered();
+		const double handMs = elapsedMs(start);
+
+		start = Clock::now();
+		for (const auto& ids : joins) {
+			for (unsigned int id : ids) {
+				meeting.byId[id]->name += static_cast<zchar_t>('!');
+			}
+			tools::StubList<unsigned int> list(ids);
+			tracker.onUserNamesChanged(&list);
+		}
+		const double renameMs = elapsedMs(start);
+
+		start = Clock::now();
+		size_t videoOn = 0;
+		for (int round = 0; round < kLookupRounds; round++) {
+			videoOn = store.count(RosterFlag::VideoOn);
+		}
+		const double countNs = elapsedMs(start) * 1e6 / kLookupRounds;
+
+		start = Clock::now();
+		for (const auto& ids : joins) {
+			tools::StubList<unsigned int> list(ids);
+			tracker.onUserLeft(&list);
+		}
+		const double leaveMs = elapsedMs(start);
+
+		std::printf("tracker  users=%.0f batch=%zu\n", users, batch);
+		std::printf("  join    %8.2f ms  %7.0f ns/user\n", joinMs, joinMs * 1e6 / users);
+		std::printf("  hands   %8.2f ms  %7.0f ns/user  (raised %zu, then all lowered)\n", handMs, handMs * 1e6 / users, raised);
+		std::printf("  rename  %8.2f ms  %7.0f ns/user\n", renameMs, renameMs * 1e6 / users);
+		std::printf("  count   %8.0f ns for video on (%zu)\n", countNs, videoOn);
+		std::printf("  leave   %8.2f ms  %7.0f ns/user  (left %zu)\n", leaveMs, leaveMs * 1e6 / users, store.size());
+	}
+
+	// Re-reads every participant on each join, as a client without a
+	// native roster has to.
+	void benchNaive(Meeting& meeting, size_t batch) {
+		const auto joins = batches(meeting, batch);
+		std::vector<unsigned int> present;
+		size_t reads = 0;
+
+		const auto start = Clock::now();
+		for (const auto& ids : joins) {
+			present.insert(present.end(), ids.begin(), ids.end());
+			std::vector<RosterMember> roster;
+			roster.reserve(present.size());
+			for (unsigned int id : present) {
+				roster.push_back(RosterTracker::describe(*meeting.lookup(id)));
+				reads++;
+			}
+		}
+		const double ms = elapsedMs(start);
+		std::printf("naive    join %8.2f ms  %7.0f ns/user  (%zu user reads)\n",
+			ms, ms * 1e6 / meeting.users.size(), reads);
+	}
+
+	void benchLookups(const Meeting& meeting) {
+		FlatIdMap flat;
+		std::unordered_map<uint32_t, uint32_t> map;
+		std::vector<uint32_t> keys;
+		for (size_t i = 0; i < meeting.users.size(); i++) {
+			flat.set(meeting.users[i]->id, static_cast<uint32_t>(i));
+			map[meeting.users[i]->id] = static_cast<uint32_t>(i);
+			keys.push_back(meeting.users[i]->id);
+		}
+		std::shuffle(keys.begin(), keys.end(), std::mt19937(3));
+
+		uint64_t sum = 0;
+		auto start = Clock::now();
+		for (int round = 0; round < kLookupRounds; round++) {
+			for (uint32_t key : keys) {
+				sum += flat.find(key);
+			}
+		}
+		const double flatNs = elapsedMs(start) * 1e6 / (kLookupRounds * keys.size());
+
+		start = Clock::now();
+		for (int round = 0; round < kLookupRounds; round++) {
+			for (uint32_t key : keys) {
+				sum += map.find(key)->second;
+			}
+		}
+		const double mapNs = elapsedMs(start) * 1e6 / (kLookupRounds * keys.size());
+		std::printf("lookup   flat=%.1f ns  unordered_map=%.1f ns  (checksum %llu)\n",
+			flatNs, mapNs, static_cast<unsigned long long>(sum));
+	}
+
+	// Filters and sorts a copy of the roster, then takes the page.
+	RosterPage naiveQuery(const RosterStore& store, const RosterQuery& query) {
+		const std::string prefix = RosterIndex::normalize(query.prefix, false);
+		std::vector<std::pair<std::string, uint32_t>> matches;
+		for (uint32_t index = 0; index < store.size(); index++) {
+			if ((query.filters & kRosterFilterHandRaised) && !store.flag(index, RosterFlag::HandRaised)) {
+				continue;
+			}
+			std::string key = RosterIndex::normalize(store.name(index));
+			if (key.compare(0, prefix.size(), prefix) == 0) {
+				matches.emplace_back(std::move(key), store.id(index));
+			}
+		}
+		std::sort(matches.begin(), matches.end());
+
+		RosterPage page;
+		page.total = matches.size();
+		for (size_t i = query.offset; i < matches.size() && page.ids.size() < query.limit; i++) {
+			page.ids.push_back(matches[i].second);
+		}
+		return page;
+	}
+
+	void benchQueries(Meeting& meeting) {
+		RosterStore store;
+		RosterIndex index(store);
+		store.addObserver(&index);
+		RosterTracker tracker(store, [&meeting](uint32_t id) { return meeting.lookup(id); });
+
+		auto start = Clock::now();
+		for (const auto& user : meeting.users) {
+			tools::StubList<unsigned int> list({ user->id });
+			tracker.onUserJoin(&list);
+		}
+		const double joinMs = elapsedMs(start);
+		for (size_t i = 0; i < meeting.users.size(); i += 20) {
+			tracker.onLowOrRaiseHandStatusChanged(false, meeting.users[i]->id);
+		}
+
+		struct Case {
+			const char* label;
+			RosterQuery query;
+		};
+		std::vector<Case> cases(4);
+		cases[0].label = "page 50 at the middle";
+		cases[0].query.offset = meeting.users.size() / 2;
+		cases[1].label = "prefix \"attendee 12\"";
+		cases[1].query.prefix = "attendee 12";
+		cases[2].label = "hands raised";
+		cases[2].query.filters = kRosterFilterHandRaised;
+		cases[3].label = "hands raised, prefix";
+		cases[3].query.filters = kRosterFilterHandRaised;
+		cases[3].query.prefix = "Attendee 5";
+
+		std::printf("query    users=%zu  (indexed join %.0f ns/user)\n", store.size(), joinMs * 1e6 / store.size());
+		for (const Case& c : cases) {
+			size_t check = 0;
+			start = Clock::now();
+			for (int round = 0; round < kQueryRounds; round++) {
+				check += index.query(c.query).total;
+			}
+			const double indexedUs = elapsedMs(start) * 1e3 / kQueryRounds;
+
+			start = Clock::now();
+			for (int round = 0; round < kQueryRounds / 10; round++) {
+				check -= naiveQuery(store, c.query).total * 10;
+			}
+			const double naiveUs = elapsedMs(start) * 1e3 / (kQueryRounds / 10);
+			std::printf("  %-24s indexed %8.2f us  naive %9.1f us  (%zu matches%s)\n", c.label, indexedUs, naiveUs,
+				index.query(c.query).total, check == 0 ? "" : ", MISMATCH");
+		}
+	}
+}
+
+int main(int argc, char** argv) {
+	size_t users = 10000;
+	size_t batch = 1;
+	for (int i = 1; i + 1 < argc; i += 2) {
+		if (std::strcmp(argv[i], "--users") == 0) {
+			users = std::strtoul(argv[i + 1], nullptr, 10);
+		}
+		else if (std::strcmp(argv[i], "--batch") == 0) {
+			batch = std::strtoul(argv[i + 1], nullptr, 10);
+		}
+	}
+	if (users == 0 || batch == 0) {
+		std::fprintf(stderr, "usage: roster_bench [--users N] [--batch B]\n");
+		return 2;
+	}
+
+	Meeting meeting = makeMeeting(users);
+	benchTracker(meeting, batch);
+	benchNaive(meeting, batch);
+	benchLookups(meeting);
+	benchQueries(meeting);
+	return 0;
+}
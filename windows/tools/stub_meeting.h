@@ -0,0 +1,190 @@
+#ifndef FLUTTER_PLUGIN_TOOLS_STUB_MEETING_H_
+#define FLUTTER_PLUGIN_TOOLS_STUB_MEETING_H_
+
+#include <string>
+#include <vector>
+
+#include "util/zchar_util.h"
+
+#include <meeting_service_interface.h>
+#include <meeting_service_components/meeting_audio_interface.h>
+#include <meeting_service_components/meeting_chat_interface.h>
+#include <meeting_service_components/meeting_closedcaption_interface.h>
+#include <meeting_service_components/meeting_participants_ctrl_interface.h>
+
+namespace flutter_zoom_sdk {
+namespace tools {
+
+	// IList backed by a vector, for handing user ids to SDK event handlers.
+	template <typename T>
+	class StubList : public ZOOM_SDK_NAMESPACE::IList<T> {
+	public:
+		StubList() = default;
+
+		explicit StubList(std::vector<T> items) : items(std::move(items)) {}
+
+		int GetCount() override { return static_cast<int>(items.size()); }
+		T GetItem(int index) override { return items[static_cast<size_t>(index)]; }
+		void AddItem(T item) override { items.push_back(item); }
+
+		std::vector<T> items;
+	};
+
+	// Participants events with every callback but join and leave ignored, so
+	// tools only implement what they drive.
+	class ParticipantsEventAdapter : public ZOOM_SDK_NAMESPACE::IMeetingParticipantsCtrlEvent {
+	public:
+		void onHostChangeNotification(unsigned int userId) override {}
+		void onLowOrRaiseHandStatusChanged(bool bLow, unsigned int userid) override {}
+		void onUserNamesChanged(ZOOM_SDK_NAMESPACE::IList<unsigned int>* lstUserID) override {}
+		void onCoHostChangeNotification(unsigned int userId, bool isCoHost) override {}
+		void onInvalidReclaimHostkey() override {}
+		void onAllHandsLowered() override {}
+		void onLocalRecordingStatusChanged(unsigned int user_id, ZOOM_SDK_NAMESPACE::RecordingStatus status) override {}
+		void onAllowParticipantsRenameNotification(bool bAllow) override {}
+		void onAllowParticipantsUnmuteSelfNotification(bool bAllow) override {}
+		void onAllowParticipantsStartVideoNotification(bool bAllow) override {}
+		void onAllowParticipantsShareWhiteBoardNotification(bool bAllow) override {}
+		void onRequestLocalRecordingPrivilegeChanged(ZOOM_SDK_NAMESPACE::LocalRecordingRequestPrivilegeStatus status) override {}
+		void onAllowParticipantsRequestCloudRecording(bool bAllow) override {}
+		void onInMeetingUserAvatarPathUpdated(unsigned int userID) override {}
+		void onParticipantProfilePictureStatusChange(bool bHidden) override {}
+		void onFocusModeStateChanged(bool bEnabled) override {}
+		void onFocusModeShareTypeChanged(ZOOM_SDK_NAMESPACE::FocusModeShareType type) override {}
+		void onBotAuthorizerRelationChanged(unsigned int authorizeUserID) override {}
+		void onVirtualNameTagStatusChanged(bool bOn, unsigned int userID) override {}
+		void onVirtualNameTagRosterInfoUpdated(unsigned int userID) override {}
+#if defined(WIN32)
+		void onCreateCompanionRelation(unsigned int parentUserID, unsigned int childUserID) override {}
+		void onRemoveCompanionRelation(unsigned int childUserID) override {}
+#endif
+		void onGrantCoOwnerPrivilegeChanged(bool canGrantOther) override {}
+	};
+
+	// Participant with settable fields, for driving roster handlers.
+	class StubUserInfo : public ZOOM_SDK_NAMESPACE::IUserInfo {
+	public:
+		explicit StubUserInfo(unsigned int id = 0) : id(id) {}
+
+		const zchar_t* GetUserName() override { return name.c_str(); }
+		bool IsHost() override { return role == ZOOM_SDK_NAMESPACE::USERROLE_HOST; }
+		unsigned int GetUserID() override { return id; }
+		const zchar_t* GetAvatarPath() override { return nullptr; }
+		const zchar_t* GetPersistentId() override { return nullptr; }
+		const zchar_t* GetCustomerKey() override { return nullptr; }
+		bool IsVideoOn() override { return videoOn; }
+		bool IsAudioMuted() override { return muted; }
+		ZOOM_SDK_NAMESPACE::AudioType GetAudioJoinType() override { return ZOOM_SDK_NAMESPACE::AUDIOTYPE_VOIP; }
+		bool IsMySelf() override { return myself; }
+		bool IsInWaitingRoom() override { return inWaitingRoom; }
+		bool IsRaiseHand() override { return handRaised; }
+		ZOOM_SDK_NAMESPACE::UserRole GetUserRole() override { return role; }
+		bool IsPurePhoneUser() override { return phone; }
+		int GetAudioVoiceLevel() override { return 0; }
+		bool IsClosedCaptionSender() override { return false; }
+		bool IsTalking() override { return talking; }
+		bool IsH323User() override { return h323; }
+		ZOOM_SDK_NAMESPACE::WebinarAttendeeStatus* GetWebinarAttendeeStatus() override { return nullptr; }
+#if defined(WIN32)
+		bool IsInterpreter() override { return interpreter; }
+		bool IsSignLanguageInterpreter() override { return false; }
+		const zchar_t* GetInterpreterActiveLanguage() override { return nullptr; }
+		ZOOM_SDK_NAMESPACE::SDKEmojiFeedbackType GetEmojiFeedbackType() override { return ZOOM_SDK_NAMESPACE::SDKEmojiFeedbackType_None; }
+		bool IsCompanionModeUser() override { return false; }
+#endif
+		ZOOM_SDK_NAMESPACE::RecordingStatus GetLocalRecordingStatus() override { return ZOOM_SDK_NAMESPACE::Recording_Stop; }
+		bool IsRawLiveStreaming() override { return false; }
+		bool HasRawLiveStreamPrivilege() override { return false; }
+		bool HasCamera() override { return true; }
+		bool IsProductionStudioUser() override { return false; }
+		bool IsInWebinarBackstage() override { return false; }
+		unsigned int GetProductionStudioParent() override { return 0; }
+		bool IsBotUser() override { return bot; }
+		const zchar_t* GetBotAppName() override { return nullptr; }
+		bool IsVirtualNameTagEnabled() override { return false; }
+		ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::ZoomSDKVirtualNameTag>* GetVirtualNameTagList() override { return nullptr; }
+		ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::GrantCoOwnerAssetsInfo>* GetGrantCoOwnerAssetsInfo() override { return nullptr; }
+
+		unsigned int id;
+		zstring name;
+		ZOOM_SDK_NAMESPACE::UserRole role = ZOOM_SDK_NAMESPACE::USERROLE_ATTENDEE;
+		bool videoOn = false;
+		bool muted = true;
+		bool talking = false;
+		bool handRaised = false;
+		bool inWaitingRoom = false;
+		bool phone = false;
+		bool bot = false;
+		bool myself = false;
+		bool h323 = false;
+		bool interpreter = false;
+	};
+
+	// One entry of onUserAudioStatusChange.
+	class StubAudioStatus : public ZOOM_SDK_NAMESPACE::IUserAudioStatus {
+	public:
+		unsigned int GetUserId() override { return id; }
+		ZOOM_SDK_NAMESPACE::AudioStatus GetStatus() override { return status; }
+		ZOOM_SDK_NAMESPACE::AudioType GetAudioType() override { return type; }
+
+		unsigned int id = 0;
+		ZOOM_SDK_NAMESPACE::AudioStatus status = ZOOM_SDK_NAMESPACE::Audio_None;
+		ZOOM_SDK_NAMESPACE::AudioType type = ZOOM_SDK_NAMESPACE::AUDIOTYPE_VOIP;
+	};
+
+	// Chat message with settable fields and no rich text or thread.
+	class StubChatMsgInfo : public ZOOM_SDK_NAMESPACE::IChatMsgInfo {
+	public:
+		const zchar_t* GetMessageID() override { return messageId.c_str(); }
+		unsigned int GetSenderUserId() override { return senderId; }
+		const zchar_t* GetSenderDisplayName() override { return senderName.c_str(); }
+		unsigned int GetReceiverUserId() override { return receiverId; }
+		const zchar_t* GetReceiverDisplayName() override { return receiverName.c_str(); }
+		const zchar_t* GetContent() override { return content.c_str(); }
+		time_t GetTimeStamp() override { return time; }
+		bool IsChatToAll() override { return toAll; }
+		bool IsChatToAllPanelist() override { return toAllPanelists; }
+		bool IsChatToWaitingroom() override { return toWaitingRoom; }
+		ZOOM_SDK_NAMESPACE::SDKChatMessageType GetChatMessageType() override { return type; }
+		bool IsComment() override { return comment; }
+		bool IsThread() override { return false; }
+		ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::IRichTextStyleItem*>* GetTextStyleItemList() override { return nullptr; }
+		ZOOM_SDK_NAMESPACE::IList<ZOOM_SDK_NAMESPACE::SegmentDetails>* GetSegmentDetails() override { return nullptr; }
+		const zchar_t* GetThreadID() override { return nullptr; }
+
+		zstring messageId;
+		unsigned int senderId = 0;
+		zstring senderName;
+		unsigned int receiverId = 0;
+		zstring receiverName;
+		zstring content;
+		time_t time = 0;
+		bool toAll = true;
+		bool toAllPanelists = false;
+		bool toWaitingRoom = false;
+		ZOOM_SDK_NAMESPACE::SDKChatMessageType type = ZOOM_SDK_NAMESPACE::SDKChatMessageType_To_All;
+		bool comment = false;
+	};
+
+	// Live transcription line with settable fields.
+	class StubTranscriptionMessage : public ZOOM_SDK_NAMESPACE::ILiveTranscriptionMessageInfo {
+	public:
+		const zchar_t* GetMessageID() override { return messageId.c_str(); }
+		unsigned int GetSpeakerID() override { return speakerId; }
+		const zchar_t* GetSpeakerName() override { return speakerName.c_str(); }
+		const zchar_t* GetMessageContent() override { return content.c_str(); }
+		time_t GetTimeStamp() override { return time; }
+		ZOOM_SDK_NAMESPACE::SDKLiveTranscriptionOperationType GetMessageOperationType() override { return operation; }
+
+		zstring messageId;
+		unsigned int speakerId = 0;
+		zstring speakerName;
+		zstring content;
+		time_t time = 0;
+		ZOOM_SDK_NAMESPACE::SDKLiveTranscriptionOperationType operation = ZOOM_SDK_NAMESPACE::SDK_LiveTranscription_OperationType_Add;
+	};
+
+}  // namespace tools
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_TOOLS_STUB_MEETING_H_
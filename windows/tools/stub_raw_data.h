@@ -0,0 +1,78 @@
+#ifndef FLUTTER_PLUGIN_TOOLS_STUB_RAW_DATA_H_
+#define FLUTTER_PLUGIN_TOOLS_STUB_RAW_DATA_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <zoom_sdk_raw_data_def.h>
+
+#include "media/i420_image.h"
+
+namespace flutter_zoom_sdk {
+namespace tools {
+
+	// In-memory AudioRawData for driving the plugin's audio paths without the
+	// SDK. The caller owns it; reference counting is a no-op.
+	class StubAudioRawData : public AudioRawData {
+	public:
+		StubAudioRawData(uint32_t sampleRate, uint32_t channels, size_t samplesPerFrame)
+			: samples(samplesPerFrame * channels), timestamp(0), sampleRate_(sampleRate), channels_(channels) {}
+
+		bool CanAddRef() override { return false; }
+		bool AddRef() override { return false; }
+		int Release() override { return 0; }
+		char* GetBuffer() override { return reinterpret_cast<char*>(samples.data()); }
+		unsigned int GetBufferLen() override { return static_cast<unsigned int>(samples.size() * sizeof(int16_t)); }
+		unsigned int GetSampleRate() override { return sampleRate_; }
+		unsigned int GetChannelNum() override { return channels_; }
+		unsigned long long GetTimeStamp() override { return timestamp; }
+
+		std::vector<int16_t> samples;
+		unsigned long long timestamp;
+
+	private:
+		uint32_t sampleRate_;
+		uint32_t channels_;
+	};
+
+	// Packed in-memory YUVRawDataI420, as handed to renderer delegates. The
+	// caller owns it and may rewrite the planes between callbacks.
+	class StubVideoRawData : public YUVRawDataI420 {
+	public:
+		StubVideoRawData(uint32_t width, uint32_t height, uint32_t sourceId = 0)
+			: buffer(I420BufferSize(static_cast<int>(width), static_cast<int>(height))),
+			timestamp(0), limitedRange(true), width_(width), height_(height), sourceId_(sourceId) {}
+
+		I420Planes planes() { return I420Planes::packed(buffer.data(), static_cast<int>(width_), static_cast<int>(height_)); }
+
+		bool CanAddRef() override { return false; }
+		bool AddRef() override { return false; }
+		int Release() override { return 0; }
+		char* GetYBuffer() override { return reinterpret_cast<char*>(planes().y); }
+		char* GetUBuffer() override { return reinterpret_cast<char*>(planes().u); }
+		char* GetVBuffer() override { return reinterpret_cast<char*>(planes().v); }
+		char* GetAlphaBuffer() override { return nullptr; }
+		char* GetBuffer() override { return reinterpret_cast<char*>(buffer.data()); }
+		unsigned int GetBufferLen() override { return static_cast<unsigned int>(buffer.size()); }
+		unsigned int GetAlphaBufferLen() override { return 0; }
+		bool IsLimitedI420() override { return limitedRange; }
+		unsigned int GetStreamWidth() override { return width_; }
+		unsigned int GetStreamHeight() override { return height_; }
+		unsigned int GetRotation() override { return 0; }
+		unsigned int GetSourceID() override { return sourceId_; }
+		unsigned long long GetTimeStamp() override { return timestamp; }
+
+		std::vector<uint8_t> buffer;
+		unsigned long long timestamp;
+		bool limitedRange;
+
+	private:
+		uint32_t width_;
+		uint32_t height_;
+		uint32_t sourceId_;
+	};
+
+}  // namespace tools
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_TOOLS_STUB_RAW_DATA_H_
@@ -0,0 +1,129 @@
+// Measures the pre-processing filters on a 1080p frame with padded strides:
+// each kernel against its scalar path where it has a vector one, then the
+// whole chain against the budget of a 30 fps frame.
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "media/i420_image.h"
+#include "media/video_filter_chain.h"
+#include "media/video_filter_kernels.h"
+#include "media/video_filters.h"
+
+using namespace flutter_zoom_sdk;
+
+namespace {
+	constexpr int kWidth = 1920;
+	constexpr int kHeight = 1080;
+	// Encoders commonly pad rows; the kernels must only touch width bytes.
+	constexpr int kPadding = 64;
+	constexpr int kFrames = 200;
+	constexpr double kFrameBudgetMs = 1000.0 / 30;
+
+	using Clock = std::chrono::steady_clock;
+
+	double elapsedMs(Clock::time_point start) {
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+	}
+
+	struct Frame {
+		Frame(int width, int height) : data(I420BufferSize(width + kPadding, height)) {
+			std::mt19937 rng(7);
+			for (auto& byte : data) {
+				byte = static_cast<uint8_t>(rng());
+			}
+			planes.width = width;
+			planes.height = height;
+			planes.strideY = width + kPadding;
+			planes.strideU = I420ChromaWidth(width) + kPadding / 2;
+			planes.strideV = planes.strideU;
+			planes.y = data.data();
+			planes.u = planes.y + static_cast<size_t>(planes.strideY) * height;
+			planes.v = planes.u + static_cast<size_t>(planes.strideU) * I420ChromaHeight(height);
+		}
+
+		std::vector<uint8_t> data;
+		I420Planes planes;
+	};
+
+	template <typename Kernel>
+	void benchKernel(const char* name, Kernel kernel, bool hasVectorPath = true) {
+		Frame scalar(kWidth, kHeight);
+		Frame simd(kWidth, kHeight);
+
+		auto start = Clock::now();
+		for (int i = 0; i < kFrames; ++i) {
+			kernel(scalar.planes, false);
+		}
+		const double scalarMs = elapsedMs(start) / kFrames;
+
+		if (!hasVectorPath) {
+			std::printf("kernel %-12s scalar=%7.3f ms/frame  (no vector path on this target)\n", name, scalarMs);
+			return;
+		}
+
+		start = Clock::now();
+		for (int i = 0; i < kFrames; ++i) {
+			kernel(simd.planes, true);
+		}
+		const double simdMs = elapsedMs(start) / kFrames;
+
+		std::printf("kernel %-12s scalar=%7.3f ms/frame  simd=%7.3f ms/frame  speedup=%.2fx  match=%s\n",
+			name, scalarMs, simdMs, scalarMs / simdMs, scalar.data == simd.data ? "yes" : "NO");
+	}
+}
+
+int main() {
+	benchKernel("affine", [](const I420Planes& f, bool vectorized) {
+		AffinePlane(f.y, f.strideY, f.width, f.height, 1200, 128, 10, 16, 235, vectorized);
+	});
+
+	uint8_t lut[256];
+	for (int i = 0; i < 256; ++i) {
+		lut[i] = static_cast<uint8_t>(255 - i);
+	}
+	benchKernel("lookup", [&lut](const I420Planes& f, bool vectorized) {
+		LookupPlane(f.y, f.strideY, f.width, f.height, lut, vectorized);
+	}, LookupPlaneHasVectorPath());
+
+	std::vector<uint8_t> scratch(BlurScratchSize(I420ChromaWidth(kWidth)));
+	for (BlurKernel kernel : { BlurKernel::Box, BlurKernel::Gaussian }) {
+		benchKernel(kernel == BlurKernel::Box ? "blur-box" : "blur-gauss", [&](const I420Planes& f, bool vectorized) {
+			BlurPlane(f.u, f.strideU, I420ChromaWidth(f.width), I420ChromaHeight(f.height), kernel, scratch.data(), vectorized);
+			BlurPlane(f.v, f.strideV, I420ChromaWidth(f.width), I420ChromaHeight(f.height), kernel, scratch.data(), vectorized);
+		});
+	}
+
+	// A 480x270 overlay, a quarter of the frame in each direction.
+	Frame overlay(480, 270);
+	std::vector<uint8_t> alpha(480 * 270, 200);
+	benchKernel("blend", [&](const I420Planes& f, bool vectorized) {
+		BlendPlane(f.y, f.strideY, overlay.planes.y, overlay.planes.strideY, alpha.data(), 480, 480, 270, vectorized);
+	});
+
+	std::vector<uint8_t> image(I420BufferSize(480, 270), 200);
+	std::vector<std::unique_ptr<IVideoFilter>> filters;
+	filters.push_back(std::make_unique<BrightnessContrastFilter>(0.05f, 1.2f));
+	filters.push_back(std::make_unique<GammaFilter>(1.4f));
+	filters.push_back(std::make_unique<ChromaBlurFilter>(BlurKernel::Gaussian, 2));
+	filters.push_back(std::make_unique<WatermarkFilter>(image.data(), alpha.data(), 480, 270, -32, -32, 0.8f));
+
+	VideoFilterChain chain;
+	chain.setFilters(std::move(filters));
+	Frame frame(kWidth, kHeight);
+	for (int i = 0; i < kFrames; ++i) {
+		chain.process(frame.planes, true);
+	}
+
+	const VideoFilterChainStats stats = chain.stats();
+	std::printf("chain  %ux%u mean=%u us max=%u us (%.1f%% of a 30 fps frame, budget %u us, over budget %llu/%llu)\n",
+		stats.width, stats.height, stats.meanUs, stats.maxUs, stats.meanUs / 10.0 / kFrameBudgetMs, stats.budgetUs,
+		static_cast<unsigned long long>(stats.overBudget), static_cast<unsigned long long>(stats.frames));
+	for (const auto& filter : stats.filters) {
+		std::printf("  %-20s mean=%6u us  max=%6u us\n", filter.name.c_str(), filter.meanUs, filter.maxUs);
+	}
+	return 0;
+}
@@ -0,0 +1,104 @@
+#ifndef FLUTTER_PLUGIN_UTIL_ZCHAR_UTIL_H_
+#define FLUTTER_PLUGIN_UTIL_ZCHAR_UTIL_H_
+
+#include <cstdint>
+#include <string>
+
+#include <zoom_sdk_def.h>
+
+namespace flutter_zoom_sdk {
+
+	using zstring = std::basic_string<zchar_t>;
+
+	// SDK strings are UTF-16 on Windows and UTF-8 elsewhere; Dart wants UTF-8.
+	// Hand-rolled so the plugin does not lean on the deprecated <codecvt>.
+#if defined(WIN32)
+	inline std::string ToUtf8(const zchar_t* text) {
+		std::string out;
+		if (!text) {
+			return out;
+		}
+
+		for (const zchar_t* p = text; *p; ++p) {
+			uint32_t cp = static_cast<uint16_t>(p[0]);
+			const uint32_t next = static_cast<uint16_t>(p[1]);
+			if (cp >= 0xD800 && cp <= 0xDBFF && next >= 0xDC00 && next <= 0xDFFF) {
+				cp = 0x10000 + ((cp - 0xD800) << 10) + (next - 0xDC00);
+				++p;
+			}
+			else if (cp >= 0xD800 && cp <= 0xDFFF) {
+				cp = 0xFFFD;
+			}
+
+			if (cp < 0x80) {
+				out.push_back(static_cast<char>(cp));
+			}
+			else if (cp < 0x800) {
+				out.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+				out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+			}
+			else if (cp < 0x10000) {
+				out.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+				out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+				out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+			}
+			else {
+				out.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+				out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+				out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+				out.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+			}
+		}
+
+		return out;
+	}
+
+	inline zstring FromUtf8(const std::string& text) {
+		zstring out;
+
+		for (size_t i = 0; i < text.size();) {
+			const uint8_t lead = static_cast<uint8_t>(text[i]);
+			uint32_t cp;
+			size_t length;
+			if (lead < 0x80) { cp = lead; length = 1; }
+			else if ((lead >> 5) == 0x6) { cp = lead & 0x1F; length = 2; }
+			else if ((lead >> 4) == 0xE) { cp = lead & 0x0F; length = 3; }
+			else if ((lead >> 3) == 0x1E) { cp = lead & 0x07; length = 4; }
+			else { cp = 0xFFFD; length = 1; }
+
+			if (i + length > text.size()) {
+				cp = 0xFFFD;
+				length = text.size() - i;
+			}
+			else {
+				for (size_t k = 1; k < length; ++k) {
+					cp = (cp << 6) | (static_cast<uint8_t>(text[i + k]) & 0x3F);
+				}
+			}
+			i += length;
+
+			if (cp >= 0x10000) {
+				cp -= 0x10000;
+				out.push_back(static_cast<zchar_t>(0xD800 + (cp >> 10)));
+				out.push_back(static_cast<zchar_t>(0xDC00 + (cp & 0x3FF)));
+			}
+			else {
+				out.push_back(static_cast<zchar_t>(cp));
+			}
+		}
+
+		return out;
+	}
+#else
+	inline std::string ToUtf8(const zchar_t* text) {
+		return text ? std::string(text) : std::string();
+	}
+
+	inline zstring FromUtf8(const std::string& text) {
+		return text;
+	}
+#endif
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_UTIL_ZCHAR_UTIL_H_
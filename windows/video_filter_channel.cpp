@@ -0,0 +1,205 @@
+#include "video_filter_channel.h"
+
+#include <rawdata/zoom_rawdata_api.h>
+
+#include <conio.h>
+#include <tchar.h>
+
+#include <string>
+#include <vector>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableList;
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	namespace {
+		constexpr int64_t kMaxWatermarkDimension = 1920;
+
+		const std::vector<uint8_t>* bytesArgument(const EncodableMap& arguments, const char* name) {
+			auto it = arguments.find(EncodableValue(name));
+			return it != arguments.end() ? std::get_if<std::vector<uint8_t>>(&it->second) : nullptr;
+		}
+
+		// Parses one filter:
+		//   {"type": "brightnessContrast", "brightness": double, "contrast": double}
+		//   {"type": "gamma", "gamma": double}
+		//   {"type": "chromaBlur", "kernel": "box" | "gaussian", "passes": int}
+		//   {"type": "watermark", "width": int, "height": int, "image": Uint8List (I420),
+		//    "alpha": Uint8List, "x": int, "y": int, "opacity": double}
+		std::unique_ptr<IVideoFilter> filterFromArguments(const EncodableMap& arguments) {
+			std::string type;
+			if (!StringArgument(arguments, "type", type)) {
+				return nullptr;
+			}
+
+			if (type == "brightnessContrast") {
+				double brightness = 0.0;
+				double contrast = 1.0;
+				DoubleArgument(arguments, "brightness", brightness);
+				DoubleArgument(arguments, "contrast", contrast);
+				return std::make_unique<BrightnessContrastFilter>(static_cast<float>(brightness), static_cast<float>(contrast));
+			}
+			else if (type == "gamma") {
+				double gamma = 1.0;
+				DoubleArgument(arguments, "gamma", gamma);
+				return std::make_unique<GammaFilter>(static_cast<float>(gamma));
+			}
+			else if (type == "chromaBlur") {
+				std::string kernel = "gaussian";
+				int64_t passes = 1;
+				StringArgument(arguments, "kernel", kernel);
+				IntArgument(arguments, "passes", passes);
+				if (kernel != "box" && kernel != "gaussian") {
+					return nullptr;
+				}
+				return std::make_unique<ChromaBlurFilter>(
+					kernel == "box" ? BlurKernel::Box : BlurKernel::Gaussian, static_cast<int>(passes));
+			}
+			else if (type == "watermark") {
+				int64_t width = 0;
+				int64_t height = 0;
+				int64_t x = 0;
+				int64_t y = 0;
+				double opacity = 1.0;
+				if (!IntArgument(arguments, "width", width) || !IntArgument(arguments, "height", height)
+					|| width <= 0 || height <= 0 || width > kMaxWatermarkDimension || height > kMaxWatermarkDimension) {
+					return nullptr;
+				}
+				IntArgument(arguments, "x", x);
+				IntArgument(arguments, "y", y);
+				DoubleArgument(arguments, "opacity", opacity);
+
+				const std::vector<uint8_t>* image = bytesArgument(arguments, "image");
+				const std::vector<uint8_t>* alpha = bytesArgument(arguments, "alpha");
+				if (!image || !alpha || image->size() < I420BufferSize(static_cast<int>(width), static_cast<int>(height))
+					|| alpha->size() < static_cast<size_t>(width * height)) {
+					return nullptr;
+				}
+				return std::make_unique<WatermarkFilter>(image->data(), alpha->data(),
+					static_cast<int>(width), static_cast<int>(height), static_cast<int>(x), static_cast<int>(y),
+					static_cast<float>(opacity));
+			}
+
+			return nullptr;
+		}
+	}
+
+	VideoFilterChannel::VideoFilterChannel() : attached_(false) {}
+
+	VideoFilterChannel::~VideoFilterChannel() {
+		if (attached_) {
+			detach();
+		}
+	}
+
+	bool VideoFilterChannel::detach() {
+		ZOOM_SDK_NAMESPACE::IZoomSDKVideoSourceHelper* helper = ZOOM_SDK_NAMESPACE::GetRawdataVideoSourceHelper();
+		const bool res = helper && helper->setPreProcessor(nullptr) == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS;
+		attached_ = false;
+		chain_.setFilters({});
+		return res;
+	}
+
+	bool VideoFilterChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		if (method.compare("video_filter_set") == 0) {
+			const EncodableList* list = nullptr;
+			if (arguments) {
+				auto it = arguments->find(EncodableValue("filters"));
+				if (it != arguments->end()) {
+					list = std::get_if<EncodableList>(&it->second);
+				}
+			}
+			if (!list) {
+				result->Error("INVALID_ARGUMENTS", "Expected filters");
+				return true;
+			}
+
+			std::vector<std::unique_ptr<IVideoFilter>> filters;
+			for (const auto& value : *list) {
+				auto map = std::get_if<EncodableMap>(&value);
+				std::unique_ptr<IVideoFilter> filter = map ? filterFromArguments(*map) : nullptr;
+				if (!filter) {
+					result->Error("INVALID_ARGUMENTS", "Unknown or incomplete filter");
+					return true;
+				}
+				filters.push_back(std::move(filter));
+			}
+
+			int64_t budgetUs = 0;
+			if (IntArgument(*arguments, "budgetUs", budgetUs) && budgetUs > 0) {
+				chain_.setBudget(std::chrono::microseconds(budgetUs));
+			}
+
+			if (filters.empty()) {
+				bool res = !attached_ || detach();
+
+				result->Success(EncodableValue(res));
+				return true;
+			}
+
+			ZOOM_SDK_NAMESPACE::IZoomSDKVideoSourceHelper* helper = ZOOM_SDK_NAMESPACE::GetRawdataVideoSourceHelper();
+			if (!helper) {
+				result->Success(EncodableValue(false));
+				return true;
+			}
+
+			// Installed before the chain is attached, so the first frame is
+			// already filtered.
+			chain_.setFilters(std::move(filters));
+			ZOOM_SDK_NAMESPACE::SDKError err = ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS;
+			if (!attached_) {
+				err = helper->setPreProcessor(&chain_);
+				attached_ = err == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS;
+				if (!attached_) {
+					_cputts(L"Video filter: setPreProcessor failed\n");
+				}
+			}
+
+			result->Success(EncodableValue(err == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS));
+			return true;
+		}
+		else if (method.compare("video_filter_clear") == 0) {
+			bool res = !attached_ || detach();
+
+			result->Success(EncodableValue(res));
+			return true;
+		}
+		else if (method.compare("video_filter_stats") == 0) {
+			const VideoFilterChainStats stats = chain_.stats();
+			EncodableList filters;
+			for (const auto& timing : stats.filters) {
+				EncodableMap filter;
+				filter[EncodableValue("name")] = EncodableValue(timing.name);
+				filter[EncodableValue("lastUs")] = EncodableValue(static_cast<int64_t>(timing.lastUs));
+				filter[EncodableValue("meanUs")] = EncodableValue(static_cast<int64_t>(timing.meanUs));
+				filter[EncodableValue("maxUs")] = EncodableValue(static_cast<int64_t>(timing.maxUs));
+				filters.push_back(EncodableValue(filter));
+			}
+
+			EncodableMap map;
+			map[EncodableValue("frames")] = EncodableValue(static_cast<int64_t>(stats.frames));
+			map[EncodableValue("width")] = EncodableValue(static_cast<int64_t>(stats.width));
+			map[EncodableValue("height")] = EncodableValue(static_cast<int64_t>(stats.height));
+			map[EncodableValue("lastUs")] = EncodableValue(static_cast<int64_t>(stats.lastUs));
+			map[EncodableValue("meanUs")] = EncodableValue(static_cast<int64_t>(stats.meanUs));
+			map[EncodableValue("maxUs")] = EncodableValue(static_cast<int64_t>(stats.maxUs));
+			map[EncodableValue("budgetUs")] = EncodableValue(static_cast<int64_t>(stats.budgetUs));
+			map[EncodableValue("overBudget")] = EncodableValue(static_cast<int64_t>(stats.overBudget));
+			map[EncodableValue("filters")] = EncodableValue(filters);
+
+			result->Success(EncodableValue(map));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,39 @@
+#ifndef FLUTTER_PLUGIN_VIDEO_FILTER_CHANNEL_H_
+#define FLUTTER_PLUGIN_VIDEO_FILTER_CHANNEL_H_
+
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <memory>
+
+#include "media/video_filter_chain.h"
+
+namespace flutter_zoom_sdk {
+
+	// Filters the camera in place before it is encoded, through
+	// setPreProcessor.
+	class VideoFilterChannel {
+	public:
+		VideoFilterChannel();
+
+		~VideoFilterChannel();
+
+		VideoFilterChannel(const VideoFilterChannel&) = delete;
+		VideoFilterChannel& operator=(const VideoFilterChannel&) = delete;
+
+		// Handles the video_filter_* methods. Returns false, leaving result
+		// untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+	private:
+		bool detach();
+
+		bool attached_;
+		VideoFilterChain chain_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_VIDEO_FILTER_CHANNEL_H_
@@ -0,0 +1,182 @@
+#include "video_health_channel.h"
+
+#include <rawdata/zoom_rawdata_api.h>
+
+#include <conio.h>
+#include <tchar.h>
+
+#include <string>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	namespace {
+		constexpr char kChannelName[] = "flutter_zoom_sdk/video_health";
+
+		constexpr size_t kMaxPendingReports = 8;
+	}
+
+	VideoHealthChannel::VideoHealthChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher)
+		: events_(messenger, dispatcher, kChannelName, kMaxPendingReports),
+		paused_(false),
+		monitor_([this](PooledBuffer report) { events_.send(std::move(report)); }, BinaryEventChannel::kEnvelopePrefix) {}
+
+	VideoHealthChannel::~VideoHealthChannel() {
+		while (!renderers_.empty()) {
+			unsubscribe(renderers_.begin()->first);
+		}
+	}
+
+	bool VideoHealthChannel::unsubscribe(uint32_t id) {
+		auto it = renderers_.find(id);
+		if (it == renderers_.end()) {
+			return false;
+		}
+
+		// A renderer the SDK already destroyed must not be touched again.
+		if (!monitor_.rendererDestroyed(id)) {
+			it->second.renderer->unSubscribe();
+			ZOOM_SDK_NAMESPACE::destroyRenderer(it->second.renderer);
+		}
+		renderers_.erase(it);
+		monitor_.remove(id);
+		return true;
+	}
+
+	void VideoHealthChannel::setPaused(bool paused) {
+		if (paused == paused_) {
+			return;
+		}
+
+		paused_ = paused;
+		for (auto& entry : renderers_) {
+			if (monitor_.rendererDestroyed(entry.first)) {
+				continue;
+			}
+
+			monitor_.suspend(entry.first);
+			if (paused) {
+				entry.second.renderer->unSubscribe();
+			}
+			else if (entry.second.renderer->subscribe(entry.first, entry.second.type) != ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+				_cputts(L"Video health: resubscribe failed\n");
+			}
+		}
+	}
+
+	bool VideoHealthChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		if (method.compare("video_health_subscribe") == 0) {
+			int64_t userId = 0;
+			if (!arguments || !IntArgument(*arguments, "userId", userId) || userId <= 0 || userId > UINT32_MAX) {
+				result->Error("INVALID_ARGUMENTS", "Expected a userId");
+				return true;
+			}
+
+			std::string type = "video";
+			ZOOM_SDK_NAMESPACE::ZoomSDKResolution resolution = ZOOM_SDK_NAMESPACE::ZoomSDKResolution_180P;
+			StringArgument(*arguments, "type", type);
+			if ((type != "video" && type != "share") || !ResolutionArgument(*arguments, "resolution", resolution)) {
+				result->Error("INVALID_ARGUMENTS", "Expected type video or share and resolution 90, 180, 360, 720 or 1080");
+				return true;
+			}
+
+			const uint32_t id = static_cast<uint32_t>(userId);
+			// A renderer the SDK destroyed, at the end of a meeting say, watches
+			// nothing more; it is replaced rather than counted as watched.
+			if (monitor_.rendererDestroyed(id)) {
+				unsubscribe(id);
+			}
+
+			ZOOM_SDK_NAMESPACE::IZoomSDKRendererDelegate* delegate = monitor_.add(id);
+			if (!delegate) {
+				// Already watched.
+				result->Success(EncodableValue(true));
+				return true;
+			}
+
+			ZOOM_SDK_NAMESPACE::IZoomSDKRenderer* renderer = nullptr;
+			if (ZOOM_SDK_NAMESPACE::createRenderer(&renderer, delegate) != ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS || !renderer) {
+				_cputts(L"Video health: createRenderer failed\n");
+				monitor_.remove(id);
+				result->Success(EncodableValue(false));
+				return true;
+			}
+
+			renderer->setRawDataResolution(resolution);
+			const ZOOM_SDK_NAMESPACE::ZoomSDKRawDataType rawDataType = type == "share"
+				? ZOOM_SDK_NAMESPACE::RAW_DATA_TYPE_SHARE : ZOOM_SDK_NAMESPACE::RAW_DATA_TYPE_VIDEO;
+			if (!paused_ && renderer->subscribe(id, rawDataType) != ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+				_cputts(L"Video health: subscribe failed\n");
+				ZOOM_SDK_NAMESPACE::destroyRenderer(renderer);
+				monitor_.remove(id);
+				result->Success(EncodableValue(false));
+				return true;
+			}
+
+			renderers_[id] = { renderer, rawDataType };
+			result->Success(EncodableValue(true));
+			return true;
+		}
+		else if (method.compare("video_health_unsubscribe") == 0) {
+			int64_t userId = 0;
+			if (!arguments || !IntArgument(*arguments, "userId", userId)) {
+				result->Error("INVALID_ARGUMENTS", "Expected a userId");
+				return true;
+			}
+
+			result->Success(EncodableValue(unsubscribe(static_cast<uint32_t>(userId))));
+			return true;
+		}
+		else if (method.compare("video_health_interval") == 0) {
+			int64_t intervalMs = 0;
+			if (!arguments || !IntArgument(*arguments, "intervalMs", intervalMs) || intervalMs <= 0) {
+				result->Error("INVALID_ARGUMENTS", "Expected a positive intervalMs");
+				return true;
+			}
+
+			monitor_.setInterval(std::chrono::milliseconds(intervalMs));
+			result->Success();
+			return true;
+		}
+		else if (method.compare("video_health_stats") == 0) {
+			int64_t userId = 0;
+			VideoHealthStats stats;
+			if (!arguments || !IntArgument(*arguments, "userId", userId)) {
+				result->Error("INVALID_ARGUMENTS", "Expected a userId");
+				return true;
+			}
+			if (!monitor_.stats(static_cast<uint32_t>(userId), stats)) {
+				result->Success();
+				return true;
+			}
+
+			EncodableMap map;
+			map[EncodableValue("width")] = EncodableValue(static_cast<int64_t>(stats.width));
+			map[EncodableValue("height")] = EncodableValue(static_cast<int64_t>(stats.height));
+			map[EncodableValue("frames")] = EncodableValue(static_cast<int64_t>(stats.frames));
+			map[EncodableValue("repeatedFrames")] = EncodableValue(static_cast<int64_t>(stats.repeatedFrames));
+			map[EncodableValue("resolutionChanges")] = EncodableValue(static_cast<int64_t>(stats.resolutionChanges));
+			map[EncodableValue("freezes")] = EncodableValue(static_cast<int64_t>(stats.freezes));
+			map[EncodableValue("frozenMs")] = EncodableValue(static_cast<int64_t>(stats.frozenMs));
+			map[EncodableValue("frozen")] = EncodableValue(stats.frozen);
+			map[EncodableValue("fps")] = EncodableValue(static_cast<double>(stats.fps));
+			map[EncodableValue("arrivalFps")] = EncodableValue(static_cast<double>(stats.arrivalFps));
+			map[EncodableValue("maxGapMs")] = EncodableValue(static_cast<int64_t>(stats.maxGapMs));
+			map[EncodableValue("jitterUs")] = EncodableValue(static_cast<int64_t>(stats.jitterUs));
+
+			result->Success(EncodableValue(map));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
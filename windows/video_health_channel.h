@@ -0,0 +1,61 @@
+#ifndef FLUTTER_PLUGIN_VIDEO_HEALTH_CHANNEL_H_
+#define FLUTTER_PLUGIN_VIDEO_HEALTH_CHANNEL_H_
+
+#include <flutter/binary_messenger.h>
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <rawdata/rawdata_renderer_interface.h>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include "binary_event_channel.h"
+#include "media/video_health_monitor.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Subscribes raw video of remote users to watch for freezes, frame rate
+	// and jitter. Reports go out on the "flutter_zoom_sdk/video_health" event
+	// channel as Uint8List events.
+	class VideoHealthChannel {
+	public:
+		VideoHealthChannel(flutter::BinaryMessenger* messenger, PlatformDispatcher& dispatcher);
+
+		~VideoHealthChannel();
+
+		VideoHealthChannel(const VideoHealthChannel&) = delete;
+		VideoHealthChannel& operator=(const VideoHealthChannel&) = delete;
+
+		// Handles the video_health_* methods. Returns false, leaving result
+		// untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+		// Pauses or resumes raw delivery for every watched stream, keeping the
+		// renderers and their counters. Subscriptions made while paused start
+		// paused.
+		void setPaused(bool paused);
+
+	private:
+		struct Subscription {
+			ZOOM_SDK_NAMESPACE::IZoomSDKRenderer* renderer;
+			ZOOM_SDK_NAMESPACE::ZoomSDKRawDataType type;
+		};
+
+		bool unsubscribe(uint32_t id);
+
+		BinaryEventChannel events_;
+		std::unordered_map<uint32_t, Subscription> renderers_;
+		bool paused_;
+
+		// Declared last so no report is sent once the members above go away.
+		VideoHealthMonitor monitor_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_VIDEO_HEALTH_CHANNEL_H_
@@ -0,0 +1,263 @@
+#include "video_source_channel.h"
+
+#include <rawdata/zoom_rawdata_api.h>
+
+#include <conio.h>
+#include <tchar.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "channel_arguments.h"
+
+namespace flutter_zoom_sdk {
+	using flutter::EncodableList;
+	using flutter::EncodableMap;
+	using flutter::EncodableValue;
+
+	namespace {
+		constexpr int64_t kMaxDimension = 4096;
+		constexpr double kMaxFrameRate = 60.0;
+	}
+
+	VideoSourceChannel::VideoSourceChannel(PlatformDispatcher& dispatcher, SettingServiceGetter settingService)
+		: dispatcher_(dispatcher), settingService_(std::move(settingService)), attached_(false) {
+		engine_.setStatisticsCallback([this]() {
+			dispatcher_.post([this]() { updateStatistics(); });
+		});
+	}
+
+	VideoSourceChannel::~VideoSourceChannel() {
+		if (attached_) {
+			detach();
+		}
+	}
+
+	bool VideoSourceChannel::detach() {
+		ZOOM_SDK_NAMESPACE::IZoomSDKVideoSourceHelper* helper = ZOOM_SDK_NAMESPACE::GetRawdataVideoSourceHelper();
+		const bool res = helper && helper->setExternalVideoSource(nullptr) == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS;
+		attached_ = false;
+		// The SDK stops sending before it lets go of the source; stop the
+		// thread here too in case it did not.
+		engine_.onUninitialized();
+		engine_.setSource(nullptr);
+		ring_.reset();
+		return res;
+	}
+
+	void VideoSourceChannel::updateStatistics() {
+		ZOOM_SDK_NAMESPACE::ISettingService* settingService = settingService_();
+		ZOOM_SDK_NAMESPACE::IStatisticSettingContext* statisticSettings =
+			settingService ? settingService->GetStatisticSettings() : nullptr;
+		ZOOM_SDK_NAMESPACE::ASVSessionStatisticInfo info;
+		if (!attached_ || !statisticSettings
+			|| statisticSettings->QueryVideoStatisticInfo(info) != ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS) {
+			return;
+		}
+
+		VideoSendStatistics statistics;
+		// Height in the high word, width in the low word.
+		statistics.width = static_cast<uint32_t>(info.resolution_send_) & 0xFFFF;
+		statistics.height = (static_cast<uint32_t>(info.resolution_send_) >> 16) & 0xFFFF;
+		statistics.fps = static_cast<uint32_t>(std::max(info.fps_send_, 0));
+		statistics.packetLossPercent = info.packetloss_send_avg_;
+		engine_.setStatistics(statistics);
+	}
+
+	bool VideoSourceChannel::HandleMethodCall(
+		const flutter::MethodCall<EncodableValue>& method_call,
+		std::unique_ptr<flutter::MethodResult<EncodableValue>>& result) {
+		const std::string& method = method_call.method_name();
+		auto arguments = std::get_if<EncodableMap>(method_call.arguments());
+
+		if (method.compare("video_source_start") == 0) {
+			std::string path;
+			int64_t width = 0;
+			int64_t height = 0;
+			double frameRate = 0.0;
+			std::shared_ptr<IVideoFrameSource> source;
+			std::shared_ptr<RingVideoSource> ring;
+
+			if (arguments && StringArgument(*arguments, "path", path)) {
+				bool loop = false;
+				BoolArgument(*arguments, "loop", loop);
+
+				auto file = std::make_shared<Y4mVideoSource>(loop);
+				if (!file->open(path)) {
+					result->Error("INVALID_ARGUMENTS", "Expected a 4:2:0 Y4M file");
+					return true;
+				}
+				source = file;
+			}
+			else if (arguments && IntArgument(*arguments, "width", width) && IntArgument(*arguments, "height", height)
+				&& width > 0 && height > 0 && width <= kMaxDimension && height <= kMaxDimension) {
+				// Without a rate the capability's rate is used.
+				DoubleArgument(*arguments, "fps", frameRate);
+				if (frameRate < 0.0 || frameRate > kMaxFrameRate) {
+					result->Error("INVALID_ARGUMENTS", "Expected fps between 0 and 60");
+					return true;
+				}
+				ring = std::make_shared<RingVideoSource>(static_cast<int>(width), static_cast<int>(height), frameRate);
+				source = ring;
+			}
+			else {
+				result->Error("INVALID_ARGUMENTS", "Expected a path, or width and height");
+				return true;
+			}
+
+			ZOOM_SDK_NAMESPACE::IZoomSDKVideoSourceHelper* helper = ZOOM_SDK_NAMESPACE::GetRawdataVideoSourceHelper();
+			if (!helper) {
+				result->Success(EncodableValue(false));
+				return true;
+			}
+
+			ring_ = ring;
+			engine_.setSource(source);
+			ZOOM_SDK_NAMESPACE::SDKError err = ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS;
+			if (!attached_) {
+				err = helper->setExternalVideoSource(&engine_);
+				attached_ = err == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS;
+				if (!attached_) {
+					_cputts(L"Video source: setExternalVideoSource failed\n");
+				}
+			}
+
+			result->Success(EncodableValue(err == ZOOM_SDK_NAMESPACE::SDKERR_SUCCESS));
+			return true;
+		}
+		else if (method.compare("video_source_push") == 0) {
+			// format is "i420" (packed, the default), "rgba" or "bgra"; RGBA
+			// rows may be padded to stride bytes.
+			int64_t width = 0;
+			int64_t height = 0;
+			int64_t stride = 0;
+			bool fullRange = false;
+			std::string format = "i420";
+			const std::vector<uint8_t>* bytes = nullptr;
+			if (arguments && IntArgument(*arguments, "width", width) && IntArgument(*arguments, "height", height)
+				&& width > 0 && height > 0 && width <= kMaxDimension && height <= kMaxDimension) {
+				auto it = arguments->find(EncodableValue("data"));
+				if (it != arguments->end()) {
+					bytes = std::get_if<std::vector<uint8_t>>(&it->second);
+				}
+				BoolArgument(*arguments, "fullRange", fullRange);
+				StringArgument(*arguments, "format", format);
+				IntArgument(*arguments, "stride", stride);
+			}
+
+			const bool rgba = format == "rgba" || format == "bgra";
+			if (rgba && stride == 0) {
+				stride = 4 * width;
+			}
+			const size_t needed = rgba
+				? static_cast<size_t>(stride) * (height - 1) + 4 * width
+				: I420BufferSize(static_cast<int>(width), static_cast<int>(height));
+			if (!bytes || (!rgba && format != "i420") || (rgba && stride < 4 * width) || bytes->size() < needed) {
+				result->Error("INVALID_ARGUMENTS", "Expected width, height and data as Uint8List in i420, rgba or bgra format");
+				return true;
+			}
+
+			bool res = ring_ != nullptr;
+			if (res && rgba) {
+				ring_->push(converter_.convert(bytes->data(), static_cast<int>(stride), static_cast<int>(width), static_cast<int>(height),
+					format == "rgba" ? PixelOrder::Rgba : PixelOrder::Bgra, fullRange),
+					static_cast<int>(width), static_cast<int>(height), fullRange);
+			}
+			else if (res) {
+				ring_->push(I420ConstPlanes::packed(bytes->data(), static_cast<int>(width), static_cast<int>(height)), fullRange);
+			}
+
+			result->Success(EncodableValue(res));
+			return true;
+		}
+		else if (method.compare("video_source_end") == 0) {
+			// The last frame stays on screen until the source is stopped.
+			bool res = ring_ != nullptr;
+			if (res) {
+				ring_->end();
+			}
+
+			result->Success(EncodableValue(res));
+			return true;
+		}
+		else if (method.compare("video_source_stop") == 0) {
+			bool res = attached_ && detach();
+
+			result->Success(EncodableValue(res));
+			return true;
+		}
+		else if (method.compare("video_source_budget") == 0) {
+			// Missing limits are left out; the capability is chosen again at
+			// once.
+			VideoCapabilityBudget budget;
+			int64_t cpuPercent = 0;
+			int64_t maxWidth = 0;
+			int64_t maxHeight = 0;
+			int64_t maxFps = 0;
+			if (arguments) {
+				IntArgument(*arguments, "cpuPercent", cpuPercent);
+				IntArgument(*arguments, "maxWidth", maxWidth);
+				IntArgument(*arguments, "maxHeight", maxHeight);
+				IntArgument(*arguments, "maxFps", maxFps);
+			}
+			if (cpuPercent < 0 || cpuPercent > 100 || maxWidth < 0 || maxWidth > kMaxDimension
+				|| maxHeight < 0 || maxHeight > kMaxDimension || maxFps < 0 || maxFps > kMaxFrameRate) {
+				result->Error("INVALID_ARGUMENTS", "Expected cpuPercent up to 100, sizes up to 4096 and maxFps up to 60");
+				return true;
+			}
+			budget.cpuPercent = static_cast<uint32_t>(cpuPercent);
+			budget.maxWidth = static_cast<uint32_t>(maxWidth);
+			budget.maxHeight = static_cast<uint32_t>(maxHeight);
+			budget.maxFps = static_cast<uint32_t>(maxFps);
+			engine_.setBudget(budget);
+
+			result->Success(EncodableValue(true));
+			return true;
+		}
+		else if (method.compare("video_source_capabilities") == 0) {
+			EncodableList list;
+			for (const auto& capability : engine_.capabilities()) {
+				EncodableMap map;
+				map[EncodableValue("width")] = EncodableValue(static_cast<int64_t>(capability.width));
+				map[EncodableValue("height")] = EncodableValue(static_cast<int64_t>(capability.height));
+				map[EncodableValue("fps")] = EncodableValue(static_cast<int64_t>(capability.frame));
+				list.push_back(EncodableValue(map));
+			}
+
+			result->Success(EncodableValue(list));
+			return true;
+		}
+		else if (method.compare("video_source_stats") == 0) {
+			const ExternalVideoSourceStats stats = engine_.stats();
+			EncodableMap map;
+			map[EncodableValue("initialized")] = EncodableValue(stats.initialized);
+			map[EncodableValue("sending")] = EncodableValue(stats.sending);
+			map[EncodableValue("finished")] = EncodableValue(stats.finished);
+			map[EncodableValue("width")] = EncodableValue(static_cast<int64_t>(stats.width));
+			map[EncodableValue("height")] = EncodableValue(static_cast<int64_t>(stats.height));
+			map[EncodableValue("fps")] = EncodableValue(static_cast<int64_t>(stats.fps));
+			map[EncodableValue("capabilityChanges")] = EncodableValue(static_cast<int64_t>(stats.capabilityChanges));
+			map[EncodableValue("limit")] = EncodableValue(VideoCapabilityLimitName(stats.limit));
+			map[EncodableValue("predictedCpuPercent")] = EncodableValue(stats.predictedCpuPercent);
+			map[EncodableValue("meanSendCostUs")] = EncodableValue(static_cast<int64_t>(stats.meanSendCostUs));
+			map[EncodableValue("networkLimit")] = EncodableValue(static_cast<int64_t>(stats.networkLimit));
+			map[EncodableValue("framesSent")] = EncodableValue(static_cast<int64_t>(stats.framesSent));
+			map[EncodableValue("sendErrors")] = EncodableValue(static_cast<int64_t>(stats.sendErrors));
+			map[EncodableValue("framesRepeated")] = EncodableValue(static_cast<int64_t>(stats.framesRepeated));
+			map[EncodableValue("framesSkipped")] = EncodableValue(static_cast<int64_t>(stats.framesSkipped));
+			map[EncodableValue("framesDropped")] = EncodableValue(static_cast<int64_t>(ring_ ? ring_->dropped() : 0));
+			map[EncodableValue("starvedTicks")] = EncodableValue(static_cast<int64_t>(stats.starvedTicks));
+			map[EncodableValue("resyncs")] = EncodableValue(static_cast<int64_t>(stats.resyncs));
+			map[EncodableValue("meanLatenessUs")] = EncodableValue(static_cast<int64_t>(stats.meanLatenessUs));
+			map[EncodableValue("maxLatenessUs")] = EncodableValue(static_cast<int64_t>(stats.maxLatenessUs));
+			map[EncodableValue("intervalJitterUs")] = EncodableValue(static_cast<int64_t>(stats.intervalJitterUs));
+
+			result->Success(EncodableValue(map));
+			return true;
+		}
+
+		return false;
+	}
+
+}  // namespace flutter_zoom_sdk
@@ -0,0 +1,56 @@
+#ifndef FLUTTER_PLUGIN_VIDEO_SOURCE_CHANNEL_H_
+#define FLUTTER_PLUGIN_VIDEO_SOURCE_CHANNEL_H_
+
+#include <flutter/method_channel.h>
+#include <flutter/encodable_value.h>
+
+#include <setting_service_interface.h>
+
+#include <functional>
+#include <memory>
+
+#include "media/external_video_source.h"
+#include "media/rgba_to_i420.h"
+#include "media/video_frame_source.h"
+#include "platform_dispatcher.h"
+
+namespace flutter_zoom_sdk {
+
+	// Replaces the camera with an external video source through
+	// setExternalVideoSource, fed from a Y4M file or from I420 frames pushed
+	// by Dart. The SDK's send statistics are fed to the capability policy
+	// from the platform thread.
+	class VideoSourceChannel {
+	public:
+		using SettingServiceGetter = std::function<ZOOM_SDK_NAMESPACE::ISettingService*()>;
+
+		VideoSourceChannel(PlatformDispatcher& dispatcher, SettingServiceGetter settingService);
+
+		~VideoSourceChannel();
+
+		VideoSourceChannel(const VideoSourceChannel&) = delete;
+		VideoSourceChannel& operator=(const VideoSourceChannel&) = delete;
+
+		// Handles the video_source_* methods. Returns false, leaving result
+		// untouched, for any other method.
+		bool HandleMethodCall(
+			const flutter::MethodCall<flutter::EncodableValue>& method_call,
+			std::unique_ptr<flutter::MethodResult<flutter::EncodableValue>>& result);
+
+	private:
+		bool detach();
+
+		void updateStatistics();
+
+		PlatformDispatcher& dispatcher_;
+		SettingServiceGetter settingService_;
+		bool attached_;
+		// Set while Dart feeds the source; null for file sources.
+		std::shared_ptr<RingVideoSource> ring_;
+		RgbaToI420Converter converter_;
+		ExternalVideoSource engine_;
+	};
+
+}  // namespace flutter_zoom_sdk
+
+#endif  // FLUTTER_PLUGIN_VIDEO_SOURCE_CHANNEL_H_